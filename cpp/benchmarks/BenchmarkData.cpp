@@ -0,0 +1,350 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "benchmarks/BenchmarkData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/utility/Random.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+// Room extents used by the scan and LiDAR generators, in meters.
+const Eigen::Vector3d kRoomExtent(6.0, 4.0, 2.5);
+
+// Standard normal draw via Box-Muller; fully specified so results are
+// identical across standard library implementations (std::normal_
+// distribution is not).
+double NextGaussian(utility::random::Philox &rng) {
+    double u1 = rng.NextUniformDouble();
+    double u2 = rng.NextUniformDouble();
+    // Guard against log(0).
+    u1 = std::max(u1, 1e-300);
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+// An axis-aligned box surface with outward (or inward) normals.
+struct SampleBox {
+    Eigen::Vector3d min_bound;
+    Eigen::Vector3d max_bound;
+    bool inward;
+};
+
+// Uniform sample on the surface of \p box, weighted by face area.
+void SampleBoxSurface(const SampleBox &box,
+                      utility::random::Philox &rng,
+                      Eigen::Vector3d &point,
+                      Eigen::Vector3d &normal) {
+    const Eigen::Vector3d extent = box.max_bound - box.min_bound;
+    const double face_areas[3] = {extent(1) * extent(2),
+                                  extent(0) * extent(2),
+                                  extent(0) * extent(1)};
+    const double total_area =
+            2.0 * (face_areas[0] + face_areas[1] + face_areas[2]);
+    double pick = rng.NextUniformDouble() * total_area;
+    int axis = 0;
+    int side = 0;
+    for (axis = 0; axis < 3; axis++) {
+        if (pick < 2.0 * face_areas[axis]) {
+            side = pick < face_areas[axis] ? 0 : 1;
+            break;
+        }
+        pick -= 2.0 * face_areas[axis];
+    }
+    if (axis == 3) {
+        axis = 2;
+        side = 1;
+    }
+    point = box.min_bound;
+    for (int d = 0; d < 3; d++) {
+        point(d) += d == axis ? (side == 0 ? 0.0 : extent(d))
+                              : rng.NextUniformDouble() * extent(d);
+    }
+    normal = Eigen::Vector3d::Zero();
+    normal(axis) = side == 0 ? -1.0 : 1.0;
+    if (box.inward) {
+        normal = -normal;
+    }
+}
+
+// Distance from \p origin along unit \p direction to the inside of the
+// room shell [0, kRoomExtent].
+double RayToRoomShell(const Eigen::Vector3d &origin,
+                      const Eigen::Vector3d &direction) {
+    double t_hit = std::numeric_limits<double>::max();
+    for (int d = 0; d < 3; d++) {
+        if (std::abs(direction(d)) < 1e-12) {
+            continue;
+        }
+        const double bound = direction(d) > 0.0 ? kRoomExtent(d) : 0.0;
+        const double t = (bound - origin(d)) / direction(d);
+        if (t > 0.0 && t < t_hit) {
+            t_hit = t;
+        }
+    }
+    return t_hit;
+}
+
+}  // namespace
+
+geometry::PointCloud MakeRoomScanCloud(int num_points,
+                                       std::uint64_t seed,
+                                       double noise_sigma /* = 0.005*/,
+                                       int num_clutter_boxes /* = 6*/) {
+    // Surfaces: the room shell (inward normals) plus clutter boxes
+    // (outward normals) placed with an independent stream so the layout
+    // does not change with num_points.
+    std::vector<SampleBox> boxes;
+    boxes.push_back({Eigen::Vector3d::Zero(), kRoomExtent, true});
+    utility::random::Philox layout_rng(seed, /*stream=*/1);
+    for (int b = 0; b < num_clutter_boxes; b++) {
+        Eigen::Vector3d size(0.3 + 0.9 * layout_rng.NextUniformDouble(),
+                             0.3 + 0.9 * layout_rng.NextUniformDouble(),
+                             0.3 + 1.2 * layout_rng.NextUniformDouble());
+        Eigen::Vector3d corner(
+                layout_rng.NextUniformDouble() * (kRoomExtent(0) - size(0)),
+                layout_rng.NextUniformDouble() * (kRoomExtent(1) - size(1)),
+                0.0);
+        boxes.push_back({corner, corner + size, false});
+    }
+    double total_area = 0.0;
+    std::vector<double> cumulative_areas;
+    for (const auto &box : boxes) {
+        const Eigen::Vector3d extent = box.max_bound - box.min_bound;
+        total_area += 2.0 * (extent(0) * extent(1) + extent(0) * extent(2) +
+                             extent(1) * extent(2));
+        cumulative_areas.push_back(total_area);
+    }
+
+    geometry::PointCloud cloud;
+    cloud.points_.resize(num_points);
+    cloud.normals_.resize(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        // One stream per point keeps the cloud identical for any thread
+        // schedule.
+        utility::random::Philox rng(seed, /*stream=*/2 + std::uint64_t(i));
+        const double pick = rng.NextUniformDouble() * total_area;
+        size_t box_index = 0;
+        while (box_index + 1 < boxes.size() &&
+               pick >= cumulative_areas[box_index]) {
+            box_index++;
+        }
+        Eigen::Vector3d point, normal;
+        SampleBoxSurface(boxes[box_index], rng, point, normal);
+        cloud.points_[i] = point + noise_sigma * NextGaussian(rng) * normal;
+        cloud.normals_[i] = normal;
+    }
+    return cloud;
+}
+
+geometry::PointCloud MakeLidarSweepCloud(int num_rings,
+                                         int points_per_ring,
+                                         std::uint64_t seed,
+                                         double noise_sigma /* = 0.01*/) {
+    const Eigen::Vector3d sensor(kRoomExtent(0) / 2.0, kRoomExtent(1) / 2.0,
+                                 1.5);
+    const double min_elevation = -25.0 * M_PI / 180.0;
+    const double max_elevation = 5.0 * M_PI / 180.0;
+    geometry::PointCloud cloud;
+    cloud.points_.resize(std::size_t(num_rings) * points_per_ring);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int ring = 0; ring < num_rings; ring++) {
+        const double elevation =
+                num_rings == 1
+                        ? min_elevation
+                        : min_elevation + (max_elevation - min_elevation) *
+                                                  ring / (num_rings - 1);
+        utility::random::Philox rng(seed, std::uint64_t(ring));
+        for (int k = 0; k < points_per_ring; k++) {
+            const double azimuth = 2.0 * M_PI * k / points_per_ring;
+            const Eigen::Vector3d direction(
+                    std::cos(elevation) * std::cos(azimuth),
+                    std::cos(elevation) * std::sin(azimuth),
+                    std::sin(elevation));
+            const double range = RayToRoomShell(sensor, direction) +
+                                 noise_sigma * NextGaussian(rng);
+            cloud.points_[std::size_t(ring) * points_per_ring + k] =
+                    sensor + range * direction;
+        }
+    }
+    return cloud;
+}
+
+geometry::PointCloud MakeVaryingDensityCloud(int num_points,
+                                             std::uint64_t seed,
+                                             int num_clusters /* = 12*/) {
+    // Cluster layout from an independent stream, as in MakeRoomScanCloud.
+    std::vector<Eigen::Vector3d> centers(num_clusters);
+    std::vector<double> sigmas(num_clusters);
+    utility::random::Philox layout_rng(seed, /*stream=*/1);
+    for (int c = 0; c < num_clusters; c++) {
+        centers[c] = Eigen::Vector3d(layout_rng.NextUniformDouble(),
+                                     layout_rng.NextUniformDouble(),
+                                     layout_rng.NextUniformDouble());
+        sigmas[c] = 0.005 + 0.03 * layout_rng.NextUniformDouble();
+    }
+
+    geometry::PointCloud cloud;
+    cloud.points_.resize(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        utility::random::Philox rng(seed, /*stream=*/2 + std::uint64_t(i));
+        if (num_clusters > 0 && rng.NextUniformDouble() < 0.8) {
+            const int c = int(rng.BoundedUInt32(std::uint32_t(num_clusters)));
+            cloud.points_[i] =
+                    centers[c] + sigmas[c] * Eigen::Vector3d(
+                                                     NextGaussian(rng),
+                                                     NextGaussian(rng),
+                                                     NextGaussian(rng));
+        } else {
+            cloud.points_[i] = Eigen::Vector3d(rng.NextUniformDouble(),
+                                               rng.NextUniformDouble(),
+                                               rng.NextUniformDouble());
+        }
+    }
+    return cloud;
+}
+
+geometry::TriangleMesh MakeTerrainMesh(int resolution, std::uint64_t seed) {
+    // Seeded harmonic coefficients.
+    const int kNumHarmonics = 8;
+    utility::random::Philox rng(seed);
+    std::vector<Eigen::Vector3d> harmonics(kNumHarmonics);
+    for (int h = 0; h < kNumHarmonics; h++) {
+        harmonics[h] = Eigen::Vector3d(
+                1.0 + 7.0 * rng.NextUniformDouble(),
+                1.0 + 7.0 * rng.NextUniformDouble(),
+                2.0 * M_PI * rng.NextUniformDouble());
+    }
+    auto height = [&harmonics](double x, double y) {
+        double z = 0.0;
+        for (const auto &h : harmonics) {
+            z += 0.02 * std::sin(h(0) * x + h(2)) * std::cos(h(1) * y);
+        }
+        return z;
+    };
+
+    geometry::TriangleMesh mesh;
+    const int verts_per_side = resolution + 1;
+    mesh.vertices_.resize(std::size_t(verts_per_side) * verts_per_side);
+    for (int j = 0; j < verts_per_side; j++) {
+        for (int i = 0; i < verts_per_side; i++) {
+            const double x = double(i) / resolution;
+            const double y = double(j) / resolution;
+            mesh.vertices_[std::size_t(j) * verts_per_side + i] =
+                    Eigen::Vector3d(x, y, height(x, y));
+        }
+    }
+    mesh.triangles_.reserve(std::size_t(resolution) * resolution * 2);
+    for (int j = 0; j < resolution; j++) {
+        for (int i = 0; i < resolution; i++) {
+            const int v00 = j * verts_per_side + i;
+            const int v10 = v00 + 1;
+            const int v01 = v00 + verts_per_side;
+            const int v11 = v01 + 1;
+            mesh.triangles_.push_back(Eigen::Vector3i(v00, v10, v11));
+            mesh.triangles_.push_back(Eigen::Vector3i(v00, v11, v01));
+        }
+    }
+    mesh.ComputeVertexNormals(/*normalized=*/true);
+    return mesh;
+}
+
+std::shared_ptr<geometry::RGBDImage> MakeSyntheticRGBDImage(
+        int width, int height, std::uint64_t seed, double phase /* = 0.0*/) {
+    // Scene: floor plane at y = -0.8, back wall at z = 3.0 and a unit
+    // sphere whose position is drawn from the seed and shifted by phase.
+    utility::random::Philox rng(seed);
+    const Eigen::Vector3d sphere_center(
+            -0.5 + rng.NextUniformDouble() + phase,
+            -0.3 + 0.6 * rng.NextUniformDouble(), 2.0);
+    const double sphere_radius = 0.4;
+    const double fx = 0.55 * width;
+    const double fy = 0.55 * width;
+    const double cx = 0.5 * width;
+    const double cy = 0.5 * height;
+
+    geometry::Image color;
+    geometry::Image depth;
+    color.Prepare(width, height, 3, 1);
+    depth.Prepare(width, height, 1, 2);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            const Eigen::Vector3d direction =
+                    Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1.0)
+                            .normalized();
+            double t_hit = (3.0 - 0.0) / direction(2);
+            Eigen::Vector3d normal(0.0, 0.0, -1.0);
+            if (direction(1) < 0.0) {
+                const double t_floor = -0.8 / direction(1);
+                if (t_floor < t_hit) {
+                    t_hit = t_floor;
+                    normal = Eigen::Vector3d(0.0, 1.0, 0.0);
+                }
+            }
+            // Ray-sphere intersection.
+            const double b = direction.dot(-sphere_center);
+            const double c = sphere_center.squaredNorm() -
+                             sphere_radius * sphere_radius;
+            const double discriminant = b * b - c;
+            if (discriminant > 0.0) {
+                const double t_sphere = -b - std::sqrt(discriminant);
+                if (t_sphere > 0.0 && t_sphere < t_hit) {
+                    t_hit = t_sphere;
+                    normal = (t_sphere * direction - sphere_center)
+                                     .normalized();
+                }
+            }
+            const double z = t_hit * direction(2);
+            const double shade = std::max(
+                    0.0, normal.dot(Eigen::Vector3d(-0.4, 0.8, -0.45)));
+            const auto intensity = std::uint8_t(40.0 + 200.0 * shade);
+            *depth.PointerAt<std::uint16_t>(u, v) =
+                    std::uint16_t(1000.0 * z);
+            *color.PointerAt<std::uint8_t>(u, v, 0) = intensity;
+            *color.PointerAt<std::uint8_t>(u, v, 1) = intensity;
+            *color.PointerAt<std::uint8_t>(u, v, 2) = intensity;
+        }
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(color, depth, 1000.0,
+                                                        4.0, true);
+}
+
+}  // namespace benchmarks
+}  // namespace open3d
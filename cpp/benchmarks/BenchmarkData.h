@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Seeded synthetic scene generators shared by the benchmark suites.
+//
+// All generators draw their randomness from the counter-based
+// utility::random::Philox engine, so a (parameters, seed) pair produces
+// bit-identical data on every machine, compiler and release; benchmark
+// numbers stay comparable without shipping data files.
+
+/// Simulated scan of a rectangular room with box clutter: points sampled
+/// on the walls, floor, ceiling and \p num_clutter_boxes axis-aligned
+/// boxes, with inward-facing normals and Gaussian depth noise of
+/// \p noise_sigma meters along the normal. Room extents are roughly
+/// 6 x 4 x 2.5 meters.
+geometry::PointCloud MakeRoomScanCloud(int num_points,
+                                       std::uint64_t seed,
+                                       double noise_sigma = 0.005,
+                                       int num_clutter_boxes = 6);
+
+/// Simulated spinning LiDAR sweep from a sensor inside the clutter-free
+/// room of MakeRoomScanCloud: \p num_rings elevation rings of
+/// \p points_per_ring azimuth steps, ranges computed analytically against
+/// the room shell plus Gaussian range noise. Reproduces the
+/// characteristic ring structure and range-dependent density of scanner
+/// data.
+geometry::PointCloud MakeLidarSweepCloud(int num_rings,
+                                         int points_per_ring,
+                                         std::uint64_t seed,
+                                         double noise_sigma = 0.01);
+
+/// Cloud with strongly varying local density: \p num_points split between
+/// tight Gaussian clusters and a sparse uniform background inside a unit
+/// box. Stresses spatial data structures whose performance depends on
+/// occupancy skew.
+geometry::PointCloud MakeVaryingDensityCloud(int num_points,
+                                             std::uint64_t seed,
+                                             int num_clusters = 12);
+
+/// Heightfield terrain mesh over a unit square: (\p resolution + 1)^2
+/// vertices displaced by seeded random harmonics, two triangles per grid
+/// cell, with vertex normals.
+geometry::TriangleMesh MakeTerrainMesh(int resolution, std::uint64_t seed);
+
+/// Synthetic RGBD frame of an analytic scene (floor plane, back wall and
+/// a sphere) rendered through a pinhole model with shaded gray color and
+/// millimeter uint16 depth, converted with
+/// RGBDImage::CreateFromColorAndDepth. \p phase shifts the sphere
+/// laterally, approximating a small camera motion between frames.
+std::shared_ptr<geometry::RGBDImage> MakeSyntheticRGBDImage(
+        int width, int height, std::uint64_t seed, double phase = 0.0);
+
+}  // namespace benchmarks
+}  // namespace open3d
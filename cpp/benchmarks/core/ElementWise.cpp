@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Bandwidth benchmarks for the core kernel launchers (CPULauncher /
+// CUDALauncher). Every benchmark calls SetBytesProcessed() with the bytes the
+// kernel has to move, so the reported GB/s can be read directly against the
+// MemcpyPeakBandwidth baseline below: a kernel that reaches a similar figure
+// is memory bound and saturating the device; a much lower figure means the
+// launcher is leaving bandwidth on the table.
+
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace core {
+
+static Tensor MakeIotaIndices(int64_t num_elements, const Device& device) {
+    std::vector<int64_t> index_vals(num_elements);
+    std::iota(index_vals.begin(), index_vals.end(), 0);
+    return Tensor(index_vals, SizeVector{num_elements}, Dtype::Int64, device);
+}
+
+static Dtype DtypeFromRange(int64_t index) {
+    switch (index) {
+        case 0:
+            return Dtype::Float32;
+        case 1:
+            return Dtype::Float64;
+        case 2:
+            return Dtype::Int32;
+        default:
+            return Dtype::Int64;
+    }
+}
+
+// Measured peak: a device-to-device copy of the same payload; this is the
+// roofline the element-wise kernels are compared against
+static void MemcpyPeakBandwidth(benchmark::State& state, const Device& device) {
+    int64_t num_bytes = state.range(0);
+    void* src = MemoryManager::Malloc(num_bytes, device);
+    void* dst = MemoryManager::Malloc(num_bytes, device);
+    MemoryManager::Memcpy(dst, device, src, device, num_bytes);
+    for (auto _ : state) {
+        MemoryManager::Memcpy(dst, device, src, device, num_bytes);
+    }
+    // One read plus one write of the payload
+    state.SetBytesProcessed(state.iterations() * num_bytes * 2);
+    MemoryManager::Free(src, device);
+    MemoryManager::Free(dst, device);
+}
+
+// Unary element-wise: dst = src.Neg(), one read and one write per element
+static void UnaryEW(benchmark::State& state, const Device& device) {
+    Dtype dtype = DtypeFromRange(state.range(1));
+    SizeVector shape{state.range(0)};
+    Tensor src = Tensor::Ones(shape, dtype, device);
+    Tensor warm_up = src.Neg();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Neg();
+        benchmark::DoNotOptimize(dst);
+    }
+    int64_t bytes = shape.NumElements() * DtypeUtil::ByteSize(dtype);
+    state.SetBytesProcessed(state.iterations() * bytes * 2);
+}
+
+// Binary element-wise: dst = lhs + rhs, two reads and one write per element
+static void BinaryEW(benchmark::State& state, const Device& device) {
+    Dtype dtype = DtypeFromRange(state.range(1));
+    SizeVector shape{state.range(0)};
+    Tensor lhs = Tensor::Ones(shape, dtype, device);
+    Tensor rhs = Tensor::Ones(shape, dtype, device);
+    Tensor warm_up = lhs.Add(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Add(rhs);
+        benchmark::DoNotOptimize(dst);
+    }
+    int64_t bytes = shape.NumElements() * DtypeUtil::ByteSize(dtype);
+    state.SetBytesProcessed(state.iterations() * bytes * 3);
+}
+
+// Advanced indexing gather: dst = src[indices]
+static void IndexGet(benchmark::State& state, const Device& device) {
+    Dtype dtype = DtypeFromRange(state.range(1));
+    int64_t num_elements = state.range(0);
+    Tensor src = Tensor::Ones(SizeVector{num_elements}, dtype, device);
+    Tensor indices = MakeIotaIndices(num_elements, device);
+    Tensor warm_up = src.IndexGet({indices});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({indices});
+        benchmark::DoNotOptimize(dst);
+    }
+    // Element read and write plus the index read per element
+    int64_t bytes = num_elements * (2 * DtypeUtil::ByteSize(dtype) +
+                                    DtypeUtil::ByteSize(Dtype::Int64));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// Advanced indexing scatter: dst[indices] = src
+static void IndexSet(benchmark::State& state, const Device& device) {
+    Dtype dtype = DtypeFromRange(state.range(1));
+    int64_t num_elements = state.range(0);
+    Tensor src = Tensor::Ones(SizeVector{num_elements}, dtype, device);
+    Tensor dst = Tensor::Zeros(SizeVector{num_elements}, dtype, device);
+    Tensor indices = MakeIotaIndices(num_elements, device);
+    dst.IndexSet({indices}, src);
+    for (auto _ : state) {
+        dst.IndexSet({indices}, src);
+    }
+    int64_t bytes = num_elements * (2 * DtypeUtil::ByteSize(dtype) +
+                                    DtypeUtil::ByteSize(Dtype::Int64));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// NonZero on a half-filled tensor; the output side is proportional to the
+// number of hits, so only the input read is counted as guaranteed traffic
+static void NonZero(benchmark::State& state, const Device& device) {
+    Dtype dtype = DtypeFromRange(state.range(1));
+    int64_t num_elements = state.range(0);
+    Tensor src = Tensor::Ones(SizeVector{num_elements}, dtype, device);
+    src.Slice(0, 0, num_elements / 2) =
+            Tensor::Zeros(SizeVector{num_elements / 2}, dtype, device);
+    Tensor warm_up = src.NonZero();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.NonZero();
+        benchmark::DoNotOptimize(dst);
+    }
+    int64_t bytes = num_elements * DtypeUtil::ByteSize(dtype);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// {number of elements, dtype index (see DtypeFromRange)}
+#define ELEMENT_WISE_ARGS                 \
+    ->Args({1 << 20, 0})                  \
+            ->Args({1 << 24, 0})          \
+            ->Args({1 << 27, 0})          \
+            ->Args({1 << 24, 1})          \
+            ->Args({1 << 24, 2})          \
+            ->Args({1 << 24, 3})          \
+            ->Unit(benchmark::kMillisecond)
+
+BENCHMARK_CAPTURE(MemcpyPeakBandwidth, CPU, Device("CPU:0"))
+        ->Arg(1 << 22)
+        ->Arg(1 << 26)
+        ->Arg(1 << 29)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEW, CPU, Device("CPU:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(BinaryEW, CPU, Device("CPU:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(IndexGet, CPU, Device("CPU:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(IndexSet, CPU, Device("CPU:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(NonZero, CPU, Device("CPU:0")) ELEMENT_WISE_ARGS;
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(MemcpyPeakBandwidth, CUDA, Device("CUDA:0"))
+        ->Arg(1 << 22)
+        ->Arg(1 << 26)
+        ->Arg(1 << 29)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEW, CUDA, Device("CUDA:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(BinaryEW, CUDA, Device("CUDA:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(IndexGet, CUDA, Device("CUDA:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(IndexSet, CUDA, Device("CUDA:0")) ELEMENT_WISE_ARGS;
+BENCHMARK_CAPTURE(NonZero, CUDA, Device("CUDA:0")) ELEMENT_WISE_ARGS;
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -30,6 +30,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include "benchmarks/BenchmarkData.h"
+
 namespace open3d {
 namespace benchmarks {
 
@@ -95,5 +97,27 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+// Radius search on a cloud with strongly skewed local density; queries at
+// the cluster centers hit the densest regions of the tree.
+static void BM_TestKDTreeVaryingDensity(benchmark::State& state) {
+    int size = state.range(0);
+    geometry::PointCloud pc = MakeVaryingDensityCloud(size, /*seed=*/42);
+    geometry::KDTreeFlann kdtree(pc);
+
+    size_t query_index = 0;
+    for (auto _ : state) {
+        const Eigen::Vector3d& query = pc.points_[query_index];
+        query_index = (query_index + 97) % pc.points_.size();
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int result = kdtree.SearchRadius<Eigen::Vector3d>(query, 0.05, indices,
+                                                          distance2);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_TestKDTreeVaryingDensity)
+        ->MinTime(0.1)
+        ->Range(1 << 14, 1 << 20);
+
 }  // namespace benchmarks
 }  // namespace open3d
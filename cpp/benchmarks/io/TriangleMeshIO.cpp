@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TriangleMeshIO.h"
+
+#include <cmath>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+
+#include <benchmark/benchmark.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace open3d {
+namespace benchmarks {
+
+using open3d::io::ReadTriangleMesh;
+using open3d::io::WriteTriangleMesh;
+
+namespace {
+
+// Process-wide peak resident set size in MB, reported as a counter so
+// a reader or writer that blows up memory shows it next to its
+// throughput
+double GetPeakRSSInMB() {
+#ifdef _WIN32
+    return 0.0;  // not tracked on Windows
+#elif defined(__APPLE__)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / (1024.0 * 1024.0);  // bytes on macOS
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;  // KB on Linux
+#endif
+}
+
+enum class IsAscii : bool { BINARY = false, ASCII = true };
+struct ReadWriteMeshArgs {
+    std::string filename;
+    IsAscii write_ascii;
+};
+std::vector<ReadWriteMeshArgs> g_mesh_args({
+        {"testb.ply", IsAscii::BINARY},   // 0
+        {"testa.ply", IsAscii::ASCII},    // 1
+        {"test.obj", IsAscii::ASCII},     // 2
+        {"test.stl", IsAscii::BINARY},    // 3
+        {"test.off", IsAscii::ASCII},     // 4
+        {"test.gltf", IsAscii::BINARY},   // 5
+});
+
+// Regular grid over a wavy surface with \p size vertices and roughly
+// twice as many triangles; generated so the benchmark needs no data
+// files and the vertex data is not trivially compressible
+class TestMeshGrid {
+    geometry::TriangleMesh mesh_;
+    int size_ = 0;
+    const bool print_progress = false;
+
+public:
+    void Setup(int size) {
+        if (size_ == size) return;
+        utility::LogInfo("setup MeshGrid size={}", size);
+        size_ = size;
+        mesh_.Clear();
+        int width = int(std::round(std::sqrt(double(size))));
+        int height = (size + width - 1) / width;
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                double x = u * 0.01;
+                double y = v * 0.01;
+                mesh_.vertices_.push_back(
+                        {x, y, 0.1 * std::sin(3.0 * x) * std::cos(3.0 * y)});
+                mesh_.vertex_colors_.push_back(
+                        {std::fmod(x * .4241490710, 1.0),
+                         std::fmod(y * .6468026221, 1.0),
+                         std::fmod((x + y) * .5376722873, 1.0)});
+            }
+        }
+        for (int v = 0; v + 1 < height; ++v) {
+            for (int u = 0; u + 1 < width; ++u) {
+                int idx = v * width + u;
+                mesh_.triangles_.push_back({idx, idx + 1, idx + width});
+                mesh_.triangles_.push_back(
+                        {idx + 1, idx + width + 1, idx + width});
+            }
+        }
+        // also fills triangle_normals_, which the STL writer needs
+        mesh_.ComputeVertexNormals();
+    }
+
+    void Write(int mesh_args_id) {
+        const auto &args = g_mesh_args[mesh_args_id];
+        if (!WriteTriangleMesh(args.filename, mesh_, bool(args.write_ascii),
+                               false, true, true, true, print_progress)) {
+            utility::LogError("Failed to write to {}", args.filename);
+        }
+    }
+
+    void Read(int mesh_args_id) {
+        const auto &args = g_mesh_args[mesh_args_id];
+        geometry::TriangleMesh mesh2;
+        if (!ReadTriangleMesh(args.filename, mesh2, print_progress)) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+};
+// reuse the same instance so we don't recreate the mesh every time
+TestMeshGrid test_mesh_grid;
+
+}  // namespace
+
+// Write and read are timed separately and report vertices/s
+// (items_per_second) and peak RSS, matching the point cloud scale
+// benchmarks in PointCloudIO.cpp
+static void BM_WriteTriangleMesh(benchmark::State &state) {
+    int mesh_args_id = state.range(0);
+    int size = state.range(1);
+    test_mesh_grid.Setup(size);
+    for (auto _ : state) {
+        test_mesh_grid.Write(mesh_args_id);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+    state.counters["peak_rss_mb"] = GetPeakRSSInMB();
+}
+
+static void BM_ReadTriangleMesh(benchmark::State &state) {
+    int mesh_args_id = state.range(0);
+    int size = state.range(1);
+    test_mesh_grid.Setup(size);
+    test_mesh_grid.Write(mesh_args_id);
+    for (auto _ : state) {
+        test_mesh_grid.Read(mesh_args_id);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+    state.counters["peak_rss_mb"] = GetPeakRSSInMB();
+}
+
+static void BM_TriangleMeshScale_Args(benchmark::internal::Benchmark *b) {
+    // A 10M-vertex mesh already holds ~20M triangles; larger scales are
+    // bound by the RAM of the benchmark machine rather than the format
+    for (int i = 0; i < int(g_mesh_args.size()); ++i) {
+        b->Args({i, 1000000});
+        b->Args({i, 10000000});
+    }
+}
+
+BENCHMARK(BM_WriteTriangleMesh)
+        ->Unit(benchmark::kMillisecond)
+        ->MinTime(0.1)
+        ->Apply(BM_TriangleMeshScale_Args);
+BENCHMARK(BM_ReadTriangleMesh)
+        ->Unit(benchmark::kMillisecond)
+        ->MinTime(0.1)
+        ->Apply(BM_TriangleMeshScale_Args);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/RGBDImage.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+// Synthetic 640x480 RGBD frame of a rippled surface with an intensity
+// pattern; \p phase shifts the pattern, which approximates a small
+// camera motion between two frames
+static std::shared_ptr<geometry::RGBDImage> MakeSyntheticRGBDFrame(
+        double phase) {
+    const int width = 640;
+    const int height = 480;
+    geometry::Image color;
+    geometry::Image depth;
+    color.Prepare(width, height, 3, 1);
+    depth.Prepare(width, height, 1, 2);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            double du = double(u) / width;
+            double dv = double(v) / height;
+            double z = 1.5 + 0.2 * std::sin(10.0 * du + phase) *
+                                     std::cos(8.0 * dv + phase);
+            auto intensity = std::uint8_t(
+                    127.5 + 100.0 * std::sin(20.0 * du + phase) *
+                                    std::cos(16.0 * dv));
+            *depth.PointerAt<std::uint16_t>(u, v) =
+                    std::uint16_t(1000.0 * z);
+            *color.PointerAt<std::uint8_t>(u, v, 0) = intensity;
+            *color.PointerAt<std::uint8_t>(u, v, 1) = intensity;
+            *color.PointerAt<std::uint8_t>(u, v, 2) = intensity;
+        }
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(color, depth, 1000.0,
+                                                        3.0, true);
+}
+
+static void BM_ComputeRGBDOdometry(benchmark::State& state) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = MakeSyntheticRGBDFrame(0.0);
+    auto target = MakeSyntheticRGBDFrame(0.02);
+    for (auto _ : state) {
+        auto result = pipelines::odometry::ComputeRGBDOdometry(
+                *source, *target, intrinsic);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ComputeRGBDOdometry)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
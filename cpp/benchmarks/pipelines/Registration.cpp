@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/Registration.h"
+
+#include <cmath>
+#include <random>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+// Deterministic synthetic scan: random samples of a wavy terrain patch
+// with analytic normals, so the benchmark needs no data files and no
+// normal estimation
+static geometry::PointCloud MakeTerrainCloud(int num_points) {
+    geometry::PointCloud cloud;
+    cloud.points_.reserve(num_points);
+    cloud.normals_.reserve(num_points);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (int i = 0; i < num_points; ++i) {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        cloud.points_.push_back(
+                {x, y, 0.1 * std::sin(3.0 * x) * std::cos(3.0 * y)});
+        Eigen::Vector3d normal(-0.3 * std::cos(3.0 * x) * std::cos(3.0 * y),
+                               0.3 * std::sin(3.0 * x) * std::sin(3.0 * y),
+                               1.0);
+        cloud.normals_.push_back(normal.normalized());
+    }
+    return cloud;
+}
+
+// Holds the source/target pair; reused so the clouds are only generated
+// when the size changes
+class TestRegistrationClouds {
+    int size_ = 0;
+
+public:
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+
+    void setup(int size) {
+        if (size_ == size) return;
+        utility::LogInfo("setup registration clouds size={:d}", size);
+        size_ = size;
+        target = MakeTerrainCloud(size);
+        source = target;
+        Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+        perturbation.block<3, 3>(0, 0) =
+                geometry::PointCloud::GetRotationMatrixFromXYZ(
+                        {0.02, -0.01, 0.03});
+        perturbation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.015, 0.01);
+        source.Transform(perturbation);
+    }
+};
+TestRegistrationClouds testRegistrationClouds;
+
+static void BM_RegistrationICPPointToPoint(benchmark::State& state) {
+    int size = state.range(0);
+    int max_iteration = state.range(1);
+    testRegistrationClouds.setup(size);
+    for (auto _ : state) {
+        auto result = pipelines::registration::RegistrationICP(
+                testRegistrationClouds.source, testRegistrationClouds.target,
+                0.05, Eigen::Matrix4d::Identity(),
+                pipelines::registration::TransformationEstimationPointToPoint(
+                        false),
+                pipelines::registration::ICPConvergenceCriteria(
+                        1e-6, 1e-6, max_iteration));
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_RegistrationICPPointToPoint)
+        ->Unit(benchmark::kMillisecond)
+        ->Args({1 << 12, 10})
+        ->Args({1 << 14, 10})
+        ->Args({1 << 16, 10})
+        ->Args({1 << 14, 30});
+
+static void BM_RegistrationICPPointToPlane(benchmark::State& state) {
+    int size = state.range(0);
+    int max_iteration = state.range(1);
+    testRegistrationClouds.setup(size);
+    for (auto _ : state) {
+        auto result = pipelines::registration::RegistrationICP(
+                testRegistrationClouds.source, testRegistrationClouds.target,
+                0.05, Eigen::Matrix4d::Identity(),
+                pipelines::registration::TransformationEstimationPointToPlane(),
+                pipelines::registration::ICPConvergenceCriteria(
+                        1e-6, 1e-6, max_iteration));
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_RegistrationICPPointToPlane)
+        ->Unit(benchmark::kMillisecond)
+        ->Args({1 << 12, 10})
+        ->Args({1 << 14, 10})
+        ->Args({1 << 16, 10})
+        ->Args({1 << 14, 30});
+
+static void BM_ComputeFPFHFeature(benchmark::State& state) {
+    int size = state.range(0);
+    int knn = state.range(1);
+    testRegistrationClouds.setup(size);
+    for (auto _ : state) {
+        auto feature = pipelines::registration::ComputeFPFHFeature(
+                testRegistrationClouds.target,
+                geometry::KDTreeSearchParamKNN(knn));
+        benchmark::DoNotOptimize(feature);
+    }
+}
+BENCHMARK(BM_ComputeFPFHFeature)
+        ->Unit(benchmark::kMillisecond)
+        ->Args({1 << 12, 100})
+        ->Args({1 << 14, 100})
+        ->Args({1 << 16, 100});
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -26,6 +26,10 @@
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
 
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cstdint>
+
 #include <json/json.h>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
@@ -91,5 +95,51 @@ bool PinholeCameraTrajectory::ConvertFromJsonValue(const Json::Value &value) {
     }
     return true;
 }
+
+std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+PinholeCameraTrajectory::InterpolateExtrinsics(
+        const std::vector<double> &indices) const {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> extrinsics(
+            indices.size(), Eigen::Matrix4d::Identity());
+    if (parameters_.empty()) {
+        utility::LogWarning(
+                "InterpolateExtrinsics called on an empty trajectory.");
+        return extrinsics;
+    }
+    const int64_t num_poses = int64_t(parameters_.size());
+
+    // Decompose every pose once; each query then only needs one slerp
+    // instead of two rotation-matrix-to-quaternion conversions.
+    std::vector<Eigen::Quaterniond,
+                Eigen::aligned_allocator<Eigen::Quaterniond>>
+            rotations(num_poses);
+    std::vector<Eigen::Vector3d> translations(num_poses);
+    for (int64_t i = 0; i < num_poses; i++) {
+        const Eigen::Matrix4d_u &extrinsic = parameters_[i].extrinsic_;
+        rotations[i] =
+                Eigen::Quaterniond(Eigen::Matrix3d(extrinsic.block<3, 3>(0, 0)))
+                        .normalized();
+        translations[i] = extrinsic.block<3, 1>(0, 3);
+    }
+
+    const int64_t num_queries = int64_t(indices.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t k = 0; k < num_queries; k++) {
+        const double index =
+                std::min(std::max(indices[k], 0.0), double(num_poses - 1));
+        const int64_t i0 = std::min(int64_t(index), num_poses - 1);
+        const int64_t i1 = std::min(i0 + 1, num_poses - 1);
+        const double u = index - double(i0);
+        Eigen::Matrix4d &extrinsic = extrinsics[k];
+        extrinsic.block<3, 3>(0, 0) =
+                rotations[i0].slerp(u, rotations[i1]).toRotationMatrix();
+        extrinsic.block<3, 1>(0, 3) =
+                (1.0 - u) * translations[i0] + u * translations[i1];
+    }
+    return extrinsics;
+}
+
 }  // namespace camera
 }  // namespace open3d
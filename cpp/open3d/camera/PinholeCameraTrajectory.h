@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 namespace camera {
@@ -47,6 +48,19 @@ public:
     bool ConvertToJsonValue(Json::Value &value) const override;
     bool ConvertFromJsonValue(const Json::Value &value) override;
 
+    /// \brief Interpolates camera extrinsics at fractional frame
+    /// indices, all queries at once.
+    ///
+    /// An index of 3.25 yields the pose a quarter of the way from
+    /// camera 3 to camera 4: the rotation is slerped between the two
+    /// extrinsics and the translation interpolated linearly. Indices
+    /// are clamped to [0, size - 1]. The per-pose quaternion
+    /// decomposition is done once and the queries are answered in
+    /// parallel, so interpolating a whole frame range costs far less
+    /// than one call per frame.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+    InterpolateExtrinsics(const std::vector<double> &indices) const;
+
 public:
     /// List of PinholeCameraParameters objects.
     std::vector<PinholeCameraParameters> parameters_;
@@ -122,8 +122,16 @@ Tensor AdvancedIndexPreprocessor::RestrideIndexTensor(
     SizeVector new_shape(dims_before + index_tensor.NumDims() + dims_after, 1);
     std::copy(old_shape.begin(), old_shape.end(),
               new_shape.begin() + dims_before);
-    Tensor reshaped = index_tensor.Reshape(new_shape);
-    return reshaped;
+    // Only size-1 dimensions are inserted, so the result is always a view:
+    // the original strides are kept and the inserted dimensions get stride
+    // 0. Reshape is avoided on purpose, as it falls back to a contiguous
+    // copy of the index tensor when the index tensor is itself a strided
+    // view (e.g. sliced or transposed).
+    SizeVector old_strides = index_tensor.GetStrides();
+    SizeVector new_strides(new_shape.size(), 0);
+    std::copy(old_strides.begin(), old_strides.end(),
+              new_strides.begin() + dims_before);
+    return index_tensor.AsStrided(new_shape, new_strides);
 }
 
 void AdvancedIndexPreprocessor::RunPreprocess() {
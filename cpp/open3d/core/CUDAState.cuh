@@ -107,6 +107,107 @@ private:
     int prev_device_id_;
 };
 
+/// \class CUDAStream
+///
+/// RAII wrapper around a cudaStream_t. A default-constructed CUDAStream
+/// owns a newly created non-blocking stream on the current device and
+/// destroys it when going out of scope; a stream wrapped with the
+/// cudaStream_t constructor is not owned.
+///
+/// Use together with CUDAScopedStream to submit the kernels and async
+/// copies of a scoped block to this stream, so independent tensor ops
+/// can overlap with each other and with transfers.
+class CUDAStream {
+public:
+    /// Creates and owns a new non-blocking stream on the current device.
+    CUDAStream() {
+        OPEN3D_CUDA_CHECK(
+                cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+        owned_ = true;
+    }
+
+    /// Wraps an existing stream without taking ownership.
+    explicit CUDAStream(cudaStream_t stream)
+        : stream_(stream), owned_(false) {}
+
+    /// Returns a non-owning wrapper of the legacy default stream.
+    static CUDAStream Default() {
+        return CUDAStream(static_cast<cudaStream_t>(0));
+    }
+
+    ~CUDAStream() {
+        if (owned_) {
+            cudaStreamDestroy(stream_);
+        }
+    }
+
+    CUDAStream(CUDAStream&& other) noexcept
+        : stream_(other.stream_), owned_(other.owned_) {
+        other.owned_ = false;
+    }
+
+    CUDAStream(const CUDAStream&) = delete;
+
+    void operator=(const CUDAStream&) = delete;
+
+    cudaStream_t Get() const { return stream_; }
+
+    /// Blocks the host until all work submitted to the stream has
+    /// completed.
+    void Synchronize() const {
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream_));
+    }
+
+private:
+    cudaStream_t stream_ = 0;
+    bool owned_ = false;
+};
+
+/// \class CUDAEvent
+///
+/// RAII wrapper around a cudaEvent_t, used to order work across streams
+/// and to let the host wait for a point in a stream without a full
+/// device synchronization. The event is created without timing to keep
+/// recording cheap.
+class CUDAEvent {
+public:
+    CUDAEvent() {
+        OPEN3D_CUDA_CHECK(
+                cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+    }
+
+    ~CUDAEvent() { cudaEventDestroy(event_); }
+
+    CUDAEvent(const CUDAEvent&) = delete;
+
+    void operator=(const CUDAEvent&) = delete;
+
+    /// Records the event after all work currently submitted to \p stream.
+    void Record(cudaStream_t stream) {
+        OPEN3D_CUDA_CHECK(cudaEventRecord(event_, stream));
+    }
+
+    void Record(const CUDAStream& stream) { Record(stream.Get()); }
+
+    /// Makes all future work submitted to \p stream wait until the event
+    /// has been reached. The host is not blocked.
+    void StreamWait(cudaStream_t stream) const {
+        OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(stream, event_, 0));
+    }
+
+    void StreamWait(const CUDAStream& stream) const {
+        StreamWait(stream.Get());
+    }
+
+    /// Blocks the host until the event has been reached.
+    void Synchronize() const {
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(event_));
+    }
+
+private:
+    cudaEvent_t event_;
+};
+
 /// CUDAState is a lazy-evaluated singleton class that initializes and stores
 /// the states of CUDA devices.
 ///
@@ -167,6 +268,16 @@ public:
         return device_id;
     }
 
+    /// Returns the stream that kernels and async copies issued by the
+    /// calling thread are submitted to. This is the legacy default stream
+    /// unless redirected, typically with CUDAScopedStream.
+    cudaStream_t GetCurrentStream() const { return CurrentStream(); }
+
+    /// Redirects kernels and async copies issued by the calling thread to
+    /// \p stream. Prefer the RAII CUDAScopedStream over calling this
+    /// directly.
+    void SetCurrentStream(cudaStream_t stream) { CurrentStream() = stream; }
+
     /// Disable P2P device transfer by marking p2p_enabled_ to `false`, in order
     /// to run non-p2p tests on a p2p-capable machine.
     void ForceDisableP2PForTesting() {
@@ -225,11 +336,60 @@ private:
         }
     }
 
+private:
+    /// The current stream is tracked per thread, so sensor or worker
+    /// threads can each pipeline their own work without affecting other
+    /// threads.
+    static cudaStream_t& CurrentStream() {
+        static thread_local cudaStream_t current_stream = 0;
+        return current_stream;
+    }
+
 private:
     int num_devices_ = 0;
     std::vector<int> warp_sizes_;
     std::vector<std::vector<bool>> p2p_enabled_;
 };
 
+/// \class CUDAScopedStream
+///
+/// Redirects the kernels and async copies issued by the current thread to
+/// a stream within the current scope. The previous stream is restored
+/// once leaving the scope, following the same RAII pattern as
+/// CUDADeviceSwitcher.
+///
+/// Example:
+/// ```cpp
+/// void my_func(const Tensor& src) {
+///     CUDAStream stream;
+///     CUDAScopedStream scoped_stream(stream);
+///     // Tensor ops here run on `stream` and may overlap with work
+///     // submitted by other threads.
+///     Tensor dst = src.Sqrt();
+///     stream.Synchronize();
+/// }
+/// ```
+class CUDAScopedStream {
+public:
+    CUDAScopedStream(cudaStream_t stream) {
+        prev_stream_ = CUDAState::GetInstance()->GetCurrentStream();
+        CUDAState::GetInstance()->SetCurrentStream(stream);
+    }
+
+    CUDAScopedStream(const CUDAStream& stream)
+        : CUDAScopedStream(stream.Get()) {}
+
+    ~CUDAScopedStream() {
+        CUDAState::GetInstance()->SetCurrentStream(prev_stream_);
+    }
+
+    CUDAScopedStream(const CUDAScopedStream&) = delete;
+
+    void operator=(const CUDAScopedStream&) = delete;
+
+private:
+    cudaStream_t prev_stream_;
+};
+
 }  // namespace core
 }  // namespace open3d
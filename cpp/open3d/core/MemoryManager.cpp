@@ -26,8 +26,12 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
@@ -37,14 +41,151 @@
 namespace open3d {
 namespace core {
 
+namespace {
+
+// Tag applied to allocations made by this thread, see ScopedAllocationTag
+thread_local std::string current_allocation_tag;
+
+struct DeviceStats {
+    // The hot counters are atomics so Malloc/Free never serialize on
+    // them; the mutex only guards the per-pointer records, which are
+    // needed to know the size (and tag) of an allocation at Free time
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> peak_bytes{0};
+    std::atomic<size_t> malloc_count{0};
+    std::atomic<size_t> free_count{0};
+    std::mutex mutex;
+    std::unordered_map<const void*, std::pair<size_t, std::string>>
+            allocations;
+    std::unordered_map<std::string, size_t> live_bytes_by_tag;
+};
+
+class StatsRegistry {
+public:
+    static StatsRegistry& GetInstance() {
+        static StatsRegistry instance;
+        return instance;
+    }
+
+    DeviceStats& GetDeviceStats(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_[device.ToString()];
+    }
+
+    std::atomic<bool> logging_enabled{false};
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, DeviceStats> stats_;
+};
+
+void RecordMalloc(const void* ptr, size_t byte_size, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+    DeviceStats& stats = StatsRegistry::GetInstance().GetDeviceStats(device);
+    size_t live = stats.live_bytes.fetch_add(byte_size) + byte_size;
+    size_t peak = stats.peak_bytes.load();
+    while (live > peak && !stats.peak_bytes.compare_exchange_weak(peak, live)) {
+    }
+    stats.malloc_count.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        stats.allocations[ptr] =
+                std::make_pair(byte_size, current_allocation_tag);
+        stats.live_bytes_by_tag[current_allocation_tag] += byte_size;
+    }
+    if (StatsRegistry::GetInstance().logging_enabled.load()) {
+        utility::LogDebug("[MemoryManager] Malloc {:#x} {} bytes {} tag \"{}\"",
+                          reinterpret_cast<std::uintptr_t>(ptr), byte_size,
+                          device.ToString(), current_allocation_tag);
+    }
+}
+
+void RecordFree(const void* ptr, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+    DeviceStats& stats = StatsRegistry::GetInstance().GetDeviceStats(device);
+    size_t byte_size = 0;
+    std::string tag;
+    {
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        auto it = stats.allocations.find(ptr);
+        if (it == stats.allocations.end()) {
+            // Not allocated through MemoryManager::Malloc; leave the
+            // counters alone
+            return;
+        }
+        byte_size = it->second.first;
+        tag = it->second.second;
+        stats.allocations.erase(it);
+        auto tag_it = stats.live_bytes_by_tag.find(tag);
+        if (tag_it != stats.live_bytes_by_tag.end()) {
+            tag_it->second -= byte_size;
+            if (tag_it->second == 0) {
+                stats.live_bytes_by_tag.erase(tag_it);
+            }
+        }
+    }
+    stats.live_bytes.fetch_sub(byte_size);
+    stats.free_count.fetch_add(1);
+    if (StatsRegistry::GetInstance().logging_enabled.load()) {
+        utility::LogDebug("[MemoryManager] Free {:#x} {} bytes {} tag \"{}\"",
+                          reinterpret_cast<std::uintptr_t>(ptr), byte_size,
+                          device.ToString(), tag);
+    }
+}
+
+}  // unnamed namespace
+
+ScopedAllocationTag::ScopedAllocationTag(const std::string& tag)
+    : previous_tag_(current_allocation_tag) {
+    current_allocation_tag = tag;
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() {
+    current_allocation_tag = previous_tag_;
+}
+
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
-    return GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    void* ptr = GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    RecordMalloc(ptr, byte_size, device);
+    return ptr;
 }
 
 void MemoryManager::Free(void* ptr, const Device& device) {
+    RecordFree(ptr, device);
     return GetDeviceMemoryManager(device)->Free(ptr, device);
 }
 
+MemoryManager::MemoryStats MemoryManager::GetStats(const Device& device) {
+    DeviceStats& stats = StatsRegistry::GetInstance().GetDeviceStats(device);
+    MemoryStats result;
+    result.live_bytes = stats.live_bytes.load();
+    result.peak_bytes = stats.peak_bytes.load();
+    result.malloc_count = stats.malloc_count.load();
+    result.free_count = stats.free_count.load();
+    {
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        result.live_bytes_by_tag = stats.live_bytes_by_tag;
+    }
+    return result;
+}
+
+void MemoryManager::ResetPeakStats(const Device& device) {
+    DeviceStats& stats = StatsRegistry::GetInstance().GetDeviceStats(device);
+    stats.peak_bytes.store(stats.live_bytes.load());
+}
+
+void MemoryManager::SetAllocationLoggingEnabled(bool enabled) {
+    StatsRegistry::GetInstance().logging_enabled.store(enabled);
+}
+
+bool MemoryManager::IsAllocationLoggingEnabled() {
+    return StatsRegistry::GetInstance().logging_enabled.load();
+}
+
 void MemoryManager::Memcpy(void* dst_ptr,
                            const Device& dst_device,
                            const void* src_ptr,
@@ -77,6 +218,39 @@ void MemoryManager::Memcpy(void* dst_ptr,
     device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::MemcpyAsync(void* dst_ptr,
+                                const Device& dst_device,
+                                const void* src_ptr,
+                                const Device& src_device,
+                                size_t num_bytes) {
+    // 0-element Tensor's data_ptr_ is nullptr
+    if (num_bytes == 0) {
+        return;
+    } else if (src_ptr == nullptr || dst_ptr == nullptr) {
+        utility::LogError("src_ptr and dst_ptr cannot be nullptr.");
+    }
+
+    if ((dst_device.GetType() != Device::DeviceType::CPU &&
+         dst_device.GetType() != Device::DeviceType::CUDA) ||
+        (src_device.GetType() != Device::DeviceType::CPU &&
+         src_device.GetType() != Device::DeviceType::CUDA)) {
+        utility::LogError("MemoryManager::MemcpyAsync: Unimplemented device.");
+    }
+
+    std::shared_ptr<DeviceMemoryManager> device_mm;
+    if (dst_device.GetType() == Device::DeviceType::CPU &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        device_mm = GetDeviceMemoryManager(src_device);
+    } else if (src_device.GetType() == Device::DeviceType::CUDA) {
+        device_mm = GetDeviceMemoryManager(src_device);
+    } else {
+        device_mm = GetDeviceMemoryManager(dst_device);
+    }
+
+    device_mm->MemcpyAsync(dst_ptr, dst_device, src_ptr, src_device,
+                           num_bytes);
+}
+
 void MemoryManager::MemcpyFromHost(void* dst_ptr,
                                    const Device& dst_device,
                                    const void* host_ptr,
@@ -103,7 +277,7 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
                      std::make_shared<CPUMemoryManager>()},
 #ifdef BUILD_CUDA_MODULE
                     {Device::DeviceType::CUDA,
-                     std::make_shared<CUDAMemoryManager>()},
+                     std::make_shared<CUDACachedMemoryManager>()},
 #endif
             };
     if (map_device_type_to_memory_manager.find(device.GetType()) ==
@@ -27,13 +27,147 @@
 #include "open3d/core/MemoryManager.h"
 
 #include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef BUILD_CUDA_MODULE
+#include <cuda_runtime.h>
+
+#include <unordered_set>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace open3d {
 namespace core {
 
+namespace {
+bool s_pinned_memory_enabled = false;
+#ifdef BUILD_CUDA_MODULE
+// Pointers served by cudaMallocHost. Tracked so they are released with
+// cudaFreeHost even after pinned memory has been disabled again.
+std::mutex s_pinned_mutex;
+std::unordered_set<void*> s_pinned_ptrs;
+#endif
+
+bool s_huge_pages_enabled = false;
+int s_preferred_numa_node = -1;
+size_t s_large_alloc_threshold = size_t(1) << 21;
+// Pointers served by mmap, with their mapped lengths for munmap.
+// Tracked so they are released correctly even after the policy knobs
+// have been changed.
+std::mutex s_mmap_mutex;
+std::unordered_map<void*, size_t> s_mmap_ptrs;
+
+#ifdef __linux__
+/// Serves \p byte_size from anonymous mmap with MADV_HUGEPAGE, bound to
+/// the preferred NUMA node when one is set. Returns nullptr on failure
+/// so the caller can fall back to malloc.
+void* MmapLargeAlloc(size_t byte_size) {
+    void* ptr = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    // Advisory only: the kernel falls back to 4K pages when no huge
+    // pages are available.
+    madvise(ptr, byte_size, MADV_HUGEPAGE);
+    if (s_preferred_numa_node >= 0) {
+        // mbind via raw syscall to avoid a libnuma link dependency.
+        // MPOL_BIND == 2. The pages are untouched, so binding moves
+        // nothing; it only sets the placement policy for the faults.
+        unsigned long node_mask[2] = {0, 0};
+        int node = s_preferred_numa_node;
+        if (node < int(sizeof(node_mask) * 8)) {
+            node_mask[node / (sizeof(unsigned long) * 8)] |=
+                    1UL << (node % (sizeof(unsigned long) * 8));
+            if (syscall(SYS_mbind, ptr, byte_size, 2, node_mask,
+                        sizeof(node_mask) * 8, 0) != 0) {
+                utility::LogWarning(
+                        "Binding allocation to NUMA node {} failed; "
+                        "falling back to first-touch placement.",
+                        node);
+            }
+        } else {
+            utility::LogWarning("Invalid NUMA node {}.", node);
+        }
+    }
+    std::lock_guard<std::mutex> lock(s_mmap_mutex);
+    s_mmap_ptrs.emplace(ptr, byte_size);
+    return ptr;
+}
+#endif
+}  // unnamed namespace
+
+void CPUMemoryManager::SetPinnedMemoryEnabled(bool enabled) {
+    s_pinned_memory_enabled = enabled;
+}
+
+bool CPUMemoryManager::IsPinnedMemoryEnabled() {
+    return s_pinned_memory_enabled;
+}
+
+void CPUMemoryManager::SetHugePagesEnabled(bool enabled) {
+#ifndef __linux__
+    if (enabled) {
+        utility::LogWarning("Huge pages are only supported on Linux.");
+        return;
+    }
+#endif
+    s_huge_pages_enabled = enabled;
+}
+
+bool CPUMemoryManager::IsHugePagesEnabled() { return s_huge_pages_enabled; }
+
+void CPUMemoryManager::SetPreferredNumaNode(int node) {
+#ifndef __linux__
+    if (node >= 0) {
+        utility::LogWarning("NUMA node binding is only supported on Linux.");
+        return;
+    }
+#endif
+    s_preferred_numa_node = node;
+}
+
+int CPUMemoryManager::GetPreferredNumaNode() { return s_preferred_numa_node; }
+
+void CPUMemoryManager::SetLargeAllocThreshold(size_t byte_size) {
+    s_large_alloc_threshold = byte_size;
+}
+
+size_t CPUMemoryManager::GetLargeAllocThreshold() {
+    return s_large_alloc_threshold;
+}
+
 CPUMemoryManager::CPUMemoryManager() {}
 
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (s_pinned_memory_enabled && byte_size != 0) {
+        void* pinned_ptr = nullptr;
+        if (cudaMallocHost(&pinned_ptr, byte_size) == cudaSuccess) {
+            std::lock_guard<std::mutex> lock(s_pinned_mutex);
+            s_pinned_ptrs.insert(pinned_ptr);
+            return pinned_ptr;
+        }
+        // Pinned memory is exhausted, fall back to pageable memory.
+        cudaGetLastError();
+    }
+#endif
+#ifdef __linux__
+    if ((s_huge_pages_enabled || s_preferred_numa_node >= 0) &&
+        byte_size >= s_large_alloc_threshold) {
+        void* mmap_ptr = MmapLargeAlloc(byte_size);
+        if (mmap_ptr != nullptr) {
+            return mmap_ptr;
+        }
+        // mmap failed, fall back to malloc.
+    }
+#endif
     void* ptr;
     ptr = std::malloc(byte_size);
     if (byte_size != 0 && !ptr) {
@@ -43,7 +177,29 @@ void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
 }
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (ptr) {
+        std::lock_guard<std::mutex> lock(s_pinned_mutex);
+        auto it = s_pinned_ptrs.find(ptr);
+        if (it != s_pinned_ptrs.end()) {
+            s_pinned_ptrs.erase(it);
+            cudaFreeHost(ptr);
+            return;
+        }
+    }
+#endif
     if (ptr) {
+        {
+            std::lock_guard<std::mutex> lock(s_mmap_mutex);
+            auto it = s_mmap_ptrs.find(ptr);
+            if (it != s_mmap_ptrs.end()) {
+#ifdef __linux__
+                munmap(ptr, it->second);
+#endif
+                s_mmap_ptrs.erase(it);
+                return;
+            }
+        }
         std::free(ptr);
     }
 }
@@ -29,6 +29,11 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 
@@ -115,6 +120,45 @@ void CUDAMemoryManager::Memcpy(void* dst_ptr,
     }
 }
 
+void CUDAMemoryManager::MemcpyAsync(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    // The copy is issued on the calling thread's current stream and
+    // returns without synchronizing, so later kernels and copies on that
+    // stream see the complete data. With a pinned host buffer the
+    // transfer runs as DMA and overlaps host work; with pageable memory
+    // the runtime stages the copy and blocks.
+    cudaStream_t stream = CUDAState::GetInstance()->GetCurrentStream();
+    if (dst_device.GetType() == Device::DeviceType::CUDA &&
+        src_device.GetType() == Device::DeviceType::CPU) {
+        CUDADeviceSwitcher switcher(dst_device);
+        if (!IsCUDAPointer(dst_ptr)) {
+            utility::LogError("dst_ptr is not a CUDA pointer");
+        }
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyHostToDevice, stream));
+    } else if (dst_device.GetType() == Device::DeviceType::CPU &&
+               src_device.GetType() == Device::DeviceType::CUDA) {
+        CUDADeviceSwitcher switcher(src_device);
+        if (!IsCUDAPointer(src_ptr)) {
+            utility::LogError("src_ptr is not a CUDA pointer");
+        }
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost, stream));
+    } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
+               src_device.GetType() == Device::DeviceType::CUDA &&
+               dst_device == src_device) {
+        CUDADeviceSwitcher switcher(src_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToDevice, stream));
+    } else {
+        // Cross-device and peer copies stay on the blocking path.
+        Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+    }
+}
+
 bool CUDAMemoryManager::IsCUDAPointer(const void* ptr) {
     cudaPointerAttributes attributes;
     cudaPointerGetAttributes(&attributes, ptr);
@@ -124,5 +168,190 @@ bool CUDAMemoryManager::IsCUDAPointer(const void* ptr) {
     return false;
 }
 
+namespace {
+
+// Allocation sizes are rounded up to power-of-two buckets with a 256 B
+// minimum, so freed blocks are reusable by any later request of the
+// same bucket. The worst-case capacity overhead is 2x.
+size_t RoundUpBucketSize(size_t byte_size) {
+    size_t bucket_size = 256;
+    while (bucket_size < byte_size) {
+        bucket_size <<= 1;
+    }
+    return bucket_size;
+}
+
+struct DeviceCache {
+    // Free blocks grouped by bucket size, reused in LIFO order.
+    std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+    // Bucket size of every block currently handed out.
+    std::unordered_map<void*, size_t> live_blocks_;
+    size_t cached_bytes_ = 0;
+    size_t allocated_bytes_ = 0;
+    size_t peak_allocated_bytes_ = 0;
+};
+
+class CUDACache {
+public:
+    static CUDACache& GetInstance() {
+        static CUDACache instance;
+        return instance;
+    }
+
+    /// Pops a cached block of exactly \p bucket_size, or returns
+    /// nullptr if none is available.
+    void* TryTake(const Device& device, size_t bucket_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceCache& cache = caches_[device.GetID()];
+        auto it = cache.free_blocks_.find(bucket_size);
+        if (it == cache.free_blocks_.end() || it->second.empty()) {
+            return nullptr;
+        }
+        void* ptr = it->second.back();
+        it->second.pop_back();
+        cache.cached_bytes_ -= bucket_size;
+        MarkLiveLocked(cache, ptr, bucket_size);
+        return ptr;
+    }
+
+    void MarkLive(const Device& device, void* ptr, size_t bucket_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        MarkLiveLocked(caches_[device.GetID()], ptr, bucket_size);
+    }
+
+    /// Moves a live block back to its free list. Returns false if the
+    /// pointer is not managed by the cache.
+    bool Recycle(const Device& device, void* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceCache& cache = caches_[device.GetID()];
+        auto it = cache.live_blocks_.find(ptr);
+        if (it == cache.live_blocks_.end()) {
+            return false;
+        }
+        size_t bucket_size = it->second;
+        cache.live_blocks_.erase(it);
+        cache.allocated_bytes_ -= bucket_size;
+        cache.free_blocks_[bucket_size].push_back(ptr);
+        cache.cached_bytes_ += bucket_size;
+        return true;
+    }
+
+    /// Returns all cached (free) blocks of one device to cudaFree.
+    void ReleaseCache(int device_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = caches_.find(device_id);
+        if (it == caches_.end()) {
+            return;
+        }
+        CUDADeviceSwitcher switcher(
+                Device(Device::DeviceType::CUDA, device_id));
+        for (auto& bucket : it->second.free_blocks_) {
+            for (void* ptr : bucket.second) {
+                OPEN3D_CUDA_CHECK(cudaFree(ptr));
+            }
+        }
+        it->second.free_blocks_.clear();
+        it->second.cached_bytes_ = 0;
+    }
+
+    void ReleaseCache() {
+        std::vector<int> device_ids;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& cache : caches_) {
+                device_ids.push_back(cache.first);
+            }
+        }
+        for (int device_id : device_ids) {
+            ReleaseCache(device_id);
+        }
+    }
+
+    size_t GetCachedBytes(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return caches_[device.GetID()].cached_bytes_;
+    }
+
+    size_t GetAllocatedBytes(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return caches_[device.GetID()].allocated_bytes_;
+    }
+
+    size_t GetPeakAllocatedBytes(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return caches_[device.GetID()].peak_allocated_bytes_;
+    }
+
+private:
+    CUDACache() {}
+
+    void MarkLiveLocked(DeviceCache& cache, void* ptr, size_t bucket_size) {
+        cache.live_blocks_[ptr] = bucket_size;
+        cache.allocated_bytes_ += bucket_size;
+        cache.peak_allocated_bytes_ =
+                std::max(cache.peak_allocated_bytes_, cache.allocated_bytes_);
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<int, DeviceCache> caches_;
+};
+
+}  // unnamed namespace
+
+CUDACachedMemoryManager::CUDACachedMemoryManager() {}
+
+void* CUDACachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "CUDACachedMemoryManager::Malloc: Unimplemented device");
+    }
+    size_t bucket_size = RoundUpBucketSize(byte_size);
+    CUDACache& cache = CUDACache::GetInstance();
+    void* ptr = cache.TryTake(device, bucket_size);
+    if (ptr != nullptr) {
+        return ptr;
+    }
+    CUDADeviceSwitcher switcher(device);
+    if (cudaMalloc(static_cast<void**>(&ptr), bucket_size) != cudaSuccess) {
+        // Flush the cache and retry once before reporting out-of-memory.
+        cudaGetLastError();
+        cache.ReleaseCache(device.GetID());
+        OPEN3D_CUDA_CHECK(cudaMalloc(static_cast<void**>(&ptr), bucket_size));
+    }
+    cache.MarkLive(device, ptr, bucket_size);
+    return ptr;
+}
+
+void CUDACachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "CUDACachedMemoryManager::Free: Unimplemented device");
+    }
+    if (ptr == nullptr) {
+        return;
+    }
+    // Pointers that did not come from this manager (e.g. allocated
+    // before the dispatch switched managers) fall through to cudaFree.
+    if (!CUDACache::GetInstance().Recycle(device, ptr)) {
+        CUDAMemoryManager::Free(ptr, device);
+    }
+}
+
+void CUDACachedMemoryManager::ReleaseCache() {
+    CUDACache::GetInstance().ReleaseCache();
+}
+
+size_t CUDACachedMemoryManager::GetCachedBytes(const Device& device) {
+    return CUDACache::GetInstance().GetCachedBytes(device);
+}
+
+size_t CUDACachedMemoryManager::GetAllocatedBytes(const Device& device) {
+    return CUDACache::GetInstance().GetAllocatedBytes(device);
+}
+
+size_t CUDACachedMemoryManager::GetPeakAllocatedBytes(const Device& device) {
+    return CUDACache::GetInstance().GetPeakAllocatedBytes(device);
+}
+
 }  // namespace core
 }  // namespace open3d
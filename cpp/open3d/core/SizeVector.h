@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "open3d/utility/Console.h"
@@ -36,37 +37,173 @@
 namespace open3d {
 namespace core {
 
+/// \brief Fixed-size arena backing the inline storage of a SizeVector.
+///
+/// Tensor shapes and strides rarely exceed a few dimensions, so the
+/// first allocation of up to kSmallDims int64_t elements is served from
+/// a buffer embedded in the SizeVector itself and never touches the
+/// heap. Larger or additional allocations fall back to operator new.
+class SizeVectorArena {
+public:
+    static constexpr int64_t kSmallDims = 5;
+
+    void* Allocate(std::size_t num_bytes) {
+        if (!in_use_ && num_bytes <= sizeof(buffer_)) {
+            in_use_ = true;
+            return buffer_;
+        }
+        return ::operator new(num_bytes);
+    }
+
+    void Deallocate(void* ptr) {
+        if (ptr == buffer_) {
+            in_use_ = false;
+            return;
+        }
+        FreeHeap(ptr);
+    }
+
+    /// Releases a pointer that is known not to be an inline buffer. The
+    /// inline asm makes the pointer opaque to the optimizer: after
+    /// inlining into SizeVector users GCC otherwise threads a path in
+    /// which the deleted pointer appears to be the embedded buffer and
+    /// raises -Wfree-nonheap-object, although that path never executes.
+    static void FreeHeap(void* ptr) {
+#if defined(__GNUC__)
+        asm("" : "+r"(ptr));
+#endif
+        ::operator delete(ptr);
+    }
+
+private:
+    alignas(int64_t) char buffer_[kSmallDims * sizeof(int64_t)];
+    bool in_use_ = false;
+};
+
+/// Allocator serving from a SizeVectorArena when one is attached and
+/// from the heap otherwise. The allocator never propagates on copy,
+/// move or swap: the arena lives inside one specific SizeVector and its
+/// storage must not be handed to another instance.
+template <typename T>
+class SizeVectorAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+
+    SizeVectorAllocator() : arena_(nullptr) {}
+
+    explicit SizeVectorAllocator(SizeVectorArena* arena) : arena_(arena) {}
+
+    template <typename U>
+    SizeVectorAllocator(const SizeVectorAllocator<U>& other)
+        : arena_(other.arena_) {}
+
+    T* allocate(std::size_t n) {
+        if (arena_ != nullptr) {
+            return static_cast<T*>(arena_->Allocate(n * sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t) {
+        if (arena_ != nullptr) {
+            arena_->Deallocate(ptr);
+        } else {
+            SizeVectorArena::FreeHeap(ptr);
+        }
+    }
+
+    /// A container copy must allocate from its own arena, never from
+    /// the arena of the container it was copied from.
+    SizeVectorAllocator select_on_container_copy_construction() const {
+        return SizeVectorAllocator();
+    }
+
+    SizeVectorArena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const SizeVectorAllocator<T>& lhs,
+                const SizeVectorAllocator<U>& rhs) {
+    return lhs.arena_ == rhs.arena_;
+}
+
+template <typename T, typename U>
+bool operator!=(const SizeVectorAllocator<T>& lhs,
+                const SizeVectorAllocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
 /// SizeVector is a vector of int64_t, typically used in Tensor shape and
 /// strides. A signed int64_t type is chosen to allow negative strides.
-class SizeVector : public std::vector<int64_t> {
+///
+/// SizeVector keeps up to SizeVectorArena::kSmallDims elements in an
+/// embedded buffer, so creating and copying shapes and strides of
+/// typical tensors is allocation-free. Since the embedded buffer cannot
+/// change owners, moving a SizeVector copies the elements; for at most
+/// a few int64_t entries this is cheaper than a heap round trip.
+class SizeVector : private SizeVectorArena,
+                   public std::vector<int64_t, SizeVectorAllocator<int64_t>> {
 public:
     SizeVector(const std::initializer_list<int64_t>& dim_sizes)
-        : std::vector<int64_t>(dim_sizes) {}
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  dim_sizes, SizeVectorAllocator<int64_t>(this)) {}
 
     SizeVector(const std::vector<int64_t>& dim_sizes)
-        : std::vector<int64_t>(dim_sizes) {}
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  dim_sizes.begin(),
+                  dim_sizes.end(),
+                  SizeVectorAllocator<int64_t>(this)) {}
 
-    SizeVector(const SizeVector& other) : std::vector<int64_t>(other) {}
+    SizeVector(const SizeVector& other)
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  other.begin(),
+                  other.end(),
+                  SizeVectorAllocator<int64_t>(this)) {}
+
+    SizeVector(SizeVector&& other)
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  other.begin(),
+                  other.end(),
+                  SizeVectorAllocator<int64_t>(this)) {}
 
     explicit SizeVector(int64_t n, int64_t initial_value = 0)
-        : std::vector<int64_t>(n, initial_value) {}
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  n, initial_value, SizeVectorAllocator<int64_t>(this)) {}
 
     template <class InputIterator>
     SizeVector(InputIterator first, InputIterator last)
-        : std::vector<int64_t>(first, last) {}
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  first, last, SizeVectorAllocator<int64_t>(this)) {}
 
-    SizeVector() {}
+    SizeVector()
+        : std::vector<int64_t, SizeVectorAllocator<int64_t>>(
+                  SizeVectorAllocator<int64_t>(this)) {
+        reserve(SizeVectorArena::kSmallDims);
+    }
 
     SizeVector& operator=(const SizeVector& v) {
-        static_cast<std::vector<int64_t>*>(this)->operator=(v);
+        this->assign(v.begin(), v.end());
         return *this;
     }
 
     SizeVector& operator=(SizeVector&& v) {
-        static_cast<std::vector<int64_t>*>(this)->operator=(v);
+        this->assign(v.begin(), v.end());
         return *this;
     }
 
+    /// Swaps contents element-wise. This shadows std::vector::swap,
+    /// which would exchange the data pointers: the storage of a
+    /// SizeVector lives in its embedded arena and must not change
+    /// owners.
+    void swap(SizeVector& other) {
+        SizeVector tmp(other);
+        other = *this;
+        *this = tmp;
+    }
+
     int64_t NumElements() const {
         if (this->size() == 0) {
             return 1;
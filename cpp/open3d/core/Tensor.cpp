@@ -428,6 +428,18 @@ Tensor Tensor::Copy(const Device& device) const {
     return dst_tensor;
 }
 
+Tensor Tensor::CopyAsync(const Device& device) const {
+    if (!IsContiguous()) {
+        return Copy(device);
+    }
+    Tensor dst_tensor(shape_, dtype_, device);
+    MemoryManager::MemcpyAsync(dst_tensor.GetDataPtr(), device, GetDataPtr(),
+                               GetDevice(),
+                               DtypeUtil::ByteSize(dtype_) *
+                                       shape_.NumElements());
+    return dst_tensor;
+}
+
 Tensor Tensor::To(Dtype dtype, bool copy) const {
     if (!copy && dtype_ == dtype) {
         return *this;
@@ -769,6 +781,22 @@ Tensor Tensor::Div_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    int64_t ndims = NumDims();
+    if ((ndims != 2 && ndims != 3) || rhs.NumDims() != ndims) {
+        utility::LogError(
+                "Matmul supports (m, k) x (k, n) and (b, m, k) x (b, k, n), "
+                "but operands have {} and {} dims.",
+                ndims, rhs.NumDims());
+    }
+    SizeVector dst_shape =
+            ndims == 3 ? SizeVector{shape_[0], shape_[1], rhs.shape_[2]}
+                       : SizeVector{shape_[0], rhs.shape_[1]};
+    Tensor dst_tensor(dst_shape, dtype_, GetDevice());
+    kernel::Matmul(*this, rhs, dst_tensor);
+    return dst_tensor;
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -815,6 +843,38 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+Tensor Tensor::MaskedSum(const Tensor& mask) const {
+    Tensor sum({}, dtype_, GetDevice());
+    Tensor count({}, Dtype::Int64, GetDevice());
+    kernel::MaskedSumCount(*this, mask, sum, count);
+    return sum;
+}
+
+Tensor Tensor::MaskedMean(const Tensor& mask) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean for Float32 or Float64, got {} instead.",
+                DtypeUtil::ToString(dtype_));
+    }
+    Tensor sum({}, dtype_, GetDevice());
+    Tensor count({}, Dtype::Int64, GetDevice());
+    kernel::MaskedSumCount(*this, mask, sum, count);
+    int64_t num_selected = count.Item<int64_t>();
+    if (num_selected == 0) {
+        utility::LogWarning("Computing mean of an empty selection.");
+    }
+    // 1 / 0 == inf and sum == 0 for an empty selection, so this yields
+    // NaN like Mean() on a 0-sized tensor.
+    return sum * (1.0 / static_cast<double>(num_selected));
+}
+
+std::tuple<Tensor, Tensor> Tensor::MaskedMinMax(const Tensor& mask) const {
+    Tensor min({}, dtype_, GetDevice());
+    Tensor max({}, dtype_, GetDevice());
+    kernel::MaskedMinMax(*this, mask, min, max);
+    return std::make_tuple(min, max);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -829,6 +889,26 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+std::tuple<Tensor, Tensor> Tensor::Sort(bool descending) const {
+    Tensor vals(shape_, dtype_, GetDevice());
+    Tensor idxs(shape_, Dtype::Int64, GetDevice());
+    kernel::Sort(*this, vals, idxs, descending);
+    return std::make_tuple(vals, idxs);
+}
+
+Tensor Tensor::Unique() const { return kernel::Unique(*this); }
+
+std::tuple<Tensor, Tensor> Tensor::TopK(int64_t k, bool largest) const {
+    SizeVector dst_shape = shape_;
+    if (!dst_shape.empty()) {
+        dst_shape.back() = k;
+    }
+    Tensor vals(dst_shape, dtype_, GetDevice());
+    Tensor idxs(dst_shape, Dtype::Int64, GetDevice());
+    kernel::TopK(*this, vals, idxs, k, largest);
+    return std::make_tuple(vals, idxs);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
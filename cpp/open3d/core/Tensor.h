@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/DLPack.h"
@@ -303,6 +304,16 @@ public:
     /// The resulting Tensor will be compacted and contiguous
     Tensor Copy(const Device& device) const;
 
+    /// Copy Tensor to a specified device without waiting for the
+    /// transfer to finish. The copy is issued on the calling thread's
+    /// current CUDA stream (see CUDAScopedStream), so later kernels and
+    /// copies on that stream see the complete data, but the source must
+    /// stay alive until the stream has caught up. Reaches full PCIe bandwidth when the host side
+    /// uses pinned memory, see
+    /// CPUMemoryManager::SetPinnedMemoryEnabled. Falls back to the
+    /// blocking Copy for non-contiguous tensors.
+    Tensor CopyAsync(const Device& device) const;
+
     /// Copy Tensor values to current tensor for source tensor
     void CopyFrom(const Tensor& other);
 
@@ -491,6 +502,13 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Matrix multiplication, returning a new tensor.
+    ///
+    /// Supports (m, k) x (k, n) -> (m, n) and the batched case
+    /// (b, m, k) x (b, k, n) -> (b, m, n). Both tensors must have the
+    /// same Float32 or Float64 dtype and live on the same device.
+    Tensor Matmul(const Tensor& rhs) const;
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -516,6 +534,27 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Returns the sum of the elements selected by a Bool \p mask of the
+    /// same shape, as a scalar tensor. Equivalent to
+    /// IndexGet({mask}).Sum(...) over all elements, but fused into a
+    /// single pass so the gathered intermediate is never materialized.
+    /// \param mask Bool tensor with the shape and device of this tensor.
+    Tensor MaskedSum(const Tensor& mask) const;
+
+    /// Returns the mean of the elements selected by a Bool \p mask of
+    /// the same shape, as a scalar tensor. The sum and the selection
+    /// count come out of one fused pass; an empty selection results in
+    /// NaN and a warning, like Mean() on a 0-sized tensor.
+    /// \param mask Bool tensor with the shape and device of this tensor.
+    Tensor MaskedMean(const Tensor& mask) const;
+
+    /// Returns the min and the max of the elements selected by a Bool
+    /// \p mask of the same shape, as a tuple of scalar tensors computed
+    /// in one fused pass. An empty selection is an error, like Min()
+    /// or Max() on a 0-sized tensor.
+    /// \param mask Bool tensor with the shape and device of this tensor.
+    std::tuple<Tensor, Tensor> MaskedMinMax(const Tensor& mask) const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -536,6 +575,24 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Stable-sorts the tensor along its last dimension. Returns a tuple
+    /// of the sorted values and the Int64 indices of the sorted values
+    /// along the last dimension of the original tensor.
+    /// \param descending If true, sorts from largest to smallest.
+    std::tuple<Tensor, Tensor> Sort(bool descending = false) const;
+
+    /// Returns the sorted unique values of a 1-D tensor.
+    Tensor Unique() const;
+
+    /// Selects the \p k largest (or smallest) values along the last
+    /// dimension, in sorted order. Returns a tuple of the selected values
+    /// and their Int64 indices along the last dimension of the original
+    /// tensor.
+    /// \param k Number of values to select, 0 <= k <= last dim size.
+    /// \param largest If true, selects the largest values, else the
+    /// smallest.
+    std::tuple<Tensor, Tensor> TopK(int64_t k, bool largest = true) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
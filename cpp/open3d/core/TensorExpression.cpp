@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpression.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+TensorExpression::TensorExpression(const Tensor& tensor) {
+    node_ = std::make_shared<Node>();
+    node_->kind = Node::Kind::Leaf;
+    node_->tensor = tensor;
+}
+
+TensorExpression TensorExpression::MakeUnary(
+        kernel::UnaryEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->kind = Node::Kind::Unary;
+    node->unary_op = op_code;
+    node->lhs = node_;
+    return TensorExpression(std::move(node));
+}
+
+TensorExpression TensorExpression::MakeBinary(
+        const TensorExpression& other, kernel::BinaryEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->kind = Node::Kind::Binary;
+    node->binary_op = op_code;
+    node->lhs = node_;
+    node->rhs = other.node_;
+    return TensorExpression(std::move(node));
+}
+
+TensorExpression TensorExpression::Add(const TensorExpression& other) const {
+    return MakeBinary(other, kernel::BinaryEWOpCode::Add);
+}
+
+TensorExpression TensorExpression::Sub(const TensorExpression& other) const {
+    return MakeBinary(other, kernel::BinaryEWOpCode::Sub);
+}
+
+TensorExpression TensorExpression::Mul(const TensorExpression& other) const {
+    return MakeBinary(other, kernel::BinaryEWOpCode::Mul);
+}
+
+TensorExpression TensorExpression::Div(const TensorExpression& other) const {
+    return MakeBinary(other, kernel::BinaryEWOpCode::Div);
+}
+
+TensorExpression TensorExpression::Sqrt() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Sqrt);
+}
+
+TensorExpression TensorExpression::Sin() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Sin);
+}
+
+TensorExpression TensorExpression::Cos() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Cos);
+}
+
+TensorExpression TensorExpression::Neg() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Neg);
+}
+
+TensorExpression TensorExpression::Exp() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Exp);
+}
+
+TensorExpression TensorExpression::Abs() const {
+    return MakeUnary(kernel::UnaryEWOpCode::Abs);
+}
+
+Tensor TensorExpression::Evaluate() const {
+    // Compile the DAG to a postfix program over the distinct leaves.
+    kernel::FusedEWProgram program;
+    program.num_instructions = 0;
+    std::vector<Tensor> inputs;
+    std::unordered_map<const Node*, int> leaf_indices;
+
+    auto emit = [&program](const kernel::FusedEWInstruction& instruction) {
+        if (program.num_instructions >= kernel::MAX_FUSED_INSTRUCTIONS) {
+            utility::LogError(
+                    "Expression exceeds {} fused instructions, evaluate a "
+                    "subexpression first.",
+                    kernel::MAX_FUSED_INSTRUCTIONS);
+        }
+        program.instructions[program.num_instructions++] = instruction;
+    };
+
+    // Iterative postorder traversal: a node is expanded once and
+    // emitted after its children.
+    std::vector<std::pair<const Node*, bool>> stack;
+    stack.push_back(std::make_pair(node_.get(), false));
+    while (!stack.empty()) {
+        const Node* node = stack.back().first;
+        bool expanded = stack.back().second;
+        stack.pop_back();
+
+        kernel::FusedEWInstruction instruction;
+        if (node->kind == Node::Kind::Leaf) {
+            auto it = leaf_indices.find(node);
+            int leaf_index;
+            if (it != leaf_indices.end()) {
+                leaf_index = it->second;
+            } else {
+                if (static_cast<int64_t>(inputs.size()) >= MAX_INPUTS) {
+                    utility::LogError(
+                            "Expression exceeds {} distinct leaf tensors, "
+                            "evaluate a subexpression first.",
+                            MAX_INPUTS);
+                }
+                leaf_index = static_cast<int>(inputs.size());
+                leaf_indices.emplace(node, leaf_index);
+                inputs.push_back(node->tensor);
+            }
+            instruction.kind = kernel::FusedEWInstruction::Kind::Input;
+            instruction.input_index = leaf_index;
+            emit(instruction);
+        } else if (!expanded) {
+            stack.push_back(std::make_pair(node, true));
+            if (node->kind == Node::Kind::Binary) {
+                stack.push_back(std::make_pair(node->rhs.get(), false));
+            }
+            stack.push_back(std::make_pair(node->lhs.get(), false));
+        } else if (node->kind == Node::Kind::Unary) {
+            instruction.kind = kernel::FusedEWInstruction::Kind::Unary;
+            instruction.unary_op = node->unary_op;
+            emit(instruction);
+        } else {
+            instruction.kind = kernel::FusedEWInstruction::Kind::Binary;
+            instruction.binary_op = node->binary_op;
+            emit(instruction);
+        }
+    }
+
+    // FusedEW validates dtype, device and program consistency.
+    SizeVector broadcasted_shape = inputs[0].GetShape();
+    for (size_t i = 1; i < inputs.size(); ++i) {
+        broadcasted_shape = shape_util::BroadcastedShape(broadcasted_shape,
+                                                         inputs[i].GetShape());
+    }
+    Tensor dst(broadcasted_shape, inputs[0].GetDtype(), inputs[0].GetDevice());
+    kernel::FusedEW(inputs, dst, program);
+    return dst;
+}
+
+}  // namespace core
+}  // namespace open3d
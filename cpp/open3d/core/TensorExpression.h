@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+
+/// \brief Lazily evaluated elementwise Tensor expression.
+///
+/// Eager Tensor arithmetic materializes a full intermediate tensor per
+/// op, so a chain like `a * b + c` reads and writes three arrays. A
+/// TensorExpression instead records the elementwise DAG and fuses it
+/// into a single pass over the broadcasted inputs at Evaluate(), so
+/// each input element is read once and only the final result is
+/// written.
+///
+/// Example:
+/// \code
+/// TensorExpression x(a);
+/// Tensor result = (x * b + c).Evaluate();
+/// \endcode
+///
+/// Restrictions: the leaf tensors must share one floating point dtype
+/// (Float32 or Float64) and one device; only the arithmetic binary ops
+/// (+, -, *, /) and the floating point unary ops (Sqrt, Sin, Cos, Neg,
+/// Exp, Abs) can be recorded; an expression can have at most MAX_INPUTS
+/// distinct leaves and MAX_FUSED_INSTRUCTIONS recorded ops.
+class TensorExpression {
+public:
+    /// Leaf expression wrapping a Tensor. Intentionally implicit so
+    /// that plain tensors mix into expressions, e.g. `x * b + c`.
+    TensorExpression(const Tensor& tensor);
+
+    /// Materializes the expression in one fused pass and returns the
+    /// resulting tensor of the broadcasted leaf shape.
+    Tensor Evaluate() const;
+
+    TensorExpression Add(const TensorExpression& other) const;
+    TensorExpression Sub(const TensorExpression& other) const;
+    TensorExpression Mul(const TensorExpression& other) const;
+    TensorExpression Div(const TensorExpression& other) const;
+
+    TensorExpression Sqrt() const;
+    TensorExpression Sin() const;
+    TensorExpression Cos() const;
+    TensorExpression Neg() const;
+    TensorExpression Exp() const;
+    TensorExpression Abs() const;
+
+    TensorExpression operator+(const TensorExpression& other) const {
+        return Add(other);
+    }
+    TensorExpression operator-(const TensorExpression& other) const {
+        return Sub(other);
+    }
+    TensorExpression operator*(const TensorExpression& other) const {
+        return Mul(other);
+    }
+    TensorExpression operator/(const TensorExpression& other) const {
+        return Div(other);
+    }
+    TensorExpression operator-() const { return Neg(); }
+
+    /// Overloads taking a plain Tensor are needed so that `x * b` binds
+    /// here instead of Tensor's templated scalar operators. A plain
+    /// tensor on the left still needs wrapping: `TensorExpression(b) *
+    /// x`.
+    TensorExpression operator+(const Tensor& other) const {
+        return Add(other);
+    }
+    TensorExpression operator-(const Tensor& other) const {
+        return Sub(other);
+    }
+    TensorExpression operator*(const Tensor& other) const {
+        return Mul(other);
+    }
+    TensorExpression operator/(const Tensor& other) const {
+        return Div(other);
+    }
+
+protected:
+    /// One node of the recorded DAG. Shared subexpressions hold the
+    /// same node, so a leaf used twice is read from one indexer input.
+    struct Node {
+        enum class Kind { Leaf, Unary, Binary };
+        Kind kind;
+        Tensor tensor;  // Leaf only.
+        kernel::UnaryEWOpCode unary_op;
+        kernel::BinaryEWOpCode binary_op;
+        std::shared_ptr<Node> lhs;  // Unary and Binary.
+        std::shared_ptr<Node> rhs;  // Binary only.
+    };
+
+    TensorExpression(std::shared_ptr<Node> node) : node_(std::move(node)) {}
+
+    TensorExpression MakeUnary(kernel::UnaryEWOpCode op_code) const;
+    TensorExpression MakeBinary(const TensorExpression& other,
+                                kernel::BinaryEWOpCode op_code) const;
+
+    std::shared_ptr<Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -25,6 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/TensorList.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 
 namespace open3d {
@@ -113,10 +118,11 @@ Tensor TensorList::AsTensor() const {
 }
 
 void TensorList::Resize(int64_t n) {
-    // Increase internal tensor size
-    int64_t new_reserved_size = ReserveSize(n);
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
+    // Increase internal tensor size. Only reallocates when the current
+    // capacity is actually exceeded, so explicitly reserved space is
+    // respected.
+    if (n > reserved_size_) {
+        ExpandTensor(ReserveSize(n));
     }
 
     if (n > size_) {
@@ -126,15 +132,24 @@ void TensorList::Resize(int64_t n) {
     size_ = n;
 }
 
+void TensorList::Reserve(int64_t n) {
+    if (n < 0) {
+        utility::LogError("Negative tensor list capacity {} is unsupported.",
+                          n);
+    }
+    if (n > reserved_size_) {
+        ExpandTensor(n);
+    }
+}
+
 void TensorList::PushBack(const Tensor& tensor) {
     if (!shape_util::CanBeBrocastedToShape(tensor.GetShape(), shape_)) {
         utility::LogError("Incompatible shape {} and {}", shape_,
                           tensor.GetShape());
     }
 
-    int64_t new_reserved_size = ReserveSize(size_ + 1);
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
+    if (size_ + 1 > reserved_size_) {
+        ExpandTensor(ReserveSize(size_ + 1));
     }
 
     // Copy tensor
@@ -179,9 +194,8 @@ void TensorList::Extend(const TensorList& other) {  // Check consistency
         extension = TensorList(*this);
     }
 
-    int64_t new_reserved_size = ReserveSize(size_ + extension.GetSize());
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
+    if (size_ + extension.GetSize() > reserved_size_) {
+        ExpandTensor(ReserveSize(size_ + extension.GetSize()));
     }
     internal_tensor_.Slice(0 /* dim */, size_, size_ + extension.GetSize()) =
             extension.AsTensor();
@@ -204,9 +218,36 @@ void TensorList::ExpandTensor(int64_t new_reserved_size) {
     SizeVector new_expanded_shape = ExpandFrontDim(shape_, new_reserved_size);
     Tensor new_internal_tensor = Tensor(new_expanded_shape, dtype_, device_);
 
-    // Copy data
-    new_internal_tensor.Slice(0 /* dim */, 0, size_) =
-            internal_tensor_.Slice(0 /* dim */, 0, size_);
+    // Copy data. The internal tensor is contiguous, so the valid entries
+    // form one flat span at the front of the blob; on CPU the span is
+    // copied in parallel chunks instead of through the strided copy
+    // kernel.
+    int64_t num_bytes =
+            size_ * shape_.NumElements() * DtypeUtil::ByteSize(dtype_);
+    if (!internal_tensor_.IsContiguous()) {
+        new_internal_tensor.Slice(0 /* dim */, 0, size_) =
+                internal_tensor_.Slice(0 /* dim */, 0, size_);
+    } else if (num_bytes > 0) {
+        char* dst_ptr = static_cast<char*>(new_internal_tensor.GetDataPtr());
+        const char* src_ptr =
+                static_cast<const char*>(internal_tensor_.GetDataPtr());
+        if (device_.GetType() == Device::DeviceType::CPU) {
+            static constexpr int64_t kCopyChunkBytes = 1 << 20;
+            int64_t num_chunks =
+                    (num_bytes + kCopyChunkBytes - 1) / kCopyChunkBytes;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+                int64_t start = chunk * kCopyChunkBytes;
+                int64_t end = std::min(start + kCopyChunkBytes, num_bytes);
+                std::memcpy(dst_ptr + start, src_ptr + start, end - start);
+            }
+        } else {
+            MemoryManager::Memcpy(dst_ptr, device_, src_ptr, device_,
+                                  num_bytes);
+        }
+    }
     internal_tensor_ = new_internal_tensor;
     reserved_size_ = new_reserved_size;
 }
@@ -228,23 +269,17 @@ int64_t TensorList::ReserveSize(int64_t n) {
         utility::LogError("Too large tensor list size {} is unsupported.", n);
     }
 
-    for (int i = 63; i >= 0; --i) {
-        // First nnz bit
-        if (((base << i) & n) > 0) {
-            if (n == (base << i)) {
-                // Power of 2: 2 * n. For instance, 8 tensors will be
-                // reserved for size=4
-                return (base << (i + 1));
-            } else {
-                // Non-power of 2: ceil(log(2)) * 2. For instance, 16
-                // tensors will be reserved for size=5
-                return (base << (i + 2));
-            }
-        }
+    // Geometric growth: the capacity doubles while the list is small and
+    // grows by 1.5x once it is large. Doubling keeps PushBack amortized
+    // O(1); the smaller factor bounds both the wasted reservation and the
+    // transient peak (old + new blob) during reallocation when each entry
+    // is large.
+    static constexpr int64_t kDoublingLimit = 1 << 22;
+    int64_t reserved = 1;
+    while (reserved < n) {
+        reserved += reserved < kDoublingLimit ? reserved : reserved / 2;
     }
-
-    // No nnz bit: by default reserve 1 element.
-    return 1;
+    return reserved;
 }
 
 std::string TensorList::ToString() const {
@@ -128,6 +128,12 @@ public:
     /// If the size decreases, the decreased part's value will be undefined.
     void Resize(int64_t n);
 
+    /// Pre-allocate capacity for at least \p n tensors, so that subsequent
+    /// PushBack and Extend calls up to that size do not reallocate. The
+    /// size and the valid data are unchanged. Does nothing if the list
+    /// already holds enough reserved space.
+    void Reserve(int64_t n);
+
     /// Push back the copy of a tensor to the list.
     /// The tensor must broadcastable to the TensorList's shape.
     /// The tensor must be on the same device and have the same dtype.
@@ -228,8 +234,10 @@ protected:
     static SizeVector ExpandFrontDim(const SizeVector& shape,
                                      int64_t new_dim_size = 1);
 
-    /// Compute the reserved size for the desired number of tensors
-    /// with reserved_size_ = (1 << (ceil(log2(size_)) + 1)).
+    /// Compute the reserved size for the desired number of tensors.
+    /// The capacity grows geometrically: it doubles while small and grows
+    /// by 1.5x once large, so the over-reservation and the transient peak
+    /// during reallocation stay bounded for multi-GB lists.
     int64_t ReserveSize(int64_t n);
 
 protected:
@@ -247,9 +255,9 @@ protected:
 
     /// Maximum number of elements in TensorList.
     /// The internal_tensor_'s shape is (reserved_size_, *shape_).
-    /// In general, reserved_size_ >= (1 << (ceil(log2(size_)) + 1))
-    /// as conventionally done in std::vector.
-    /// Examples: (size_, reserved_size_) = (3, 8), (4, 8), (5, 16).
+    /// reserved_size_ >= size_ always holds, with geometric growth as
+    /// conventionally done in std::vector; see ReserveSize.
+    /// Examples: (size_, reserved_size_) = (3, 4), (4, 4), (5, 8).
     int64_t reserved_size_ = 0;
 
     /// The internal tensor for data storage.
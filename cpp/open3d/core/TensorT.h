@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+/// \brief A small stack-allocated tensor with compile-time shape and
+/// dtype.
+///
+/// TensorT avoids the per-call dtype dispatch and broadcast metadata
+/// setup of the dynamic Tensor kernels, which dominates the cost of
+/// arithmetic on tiny fixed-size tensors such as 4x4 poses and
+/// 6-vectors. All loops have constexpr bounds so the compiler fully
+/// unrolls and vectorizes them.
+///
+/// TensorT interoperates with the dynamic Tensor: FromTensor imports a
+/// matching CPU tensor with a single flat copy, and ToTensor exports
+/// one. Use the dynamic Tensor for anything large or of runtime shape.
+///
+/// Example:
+/// ```cpp
+/// TensorT<float, 4, 4> pose =
+///         TensorT<float, 4, 4>::FromTensor(pose_tensor);
+/// TensorT<float, 4, 1> point_h = pose.Matmul(point);
+/// ```
+template <typename T, int64_t M, int64_t N = 1>
+class TensorT {
+public:
+    static_assert(M > 0 && N > 0, "TensorT dimensions must be positive.");
+
+    /// Creates an uninitialized TensorT.
+    TensorT() {}
+
+    /// Returns a TensorT with all elements set to \p value.
+    static TensorT Full(T value) {
+        TensorT t;
+        t.data_.fill(value);
+        return t;
+    }
+
+    /// Returns a TensorT with all elements set to 0.
+    static TensorT Zeros() { return Full(T(0)); }
+
+    /// Returns a TensorT with all elements set to 1.
+    static TensorT Ones() { return Full(T(1)); }
+
+    /// Returns the identity matrix; only available when M == N.
+    static TensorT Identity() {
+        static_assert(M == N, "Identity requires a square TensorT.");
+        TensorT t = Zeros();
+        for (int64_t i = 0; i < M; ++i) {
+            t(i, i) = T(1);
+        }
+        return t;
+    }
+
+    /// Imports a (M, N) or, for N == 1, a (M,) CPU tensor of matching
+    /// dtype with a single flat copy.
+    static TensorT FromTensor(const Tensor& tensor) {
+        if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+            utility::LogError("TensorT only supports CPU, but {} was used.",
+                              tensor.GetDevice().ToString());
+        }
+        if (tensor.GetDtype() != DtypeUtil::FromType<T>()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(tensor.GetDtype()),
+                              DtypeUtil::ToString(DtypeUtil::FromType<T>()));
+        }
+        if (tensor.GetShape() != SizeVector{M, N} &&
+            !(N == 1 && tensor.GetShape() == SizeVector{M})) {
+            utility::LogError("Shape mismatch: expected {{{}, {}}}, got {}.",
+                              M, N, tensor.GetShape());
+        }
+        TensorT t;
+        Tensor conti = tensor.Contiguous();
+        std::memcpy(t.data_.data(), conti.GetDataPtr(), M * N * sizeof(T));
+        return t;
+    }
+
+    /// Exports to a contiguous (M, N) CPU tensor.
+    Tensor ToTensor() const {
+        Tensor tensor(SizeVector{M, N}, DtypeUtil::FromType<T>(),
+                      Device("CPU:0"));
+        std::memcpy(tensor.GetDataPtr(), data_.data(), M * N * sizeof(T));
+        return tensor;
+    }
+
+    T& operator()(int64_t i, int64_t j = 0) { return data_[i * N + j]; }
+
+    const T& operator()(int64_t i, int64_t j = 0) const {
+        return data_[i * N + j];
+    }
+
+    T* GetDataPtr() { return data_.data(); }
+
+    const T* GetDataPtr() const { return data_.data(); }
+
+    TensorT operator+(const TensorT& other) const {
+        TensorT t;
+        for (int64_t i = 0; i < M * N; ++i) {
+            t.data_[i] = data_[i] + other.data_[i];
+        }
+        return t;
+    }
+
+    TensorT operator-(const TensorT& other) const {
+        TensorT t;
+        for (int64_t i = 0; i < M * N; ++i) {
+            t.data_[i] = data_[i] - other.data_[i];
+        }
+        return t;
+    }
+
+    /// Element-wise product.
+    TensorT operator*(const TensorT& other) const {
+        TensorT t;
+        for (int64_t i = 0; i < M * N; ++i) {
+            t.data_[i] = data_[i] * other.data_[i];
+        }
+        return t;
+    }
+
+    TensorT operator*(T scalar) const {
+        TensorT t;
+        for (int64_t i = 0; i < M * N; ++i) {
+            t.data_[i] = data_[i] * scalar;
+        }
+        return t;
+    }
+
+    TensorT& operator+=(const TensorT& other) {
+        for (int64_t i = 0; i < M * N; ++i) {
+            data_[i] += other.data_[i];
+        }
+        return *this;
+    }
+
+    TensorT& operator-=(const TensorT& other) {
+        for (int64_t i = 0; i < M * N; ++i) {
+            data_[i] -= other.data_[i];
+        }
+        return *this;
+    }
+
+    /// Matrix product (M, N) x (N, K) -> (M, K), fully unrolled at
+    /// compile time.
+    template <int64_t K>
+    TensorT<T, M, K> Matmul(const TensorT<T, N, K>& other) const {
+        TensorT<T, M, K> t = TensorT<T, M, K>::Zeros();
+        for (int64_t i = 0; i < M; ++i) {
+            for (int64_t k = 0; k < N; ++k) {
+                T a = data_[i * N + k];
+                for (int64_t j = 0; j < K; ++j) {
+                    t(i, j) += a * other(k, j);
+                }
+            }
+        }
+        return t;
+    }
+
+    TensorT<T, N, M> T_() const {
+        TensorT<T, N, M> t;
+        for (int64_t i = 0; i < M; ++i) {
+            for (int64_t j = 0; j < N; ++j) {
+                t(j, i) = data_[i * N + j];
+            }
+        }
+        return t;
+    }
+
+    /// Sum of the element-wise product with \p other.
+    T Dot(const TensorT& other) const {
+        T sum = T(0);
+        for (int64_t i = 0; i < M * N; ++i) {
+            sum += data_[i] * other.data_[i];
+        }
+        return sum;
+    }
+
+    bool operator==(const TensorT& other) const {
+        for (int64_t i = 0; i < M * N; ++i) {
+            if (data_[i] != other.data_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const TensorT& other) const { return !(*this == other); }
+
+    static constexpr int64_t NumElements() { return M * N; }
+
+    static SizeVector GetShape() { return SizeVector{M, N}; }
+
+    static Dtype GetDtype() { return DtypeUtil::FromType<T>(); }
+
+protected:
+    std::array<T, M * N> data_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -62,6 +62,48 @@ static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
                                    *static_cast<const scalar_t*>(rhs);
 }
 
+// Contiguous kernels process a whole span through raw typed pointers,
+// so the compiler can vectorize the inner loop.
+template <typename scalar_t>
+static void CPUAddContiguousKernel(const scalar_t* lhs,
+                                   const scalar_t* rhs,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = lhs[i] + rhs[i];
+    }
+}
+
+template <typename scalar_t>
+static void CPUSubContiguousKernel(const scalar_t* lhs,
+                                   const scalar_t* rhs,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = lhs[i] - rhs[i];
+    }
+}
+
+template <typename scalar_t>
+static void CPUMulContiguousKernel(const scalar_t* lhs,
+                                   const scalar_t* rhs,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = lhs[i] * rhs[i];
+    }
+}
+
+template <typename scalar_t>
+static void CPUDivContiguousKernel(const scalar_t* lhs,
+                                   const scalar_t* rhs,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = lhs[i] / rhs[i];
+    }
+}
+
 template <typename src_t, typename dst_t>
 static void CPULogicalAndElementKernel(const void* lhs,
                                        const void* rhs,
@@ -202,6 +244,57 @@ void BinaryEWCPU(const Tensor& lhs,
                         "same type as the input.");
             }
         });
+    } else if (lhs.IsContiguous() && rhs.IsContiguous() &&
+               dst.IsContiguous() && lhs.GetShape() == rhs.GetShape() &&
+               lhs.GetShape() == dst.GetShape() &&
+               rhs.GetDtype() == src_dtype && dst_dtype == src_dtype) {
+        // Contiguous fast path without broadcasting: hand whole spans
+        // to SIMD inner loops instead of per-element Indexer pointer
+        // arithmetic.
+        int64_t n = lhs.GetShape().NumElements();
+        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+            const scalar_t* lhs_ptr =
+                    static_cast<const scalar_t*>(lhs.GetDataPtr());
+            const scalar_t* rhs_ptr =
+                    static_cast<const scalar_t*>(rhs.GetDataPtr());
+            scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+            switch (op_code) {
+                case BinaryEWOpCode::Add:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUAddContiguousKernel(
+                                        lhs_ptr + start, rhs_ptr + start,
+                                        dst_ptr + start, count);
+                            });
+                    break;
+                case BinaryEWOpCode::Sub:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUSubContiguousKernel(
+                                        lhs_ptr + start, rhs_ptr + start,
+                                        dst_ptr + start, count);
+                            });
+                    break;
+                case BinaryEWOpCode::Mul:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUMulContiguousKernel(
+                                        lhs_ptr + start, rhs_ptr + start,
+                                        dst_ptr + start, count);
+                            });
+                    break;
+                case BinaryEWOpCode::Div:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUDivContiguousKernel(
+                                        lhs_ptr + start, rhs_ptr + start,
+                                        dst_ptr + start, count);
+                            });
+                    break;
+                default:
+                    break;
+            }
+        });
     } else {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
@@ -34,6 +34,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -44,6 +45,7 @@ public:
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
+        utility::ProfilerZone zone("CPULauncher::UnaryEW");
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -57,6 +59,7 @@ public:
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
+        utility::ProfilerZone zone("CPULauncher::BinaryEW");
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -68,9 +71,35 @@ public:
         }
     }
 
+    /// Contiguous-case fast path for elementwise ops: splits
+    /// [0, num_elements) into one span per thread and calls
+    /// span_kernel(start, count) once per span, so kernels can run
+    /// tight SIMD inner loops over raw typed pointers instead of
+    /// per-element Indexer pointer arithmetic.
+    template <typename func_t>
+    static void LaunchContiguousEWKernel(int64_t num_elements,
+                                         func_t span_kernel) {
+        utility::ProfilerZone zone("CPULauncher::ContiguousEW");
+        int64_t num_threads = GetMaxThreads();
+        int64_t elements_per_thread =
+                (num_elements + num_threads - 1) / num_threads;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            int64_t start = thread_idx * elements_per_thread;
+            int64_t end = std::min(start + elements_per_thread, num_elements);
+            if (start < end) {
+                span_kernel(start, end - start);
+            }
+        }
+    }
+
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
+        utility::ProfilerZone zone("CPULauncher::AdvancedIndexer");
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -81,6 +110,22 @@ public:
         }
     }
 
+    /// General kernel launcher calling element_kernel(workload_idx) for
+    /// each workload. The element kernel captures whatever state it
+    /// needs, e.g. an Indexer over an arbitrary number of inputs.
+    template <typename func_t>
+    static void LaunchGeneralKernel(int64_t num_workloads,
+                                    func_t element_kernel) {
+        utility::ProfilerZone zone("CPULauncher::General");
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t workload_idx = 0; workload_idx < num_workloads;
+             ++workload_idx) {
+            element_kernel(workload_idx);
+        }
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
@@ -30,6 +30,7 @@
 #include <cuda_runtime.h>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/SizeVector.h"
@@ -83,7 +84,8 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   CUDAState::GetInstance()->GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
     }
 
@@ -106,7 +108,8 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   CUDAState::GetInstance()->GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
     }
 
@@ -128,9 +131,32 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   CUDAState::GetInstance()->GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
     }
+
+    /// General kernel launcher calling element_kernel(workload_idx) for
+    /// each workload. The element kernel captures whatever state it
+    /// needs, e.g. an Indexer over an arbitrary number of inputs.
+    template <typename func_t>
+    static void LaunchGeneralKernel(int64_t num_workloads,
+                                    func_t element_kernel) {
+        OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
+
+        int64_t n = num_workloads;
+        if (n == 0) {
+            return;
+        }
+        int64_t items_per_block = default_block_size * default_thread_size;
+        int64_t grid_size = (n + items_per_block - 1) / items_per_block;
+
+        ElementWiseKernel<default_block_size, default_thread_size>
+                <<<grid_size, default_block_size, 0,
+                   CUDAState::GetInstance()->GetCurrentStream()>>>(
+                        n, element_kernel);
+        OPEN3D_GET_LAST_CUDA_ERROR("LaunchGeneralKernel failed.");
+    }
 };
 }  // namespace kernel
 }  // namespace core
@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program) {
+    if (inputs.empty()) {
+        utility::LogError("FusedEW must have at least one input.");
+    }
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW supports at most {} inputs, but {} given.",
+                          MAX_INPUTS, inputs.size());
+    }
+
+    // All inputs and dst must be on the same device and share one
+    // floating point dtype.
+    Dtype dtype = dst.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          DtypeUtil::ToString(dtype));
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (input.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(input.GetDtype()),
+                              DtypeUtil::ToString(dtype));
+        }
+    }
+
+    // broadcast(input shapes) must be dst.shape.
+    SizeVector broadcasted_input_shape = inputs[0].GetShape();
+    for (size_t i = 1; i < inputs.size(); ++i) {
+        broadcasted_input_shape = shape_util::BroadcastedShape(
+                broadcasted_input_shape, inputs[i].GetShape());
+    }
+    if (broadcasted_input_shape != dst.GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                broadcasted_input_shape, dst.GetShape());
+    }
+
+    // The program must respect postfix stack discipline and leave
+    // exactly one value, the output element, on the stack.
+    if (program.num_instructions <= 0 ||
+        program.num_instructions > MAX_FUSED_INSTRUCTIONS) {
+        utility::LogError(
+                "A fused program must have between 1 and {} instructions, "
+                "but has {}.",
+                MAX_FUSED_INSTRUCTIONS, program.num_instructions);
+    }
+    int stack_depth = 0;
+    for (int i = 0; i < program.num_instructions; ++i) {
+        const FusedEWInstruction& instruction = program.instructions[i];
+        switch (instruction.kind) {
+            case FusedEWInstruction::Kind::Input:
+                if (instruction.input_index < 0 ||
+                    instruction.input_index >=
+                            static_cast<int>(inputs.size())) {
+                    utility::LogError(
+                            "Instruction {} reads input {} but only {} "
+                            "inputs are given.",
+                            i, instruction.input_index, inputs.size());
+                }
+                stack_depth++;
+                break;
+            case FusedEWInstruction::Kind::Unary:
+                if (stack_depth < 1) {
+                    utility::LogError("Stack underflow at instruction {}.", i);
+                }
+                if (instruction.unary_op == UnaryEWOpCode::LogicalNot) {
+                    utility::LogError(
+                            "Boolean ops cannot be fused, use the eager "
+                            "kernels instead.");
+                }
+                break;
+            case FusedEWInstruction::Kind::Binary:
+                if (stack_depth < 2) {
+                    utility::LogError("Stack underflow at instruction {}.", i);
+                }
+                if (s_boolean_binary_ew_op_codes.find(instruction.binary_op) !=
+                    s_boolean_binary_ew_op_codes.end()) {
+                    utility::LogError(
+                            "Boolean ops cannot be fused, use the eager "
+                            "kernels instead.");
+                }
+                stack_depth--;
+                break;
+            default:
+                utility::LogError("Invalid instruction kind at {}.", i);
+                break;
+        }
+    }
+    if (stack_depth != 1) {
+        utility::LogError(
+                "A fused program must leave exactly one value on the stack, "
+                "but leaves {}.",
+                stack_depth);
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, dst, program);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, dst, program);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Maximum number of postfix instructions of a fused elementwise
+/// program. It also bounds the per-element evaluation stack, so the
+/// program can be passed to CUDA kernels by value.
+static constexpr int64_t MAX_FUSED_INSTRUCTIONS = 32;
+
+/// One postfix instruction of a fused elementwise program. Input pushes
+/// one element of the indexer input \p input_index; Unary and Binary
+/// pop one resp. two values and push the op result.
+struct FusedEWInstruction {
+    enum class Kind { Input, Unary, Binary };
+    Kind kind;
+    int input_index;
+    UnaryEWOpCode unary_op;
+    BinaryEWOpCode binary_op;
+};
+
+/// Fixed-size postfix program evaluated once per output element.
+struct FusedEWProgram {
+    FusedEWInstruction instructions[MAX_FUSED_INSTRUCTIONS];
+    int num_instructions;
+};
+
+/// Evaluates an elementwise postfix program in a single pass over the
+/// broadcasted inputs, writing one output element per workload without
+/// materializing intermediates. Only the arithmetic binary ops
+/// (Add/Sub/Mul/Div) and the floating point unary ops are supported;
+/// all tensors must share one floating point dtype and one device.
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                Tensor& dst,
+                const FusedEWProgram& program);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 Tensor& dst,
+                 const FusedEWProgram& program);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
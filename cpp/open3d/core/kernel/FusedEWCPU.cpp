@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Evaluates the postfix program for one output element. The program
+/// has been validated in FusedEW, so the stack cannot under- or
+/// overflow here.
+template <typename scalar_t>
+static void CPUFusedEWElementKernel(const Indexer& indexer,
+                                    const FusedEWProgram& program,
+                                    int64_t workload_idx) {
+    scalar_t stack[MAX_FUSED_INSTRUCTIONS];
+    int top = -1;
+    for (int i = 0; i < program.num_instructions; ++i) {
+        const FusedEWInstruction& instruction = program.instructions[i];
+        if (instruction.kind == FusedEWInstruction::Kind::Input) {
+            const void* src = indexer.GetInputPtr(instruction.input_index,
+                                                  workload_idx);
+            stack[++top] = *static_cast<const scalar_t*>(src);
+        } else if (instruction.kind == FusedEWInstruction::Kind::Unary) {
+            scalar_t& value = stack[top];
+            switch (instruction.unary_op) {
+                case UnaryEWOpCode::Sqrt:
+                    value = static_cast<scalar_t>(std::sqrt(value));
+                    break;
+                case UnaryEWOpCode::Sin:
+                    value = static_cast<scalar_t>(std::sin(value));
+                    break;
+                case UnaryEWOpCode::Cos:
+                    value = static_cast<scalar_t>(std::cos(value));
+                    break;
+                case UnaryEWOpCode::Neg:
+                    value = -value;
+                    break;
+                case UnaryEWOpCode::Exp:
+                    value = static_cast<scalar_t>(std::exp(value));
+                    break;
+                case UnaryEWOpCode::Abs:
+                    value = static_cast<scalar_t>(
+                            std::abs(static_cast<double>(value)));
+                    break;
+                default:
+                    break;
+            }
+        } else {
+            scalar_t rhs = stack[top--];
+            scalar_t& lhs = stack[top];
+            switch (instruction.binary_op) {
+                case BinaryEWOpCode::Add:
+                    lhs = lhs + rhs;
+                    break;
+                case BinaryEWOpCode::Sub:
+                    lhs = lhs - rhs;
+                    break;
+                case BinaryEWOpCode::Mul:
+                    lhs = lhs * rhs;
+                    break;
+                case BinaryEWOpCode::Div:
+                    lhs = lhs / rhs;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    void* dst = indexer.GetOutputPtr(workload_idx);
+    *static_cast<scalar_t*>(dst) = stack[0];
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                Tensor& dst,
+                const FusedEWProgram& program) {
+    // inputs, dst and program have been validated in FusedEW.
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPULauncher::LaunchGeneralKernel(
+                indexer.NumWorkloads(), [&](int64_t workload_idx) {
+                    CPUFusedEWElementKernel<scalar_t>(indexer, program,
+                                                      workload_idx);
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
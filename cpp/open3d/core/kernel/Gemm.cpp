@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Gemm.h"
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    // lhs, rhs and dst must be on the same device.
+    for (auto device :
+         std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
+        if (lhs.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              lhs.GetDevice().ToString(), device.ToString());
+        }
+    }
+
+    Dtype dtype = lhs.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          DtypeUtil::ToString(dtype));
+    }
+    if (rhs.GetDtype() != dtype || dst.GetDtype() != dtype) {
+        utility::LogError("Dtype mismatch: {} x {} -> {}.",
+                          DtypeUtil::ToString(dtype),
+                          DtypeUtil::ToString(rhs.GetDtype()),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+
+    int64_t ndims = lhs.NumDims();
+    if ((ndims != 2 && ndims != 3) || rhs.NumDims() != ndims) {
+        utility::LogError(
+                "Matmul supports (m, k) x (k, n) and (b, m, k) x (b, k, n), "
+                "but operands have {} and {} dims.",
+                lhs.NumDims(), rhs.NumDims());
+    }
+    if (ndims == 3 && lhs.GetShape()[0] != rhs.GetShape()[0]) {
+        utility::LogError("Batch size mismatch {} != {}.", lhs.GetShape()[0],
+                          rhs.GetShape()[0]);
+    }
+    if (lhs.GetShape()[ndims - 1] != rhs.GetShape()[ndims - 2]) {
+        utility::LogError(
+                "Inner dimension mismatch: lhs shape {} and rhs shape {}.",
+                lhs.GetShape(), rhs.GetShape());
+    }
+    SizeVector expected_shape =
+            ndims == 3 ? SizeVector{lhs.GetShape()[0], lhs.GetShape()[1],
+                                    rhs.GetShape()[2]}
+                       : SizeVector{lhs.GetShape()[0], rhs.GetShape()[1]};
+    if (dst.GetShape() != expected_shape) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          expected_shape, dst.GetShape());
+    }
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs, rhs, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MatmulCUDA(lhs, rhs, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Matmul: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ImageOp.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+void CheckImagePair(const Tensor& src, const Tensor& dst, const char* op) {
+    if (src.NumDims() != 3 || src.GetShape()[2] != 1) {
+        utility::LogError("{}: src must have shape (rows, cols, 1), but {} "
+                          "was given.",
+                          op, src.GetShape().ToString());
+    }
+    if (!src.IsContiguous() || !dst.IsContiguous()) {
+        utility::LogError("{}: src and dst must be contiguous.", op);
+    }
+    if (src.GetDevice() != dst.GetDevice()) {
+        utility::LogError("{}: src device {} != dst device {}.", op,
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+}
+
+}  // unnamed namespace
+
+void ImageFilter(const Tensor& src, Tensor& dst, ImageFilterType type) {
+    CheckImagePair(src, dst, "ImageFilter");
+    if (src.GetDtype() != Dtype::Float32 ||
+        dst.GetDtype() != Dtype::Float32) {
+        utility::LogError("ImageFilter: src and dst must be Float32.");
+    }
+    if (dst.GetShape() != src.GetShape()) {
+        utility::LogError("ImageFilter: dst shape {} != src shape {}.",
+                          dst.GetShape().ToString(),
+                          src.GetShape().ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ImageFilterCPU(src, dst, type);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ImageFilterCUDA(src, dst, type);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ImageFilter: Unimplemented device");
+    }
+}
+
+void ImageDownsample(const Tensor& src, Tensor& dst) {
+    CheckImagePair(src, dst, "ImageDownsample");
+    if (src.GetDtype() != Dtype::Float32 ||
+        dst.GetDtype() != Dtype::Float32) {
+        utility::LogError("ImageDownsample: src and dst must be Float32.");
+    }
+    SizeVector expected{src.GetShape()[0] / 2, src.GetShape()[1] / 2, 1};
+    if (dst.GetShape() != expected) {
+        utility::LogError("ImageDownsample: dst shape {} != expected {}.",
+                          dst.GetShape().ToString(), expected.ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ImageDownsampleCPU(src, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ImageDownsampleCUDA(src, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ImageDownsample: Unimplemented device");
+    }
+}
+
+void ImageToFloat(const Tensor& src, Tensor& dst, double scale, double trunc) {
+    CheckImagePair(src, dst, "ImageToFloat");
+    if (src.GetDtype() != Dtype::Float32 &&
+        src.GetDtype() != Dtype::UInt8) {
+        utility::LogError("ImageToFloat: src must be Float32 or UInt8, but "
+                          "{} was given.",
+                          DtypeUtil::ToString(src.GetDtype()));
+    }
+    if (dst.GetDtype() != Dtype::Float32) {
+        utility::LogError("ImageToFloat: dst must be Float32.");
+    }
+    if (dst.GetShape() != src.GetShape()) {
+        utility::LogError("ImageToFloat: dst shape {} != src shape {}.",
+                          dst.GetShape().ToString(),
+                          src.GetShape().ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ImageToFloatCPU(src, dst, scale, trunc);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ImageToFloatCUDA(src, dst, scale, trunc);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ImageToFloat: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
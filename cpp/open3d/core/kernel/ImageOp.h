@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Device-resident image operations on (rows, cols, 1) tensors. The
+// coefficients and border handling (clamp-to-edge) match the separable
+// filters of geometry::Image, so CPU and CUDA runs reproduce the
+// legacy results.
+enum class ImageFilterType { Gaussian3, Gaussian5, Gaussian7, Sobel3Dx,
+                             Sobel3Dy };
+
+// Separable filter on a contiguous (rows, cols, 1) Float32 tensor.
+// dst must be preallocated with the shape, dtype and device of src.
+void ImageFilter(const Tensor& src, Tensor& dst, ImageFilterType type);
+
+void ImageFilterCPU(const Tensor& src, Tensor& dst, ImageFilterType type);
+
+#ifdef BUILD_CUDA_MODULE
+void ImageFilterCUDA(const Tensor& src, Tensor& dst, ImageFilterType type);
+#endif
+
+// 2x2 box downsample of a contiguous (rows, cols, 1) Float32 tensor
+// into a preallocated (rows / 2, cols / 2, 1) tensor.
+void ImageDownsample(const Tensor& src, Tensor& dst);
+
+void ImageDownsampleCPU(const Tensor& src, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void ImageDownsampleCUDA(const Tensor& src, Tensor& dst);
+#endif
+
+// Depth-to-float conversion of a contiguous (rows, cols, 1) Float32 or
+// UInt8 tensor into a preallocated Float32 tensor of the same shape:
+// UInt8 values are first mapped to [0, 1], then every value is divided
+// by scale and values >= trunc are zeroed, as in
+// geometry::Image::ConvertDepthToFloatImage().
+void ImageToFloat(const Tensor& src, Tensor& dst, double scale, double trunc);
+
+void ImageToFloatCPU(const Tensor& src, Tensor& dst, double scale,
+                     double trunc);
+
+#ifdef BUILD_CUDA_MODULE
+void ImageToFloatCUDA(const Tensor& src, Tensor& dst, double scale,
+                      double trunc);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
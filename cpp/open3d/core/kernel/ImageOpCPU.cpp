@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ImageOp.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+// Separable kernel coefficients, identical to geometry::Image.
+const std::vector<float> kGaussian3 = {0.25f, 0.5f, 0.25f};
+const std::vector<float> kGaussian5 = {0.0625f, 0.25f, 0.375f, 0.25f,
+                                       0.0625f};
+const std::vector<float> kGaussian7 = {0.03125f, 0.109375f, 0.21875f,
+                                       0.28125f, 0.21875f,  0.109375f,
+                                       0.03125f};
+const std::vector<float> kSobel31 = {-1.0f, 0.0f, 1.0f};
+const std::vector<float> kSobel32 = {1.0f, 2.0f, 1.0f};
+
+void GetSeparableKernels(ImageFilterType type,
+                         const std::vector<float>** kernel_x,
+                         const std::vector<float>** kernel_y) {
+    switch (type) {
+        case ImageFilterType::Gaussian3:
+            *kernel_x = &kGaussian3;
+            *kernel_y = &kGaussian3;
+            break;
+        case ImageFilterType::Gaussian5:
+            *kernel_x = &kGaussian5;
+            *kernel_y = &kGaussian5;
+            break;
+        case ImageFilterType::Gaussian7:
+            *kernel_x = &kGaussian7;
+            *kernel_y = &kGaussian7;
+            break;
+        case ImageFilterType::Sobel3Dx:
+            *kernel_x = &kSobel31;
+            *kernel_y = &kSobel32;
+            break;
+        case ImageFilterType::Sobel3Dy:
+            *kernel_x = &kSobel32;
+            *kernel_y = &kSobel31;
+            break;
+        default:
+            utility::LogError("ImageFilterCPU: Unsupported filter type.");
+    }
+}
+
+// Applies a 1D kernel along the rows with clamp-to-edge borders and
+// double accumulation, matching geometry::Image::FilterHorizontal.
+void FilterHorizontal(const float* input,
+                      float* output,
+                      int64_t rows,
+                      int64_t cols,
+                      const std::vector<float>& kernel) {
+    const int half_kernel_size = int(kernel.size() / 2);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t y = 0; y < rows; y++) {
+        const float* row_in = input + y * cols;
+        float* row_out = output + y * cols;
+        for (int64_t x = 0; x < cols; x++) {
+            double temp = 0;
+            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
+                int64_t x_shift =
+                        std::min(std::max(x + i, int64_t(0)), cols - 1);
+                temp += row_in[x_shift] * kernel[i + half_kernel_size];
+            }
+            row_out[x] = float(temp);
+        }
+    }
+}
+
+// Applies a 1D kernel along the columns with whole-row accumulators,
+// matching geometry::Image's vertical pass.
+void FilterVertical(const float* input,
+                    float* output,
+                    int64_t rows,
+                    int64_t cols,
+                    const std::vector<float>& kernel) {
+    const int half_kernel_size = int(kernel.size() / 2);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<double> acc(cols);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t y = 0; y < rows; y++) {
+            std::fill(acc.begin(), acc.end(), 0.0);
+            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
+                int64_t y_shift =
+                        std::min(std::max(y + i, int64_t(0)), rows - 1);
+                const float* row_in = input + y_shift * cols;
+                const float k = kernel[i + half_kernel_size];
+                for (int64_t x = 0; x < cols; x++) {
+                    acc[x] += row_in[x] * k;
+                }
+            }
+            float* row_out = output + y * cols;
+            for (int64_t x = 0; x < cols; x++) {
+                row_out[x] = float(acc[x]);
+            }
+        }
+    }
+}
+
+}  // unnamed namespace
+
+void ImageFilterCPU(const Tensor& src, Tensor& dst, ImageFilterType type) {
+    const std::vector<float>* kernel_x = nullptr;
+    const std::vector<float>* kernel_y = nullptr;
+    GetSeparableKernels(type, &kernel_x, &kernel_y);
+
+    const int64_t rows = src.GetShape()[0];
+    const int64_t cols = src.GetShape()[1];
+    Tensor temp(src.GetShape(), Dtype::Float32, src.GetDevice());
+    FilterHorizontal(static_cast<const float*>(src.GetDataPtr()),
+                     static_cast<float*>(temp.GetDataPtr()), rows, cols,
+                     *kernel_x);
+    FilterVertical(static_cast<const float*>(temp.GetDataPtr()),
+                   static_cast<float*>(dst.GetDataPtr()), rows, cols,
+                   *kernel_y);
+}
+
+void ImageDownsampleCPU(const Tensor& src, Tensor& dst) {
+    const int64_t cols = src.GetShape()[1];
+    const int64_t half_rows = dst.GetShape()[0];
+    const int64_t half_cols = dst.GetShape()[1];
+    const float* input = static_cast<const float*>(src.GetDataPtr());
+    float* output = static_cast<float*>(dst.GetDataPtr());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t y = 0; y < half_rows; y++) {
+        const float* row0 = input + (y * 2) * cols;
+        const float* row1 = input + (y * 2 + 1) * cols;
+        float* row_out = output + y * half_cols;
+        for (int64_t x = 0; x < half_cols; x++) {
+            row_out[x] = (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] +
+                          row1[x * 2 + 1]) /
+                         4.0f;
+        }
+    }
+}
+
+void ImageToFloatCPU(const Tensor& src, Tensor& dst, double scale,
+                     double trunc) {
+    const int64_t num_pixels = src.GetShape()[0] * src.GetShape()[1];
+    float* output = static_cast<float*>(dst.GetDataPtr());
+    const float scale_f = float(scale);
+    const float trunc_f = float(trunc);
+    if (src.GetDtype() == Dtype::Float32) {
+        const float* input = static_cast<const float*>(src.GetDataPtr());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_pixels; i++) {
+            float d = input[i] / scale_f;
+            output[i] = d >= trunc_f ? 0.0f : d;
+        }
+    } else {
+        const uint8_t* input = static_cast<const uint8_t*>(src.GetDataPtr());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_pixels; i++) {
+            float d = float(input[i]) / 255.0f / scale_f;
+            output[i] = d >= trunc_f ? 0.0f : d;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
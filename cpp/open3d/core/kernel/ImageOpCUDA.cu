@@ -0,0 +1,237 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ImageOp.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 128;
+constexpr int kMaxKernelSize = 7;
+
+// Small enough to pass by value into the kernels; accumulation is done
+// in double like the CPU path, so both devices produce the same image.
+struct SeparableKernel {
+    float coeff[kMaxKernelSize];
+    int half_size;
+};
+
+__global__ void FilterHorizontalKernel(const float* input,
+                                       float* output,
+                                       int64_t rows,
+                                       int64_t cols,
+                                       SeparableKernel kernel) {
+    const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= rows * cols) {
+        return;
+    }
+    const int64_t y = idx / cols;
+    const int64_t x = idx - y * cols;
+    const float* row_in = input + y * cols;
+    double temp = 0;
+    for (int i = -kernel.half_size; i <= kernel.half_size; i++) {
+        int64_t x_shift = min(max(x + i, int64_t(0)), cols - 1);
+        temp += row_in[x_shift] * kernel.coeff[i + kernel.half_size];
+    }
+    output[idx] = float(temp);
+}
+
+__global__ void FilterVerticalKernel(const float* input,
+                                     float* output,
+                                     int64_t rows,
+                                     int64_t cols,
+                                     SeparableKernel kernel) {
+    const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= rows * cols) {
+        return;
+    }
+    const int64_t y = idx / cols;
+    const int64_t x = idx - y * cols;
+    double temp = 0;
+    for (int i = -kernel.half_size; i <= kernel.half_size; i++) {
+        int64_t y_shift = min(max(y + i, int64_t(0)), rows - 1);
+        temp += input[y_shift * cols + x] *
+                kernel.coeff[i + kernel.half_size];
+    }
+    output[idx] = float(temp);
+}
+
+__global__ void DownsampleKernel(const float* input,
+                                 float* output,
+                                 int64_t cols,
+                                 int64_t half_rows,
+                                 int64_t half_cols) {
+    const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= half_rows * half_cols) {
+        return;
+    }
+    const int64_t y = idx / half_cols;
+    const int64_t x = idx - y * half_cols;
+    const float* row0 = input + (y * 2) * cols;
+    const float* row1 = input + (y * 2 + 1) * cols;
+    output[idx] = (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] +
+                   row1[x * 2 + 1]) /
+                  4.0f;
+}
+
+__global__ void ToFloatFromFloatKernel(const float* input,
+                                       float* output,
+                                       int64_t num_pixels,
+                                       float scale,
+                                       float trunc) {
+    const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= num_pixels) {
+        return;
+    }
+    float d = input[idx] / scale;
+    output[idx] = d >= trunc ? 0.0f : d;
+}
+
+__global__ void ToFloatFromUInt8Kernel(const uint8_t* input,
+                                       float* output,
+                                       int64_t num_pixels,
+                                       float scale,
+                                       float trunc) {
+    const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= num_pixels) {
+        return;
+    }
+    float d = float(input[idx]) / 255.0f / scale;
+    output[idx] = d >= trunc ? 0.0f : d;
+}
+
+SeparableKernel MakeKernel(std::initializer_list<float> coeffs) {
+    SeparableKernel kernel;
+    kernel.half_size = int(coeffs.size() / 2);
+    int i = 0;
+    for (float c : coeffs) {
+        kernel.coeff[i++] = c;
+    }
+    return kernel;
+}
+
+void GetSeparableKernels(ImageFilterType type,
+                         SeparableKernel& kernel_x,
+                         SeparableKernel& kernel_y) {
+    const SeparableKernel gaussian3 = MakeKernel({0.25f, 0.5f, 0.25f});
+    const SeparableKernel gaussian5 =
+            MakeKernel({0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f});
+    const SeparableKernel gaussian7 =
+            MakeKernel({0.03125f, 0.109375f, 0.21875f, 0.28125f, 0.21875f,
+                        0.109375f, 0.03125f});
+    const SeparableKernel sobel31 = MakeKernel({-1.0f, 0.0f, 1.0f});
+    const SeparableKernel sobel32 = MakeKernel({1.0f, 2.0f, 1.0f});
+    switch (type) {
+        case ImageFilterType::Gaussian3:
+            kernel_x = gaussian3;
+            kernel_y = gaussian3;
+            break;
+        case ImageFilterType::Gaussian5:
+            kernel_x = gaussian5;
+            kernel_y = gaussian5;
+            break;
+        case ImageFilterType::Gaussian7:
+            kernel_x = gaussian7;
+            kernel_y = gaussian7;
+            break;
+        case ImageFilterType::Sobel3Dx:
+            kernel_x = sobel31;
+            kernel_y = sobel32;
+            break;
+        case ImageFilterType::Sobel3Dy:
+            kernel_x = sobel32;
+            kernel_y = sobel31;
+            break;
+        default:
+            utility::LogError("ImageFilterCUDA: Unsupported filter type.");
+    }
+}
+
+int64_t NumBlocks(int64_t num_items) {
+    return (num_items + kThreadsPerBlock - 1) / kThreadsPerBlock;
+}
+
+}  // unnamed namespace
+
+void ImageFilterCUDA(const Tensor& src, Tensor& dst, ImageFilterType type) {
+    SeparableKernel kernel_x, kernel_y;
+    GetSeparableKernels(type, kernel_x, kernel_y);
+
+    const int64_t rows = src.GetShape()[0];
+    const int64_t cols = src.GetShape()[1];
+    Tensor temp(src.GetShape(), Dtype::Float32, src.GetDevice());
+    FilterHorizontalKernel<<<NumBlocks(rows * cols), kThreadsPerBlock>>>(
+            static_cast<const float*>(src.GetDataPtr()),
+            static_cast<float*>(temp.GetDataPtr()), rows, cols, kernel_x);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    FilterVerticalKernel<<<NumBlocks(rows * cols), kThreadsPerBlock>>>(
+            static_cast<const float*>(temp.GetDataPtr()),
+            static_cast<float*>(dst.GetDataPtr()), rows, cols, kernel_y);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+void ImageDownsampleCUDA(const Tensor& src, Tensor& dst) {
+    const int64_t cols = src.GetShape()[1];
+    const int64_t half_rows = dst.GetShape()[0];
+    const int64_t half_cols = dst.GetShape()[1];
+    DownsampleKernel<<<NumBlocks(half_rows * half_cols), kThreadsPerBlock>>>(
+            static_cast<const float*>(src.GetDataPtr()),
+            static_cast<float*>(dst.GetDataPtr()), cols, half_rows,
+            half_cols);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+void ImageToFloatCUDA(const Tensor& src, Tensor& dst, double scale,
+                      double trunc) {
+    const int64_t num_pixels = src.GetShape()[0] * src.GetShape()[1];
+    if (src.GetDtype() == Dtype::Float32) {
+        ToFloatFromFloatKernel<<<NumBlocks(num_pixels), kThreadsPerBlock>>>(
+                static_cast<const float*>(src.GetDataPtr()),
+                static_cast<float*>(dst.GetDataPtr()), num_pixels,
+                float(scale), float(trunc));
+    } else {
+        ToFloatFromUInt8Kernel<<<NumBlocks(num_pixels), kThreadsPerBlock>>>(
+                static_cast<const uint8_t*>(src.GetDataPtr()),
+                static_cast<float*>(dst.GetDataPtr()), num_pixels,
+                float(scale), float(trunc));
+    }
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -27,7 +27,10 @@
 #pragma once
 
 #include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/Gemm.h"
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/Sort.h"
 #include "open3d/core/kernel/UnaryEW.h"
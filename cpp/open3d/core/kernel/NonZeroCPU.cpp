@@ -24,54 +24,83 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "open3d/core/kernel/NonZero.h"
+#include <algorithm>
+#include <vector>
 
 #include "open3d/core/Indexer.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/NonZero.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
 Tensor NonZeroCPU(const Tensor& src) {
-    // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
-    const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t num_elements = src_contiguous.NumElements();
+
+    // Two-pass parallel selection over fixed-size chunks. Pass 1 counts
+    // the non-zeros in each chunk; an inclusive prefix sum over the
+    // counts then yields the position where each chunk's indices end in
+    // the output, so pass 2 can write all chunks concurrently without
+    // synchronization.
+    static constexpr int64_t kChunkSize = 1 << 15;
+    const int64_t num_chunks = (num_elements + kChunkSize - 1) / kChunkSize;
+    std::vector<int64_t> chunk_counts(num_chunks, 0);
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
-                });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t end = std::min(start + kChunkSize, num_elements);
+            int64_t count = 0;
+            for (int64_t i = start; i < end; ++i) {
+                if (static_cast<float>(src_ptr[i]) != 0) {
+                    ++count;
+                }
+            }
+            chunk_counts[chunk_idx] = count;
+        });
     });
 
-    // Transform flattend indices to indices in each dimension.
+    std::vector<int64_t> chunk_ends(num_chunks, 0);
+    if (num_chunks > 0) {
+        utility::InclusivePrefixSum(chunk_counts.data(),
+                                    chunk_counts.data() + num_chunks,
+                                    chunk_ends.data());
+    }
+    const int64_t num_non_zeros = num_chunks > 0 ? chunk_ends.back() : 0;
+
+    // Pass 2: gather the flattened indices, decomposed into per-dimension
+    // indices, directly into the result tensor.
     SizeVector shape = src.GetShape();
     const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
-
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
+    SizeVector result_shape{num_dims, num_non_zeros};
     Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    int64_t* result_ptr = static_cast<int64_t*>(result.GetDataPtr());
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
-        for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
-            non_zero_index = non_zero_index / shape[dim];
-        }
-    }
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t end = std::min(start + kChunkSize, num_elements);
+            int64_t offset = chunk_ends[chunk_idx] - chunk_counts[chunk_idx];
+            for (int64_t i = start; i < end; ++i) {
+                if (static_cast<float>(src_ptr[i]) != 0) {
+                    int64_t non_zero_index = i;
+                    for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
+                        result_ptr[dim * num_non_zeros + offset] =
+                                non_zero_index % shape[dim];
+                        non_zero_index = non_zero_index / shape[dim];
+                    }
+                    ++offset;
+                }
+            }
+        });
+    });
 
     return result;
 }
@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/NonZero.h"
 
+#include <thrust/count.h>
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
@@ -78,22 +79,24 @@ protected:
 Tensor NonZeroCUDA(const Tensor& src) {
     Tensor src_contiguous = src.Contiguous();
     const int64_t num_elements = src_contiguous.NumElements();
-    const int64_t num_bytes =
-            num_elements * DtypeUtil::ByteSize(src_contiguous.GetDtype());
 
     thrust::counting_iterator<int64_t> index_first(0);
     thrust::counting_iterator<int64_t> index_last = index_first + num_elements;
 
-    // Get flattened non-zero indices.
-    thrust::device_vector<int64_t> non_zero_indices(num_elements);
+    // Get flattened non-zero indices. A counting pass sizes the index
+    // buffer exactly, so the temporary no longer scales with the full
+    // tensor; copy_if then performs the device-side stream compaction
+    // (count + scan + scatter) in a single fused pass.
+    thrust::device_vector<int64_t> non_zero_indices;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
         thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
                 src_contiguous.GetBlob()->GetDataPtr()));
 
-        auto it = thrust::copy_if(index_first, index_last, src_ptr,
-                                  non_zero_indices.begin(),
-                                  NonZeroFunctor<scalar_t>());
-        non_zero_indices.resize(thrust::distance(non_zero_indices.begin(), it));
+        int64_t count = thrust::count_if(src_ptr, src_ptr + num_elements,
+                                         NonZeroFunctor<scalar_t>());
+        non_zero_indices.resize(count);
+        thrust::copy_if(index_first, index_last, src_ptr,
+                        non_zero_indices.begin(), NonZeroFunctor<scalar_t>());
     });
 
     // Transform flattend indices to indices in each dimension.
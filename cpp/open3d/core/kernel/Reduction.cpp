@@ -31,6 +31,18 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+namespace {
+bool s_deterministic_reduction_order = false;
+}  // unnamed namespace
+
+void SetDeterministicReductionOrder(bool deterministic) {
+    s_deterministic_reduction_order = deterministic;
+}
+
+bool GetDeterministicReductionOrder() {
+    return s_deterministic_reduction_order;
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
@@ -105,6 +117,169 @@ void Reduction(const Tensor& src,
     }
 }
 
+void ReductionWithIndices(const Tensor& src,
+                          Tensor& vals,
+                          Tensor& idxs,
+                          const SizeVector& dims,
+                          ReductionOpCode op_code) {
+    if (arg_reduce_ops.find(op_code) == arg_reduce_ops.end()) {
+        utility::LogError(
+                "ReductionWithIndices only supports ArgMin and ArgMax.");
+    }
+    // Like arg-reduction, dims can only contain one or all dimensions.
+    if (dims.size() != 1) {
+        std::vector<bool> seen_dims(src.NumDims(), false);
+        for (const int64_t& dim : dims) {
+            seen_dims[dim] = true;
+        }
+        if (!std::all_of(seen_dims.begin(), seen_dims.end(),
+                         [](bool seen) { return seen; })) {
+            utility::LogError(
+                    "Arg-reduction can only have 1 or all reduction "
+                    "dimensions. However, dims = {}.",
+                    dims);
+        }
+    }
+
+    SizeVector keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, true);
+    SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, false);
+    if (non_keepdim_shape != vals.GetShape()) {
+        utility::LogError("Expected vals shape {} but got {}.",
+                          non_keepdim_shape.ToString(),
+                          vals.GetShape().ToString());
+    }
+    if (non_keepdim_shape != idxs.GetShape()) {
+        utility::LogError("Expected idxs shape {} but got {}.",
+                          non_keepdim_shape.ToString(),
+                          idxs.GetShape().ToString());
+    }
+    if (vals.GetDtype() != src.GetDtype()) {
+        utility::LogError("Reduced values must have the input dtype.");
+    }
+    if (idxs.GetDtype() != Dtype::Int64) {
+        utility::LogError("Arg-reduction must have int64 output dtype.");
+    }
+    for (const Tensor& dst : {vals, idxs}) {
+        if (src.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    // Always reshape to keepdim case. This reshaping is copy-free.
+    vals = vals.Reshape(keepdim_shape);
+    idxs = idxs.Reshape(keepdim_shape);
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ReductionWithIndicesCPU(src, vals, idxs, dims, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ReductionWithIndicesCUDA(src, vals, idxs, dims, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    vals = vals.Reshape(non_keepdim_shape);
+    idxs = idxs.Reshape(non_keepdim_shape);
+}
+
+static void CheckMaskedReductionOutput(const Tensor& src,
+                                       const Tensor& dst,
+                                       Dtype dst_dtype) {
+    if (dst.GetShape() != SizeVector{}) {
+        utility::LogError(
+                "Masked reduction output must be a scalar, but got shape {}.",
+                dst.GetShape().ToString());
+    }
+    if (dst.GetDtype() != dst_dtype) {
+        utility::LogError("Masked reduction output must have dtype {}, "
+                          "but got {}.",
+                          DtypeUtil::ToString(dst_dtype),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (dst.GetDevice() != src.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+}
+
+static void CheckMaskedReductionMask(const Tensor& src, const Tensor& mask) {
+    if (mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("Mask must have Bool dtype, but got {}.",
+                          DtypeUtil::ToString(mask.GetDtype()));
+    }
+    if (mask.GetShape() != src.GetShape()) {
+        utility::LogError("Mask shape {} does not match tensor shape {}.",
+                          mask.GetShape().ToString(),
+                          src.GetShape().ToString());
+    }
+    if (mask.GetDevice() != src.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          src.GetDevice().ToString(),
+                          mask.GetDevice().ToString());
+    }
+}
+
+void MaskedSumCount(const Tensor& src,
+                    const Tensor& mask,
+                    Tensor& sum,
+                    Tensor& count) {
+    CheckMaskedReductionMask(src, mask);
+    CheckMaskedReductionOutput(src, sum, src.GetDtype());
+    CheckMaskedReductionOutput(src, count, Dtype::Int64);
+
+    // The kernels read both inputs as flat arrays; this copies only
+    // when a non-contiguous view is passed.
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MaskedSumCountCPU(src_contiguous, mask_contiguous, sum, count);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MaskedSumCountCUDA(src_contiguous, mask_contiguous, sum, count);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void MaskedMinMax(const Tensor& src,
+                  const Tensor& mask,
+                  Tensor& min,
+                  Tensor& max) {
+    CheckMaskedReductionMask(src, mask);
+    CheckMaskedReductionOutput(src, min, src.GetDtype());
+    CheckMaskedReductionOutput(src, max, src.GetDtype());
+
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MaskedMinMaxCPU(src_contiguous, mask_contiguous, min, max);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MaskedMinMaxCUDA(src_contiguous, mask_contiguous, min, max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
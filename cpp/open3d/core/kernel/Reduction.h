@@ -45,24 +45,107 @@ static const std::unordered_set<ReductionOpCode, utility::hash_enum_class>
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class>
         arg_reduce_ops = {ReductionOpCode::ArgMin, ReductionOpCode::ArgMax};
 
+/// \brief Selects a thread-count independent reduction order.
+///
+/// The default single-output CPU reduction accumulates one partial per
+/// thread, so floating point Sum/Prod results can differ between runs
+/// with different thread counts. With the deterministic order enabled,
+/// partials are instead accumulated over fixed-size chunks and combined
+/// in a fixed pairwise tree, making the result bitwise reproducible for
+/// any thread count at a small combining overhead.
+void SetDeterministicReductionOrder(bool deterministic);
+bool GetDeterministicReductionOrder();
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code);
 
+/// \brief Fused arg-reduction producing values and indices together.
+///
+/// Runs ArgMin or ArgMax over \p dims and writes both the reduced
+/// values and their int64 indices, so min+argmin style selection (e.g.
+/// nearest-neighbour lookup over a distance matrix) does not need a
+/// separate Min/Max pass over the input. \p vals must have the dtype of
+/// \p src, \p idxs must be Int64, and both must have the non-keepdim
+/// reduction shape.
+void ReductionWithIndices(const Tensor& src,
+                          Tensor& vals,
+                          Tensor& idxs,
+                          const SizeVector& dims,
+                          ReductionOpCode op_code);
+
+/// \brief Fused masked sum and selection count over all elements.
+///
+/// Accumulates the elements of \p src where \p mask is true directly
+/// into a scalar, so t.IndexGet({mask}).Sum(...) style chains do not
+/// materialize the gathered intermediate tensor. The number of selected
+/// elements comes out of the same pass (it is the divisor of
+/// Tensor::MaskedMean). \p mask must be Bool with the shape and device
+/// of \p src; \p sum must be a scalar of the dtype of \p src and
+/// \p count a scalar Int64.
+void MaskedSumCount(const Tensor& src,
+                    const Tensor& mask,
+                    Tensor& sum,
+                    Tensor& count);
+
+/// \brief Fused masked min and max over all elements.
+///
+/// Computes the minimum and the maximum of the elements of \p src where
+/// \p mask is true in a single pass, without materializing the gather.
+/// \p mask must be Bool with the shape and device of \p src; \p min and
+/// \p max must be scalars of the dtype of \p src. An empty selection is
+/// an error, like Min/Max on a zero-size Tensor.
+void MaskedMinMax(const Tensor& src,
+                  const Tensor& mask,
+                  Tensor& min,
+                  Tensor& max);
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code);
 
+void ReductionWithIndicesCPU(const Tensor& src,
+                             Tensor& vals,
+                             Tensor& idxs,
+                             const SizeVector& dims,
+                             ReductionOpCode op_code);
+
+void MaskedSumCountCPU(const Tensor& src,
+                       const Tensor& mask,
+                       Tensor& sum,
+                       Tensor& count);
+
+void MaskedMinMaxCPU(const Tensor& src,
+                     const Tensor& mask,
+                     Tensor& min,
+                     Tensor& max);
+
 #ifdef BUILD_CUDA_MODULE
 void ReductionCUDA(const Tensor& src,
                    Tensor& dst,
                    const SizeVector& dims,
                    bool keepdim,
                    ReductionOpCode op_code);
+
+void ReductionWithIndicesCUDA(const Tensor& src,
+                              Tensor& vals,
+                              Tensor& idxs,
+                              const SizeVector& dims,
+                              ReductionOpCode op_code);
+
+void MaskedSumCountCUDA(const Tensor& src,
+                        const Tensor& mask,
+                        Tensor& sum,
+                        Tensor& count);
+
+void MaskedMinMaxCUDA(const Tensor& src,
+                      const Tensor& mask,
+                      Tensor& min,
+                      Tensor& max);
 #endif
 
 }  // namespace kernel
@@ -88,12 +88,20 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
+        if (indexer_.NumOutputElements() <= 1 &&
+            GetDeterministicReductionOrder()) {
+            // Must be used for any thread count, including 1, so the
+            // accumulation order never changes.
+            LaunchReductionKernelTreeDeterministic<scalar_t>(
+                    indexer_, reduce_func, identity);
+        } else if (GetMaxThreads() == 1 || InParallel()) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
                                                    identity);
         } else {
+            // Each output element is reduced by one serial loop in a
+            // fixed order, so this path is deterministic already.
             LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
         }
     }
@@ -149,6 +157,60 @@ private:
         }
     }
 
+    /// Deterministic variant of the two-pass reduction: partials are
+    /// accumulated over fixed-size chunks and combined in a fixed
+    /// pairwise tree, so the result does not depend on the number of
+    /// threads.
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelTreeDeterministic(const Indexer& indexer,
+                                                       func_t element_kernel,
+                                                       scalar_t identity) {
+        if (indexer.NumOutputElements() > 1) {
+            utility::LogError(
+                    "Internal error: deterministic tree reduction only works "
+                    "for single-output reduction ops.");
+        }
+        // The chunk size is fixed, not derived from the thread count,
+        // so the accumulation order never changes.
+        static constexpr int64_t kChunkSize = 1 << 15;
+        int64_t num_workloads = indexer.NumWorkloads();
+        int64_t num_chunks = (num_workloads + kChunkSize - 1) / kChunkSize;
+        std::vector<scalar_t> chunk_results(num_chunks, identity);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t end = std::min(start + kChunkSize, num_workloads);
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                scalar_t* src = reinterpret_cast<scalar_t*>(
+                        indexer.GetInputPtr(0, workload_idx));
+                chunk_results[chunk_idx] =
+                        element_kernel(*src, chunk_results[chunk_idx]);
+            }
+        }
+
+        // Pairwise combine tree over the chunk partials; the pairing
+        // only depends on the chunk count.
+        for (int64_t width = num_chunks; width > 1;) {
+            int64_t half = (width + 1) / 2;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int64_t i = 0; i < width / 2; ++i) {
+                chunk_results[i] =
+                        element_kernel(chunk_results[i + half],
+                                       chunk_results[i]);
+            }
+            width = half;
+        }
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        *dst = element_kernel(
+                num_chunks == 0 ? identity : chunk_results[0], *dst);
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
                                            func_t element_kernel) {
@@ -224,6 +286,11 @@ public:
                 std::tie(*dst_idx, dst_val) =
                         reduce_func(src_idx, *src_val, *dst_idx, dst_val);
             }
+            // The second output receives the reduced value, so fused
+            // min+argmin style callers get it without a second pass.
+            scalar_t* dst_val_ptr = reinterpret_cast<scalar_t*>(
+                    sub_indexer.GetOutputPtr(1, 0));
+            *dst_val_ptr = dst_val;
         }
     }
 
@@ -322,6 +389,161 @@ void ReductionCPU(const Tensor& src,
     }
 }
 
+void ReductionWithIndicesCPU(const Tensor& src,
+                             Tensor& vals,
+                             Tensor& idxs,
+                             const SizeVector& dims,
+                             ReductionOpCode op_code) {
+    // Same engine as the arg-reduction branch of ReductionCPU, but the
+    // reduced values go to vals instead of a temporary accumulator, so
+    // values and indices come out of one pass over the input.
+    DtypePolicy dtype_policy = DtypePolicy::INPUT_SAME;
+    Indexer indexer({src}, {idxs, vals}, dtype_policy, dims);
+    CPUArgReductionEngine re(indexer);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (indexer.NumWorkloads() == 0) {
+            utility::LogError(
+                    "Zero-size Tensor does not suport ArgMin/ArgMax.");
+        }
+        scalar_t identity;
+        switch (op_code) {
+            case ReductionOpCode::ArgMin:
+                identity = std::numeric_limits<scalar_t>::max();
+                vals.Fill(identity);
+                re.Run(CPUArgMinReductionKernel<scalar_t>, identity);
+                break;
+            case ReductionOpCode::ArgMax:
+                identity = std::numeric_limits<scalar_t>::lowest();
+                vals.Fill(identity);
+                re.Run(CPUArgMaxReductionKernel<scalar_t>, identity);
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+/// Fixed-size chunk partials combined in index order, so the result
+/// never depends on the thread count (see
+/// LaunchReductionKernelTreeDeterministic).
+template <typename scalar_t>
+static void LaunchMaskedSumCountKernel(const scalar_t* src_ptr,
+                                       const bool* mask_ptr,
+                                       int64_t num_elements,
+                                       scalar_t* sum_ptr,
+                                       int64_t* count_ptr) {
+    static constexpr int64_t kChunkSize = 1 << 15;
+    int64_t num_chunks = (num_elements + kChunkSize - 1) / kChunkSize;
+    std::vector<scalar_t> chunk_sums(num_chunks, scalar_t(0));
+    std::vector<int64_t> chunk_counts(num_chunks, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        int64_t start = chunk_idx * kChunkSize;
+        int64_t end = std::min(start + kChunkSize, num_elements);
+        scalar_t chunk_sum = 0;
+        int64_t chunk_count = 0;
+        for (int64_t i = start; i < end; ++i) {
+            if (mask_ptr[i]) {
+                chunk_sum += src_ptr[i];
+                chunk_count++;
+            }
+        }
+        chunk_sums[chunk_idx] = chunk_sum;
+        chunk_counts[chunk_idx] = chunk_count;
+    }
+
+    scalar_t total_sum = 0;
+    int64_t total_count = 0;
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        total_sum += chunk_sums[chunk_idx];
+        total_count += chunk_counts[chunk_idx];
+    }
+    *sum_ptr = total_sum;
+    *count_ptr = total_count;
+}
+
+template <typename scalar_t>
+static void LaunchMaskedMinMaxKernel(const scalar_t* src_ptr,
+                                     const bool* mask_ptr,
+                                     int64_t num_elements,
+                                     scalar_t* min_ptr,
+                                     scalar_t* max_ptr) {
+    static constexpr int64_t kChunkSize = 1 << 15;
+    int64_t num_chunks = (num_elements + kChunkSize - 1) / kChunkSize;
+    std::vector<scalar_t> chunk_mins(num_chunks,
+                                     std::numeric_limits<scalar_t>::max());
+    std::vector<scalar_t> chunk_maxs(num_chunks,
+                                     std::numeric_limits<scalar_t>::lowest());
+    std::vector<int64_t> chunk_counts(num_chunks, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        int64_t start = chunk_idx * kChunkSize;
+        int64_t end = std::min(start + kChunkSize, num_elements);
+        scalar_t chunk_min = std::numeric_limits<scalar_t>::max();
+        scalar_t chunk_max = std::numeric_limits<scalar_t>::lowest();
+        int64_t chunk_count = 0;
+        for (int64_t i = start; i < end; ++i) {
+            if (mask_ptr[i]) {
+                chunk_min = std::min(chunk_min, src_ptr[i]);
+                chunk_max = std::max(chunk_max, src_ptr[i]);
+                chunk_count++;
+            }
+        }
+        chunk_mins[chunk_idx] = chunk_min;
+        chunk_maxs[chunk_idx] = chunk_max;
+        chunk_counts[chunk_idx] = chunk_count;
+    }
+
+    scalar_t total_min = std::numeric_limits<scalar_t>::max();
+    scalar_t total_max = std::numeric_limits<scalar_t>::lowest();
+    int64_t total_count = 0;
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        total_min = std::min(total_min, chunk_mins[chunk_idx]);
+        total_max = std::max(total_max, chunk_maxs[chunk_idx]);
+        total_count += chunk_counts[chunk_idx];
+    }
+    if (total_count == 0) {
+        utility::LogError("Empty selection does not suport Min/Max.");
+    }
+    *min_ptr = total_min;
+    *max_ptr = total_max;
+}
+
+void MaskedSumCountCPU(const Tensor& src,
+                       const Tensor& mask,
+                       Tensor& sum,
+                       Tensor& count) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        LaunchMaskedSumCountKernel(
+                static_cast<const scalar_t*>(src.GetDataPtr()),
+                static_cast<const bool*>(mask.GetDataPtr()),
+                src.NumElements(),
+                static_cast<scalar_t*>(sum.GetDataPtr()),
+                static_cast<int64_t*>(count.GetDataPtr()));
+    });
+}
+
+void MaskedMinMaxCPU(const Tensor& src,
+                     const Tensor& mask,
+                     Tensor& min,
+                     Tensor& max) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        LaunchMaskedMinMaxKernel(
+                static_cast<const scalar_t*>(src.GetDataPtr()),
+                static_cast<const bool*>(mask.GetDataPtr()),
+                src.NumElements(),
+                static_cast<scalar_t*>(min.GetDataPtr()),
+                static_cast<scalar_t*>(max.GetDataPtr()));
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -1098,6 +1098,204 @@ void ReductionCUDA(const Tensor& src,
     });
 }
 
+void ReductionWithIndicesCUDA(const Tensor& src,
+                              Tensor& vals,
+                              Tensor& idxs,
+                              const SizeVector& dims,
+                              ReductionOpCode op_code) {
+    // The reduce engine accumulates (value, index) pairs but only
+    // materializes the index output, so the values are currently
+    // produced by a second reduced pass with the same geometry.
+    ReductionCUDA(src, idxs, dims, true, op_code);
+    ReductionCUDA(src, vals, dims, true,
+                  op_code == ReductionOpCode::ArgMin ? ReductionOpCode::Min
+                                                     : ReductionOpCode::Max);
+}
+
+constexpr int kMaskedReductionThreads = 256;
+constexpr int64_t kMaskedReductionMaxBlocks = 1024;
+
+template <typename scalar_t>
+__global__ void MaskedSumCountKernel(const scalar_t* src,
+                                     const bool* mask,
+                                     int64_t num_elements,
+                                     scalar_t* block_sums,
+                                     int64_t* block_counts) {
+    __shared__ scalar_t shared_sums[kMaskedReductionThreads];
+    __shared__ int64_t shared_counts[kMaskedReductionThreads];
+    scalar_t thread_sum = 0;
+    int64_t thread_count = 0;
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+         i < num_elements; i += int64_t(gridDim.x) * blockDim.x) {
+        if (mask[i]) {
+            thread_sum += src[i];
+            thread_count++;
+        }
+    }
+    shared_sums[threadIdx.x] = thread_sum;
+    shared_counts[threadIdx.x] = thread_count;
+    __syncthreads();
+    for (int offset = blockDim.x / 2; offset > 0; offset >>= 1) {
+        if (int(threadIdx.x) < offset) {
+            shared_sums[threadIdx.x] += shared_sums[threadIdx.x + offset];
+            shared_counts[threadIdx.x] += shared_counts[threadIdx.x + offset];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        block_sums[blockIdx.x] = shared_sums[0];
+        block_counts[blockIdx.x] = shared_counts[0];
+    }
+}
+
+template <typename scalar_t>
+__global__ void MaskedMinMaxKernel(const scalar_t* src,
+                                   const bool* mask,
+                                   int64_t num_elements,
+                                   scalar_t identity_min,
+                                   scalar_t identity_max,
+                                   scalar_t* block_mins,
+                                   scalar_t* block_maxs,
+                                   int64_t* block_counts) {
+    __shared__ scalar_t shared_mins[kMaskedReductionThreads];
+    __shared__ scalar_t shared_maxs[kMaskedReductionThreads];
+    __shared__ int64_t shared_counts[kMaskedReductionThreads];
+    scalar_t thread_min = identity_min;
+    scalar_t thread_max = identity_max;
+    int64_t thread_count = 0;
+    for (int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+         i < num_elements; i += int64_t(gridDim.x) * blockDim.x) {
+        if (mask[i]) {
+            scalar_t v = src[i];
+            thread_min = v < thread_min ? v : thread_min;
+            thread_max = v > thread_max ? v : thread_max;
+            thread_count++;
+        }
+    }
+    shared_mins[threadIdx.x] = thread_min;
+    shared_maxs[threadIdx.x] = thread_max;
+    shared_counts[threadIdx.x] = thread_count;
+    __syncthreads();
+    for (int offset = blockDim.x / 2; offset > 0; offset >>= 1) {
+        if (int(threadIdx.x) < offset) {
+            scalar_t other_min = shared_mins[threadIdx.x + offset];
+            scalar_t other_max = shared_maxs[threadIdx.x + offset];
+            shared_mins[threadIdx.x] = other_min < shared_mins[threadIdx.x]
+                                               ? other_min
+                                               : shared_mins[threadIdx.x];
+            shared_maxs[threadIdx.x] = other_max > shared_maxs[threadIdx.x]
+                                               ? other_max
+                                               : shared_maxs[threadIdx.x];
+            shared_counts[threadIdx.x] += shared_counts[threadIdx.x + offset];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        block_mins[blockIdx.x] = shared_mins[0];
+        block_maxs[blockIdx.x] = shared_maxs[0];
+        block_counts[blockIdx.x] = shared_counts[0];
+    }
+}
+
+void MaskedSumCountCUDA(const Tensor& src,
+                        const Tensor& mask,
+                        Tensor& sum,
+                        Tensor& count) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    int64_t num_elements = src.NumElements();
+    int64_t num_blocks = std::min(
+            DivUp(num_elements, int64_t(kMaskedReductionThreads)),
+            kMaskedReductionMaxBlocks);
+    num_blocks = std::max(num_blocks, int64_t(1));
+    const Device cpu_device("CPU:0");
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        // Per-block partials; they are combined on the host in block
+        // order, so the grid geometry fixes the accumulation order.
+        Tensor block_sums({num_blocks}, src.GetDtype(), src.GetDevice());
+        Tensor block_counts({num_blocks}, Dtype::Int64, src.GetDevice());
+        MaskedSumCountKernel<scalar_t>
+                <<<num_blocks, kMaskedReductionThreads>>>(
+                        static_cast<const scalar_t*>(src.GetDataPtr()),
+                        static_cast<const bool*>(mask.GetDataPtr()),
+                        num_elements,
+                        static_cast<scalar_t*>(block_sums.GetDataPtr()),
+                        static_cast<int64_t*>(block_counts.GetDataPtr()));
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+        Tensor host_sums = block_sums.Copy(cpu_device);
+        Tensor host_counts = block_counts.Copy(cpu_device);
+        const scalar_t* sums_ptr =
+                static_cast<const scalar_t*>(host_sums.GetDataPtr());
+        const int64_t* counts_ptr =
+                static_cast<const int64_t*>(host_counts.GetDataPtr());
+        scalar_t total_sum = 0;
+        int64_t total_count = 0;
+        for (int64_t i = 0; i < num_blocks; ++i) {
+            total_sum += sums_ptr[i];
+            total_count += counts_ptr[i];
+        }
+        MemoryManager::MemcpyFromHost(sum.GetDataPtr(), sum.GetDevice(),
+                                      &total_sum, sizeof(scalar_t));
+        MemoryManager::MemcpyFromHost(count.GetDataPtr(), count.GetDevice(),
+                                      &total_count, sizeof(int64_t));
+    });
+}
+
+void MaskedMinMaxCUDA(const Tensor& src,
+                      const Tensor& mask,
+                      Tensor& min,
+                      Tensor& max) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    int64_t num_elements = src.NumElements();
+    int64_t num_blocks = std::min(
+            DivUp(num_elements, int64_t(kMaskedReductionThreads)),
+            kMaskedReductionMaxBlocks);
+    num_blocks = std::max(num_blocks, int64_t(1));
+    const Device cpu_device("CPU:0");
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        scalar_t identity_min = std::numeric_limits<scalar_t>::max();
+        scalar_t identity_max = std::numeric_limits<scalar_t>::lowest();
+        Tensor block_mins({num_blocks}, src.GetDtype(), src.GetDevice());
+        Tensor block_maxs({num_blocks}, src.GetDtype(), src.GetDevice());
+        Tensor block_counts({num_blocks}, Dtype::Int64, src.GetDevice());
+        MaskedMinMaxKernel<scalar_t><<<num_blocks, kMaskedReductionThreads>>>(
+                static_cast<const scalar_t*>(src.GetDataPtr()),
+                static_cast<const bool*>(mask.GetDataPtr()), num_elements,
+                identity_min, identity_max,
+                static_cast<scalar_t*>(block_mins.GetDataPtr()),
+                static_cast<scalar_t*>(block_maxs.GetDataPtr()),
+                static_cast<int64_t*>(block_counts.GetDataPtr()));
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+        Tensor host_mins = block_mins.Copy(cpu_device);
+        Tensor host_maxs = block_maxs.Copy(cpu_device);
+        Tensor host_counts = block_counts.Copy(cpu_device);
+        const scalar_t* mins_ptr =
+                static_cast<const scalar_t*>(host_mins.GetDataPtr());
+        const scalar_t* maxs_ptr =
+                static_cast<const scalar_t*>(host_maxs.GetDataPtr());
+        const int64_t* counts_ptr =
+                static_cast<const int64_t*>(host_counts.GetDataPtr());
+        scalar_t total_min = identity_min;
+        scalar_t total_max = identity_max;
+        int64_t total_count = 0;
+        for (int64_t i = 0; i < num_blocks; ++i) {
+            total_min = std::min(total_min, mins_ptr[i]);
+            total_max = std::max(total_max, maxs_ptr[i]);
+            total_count += counts_ptr[i];
+        }
+        if (total_count == 0) {
+            utility::LogError("Empty selection does not suport Min/Max.");
+        }
+        MemoryManager::MemcpyFromHost(min.GetDataPtr(), min.GetDevice(),
+                                      &total_min, sizeof(scalar_t));
+        MemoryManager::MemcpyFromHost(max.GetDataPtr(), max.GetDevice(),
+                                      &total_max, sizeof(scalar_t));
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void CheckSortOutputs(const Tensor& src,
+                             const Tensor& vals,
+                             const Tensor& idxs,
+                             const SizeVector& expected_shape) {
+    for (auto device :
+         std::vector<Device>({vals.GetDevice(), idxs.GetDevice()})) {
+        if (src.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(), device.ToString());
+        }
+    }
+    if (src.GetDtype() == Dtype::Bool) {
+        utility::LogError("Bool tensors are not supported.");
+    }
+    if (vals.GetDtype() != src.GetDtype()) {
+        utility::LogError("vals must have the same dtype as src, {} != {}.",
+                          DtypeUtil::ToString(vals.GetDtype()),
+                          DtypeUtil::ToString(src.GetDtype()));
+    }
+    if (idxs.GetDtype() != Dtype::Int64) {
+        utility::LogError("idxs must have Int64 dtype, but {} was used.",
+                          DtypeUtil::ToString(idxs.GetDtype()));
+    }
+    if (vals.GetShape() != expected_shape ||
+        idxs.GetShape() != expected_shape) {
+        utility::LogError(
+                "Expected output shape {}, but got vals shape {} and idxs "
+                "shape {}.",
+                expected_shape, vals.GetShape(), idxs.GetShape());
+    }
+}
+
+void Sort(const Tensor& src, Tensor& vals, Tensor& idxs, bool descending) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Sort needs at least one dimension.");
+    }
+    CheckSortOutputs(src, vals, idxs, src.GetShape());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SortCPU(src, vals, idxs, descending);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SortCUDA(src, vals, idxs, descending);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Sort: Unimplemented device");
+    }
+}
+
+Tensor Unique(const Tensor& src) {
+    if (src.NumDims() != 1) {
+        utility::LogError("Unique only supports 1-D tensors, but src has {} "
+                          "dims.",
+                          src.NumDims());
+    }
+    if (src.GetDtype() == Dtype::Bool) {
+        utility::LogError("Bool tensors are not supported.");
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return UniqueCPU(src);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return UniqueCUDA(src);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unique: Unimplemented device");
+    }
+}
+
+void TopK(const Tensor& src,
+          Tensor& vals,
+          Tensor& idxs,
+          int64_t k,
+          bool largest) {
+    if (src.NumDims() == 0) {
+        utility::LogError("TopK needs at least one dimension.");
+    }
+    int64_t last_dim_size = src.GetShape().back();
+    if (k < 0 || k > last_dim_size) {
+        utility::LogError("k must be in [0, {}], but got {}.", last_dim_size,
+                          k);
+    }
+    SizeVector expected_shape = src.GetShape();
+    expected_shape.back() = k;
+    CheckSortOutputs(src, vals, idxs, expected_shape);
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        TopKCPU(src, vals, idxs, k, largest);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        TopKCUDA(src, vals, idxs, k, largest);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("TopK: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable-sorts src along its last dimension.
+///
+/// \param src Input tensor with at least one dimension and a non-Bool
+/// dtype.
+/// \param vals Output tensor of the sorted values; must have the same
+/// shape, dtype and device as src.
+/// \param idxs Output Int64 tensor of the same shape as src, receiving
+/// for each output element its index along the last dimension of src.
+/// \param descending If true, sorts from largest to smallest.
+void Sort(const Tensor& src, Tensor& vals, Tensor& idxs, bool descending);
+
+void SortCPU(const Tensor& src, Tensor& vals, Tensor& idxs, bool descending);
+
+/// Returns the sorted unique values of a 1-D tensor.
+Tensor Unique(const Tensor& src);
+
+Tensor UniqueCPU(const Tensor& src);
+
+/// Selects the k largest (or smallest) values along the last dimension
+/// of src, in sorted order.
+///
+/// \param src Input tensor with at least one dimension and a non-Bool
+/// dtype.
+/// \param vals Output tensor shaped like src with the last dimension
+/// replaced by k; same dtype and device as src.
+/// \param idxs Output Int64 tensor of the same shape as vals, receiving
+/// the index of each selected value along the last dimension of src.
+/// \param k Number of values to select, 0 <= k <= src last dim size.
+/// \param largest If true, selects the largest values, else the smallest.
+void TopK(const Tensor& src, Tensor& vals, Tensor& idxs, int64_t k,
+          bool largest);
+
+void TopKCPU(const Tensor& src, Tensor& vals, Tensor& idxs, int64_t k,
+             bool largest);
+
+#ifdef BUILD_CUDA_MODULE
+void SortCUDA(const Tensor& src, Tensor& vals, Tensor& idxs, bool descending);
+
+Tensor UniqueCUDA(const Tensor& src);
+
+void TopKCUDA(const Tensor& src, Tensor& vals, Tensor& idxs, int64_t k,
+              bool largest);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
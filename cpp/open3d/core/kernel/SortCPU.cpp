@@ -0,0 +1,270 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable-sorts a permutation of a single row by value. The row is split
+/// into one span per thread; the spans are sorted in parallel and then
+/// combined with rounds of pairwise merges, also run in parallel, so a
+/// single large row still uses all cores.
+template <typename scalar_t>
+static void CPUSortRowKernel(const scalar_t* src,
+                             scalar_t* vals,
+                             int64_t* idxs,
+                             int64_t n,
+                             bool descending) {
+    auto comp = [src, descending](int64_t lhs, int64_t rhs) {
+        return descending ? src[rhs] < src[lhs] : src[lhs] < src[rhs];
+    };
+
+    std::vector<int64_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    int64_t num_threads = GetMaxThreads();
+    int64_t span = (n + num_threads - 1) / num_threads;
+    int64_t num_spans = (n + span - 1) / span;
+    CPULauncher::LaunchGeneralKernel(num_spans, [&](int64_t span_idx) {
+        int64_t start = span_idx * span;
+        int64_t end = std::min(start + span, n);
+        std::stable_sort(perm.begin() + start, perm.begin() + end, comp);
+    });
+
+    std::vector<int64_t> merge_buffer(n);
+    int64_t* in = perm.data();
+    int64_t* out = merge_buffer.data();
+    for (int64_t width = span; width < n; width *= 2) {
+        int64_t num_pairs = (n + 2 * width - 1) / (2 * width);
+        CPULauncher::LaunchGeneralKernel(num_pairs, [&](int64_t pair_idx) {
+            int64_t lo = pair_idx * 2 * width;
+            int64_t mid = std::min(lo + width, n);
+            int64_t hi = std::min(lo + 2 * width, n);
+            std::merge(in + lo, in + mid, in + mid, in + hi, out + lo, comp);
+        });
+        std::swap(in, out);
+    }
+
+    CPULauncher::LaunchGeneralKernel(n, [&](int64_t i) {
+        vals[i] = src[in[i]];
+        idxs[i] = in[i];
+    });
+}
+
+void SortCPU(const Tensor& src, Tensor& vals, Tensor& idxs, bool descending) {
+    Tensor src_conti = src.Contiguous();
+    int64_t n = src.GetShape().back();
+    int64_t num_rows = n == 0 ? 0 : src.NumElements() / n;
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_conti.GetDataPtr());
+        scalar_t* vals_ptr = static_cast<scalar_t*>(vals.GetDataPtr());
+        int64_t* idxs_ptr = static_cast<int64_t*>(idxs.GetDataPtr());
+        if (num_rows == 1) {
+            CPUSortRowKernel(src_ptr, vals_ptr, idxs_ptr, n, descending);
+        } else {
+            // Many independent rows: one row per workload.
+            CPULauncher::LaunchGeneralKernel(num_rows, [&](int64_t row) {
+                const scalar_t* row_src = src_ptr + row * n;
+                auto comp = [row_src, descending](int64_t lhs, int64_t rhs) {
+                    return descending ? row_src[rhs] < row_src[lhs]
+                                      : row_src[lhs] < row_src[rhs];
+                };
+                std::vector<int64_t> perm(n);
+                std::iota(perm.begin(), perm.end(), 0);
+                std::stable_sort(perm.begin(), perm.end(), comp);
+                for (int64_t i = 0; i < n; ++i) {
+                    vals_ptr[row * n + i] = row_src[perm[i]];
+                    idxs_ptr[row * n + i] = perm[i];
+                }
+            });
+        }
+    });
+}
+
+Tensor UniqueCPU(const Tensor& src) {
+    const int64_t n = src.NumElements();
+    Tensor sorted_vals({n}, src.GetDtype(), src.GetDevice());
+    Tensor sorted_idxs({n}, Dtype::Int64, src.GetDevice());
+    if (n > 0) {
+        SortCPU(src, sorted_vals, sorted_idxs, /*descending=*/false);
+    }
+
+    // Compact the first occurrence of each run of equal values, using the
+    // same chunked count + prefix sum + gather scheme as NonZeroCPU.
+    static constexpr int64_t kChunkSize = 1 << 15;
+    const int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+    std::vector<int64_t> chunk_counts(num_chunks, 0);
+    std::vector<int64_t> chunk_ends(num_chunks, 0);
+    Tensor result;
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* vals_ptr =
+                static_cast<const scalar_t*>(sorted_vals.GetDataPtr());
+        auto is_first = [vals_ptr](int64_t i) {
+            return i == 0 || vals_ptr[i] != vals_ptr[i - 1];
+        };
+        CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t end = std::min(start + kChunkSize, n);
+            int64_t count = 0;
+            for (int64_t i = start; i < end; ++i) {
+                count += is_first(i) ? 1 : 0;
+            }
+            chunk_counts[chunk_idx] = count;
+        });
+        if (num_chunks > 0) {
+            utility::InclusivePrefixSum(chunk_counts.data(),
+                                        chunk_counts.data() + num_chunks,
+                                        chunk_ends.data());
+        }
+        const int64_t num_unique = num_chunks > 0 ? chunk_ends.back() : 0;
+
+        result = Tensor({num_unique}, src.GetDtype(), src.GetDevice());
+        scalar_t* result_ptr = static_cast<scalar_t*>(result.GetDataPtr());
+        CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t end = std::min(start + kChunkSize, n);
+            int64_t offset = chunk_ends[chunk_idx] - chunk_counts[chunk_idx];
+            for (int64_t i = start; i < end; ++i) {
+                if (is_first(i)) {
+                    result_ptr[offset++] = vals_ptr[i];
+                }
+            }
+        });
+    });
+    return result;
+}
+
+void TopKCPU(const Tensor& src,
+             Tensor& vals,
+             Tensor& idxs,
+             int64_t k,
+             bool largest) {
+    Tensor src_conti = src.Contiguous();
+    int64_t n = src.GetShape().back();
+    int64_t num_rows = n == 0 ? 0 : src.NumElements() / n;
+    if (k == 0) {
+        return;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_conti.GetDataPtr());
+        scalar_t* vals_ptr = static_cast<scalar_t*>(vals.GetDataPtr());
+        int64_t* idxs_ptr = static_cast<int64_t*>(idxs.GetDataPtr());
+
+        // Ties are broken by the smaller index so the selection matches a
+        // stable full sort.
+        auto select_row = [&](const scalar_t* row_src, int64_t* first,
+                              int64_t* last, int64_t* middle) {
+            auto comp = [row_src, largest](int64_t lhs, int64_t rhs) {
+                if (row_src[lhs] != row_src[rhs]) {
+                    return largest ? row_src[rhs] < row_src[lhs]
+                                   : row_src[lhs] < row_src[rhs];
+                }
+                return lhs < rhs;
+            };
+            std::partial_sort(first, middle, last, comp);
+        };
+
+        if (num_rows == 1) {
+            // A single large row: each chunk selects its own top-k
+            // candidates in parallel, then the final selection runs on
+            // the num_chunks * k candidates only.
+            int64_t num_threads = GetMaxThreads();
+            int64_t span = (n + num_threads - 1) / num_threads;
+            int64_t num_spans = (n + span - 1) / span;
+            std::vector<int64_t> candidates;
+            if (num_spans > 1 && num_spans * k < n) {
+                std::vector<int64_t> span_candidates(num_spans * k);
+                CPULauncher::LaunchGeneralKernel(
+                        num_spans, [&](int64_t span_idx) {
+                            int64_t start = span_idx * span;
+                            int64_t end = std::min(start + span, n);
+                            int64_t count = std::min(k, end - start);
+                            std::vector<int64_t> perm(end - start);
+                            std::iota(perm.begin(), perm.end(), start);
+                            select_row(src_ptr, perm.data(),
+                                       perm.data() + perm.size(),
+                                       perm.data() + count);
+                            // Pad with the last selected candidate so the
+                            // buffer stays rectangular; duplicates are
+                            // removed by the final selection reading only
+                            // the first k.
+                            for (int64_t i = 0; i < k; ++i) {
+                                span_candidates[span_idx * k + i] =
+                                        perm[std::min(i, count - 1)];
+                            }
+                        });
+                // Deduplicate padded entries while keeping order stable.
+                std::sort(span_candidates.begin(), span_candidates.end());
+                span_candidates.erase(std::unique(span_candidates.begin(),
+                                                  span_candidates.end()),
+                                      span_candidates.end());
+                candidates = std::move(span_candidates);
+            } else {
+                candidates.resize(n);
+                std::iota(candidates.begin(), candidates.end(), 0);
+            }
+            select_row(src_ptr, candidates.data(),
+                       candidates.data() + candidates.size(),
+                       candidates.data() + k);
+            for (int64_t i = 0; i < k; ++i) {
+                vals_ptr[i] = src_ptr[candidates[i]];
+                idxs_ptr[i] = candidates[i];
+            }
+        } else {
+            // Many independent rows: one row per workload.
+            CPULauncher::LaunchGeneralKernel(num_rows, [&](int64_t row) {
+                const scalar_t* row_src = src_ptr + row * n;
+                std::vector<int64_t> perm(n);
+                std::iota(perm.begin(), perm.end(), 0);
+                select_row(row_src, perm.data(), perm.data() + n,
+                           perm.data() + k);
+                for (int64_t i = 0; i < k; ++i) {
+                    vals_ptr[row * k + i] = row_src[perm[i]];
+                    idxs_ptr[row * k + i] = perm[i];
+                }
+            });
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -82,6 +82,62 @@ static void CPUAbsElementKernel(const void* src, void* dst) {
             std::abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
 }
 
+// Contiguous kernels process a whole span through raw typed pointers,
+// so the compiler can vectorize the inner loop.
+template <typename scalar_t>
+static void CPUSqrtContiguousKernel(const scalar_t* src,
+                                    scalar_t* dst,
+                                    int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+    }
+}
+
+template <typename scalar_t>
+static void CPUSinContiguousKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+    }
+}
+
+template <typename scalar_t>
+static void CPUCosContiguousKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+    }
+}
+
+template <typename scalar_t>
+static void CPUNegContiguousKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(-src[i]);
+    }
+}
+
+template <typename scalar_t>
+static void CPUExpContiguousKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+    }
+}
+
+template <typename scalar_t>
+static void CPUAbsContiguousKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(std::abs(static_cast<double>(src[i])));
+    }
+}
+
 template <typename src_t, typename dst_t>
 static void CPULogicalNotElementKernel(const void* src, void* dst) {
     *static_cast<dst_t*>(dst) = static_cast<dst_t>(
@@ -143,6 +199,68 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                         "same type as the input.");
             }
         });
+    } else if (src.IsContiguous() && dst.IsContiguous() &&
+               src.GetShape() == dst.GetShape() && src_dtype == dst_dtype) {
+        // Contiguous fast path: hand whole spans to SIMD inner loops
+        // instead of per-element Indexer pointer arithmetic.
+        int64_t n = src.GetShape().NumElements();
+        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+            const scalar_t* src_ptr =
+                    static_cast<const scalar_t*>(src.GetDataPtr());
+            scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+            switch (op_code) {
+                case UnaryEWOpCode::Sqrt:
+                    assert_dtype_is_float(src_dtype);
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUSqrtContiguousKernel(src_ptr + start,
+                                                        dst_ptr + start,
+                                                        count);
+                            });
+                    break;
+                case UnaryEWOpCode::Sin:
+                    assert_dtype_is_float(src_dtype);
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUSinContiguousKernel(src_ptr + start,
+                                                       dst_ptr + start, count);
+                            });
+                    break;
+                case UnaryEWOpCode::Cos:
+                    assert_dtype_is_float(src_dtype);
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUCosContiguousKernel(src_ptr + start,
+                                                       dst_ptr + start, count);
+                            });
+                    break;
+                case UnaryEWOpCode::Neg:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUNegContiguousKernel(src_ptr + start,
+                                                       dst_ptr + start, count);
+                            });
+                    break;
+                case UnaryEWOpCode::Exp:
+                    assert_dtype_is_float(src_dtype);
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUExpContiguousKernel(src_ptr + start,
+                                                       dst_ptr + start, count);
+                            });
+                    break;
+                case UnaryEWOpCode::Abs:
+                    CPULauncher::LaunchContiguousEWKernel(
+                            n, [&](int64_t start, int64_t count) {
+                                CPUAbsContiguousKernel(src_ptr + start,
+                                                       dst_ptr + start, count);
+                            });
+                    break;
+                default:
+                    utility::LogError("Unimplemented op_code for UnaryEWCPU");
+                    break;
+            }
+        });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
@@ -28,10 +28,12 @@
 
 #include <Eigen/Eigenvalues>
 
+#include "open3d/geometry/FixedRadiusSearch.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -334,31 +336,89 @@ namespace geometry {
 
 void PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
-        bool fast_normal_computation /* = true */) {
+        bool fast_normal_computation /* = true */,
+        int num_threads /* = 0 */) {
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
     bool has_normal = HasNormals();
     if (!has_normal) {
         normals_.resize(points_.size());
     }
+    auto assign_normal = [&](int i, const std::vector<int> &indices,
+                             int num_neighbors) {
+        Eigen::Vector3d normal;
+        if (num_neighbors >= 3) {
+            normal = ComputeNormal(*this, indices, fast_normal_computation);
+            if (normal.norm() == 0.0) {
+                if (has_normal) {
+                    normal = normals_[i];
+                } else {
+                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                }
+            }
+            if (has_normal && normal.dot(normals_[i]) < 0.0) {
+                normal *= -1.0;
+            }
+            normals_[i] = normal;
+        } else {
+            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+        }
+    };
+    if (search_param.GetSearchType() ==
+        KDTreeSearchParam::SearchType::Radius) {
+        // All queries share one radius; the hash grid builds in linear
+        // time and answers them faster than the k-d tree.
+        const auto &radius_param =
+                (const KDTreeSearchParamRadius &)search_param;
+        FixedRadiusSearch grid(points_, radius_param.radius_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < (int)points_.size(); i++) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            assign_normal(i, indices,
+                          grid.SearchRadius(points_[i], indices, distance2));
+        }
+        return;
+    }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)points_.size(); i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        assign_normal(i, indices,
+                      kdtree.Search(points_[i], search_param, indices,
+                                    distance2));
+    }
+}
+
+void PointCloud::EstimateNormalsIncremental(
+        const KDTreeFlann &kdtree,
+        size_t start_index,
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    if (start_index > points_.size()) {
+        utility::LogError(
+                "[EstimateNormalsIncremental] start_index exceeds the number "
+                "of points.");
+    }
+    // Normals of points before start_index are preserved; new entries are
+    // value-initialized and filled below.
+    normals_.resize(points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = (int)start_index; i < (int)points_.size(); i++) {
         std::vector<int> indices;
         std::vector<double> distance2;
         Eigen::Vector3d normal;
         if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
             normal = ComputeNormal(*this, indices, fast_normal_computation);
             if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
+                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
             }
             normals_[i] = normal;
         } else {
@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/FixedRadiusSearch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Spatial hashing function for integer voxel coordinates (same scheme
+/// as the hash grid of the ML fixed radius search).
+inline size_t SpatialHash(int x, int y, int z) {
+    return size_t(x) * 73856096 ^ size_t(y) * 193649663 ^
+           size_t(z) * 83492791;
+}
+
+inline size_t CellOf(const double *pos,
+                     double inv_voxel_size,
+                     size_t num_cells) {
+    int x = int(std::floor(pos[0] * inv_voxel_size));
+    int y = int(std::floor(pos[1] * inv_voxel_size));
+    int z = int(std::floor(pos[2] * inv_voxel_size));
+    return SpatialHash(x, y, z) % num_cells;
+}
+
+}  // unnamed namespace
+
+FixedRadiusSearch::FixedRadiusSearch(const std::vector<Eigen::Vector3d> &points,
+                                     double radius) {
+    SetGeometry(points, radius);
+}
+
+bool FixedRadiusSearch::SetGeometry(const std::vector<Eigen::Vector3d> &points,
+                                    double radius) {
+    if (radius <= 0.0) {
+        utility::LogWarning(
+                "[FixedRadiusSearch::SetGeometry] radius must be positive.");
+        return false;
+    }
+    const size_t num_points = points.size();
+    radius_ = radius;
+    inv_voxel_size_ = 1.0 / (2.0 * radius);
+    // Load factor 1: with voxels of 2 * radius most occupied cells hold
+    // few points and collisions only add false candidates, not errors.
+    num_cells_ = std::max<size_t>(num_points, 1);
+
+    data_.resize(3 * num_points);
+    if (num_points > 0) {
+        std::memcpy(data_.data(), points[0].data(),
+                    sizeof(Eigen::Vector3d) * num_points);
+    }
+
+    // Count the points of each cell, turn the counts into CSR offsets,
+    // then scatter the point indices; the counting and scatter passes
+    // are parallel with atomic per-cell cursors.
+    std::vector<std::atomic<uint32_t>> counts(num_cells_);
+    for (auto &count : counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(num_points); i++) {
+        size_t cell = CellOf(&data_[3 * i], inv_voxel_size_, num_cells_);
+        counts[cell].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    cell_splits_.resize(num_cells_ + 1);
+    uint32_t sum = 0;
+    for (size_t c = 0; c < num_cells_; c++) {
+        cell_splits_[c] = sum;
+        sum += counts[c].load(std::memory_order_relaxed);
+        counts[c].store(cell_splits_[c], std::memory_order_relaxed);
+    }
+    cell_splits_[num_cells_] = sum;
+
+    cell_index_.resize(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(num_points); i++) {
+        size_t cell = CellOf(&data_[3 * i], inv_voxel_size_, num_cells_);
+        cell_index_[counts[cell].fetch_add(1, std::memory_order_relaxed)] =
+                uint32_t(i);
+    }
+    return true;
+}
+
+int FixedRadiusSearch::SearchRadius(const Eigen::Vector3d &query,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (cell_index_.empty()) {
+        return 0;
+    }
+    // The query ball spans at most two voxels per axis, so the center
+    // cell plus the cells of the eight ball corners cover it.
+    size_t cells[9];
+    int num_unique = 0;
+    auto add_cell = [&](const Eigen::Vector3d &pos) {
+        size_t cell = CellOf(pos.data(), inv_voxel_size_, num_cells_);
+        for (int i = 0; i < num_unique; i++) {
+            if (cells[i] == cell) {
+                return;
+            }
+        }
+        cells[num_unique++] = cell;
+    };
+    add_cell(query);
+    for (int dz = -1; dz <= 1; dz += 2) {
+        for (int dy = -1; dy <= 1; dy += 2) {
+            for (int dx = -1; dx <= 1; dx += 2) {
+                add_cell(query + radius_ * Eigen::Vector3d(dx, dy, dz));
+            }
+        }
+    }
+
+    const double threshold = radius_ * radius_;
+    for (int c = 0; c < num_unique; c++) {
+        for (uint32_t j = cell_splits_[cells[c]];
+             j < cell_splits_[cells[c] + 1]; j++) {
+            uint32_t idx = cell_index_[j];
+            const double *p = &data_[3 * idx];
+            double dx = p[0] - query(0);
+            double dy = p[1] - query(1);
+            double dz = p[2] - query(2);
+            double dist2 = dx * dx + dy * dy + dz * dz;
+            if (dist2 <= threshold) {
+                indices.push_back(int(idx));
+                distance2.push_back(dist2);
+            }
+        }
+    }
+    return int(indices.size());
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class FixedRadiusSearch
+///
+/// \brief Spatial hash grid for repeated radius searches with a radius
+/// known up front.
+///
+/// The points are binned into a hash table of voxels with edge length
+/// 2 * radius, so a query ball overlaps at most eight voxels and a
+/// search is a scan over their points. For the dense queries of normal
+/// estimation or DBSCAN (one search per point, same radius) this is
+/// several times faster than KDTreeFlann::SearchRadius and the grid
+/// builds in linear time. The same hash-grid scheme backs the fixed
+/// radius search of the ML ops; this class provides it to the geometry
+/// pipelines without the ML layer. Unlike a k-d tree the grid only
+/// answers queries with the radius it was built for.
+class FixedRadiusSearch {
+public:
+    /// \brief Default Constructor.
+    FixedRadiusSearch() = default;
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points The points to index.
+    /// \param radius The search radius the grid is built for.
+    FixedRadiusSearch(const std::vector<Eigen::Vector3d> &points,
+                      double radius);
+    FixedRadiusSearch(const FixedRadiusSearch &) = delete;
+    FixedRadiusSearch &operator=(const FixedRadiusSearch &) = delete;
+
+    /// \brief Builds the grid over \p points for searches with
+    /// \p radius. The points are copied; the cloud may be freed or
+    /// modified afterwards.
+    bool SetGeometry(const std::vector<Eigen::Vector3d> &points,
+                     double radius);
+
+    /// The radius the grid was built for.
+    double GetRadius() const { return radius_; }
+
+    /// \brief Finds all indexed points within GetRadius() of \p query.
+    ///
+    /// Same output convention as KDTreeFlann::SearchRadius: returns the
+    /// number of neighbors and fills \p indices and the squared
+    /// distances \p distance2. The neighbor order is the grid order,
+    /// not sorted by distance.
+    int SearchRadius(const Eigen::Vector3d &query,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+private:
+    std::vector<double> data_;
+    double radius_ = 0.0;
+    double inv_voxel_size_ = 0.0;
+    size_t num_cells_ = 0;
+    /// CSR layout of the hash table: cell c holds the points
+    /// cell_index_[cell_splits_[c] .. cell_splits_[c + 1]).
+    std::vector<uint32_t> cell_splits_;
+    std::vector<uint32_t> cell_index_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
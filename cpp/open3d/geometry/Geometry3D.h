@@ -97,6 +97,38 @@ public:
 
     virtual Geometry3D& Rotate(const Eigen::Matrix3d& R);
 
+    /// \brief Attribute groups tracked for incremental render updates.
+    ///
+    /// Values combine as a bitmask in MarkRenderAttributesChanged().
+    enum RenderAttributes {
+        RenderAttributePoints = 1 << 0,
+        RenderAttributeNormals = 1 << 1,
+        RenderAttributeColors = 1 << 2,
+        RenderAttributeTopology = 1 << 3,
+    };
+
+    /// \brief Narrows the next renderer re-upload to the given attributes.
+    ///
+    /// Callers that mutate the geometry in place (e.g. recoloring a subset
+    /// of points) can call this before Visualizer::UpdateGeometry(); the
+    /// renderers then refresh only the flagged vertex buffers. Without a
+    /// mark everything is treated as changed, so code unaware of the
+    /// mechanism keeps full re-uploads.
+    ///
+    /// \param attribute_mask Bitwise OR of RenderAttributes values.
+    void MarkRenderAttributesChanged(int attribute_mask) const {
+        render_attributes_changed_ |= attribute_mask;
+    }
+
+    /// Returns the accumulated attribute change mask and clears it. 0 means
+    /// nothing was marked, and the caller must assume everything changed.
+    /// Consumed by the visualization renderers.
+    int ConsumeRenderAttributesChanged() const {
+        int attribute_mask = render_attributes_changed_;
+        render_attributes_changed_ = 0;
+        return attribute_mask;
+    }
+
     /// Get Rotation Matrix from XYZ RotationType.
     static Eigen::Matrix3d GetRotationMatrixFromXYZ(
             const Eigen::Vector3d& rotation);
@@ -192,6 +224,11 @@ protected:
     /// \param normals A list of normals to be transformed.
     void RotateNormals(const Eigen::Matrix3d& R,
                        std::vector<Eigen::Vector3d>& normals) const;
+
+private:
+    /// Bitmask of RenderAttributes marked changed since the last consume.
+    /// Mutable because renderers hold the geometry by const reference.
+    mutable int render_attributes_changed_ = 0;
 };
 
 }  // namespace geometry
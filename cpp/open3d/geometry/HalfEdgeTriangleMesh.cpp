@@ -27,6 +27,8 @@
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 
 #include "open3d/utility/Console.h"
@@ -171,96 +173,136 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
+    // Collect half edges. Each triangle contributes three half-edges at
+    // fixed positions, so the flat half-edge array can be filled in
+    // parallel without any edge map.
+    const int num_triangles = int(mesh_cpy->triangles_.size());
+    const int num_half_edges = num_triangles * 3;
+    het_mesh->half_edges_.resize(num_half_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int triangle_index = 0; triangle_index < num_triangles;
+         triangle_index++) {
         const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
-        }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
+        int he_0_index = triangle_index * 3;
+        het_mesh->half_edges_[he_0_index] =
+                HalfEdge(Eigen::Vector2i(triangle(0), triangle(1)),
+                         triangle_index, he_0_index + 1, -1);
+        het_mesh->half_edges_[he_0_index + 1] =
+                HalfEdge(Eigen::Vector2i(triangle(1), triangle(2)),
+                         triangle_index, he_0_index + 2, -1);
+        het_mesh->half_edges_[he_0_index + 2] =
+                HalfEdge(Eigen::Vector2i(triangle(2), triangle(0)),
+                         triangle_index, he_0_index, -1);
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+    // Match twin half-edges via a sorted edge array instead of a hash map
+    // keyed by vertex pairs. Both orientations of an edge map to the same
+    // 64-bit key, so after sorting, the half-edges of an undirected edge
+    // are adjacent and each group can be resolved independently.
+    std::vector<std::pair<uint64_t, int>> edge_keys(num_half_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int he_index = 0; he_index < num_half_edges; he_index++) {
+        const Eigen::Vector2i &vis =
+                het_mesh->half_edges_[he_index].vertex_indices_;
+        uint64_t lo = uint64_t(std::min(vis(0), vis(1)));
+        uint64_t hi = uint64_t(std::max(vis(0), vis(1)));
+        edge_keys[he_index] = std::make_pair((lo << 32) | hi, he_index);
+    }
+    std::sort(edge_keys.begin(), edge_keys.end());
+
+    bool has_duplicated_half_edges = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int kidx = 0; kidx < num_half_edges; kidx++) {
+        // Only process the first entry of each group of equal keys.
+        if (kidx > 0 && edge_keys[kidx].first == edge_keys[kidx - 1].first) {
+            continue;
+        }
+        int group_end = kidx + 1;
+        while (group_end < num_half_edges &&
+               edge_keys[group_end].first == edge_keys[kidx].first) {
+            group_end++;
+        }
+        if (group_end - kidx == 1) {
+            // Boundary edge, twin stays -1.
+            continue;
         }
+        int he_0_index = edge_keys[kidx].second;
+        int he_1_index = edge_keys[kidx + 1].second;
+        HalfEdge &he_0 = het_mesh->half_edges_[he_0_index];
+        HalfEdge &he_1 = het_mesh->half_edges_[he_1_index];
+        if (group_end - kidx > 2 ||
+            he_0.vertex_indices_(0) == he_1.vertex_indices_(0)) {
+            // More than two half-edges on an undirected edge always repeat
+            // an orientation; two with the same orientation are duplicates.
+            has_duplicated_half_edges = true;
+            continue;
+        }
+        he_0.twin_ = he_1_index;
+        he_1.twin_ = he_0_index;
+    }
+    if (has_duplicated_half_edges) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
     }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
+    // Get out-going half-edges from each vertex with a counting sort over
+    // the source vertices. This can be done during half-edge construction.
+    // Done here for readability.
+    std::vector<int> half_edges_from_vertex_offsets(
+            mesh_cpy->vertices_.size() + 1, 0);
+    for (int he_index = 0; he_index < num_half_edges; he_index++) {
+        half_edges_from_vertex_offsets
+                [het_mesh->half_edges_[he_index].vertex_indices_(0) + 1]++;
+    }
+    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
+         vertex_index++) {
+        half_edges_from_vertex_offsets[vertex_index + 1] +=
+                half_edges_from_vertex_offsets[vertex_index];
+    }
+    std::vector<int> half_edges_from_vertex(num_half_edges);
+    std::vector<int> cursor(half_edges_from_vertex_offsets.begin(),
+                            half_edges_from_vertex_offsets.end() - 1);
+    for (int he_index = 0; he_index < num_half_edges; he_index++) {
         int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+                het_mesh->half_edges_[he_index].vertex_indices_(0);
+        half_edges_from_vertex[cursor[src_vertex_index]++] = he_index;
     }
 
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
+    // Each vertex only reads the (now immutable) half-edges and writes its
+    // own list, so the traversals run in parallel.
     het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
+    bool has_invalid_vertices = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vertex_index = 0; vertex_index < int(mesh_cpy->vertices_.size());
          vertex_index++) {
         size_t num_boundaries = 0;
         int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
+        for (int oidx = half_edges_from_vertex_offsets[vertex_index];
+             oidx < half_edges_from_vertex_offsets[vertex_index + 1]; ++oidx) {
+            int half_edge_index = half_edges_from_vertex[oidx];
             if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
                 num_boundaries++;
                 init_half_edge_index = half_edge_index;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+            has_invalid_vertices = true;
+            continue;
         }
         // If there is a boundary edge, start from that; otherwise start
         // with any half-edge (default 0) started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge_index = half_edges_from_vertex
+                    [half_edges_from_vertex_offsets[vertex_index]];
         }
 
         // Push edges to ordered_half_edge_from_vertex_.
@@ -278,6 +320,9 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
             curr_he_index = next_next_twin_he_index;
         }
     }
+    if (has_invalid_vertices) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+    }
 
     mesh_cpy->ComputeVertexNormals();
     het_mesh->vertices_ = mesh_cpy->vertices_;
@@ -145,69 +145,150 @@ Image &Image::LinearTransform(double scale, double offset /* = 0.0*/) {
     return *this;
 }
 
-std::shared_ptr<Image> Image::Downsample() const {
-    auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Downsample] Unsupported image format.");
-    }
-    int half_width = (int)floor((double)width_ / 2.0);
-    int half_height = (int)floor((double)height_ / 2.0);
-    output->Prepare(half_width, half_height, 1, 4);
+namespace {
 
+/// In-place kernels behind Downsample, FilterHorizontal, and the separable
+/// Filter. They assume a prepared single channel float input and write into
+/// \p output, preparing it to the right dimensions; the public entry points
+/// and the pyramid workspace share them so pyramid levels can be refilled
+/// without allocating. The inner loops run over whole rows with unit-stride
+/// accesses and vectorize.
+void DownsampleInPlace(const Image &input, Image &output) {
+    int half_width = (int)floor((double)input.width_ / 2.0);
+    int half_height = (int)floor((double)input.height_ / 2.0);
+    output.Prepare(half_width, half_height, 1, 4);
+
+    const float *input_data = (const float *)input.data_.data();
+    float *output_data = (float *)output.data_.data();
 #ifdef _OPENMP
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
 #endif
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+    for (int y = 0; y < output.height_; y++) {
+        const float *row0 = input_data + (y * 2) * input.width_;
+        const float *row1 = input_data + (y * 2 + 1) * input.width_;
+        float *row_out = output_data + y * half_width;
+        for (int x = 0; x < half_width; x++) {
+            row_out[x] = (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] +
+                          row1[x * 2 + 1]) /
+                         4.0f;
         }
     }
-    return output;
 }
 
-std::shared_ptr<Image> Image::FilterHorizontal(
-        const std::vector<double> &kernel) const {
-    auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
-        kernel.size() % 2 != 1) {
-        utility::LogError(
-                "[FilterHorizontal] Unsupported image format or kernel "
-                "size.");
-    }
-    output->Prepare(width_, height_, 1, 4);
+void FilterHorizontalInPlace(const Image &input,
+                             const std::vector<double> &kernel,
+                             Image &output) {
+    output.Prepare(input.width_, input.height_, 1, 4);
 
+    const int width = input.width_;
+    const int height = input.height_;
     const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
+    std::vector<float> kernel_f(kernel.begin(), kernel.end());
 
+    const float *input_data = (const float *)input.data_.data();
+    float *output_data = (float *)output.data_.data();
 #ifdef _OPENMP
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
 #endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
+    for (int y = 0; y < height; y++) {
+        const float *row_in = input_data + y * width;
+        float *row_out = output_data + y * width;
+        auto filter_clamped = [&](int x) {
             double temp = 0;
             for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
                 int x_shift = x + i;
                 if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
+                if (x_shift > width - 1) x_shift = width - 1;
+                temp += row_in[x_shift] * kernel_f[i + half_kernel_size];
+            }
+            row_out[x] = (float)temp;
+        };
+        int x_begin = std::min(half_kernel_size, width);
+        int x_end = std::max(width - half_kernel_size, x_begin);
+        for (int x = 0; x < x_begin; x++) {
+            filter_clamped(x);
+        }
+        // Interior pixels need no boundary clamping; the branch-free
+        // unit-stride loop vectorizes.
+        for (int x = x_begin; x < x_end; x++) {
+            double temp = 0;
+            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
+                temp += row_in[x + i] * kernel_f[i + half_kernel_size];
+            }
+            row_out[x] = (float)temp;
+        }
+        for (int x = x_end; x < width; x++) {
+            filter_clamped(x);
+        }
+    }
+}
+
+/// Applies a 1D kernel along the columns. Together with
+/// FilterHorizontalInPlace this forms the separable filter without the two
+/// transposes of the former implementation.
+void FilterVerticalInPlace(const Image &input,
+                           const std::vector<double> &kernel,
+                           Image &output) {
+    output.Prepare(input.width_, input.height_, 1, 4);
+
+    const int width = input.width_;
+    const int height = input.height_;
+    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
+    std::vector<float> kernel_f(kernel.begin(), kernel.end());
+
+    const float *input_data = (const float *)input.data_.data();
+    float *output_data = (float *)output.data_.data();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Row accumulator in double, matching the accumulation precision of
+        // the horizontal pass; reused across the rows of this thread.
+        std::vector<double> acc(width);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < height; y++) {
+            std::fill(acc.begin(), acc.end(), 0.0);
+            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
+                int y_shift = y + i;
+                if (y_shift < 0) y_shift = 0;
+                if (y_shift > height - 1) y_shift = height - 1;
+                const float *row_in = input_data + y_shift * width;
+                const float k = kernel_f[i + half_kernel_size];
+                for (int x = 0; x < width; x++) {
+                    acc[x] += row_in[x] * k;
+                }
+            }
+            float *row_out = output_data + y * width;
+            for (int x = 0; x < width; x++) {
+                row_out[x] = (float)acc[x];
             }
-            *po = (float)temp;
         }
     }
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<Image> Image::Downsample() const {
+    auto output = std::make_shared<Image>();
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
+        utility::LogError("[Downsample] Unsupported image format.");
+    }
+    DownsampleInPlace(*this, *output);
+    return output;
+}
+
+std::shared_ptr<Image> Image::FilterHorizontal(
+        const std::vector<double> &kernel) const {
+    auto output = std::make_shared<Image>();
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
+        kernel.size() % 2 != 1) {
+        utility::LogError(
+                "[FilterHorizontal] Unsupported image format or kernel "
+                "size.");
+    }
+    FilterHorizontalInPlace(*this, kernel, *output);
     return output;
 }
 
@@ -257,11 +338,42 @@ std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
         utility::LogError("[Filter] Unsupported image format.");
     }
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+    Image temp;
+    FilterHorizontalInPlace(*this, dx, temp);
+    FilterVerticalInPlace(temp, dy, *output);
+    return output;
+}
+
+ImagePyramid Image::CreatePyramid(size_t num_of_levels,
+                                  ImagePyramidWorkspace &workspace,
+                                  bool with_gaussian_filter /* = true*/) const {
+    if ((num_of_channels_ != 1) || (bytes_per_channel_ != 4)) {
+        utility::LogError("[CreateImagePyramid] Unsupported image format.");
+    }
+
+    workspace.levels_.resize(num_of_levels);
+    for (size_t i = 0; i < num_of_levels; i++) {
+        if (workspace.levels_[i] == nullptr) {
+            workspace.levels_[i] = std::make_shared<Image>();
+        }
+        if (i == 0) {
+            // Buffer assignment reuses the existing capacity when the
+            // dimensions are unchanged from the previous frame.
+            *workspace.levels_[i] = *this;
+        } else {
+            const Image &prev = *workspace.levels_[i - 1];
+            if (with_gaussian_filter) {
+                // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
+                FilterHorizontalInPlace(prev, Gaussian3, workspace.temp_);
+                FilterVerticalInPlace(workspace.temp_, Gaussian3,
+                                      workspace.blurred_);
+                DownsampleInPlace(workspace.blurred_, *workspace.levels_[i]);
+            } else {
+                DownsampleInPlace(prev, *workspace.levels_[i]);
+            }
+        }
+    }
+    return workspace.levels_;
 }
 
 std::shared_ptr<Image> Image::Transpose() const {
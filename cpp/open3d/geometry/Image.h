@@ -42,6 +42,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class ImagePyramidWorkspace;
 
 /// Typedef and functions for ImagePyramid.
 typedef std::vector<std::shared_ptr<Image>> ImagePyramid;
@@ -220,6 +221,15 @@ public:
     ImagePyramid CreatePyramid(size_t num_of_levels,
                                bool with_gaussian_filter = true) const;
 
+    /// \brief Function to create an image pyramid into reusable buffers.
+    ///
+    /// Same as CreatePyramid, but fills the levels of \p workspace in place
+    /// instead of allocating new images, which avoids the per-frame
+    /// allocation churn when pyramids are rebuilt every frame.
+    ImagePyramid CreatePyramid(size_t num_of_levels,
+                               ImagePyramidWorkspace &workspace,
+                               bool with_gaussian_filter = true) const;
+
     /// Function to create a depthmap boundary mask from depth image.
     std::shared_ptr<Image> CreateDepthBoundaryMask(
             double depth_threshold_for_discontinuity_check = 0.1,
@@ -243,5 +253,26 @@ public:
     std::vector<uint8_t> data_;
 };
 
+/// \class ImagePyramidWorkspace
+///
+/// \brief Reusable buffers for Image::CreatePyramid.
+///
+/// CreatePyramid allocates one Image per level per call. Loops that build
+/// pyramids for every frame (e.g. RGBD odometry) can hand the same
+/// workspace to consecutive calls instead; the level and scratch buffers
+/// are then allocated for the first frame only and refilled in place
+/// afterwards, as long as the source image dimensions do not change. The
+/// pyramid returned from such a call shares its buffers with the
+/// workspace and is overwritten by the next call.
+class ImagePyramidWorkspace {
+public:
+    /// Pyramid levels, filled by Image::CreatePyramid.
+    ImagePyramid levels_;
+    /// Scratch image for the horizontal blur pass between levels.
+    Image temp_;
+    /// Scratch image for the blurred level before downsampling.
+    Image blurred_;
+};
+
 }  // namespace geometry
 }  // namespace open3d
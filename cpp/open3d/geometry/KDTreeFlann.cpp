@@ -186,6 +186,106 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+int KDTreeFlann::SearchKNNBatch(const Eigen::MatrixXd &queries,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    // flann_index_->knnSearch() only reads the index, so partitioning the
+    // query columns across threads is safe; each query writes a disjoint
+    // knn-sized slice of the caller-provided flat buffers.
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    const int num_queries = (int)queries.cols();
+    indices.resize((size_t)num_queries * knn);
+    distance2.resize((size_t)num_queries * knn);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_queries; i++) {
+        flann::Matrix<double> query_flann((double *)queries.col(i).data(), 1,
+                                          dimension_);
+        int *indices_ptr = indices.data() + (size_t)i * knn;
+        double *dists_ptr = distance2.data() + (size_t)i * knn;
+        flann::Matrix<int> indices_flann(indices_ptr, 1, knn);
+        flann::Matrix<double> dists_flann(dists_ptr, 1, knn);
+        int k = flann_index_->knnSearch(query_flann, indices_flann,
+                                        dists_flann, knn,
+                                        flann::SearchParams(-1, 0.0));
+        for (int j = k; j < knn; j++) {
+            indices_ptr[j] = -1;
+            dists_ptr[j] = 0.0;
+        }
+    }
+    return num_queries;
+}
+
+bool KDTreeFlann::SaveIndex(const std::string &filename) const {
+    if (data_.empty() || flann_index_ == nullptr) {
+        utility::LogWarning("[KDTreeFlann::SaveIndex] No index to save.");
+        return false;
+    }
+    FILE *file = fopen(filename.c_str(), "wb");
+    if (file == nullptr) {
+        utility::LogWarning("[KDTreeFlann::SaveIndex] Cannot open file {}.",
+                            filename);
+        return false;
+    }
+    // Dataset header: dimension and size, followed by the raw doubles. The
+    // FLANN index structure references this dataset and is stored next to it.
+    uint64_t dimension = dimension_;
+    uint64_t dataset_size = dataset_size_;
+    bool ok = fwrite(&dimension, sizeof(uint64_t), 1, file) == 1 &&
+              fwrite(&dataset_size, sizeof(uint64_t), 1, file) == 1 &&
+              fwrite(data_.data(), sizeof(double), data_.size(), file) ==
+                      data_.size();
+    fclose(file);
+    if (!ok) {
+        utility::LogWarning("[KDTreeFlann::SaveIndex] Write to {} failed.",
+                            filename);
+        return false;
+    }
+    flann_index_->save(filename + ".flann");
+    return true;
+}
+
+bool KDTreeFlann::LoadIndex(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        utility::LogWarning("[KDTreeFlann::LoadIndex] Cannot open file {}.",
+                            filename);
+        return false;
+    }
+    uint64_t dimension = 0;
+    uint64_t dataset_size = 0;
+    if (fread(&dimension, sizeof(uint64_t), 1, file) != 1 ||
+        fread(&dataset_size, sizeof(uint64_t), 1, file) != 1 ||
+        dimension == 0 || dataset_size == 0) {
+        utility::LogWarning("[KDTreeFlann::LoadIndex] Corrupt header in {}.",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    data_.resize(dimension * dataset_size);
+    if (fread(data_.data(), sizeof(double), data_.size(), file) !=
+        data_.size()) {
+        utility::LogWarning("[KDTreeFlann::LoadIndex] Corrupt dataset in {}.",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    dimension_ = dimension;
+    dataset_size_ = dataset_size;
+    flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
+                                                   dataset_size_, dimension_));
+    // Attach the serialized index instead of rebuilding it.
+    flann_index_.reset(new flann::Index<flann::L2<double>>(
+            *flann_dataset_, flann::SavedIndexParams(filename + ".flann")));
+    return true;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "open3d/geometry/Geometry.h"
@@ -111,6 +112,43 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Thread-safe batched KNN search.
+    ///
+    /// Answers all queries in one call, partitioning them across threads
+    /// internally. Results are written into the caller-provided flat buffers
+    /// at offset query_index * knn, so no per-query allocation takes place;
+    /// unused result slots (when fewer than \p knn neighbors exist) are set
+    /// to -1. Queries only read the index, so this is safe to call
+    /// concurrently with other searches on the same tree.
+    ///
+    /// \param queries Query points, one per column (dimension x num_queries).
+    /// \param knn Number of neighbors per query.
+    /// \param indices Output buffer of size num_queries * knn.
+    /// \param distance2 Output buffer of size num_queries * knn.
+    /// \return The number of queries answered, or -1 on invalid input.
+    int SearchKNNBatch(const Eigen::MatrixXd &queries,
+                       int knn,
+                       std::vector<int> &indices,
+                       std::vector<double> &distance2) const;
+
+    /// \brief Saves the dataset and the built FLANN index to disk.
+    ///
+    /// Writes the raw dataset to \p filename and the FLANN index structure to
+    /// \p filename + ".flann", so a later LoadIndex skips the index build
+    /// entirely.
+    ///
+    /// \param filename Path of the output file.
+    bool SaveIndex(const std::string &filename) const;
+
+    /// \brief Restores a KDTree previously written with SaveIndex.
+    ///
+    /// Loads the dataset from \p filename and attaches the serialized FLANN
+    /// index from \p filename + ".flann" without rebuilding it, turning
+    /// multi-minute cold starts on large reference maps into a file read.
+    ///
+    /// \param filename Path of the file written by SaveIndex.
+    bool LoadIndex(const std::string &filename);
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
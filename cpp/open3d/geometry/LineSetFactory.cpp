@@ -40,20 +40,29 @@ std::shared_ptr<LineSet> LineSet::CreateFromPointCloudCorrespondences(
         const PointCloud &cloud1,
         const std::vector<std::pair<int, int>> &correspondences) {
     auto lineset_ptr = std::make_shared<LineSet>();
-    size_t point0_size = cloud0.points_.size();
-    size_t point1_size = cloud1.points_.size();
+    int64_t point0_size = int64_t(cloud0.points_.size());
+    int64_t point1_size = int64_t(cloud1.points_.size());
     lineset_ptr->points_.resize(point0_size + point1_size);
-    for (size_t i = 0; i < point0_size; i++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < point0_size; i++)
         lineset_ptr->points_[i] = cloud0.points_[i];
-    for (size_t i = 0; i < point1_size; i++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < point1_size; i++)
         lineset_ptr->points_[point0_size + i] = cloud1.points_[i];
 
-    size_t corr_size = correspondences.size();
+    int64_t corr_size = int64_t(correspondences.size());
     lineset_ptr->lines_.resize(corr_size);
-    for (size_t i = 0; i < corr_size; i++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < corr_size; i++)
         lineset_ptr->lines_[i] =
                 Eigen::Vector2i(correspondences[i].first,
-                                point0_size + correspondences[i].second);
+                                int(point0_size) + correspondences[i].second);
     return lineset_ptr;
 }
 
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <functional>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+LinearOctree LinearOctree::FromOctree(const Octree &octree) {
+    LinearOctree linear;
+    linear.origin_ = octree.origin_;
+    linear.size_ = octree.size_;
+    if (octree.root_node_ == nullptr) {
+        return linear;
+    }
+    // Depth-first flatten; children of a node are appended after it so the
+    // array is laid out in traversal order.
+    std::function<int32_t(const std::shared_ptr<OctreeNode> &, uint64_t,
+                          uint32_t)>
+            flatten = [&](const std::shared_ptr<OctreeNode> &node,
+                          uint64_t code, uint32_t depth) -> int32_t {
+        int32_t node_index = (int32_t)linear.nodes_.size();
+        linear.nodes_.emplace_back();
+        linear.nodes_[node_index].code_ = code;
+        linear.nodes_[node_index].depth_ = depth;
+        if (auto leaf =
+                    std::dynamic_pointer_cast<OctreeColorLeafNode>(node)) {
+            linear.nodes_[node_index].is_leaf_ = true;
+            linear.nodes_[node_index].color_ = leaf->color_;
+        } else if (std::dynamic_pointer_cast<OctreeLeafNode>(node)) {
+            linear.nodes_[node_index].is_leaf_ = true;
+        } else if (auto internal =
+                           std::dynamic_pointer_cast<OctreeInternalNode>(
+                                   node)) {
+            for (size_t cid = 0; cid < 8; cid++) {
+                if (internal->children_[cid] != nullptr) {
+                    int32_t child_index =
+                            flatten(internal->children_[cid],
+                                    (code << 3) | (uint64_t)cid, depth + 1);
+                    linear.nodes_[node_index].children_[cid] = child_index;
+                }
+            }
+        }
+        return node_index;
+    };
+    flatten(octree.root_node_, 0, 0);
+    return linear;
+}
+
+int LinearOctree::Locate(const Eigen::Vector3d &point) const {
+    if (nodes_.empty() || size_ <= 0.0 ||
+        !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    int current = 0;
+    Eigen::Vector3d node_origin = origin_;
+    double node_size = size_;
+    while (true) {
+        const LinearOctreeNode &node = nodes_[current];
+        if (node.is_leaf_) {
+            return current;
+        }
+        double child_size = node_size / 2.0;
+        size_t x_index = point(0) < node_origin(0) + child_size ? 0 : 1;
+        size_t y_index = point(1) < node_origin(1) + child_size ? 0 : 1;
+        size_t z_index = point(2) < node_origin(2) + child_size ? 0 : 1;
+        size_t child_index = x_index + y_index * 2 + z_index * 4;
+        if (node.children_[child_index] < 0) {
+            return current;
+        }
+        node_origin += Eigen::Vector3d(x_index * child_size,
+                                       y_index * child_size,
+                                       z_index * child_size);
+        node_size = child_size;
+        current = node.children_[child_index];
+    }
+}
+
+std::vector<int> LinearOctree::QueryBox(const Eigen::Vector3d &box_min,
+                                        const Eigen::Vector3d &box_max) const {
+    std::vector<int> hits;
+    if (nodes_.empty()) {
+        return hits;
+    }
+    // Iterative DFS over the flat array with explicit cell bounds.
+    struct Entry {
+        int index;
+        Eigen::Vector3d origin;
+        double size;
+    };
+    std::vector<Entry> stack;
+    stack.push_back({0, origin_, size_});
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+        const Eigen::Vector3d cell_max =
+                entry.origin + Eigen::Vector3d::Constant(entry.size);
+        if ((entry.origin.array() > box_max.array()).any() ||
+            (cell_max.array() < box_min.array()).any()) {
+            continue;
+        }
+        const LinearOctreeNode &node = nodes_[entry.index];
+        if (node.is_leaf_) {
+            hits.push_back(entry.index);
+            continue;
+        }
+        double child_size = entry.size / 2.0;
+        for (size_t cid = 0; cid < 8; cid++) {
+            if (node.children_[cid] < 0) continue;
+            Eigen::Vector3d child_origin =
+                    entry.origin +
+                    Eigen::Vector3d((cid & 1) * child_size,
+                                    ((cid >> 1) & 1) * child_size,
+                                    ((cid >> 2) & 1) * child_size);
+            stack.push_back({node.children_[cid], child_origin, child_size});
+        }
+    }
+    return hits;
+}
+
+Eigen::Vector3d LinearOctree::GetNodeOrigin(
+        const LinearOctreeNode &node) const {
+    Eigen::Vector3d node_origin = origin_;
+    double node_size = size_;
+    for (uint32_t level = 0; level < node.depth_; level++) {
+        node_size /= 2.0;
+        uint64_t cid = (node.code_ >> (3 * (node.depth_ - level - 1))) & 7;
+        node_origin += Eigen::Vector3d((cid & 1) * node_size,
+                                       ((cid >> 1) & 1) * node_size,
+                                       ((cid >> 2) & 1) * node_size);
+    }
+    return node_origin;
+}
+
+double LinearOctree::GetNodeSize(const LinearOctreeNode &node) const {
+    return size_ / double(uint64_t(1) << node.depth_);
+}
+
+}  // namespace geometry
+}  // namespace open3d
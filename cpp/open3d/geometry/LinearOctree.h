@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class Octree;
+
+/// \class LinearOctreeNode
+///
+/// \brief One node of a LinearOctree, stored by value in a flat array.
+struct LinearOctreeNode {
+    /// Morton path code from the root (3 bits per level, most significant
+    /// group first).
+    uint64_t code_ = 0;
+    /// Depth of the node; the root has depth 0.
+    uint32_t depth_ = 0;
+    /// Indices of the children in the node array; -1 if absent. Child
+    /// ordering matches OctreeInternalNode (x + 2y + 4z).
+    int32_t children_[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+    /// True for leaf nodes.
+    bool is_leaf_ = false;
+    /// Color payload carried over from OctreeColorLeafNode leaves.
+    Eigen::Vector3d color_ = Eigen::Vector3d(0, 0, 0);
+};
+
+/// \class LinearOctree
+///
+/// \brief Flat, cache-friendly octree representation keyed by Morton code.
+///
+/// Nodes live in one contiguous array in depth-first order, so
+/// traversal-heavy workloads (frustum culling, LOD streaming) walk linear
+/// memory instead of chasing shared_ptr children. The structure is immutable
+/// after construction and all queries are const, so any number of reader
+/// threads may traverse it concurrently without locking.
+class LinearOctree {
+public:
+    LinearOctree() {}
+
+    /// \brief Flattens an existing pointer-based Octree.
+    ///
+    /// \param octree Source octree; color leaf payloads are preserved.
+    static LinearOctree FromOctree(const Octree &octree);
+
+    /// Returns the number of nodes.
+    size_t size() const { return nodes_.size(); }
+    /// Returns `true` if the octree contains no nodes.
+    bool IsEmpty() const { return nodes_.empty(); }
+    /// Returns the node array.
+    const std::vector<LinearOctreeNode> &GetNodes() const { return nodes_; }
+
+    /// \brief Locates the deepest node containing \p point.
+    ///
+    /// \return Index into the node array, or -1 if the point is out of bound.
+    int Locate(const Eigen::Vector3d &point) const;
+
+    /// \brief Collects the leaf nodes whose cells intersect the axis-aligned
+    /// box [\p box_min, \p box_max].
+    ///
+    /// \return Indices into the node array.
+    std::vector<int> QueryBox(const Eigen::Vector3d &box_min,
+                              const Eigen::Vector3d &box_max) const;
+
+    /// Returns the origin of a node's cell.
+    Eigen::Vector3d GetNodeOrigin(const LinearOctreeNode &node) const;
+    /// Returns the edge length of a node's cell.
+    double GetNodeSize(const LinearOctreeNode &node) const;
+
+    /// Global min bound of the octree.
+    Eigen::Vector3d origin_ = Eigen::Vector3d(0, 0, 0);
+    /// Outer bounding edge length of the octree.
+    double size_ = 0.0;
+
+private:
+    std::vector<LinearOctreeNode> nodes_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
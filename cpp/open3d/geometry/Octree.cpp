@@ -30,6 +30,7 @@
 #include <json/json.h>
 #include <Eigen/Dense>
 #include <algorithm>
+#include <numeric>
 #include <unordered_map>
 
 #include "open3d/geometry/PointCloud.h"
@@ -419,6 +420,99 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
     }
 }
 
+void Octree::ConvertFromPointCloudBulk(const geometry::PointCloud& point_cloud,
+                                       double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    // A 64-bit Morton code holds 21 bits per axis.
+    if (max_depth_ > 21) {
+        ConvertFromPointCloud(point_cloud, size_expand);
+        return;
+    }
+
+    // Set bounds (identical to ConvertFromPointCloud)
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+    if (point_cloud.points_.empty()) {
+        return;
+    }
+    bool has_colors = point_cloud.HasColors();
+
+    // Compute a Morton code per point at leaf resolution. Each 3-bit group,
+    // read from the most significant end, is the child index (x + 2y + 4z)
+    // on the path from the root to the point's leaf.
+    const uint64_t grid_size = uint64_t(1) << max_depth_;
+    const double inv_leaf_size = double(grid_size) / size_;
+    std::vector<uint64_t> codes(point_cloud.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)point_cloud.points_.size(); i++) {
+        Eigen::Array3d rel =
+                (point_cloud.points_[i].array() - origin_.array()) *
+                inv_leaf_size;
+        uint64_t code = 0;
+        uint64_t ix = std::min(uint64_t(std::max(rel(0), 0.0)), grid_size - 1);
+        uint64_t iy = std::min(uint64_t(std::max(rel(1), 0.0)), grid_size - 1);
+        uint64_t iz = std::min(uint64_t(std::max(rel(2), 0.0)), grid_size - 1);
+        for (size_t bit = 0; bit < max_depth_; bit++) {
+            code |= (((ix >> bit) & 1) << (3 * bit)) |
+                    (((iy >> bit) & 1) << (3 * bit + 1)) |
+                    (((iz >> bit) & 1) << (3 * bit + 2));
+        }
+        codes[i] = code;
+    }
+    std::vector<size_t> order(codes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&codes](size_t a, size_t b) {
+        return codes[a] < codes[b];
+    });
+
+    // Build the tree over contiguous code ranges; every node is created
+    // exactly once.
+    std::function<std::shared_ptr<OctreeNode>(size_t, size_t, size_t)> build =
+            [&](size_t begin, size_t end,
+                size_t depth) -> std::shared_ptr<OctreeNode> {
+        if (depth == max_depth_) {
+            auto leaf = OctreeColorLeafNode::GetInitFunction()();
+            for (size_t i = begin; i < end; i++) {
+                size_t pidx = order[i];
+                OctreeColorLeafNode::GetUpdateFunction(
+                        has_colors ? point_cloud.colors_[pidx]
+                                   : Eigen::Vector3d::Zero())(leaf);
+            }
+            return leaf;
+        }
+        auto internal_node = std::make_shared<OctreeInternalNode>();
+        const size_t shift = 3 * (max_depth_ - depth - 1);
+        size_t child_begin = begin;
+        while (child_begin < end) {
+            size_t child_index = (codes[order[child_begin]] >> shift) & 7;
+            size_t child_end = child_begin;
+            while (child_end < end &&
+                   ((codes[order[child_end]] >> shift) & 7) == child_index) {
+                child_end++;
+            }
+            internal_node->children_[child_index] =
+                    build(child_begin, child_end, depth + 1);
+            child_begin = child_end;
+        }
+        return internal_node;
+    };
+    root_node_ = build(0, order.size(), 0);
+}
+
 void Octree::InsertPoint(
         const Eigen::Vector3d& point,
         const std::function<std::shared_ptr<OctreeLeafNode>()>& f_init,
@@ -567,12 +661,70 @@ Octree::LocateLeafNode(const Eigen::Vector3d& point) const {
     return std::make_pair(target_leaf_node, target_leaf_node_info);
 }
 
+void Octree::CollectColorLeaves(std::vector<Eigen::Vector3d>& centers,
+                                std::vector<double>& sizes,
+                                std::vector<Eigen::Vector3d>& colors) const {
+    centers.clear();
+    sizes.clear();
+    colors.clear();
+    if (root_node_ == nullptr) {
+        return;
+    }
+    // Explicit DFS stack over raw pointers. Unlike TraverseRecurse, this
+    // avoids a shared_ptr<OctreeNodeInfo> allocation and an std::function
+    // call per visited node.
+    struct StackEntry {
+        const OctreeNode* node;
+        Eigen::Vector3d origin;
+        double size;
+    };
+    std::vector<StackEntry> stack;
+    stack.reserve(64);
+    stack.push_back({root_node_.get(), origin_, size_});
+    while (!stack.empty()) {
+        const StackEntry entry = stack.back();
+        stack.pop_back();
+        if (auto internal_node =
+                    dynamic_cast<const OctreeInternalNode*>(entry.node)) {
+            const double child_size = entry.size / 2.0;
+            for (size_t child_index = 0; child_index < 8; ++child_index) {
+                const auto& child_node = internal_node->children_[child_index];
+                if (child_node == nullptr) {
+                    continue;
+                }
+                const Eigen::Vector3d child_node_origin =
+                        entry.origin +
+                        Eigen::Vector3d(double(child_index % 2),
+                                        double((child_index / 2) % 2),
+                                        double((child_index / 4) % 2)) *
+                                child_size;
+                stack.push_back(
+                        {child_node.get(), child_node_origin, child_size});
+            }
+        } else if (auto color_leaf_node =
+                           dynamic_cast<const OctreeColorLeafNode*>(
+                                   entry.node)) {
+            centers.push_back(entry.origin +
+                              Eigen::Vector3d(0.5, 0.5, 0.5) * entry.size);
+            sizes.push_back(entry.size);
+            colors.push_back(color_leaf_node->color_);
+        }
+    }
+}
+
 std::shared_ptr<geometry::VoxelGrid> Octree::ToVoxelGrid() const {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->CreateFromOctree(*this);
     return voxel_grid;
 }
 
+std::shared_ptr<geometry::PointCloud> Octree::ToPointCloud() const {
+    auto point_cloud = std::make_shared<geometry::PointCloud>();
+    std::vector<double> sizes;
+    CollectColorLeaves(point_cloud->points_, sizes, point_cloud->colors_);
+    return point_cloud;
+}
+
 bool Octree::ConvertToJsonValue(Json::Value& value) const {
     bool rc = true;
     value["class_name"] = "Octree";
@@ -236,6 +236,22 @@ public:
     void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
                                double size_expand = 0.01);
 
+    /// \brief Bulk bottom-up conversion from point cloud.
+    ///
+    /// Computes a Morton code per point at leaf resolution, sorts once, and
+    /// builds the tree over contiguous code ranges, so each node is created
+    /// exactly once instead of paying a root-to-leaf walk per inserted point.
+    /// Produces the same tree as ConvertFromPointCloud. Falls back to
+    /// per-point insertion for max_depth > 21, where leaf coordinates no
+    /// longer fit a 64-bit Morton code.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloudBulk(const geometry::PointCloud& point_cloud,
+                                   double size_expand = 0.01);
+
     /// Root of the octree.
     std::shared_ptr<OctreeNode> root_node_ = nullptr;
 
@@ -295,9 +311,27 @@ public:
     /// Returns true if the Octree is completely the same, used for testing.
     bool operator==(const Octree& other) const;
 
+    /// \brief Collect all color leaf nodes into flat arrays.
+    ///
+    /// Walks the tree iteratively with an explicit stack instead of the
+    /// Traverse() callback machinery, so no OctreeNodeInfo is allocated per
+    /// visited node. For leaf i, \p centers[i] and \p sizes[i] describe the
+    /// leaf cell and \p colors[i] is its color. Leaves of other types are
+    /// skipped. Used by the bulk conversions to VoxelGrid and PointCloud.
+    void CollectColorLeaves(std::vector<Eigen::Vector3d>& centers,
+                            std::vector<double>& sizes,
+                            std::vector<Eigen::Vector3d>& colors) const;
+
     /// Convert to VoxelGrid.
     std::shared_ptr<geometry::VoxelGrid> ToVoxelGrid() const;
 
+    /// \brief Convert to PointCloud with one point per color leaf node.
+    ///
+    /// Points are the leaf cell centers and carry the leaf colors. Uses
+    /// CollectColorLeaves, so conversion cost is one iterative walk plus two
+    /// array moves rather than a callback per node.
+    std::shared_ptr<geometry::PointCloud> ToPointCloud() const;
+
     /// Convert from voxel grid.
     void CreateFromVoxelGrid(const geometry::VoxelGrid& voxel_grid);
 
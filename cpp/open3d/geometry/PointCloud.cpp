@@ -30,8 +30,13 @@
 
 #include <Eigen/Dense>
 #include <numeric>
+#include <random>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/utility/Console.h"
 
@@ -65,6 +70,23 @@ OrientedBoundingBox PointCloud::GetOrientedBoundingBox() const {
     return OrientedBoundingBox::CreateFromPoints(points_);
 }
 
+std::vector<OrientedBoundingBox> PointCloud::GetOrientedBoundingBoxes(
+        const std::vector<std::vector<size_t>> &segments) const {
+    std::vector<OrientedBoundingBox> boxes(segments.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)segments.size(); i++) {
+        std::vector<Eigen::Vector3d> segment_points;
+        segment_points.reserve(segments[i].size());
+        for (size_t idx : segments[i]) {
+            segment_points.push_back(points_[idx]);
+        }
+        boxes[i] = OrientedBoundingBox::CreateFromPoints(segment_points);
+    }
+    return boxes;
+}
+
 PointCloud &PointCloud::Transform(const Eigen::Matrix4d &transformation) {
     TransformPoints(transformation, points_);
     TransformNormals(transformation, normals_);
@@ -144,6 +166,111 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     return distances;
 }
 
+std::vector<double> PointCloud::ComputePointCloudDistanceApprox(
+        const PointCloud &target, double approx_voxel_size) {
+    if (approx_voxel_size <= 0.0) {
+        utility::LogError(
+                "[ComputePointCloudDistanceApprox] approx_voxel_size <= 0.");
+    }
+    std::vector<double> distances(points_.size());
+    // Bin target points into a voxel hash.
+    const double inv_voxel_size = 1.0 / approx_voxel_size;
+    std::unordered_map<Eigen::Vector3i, std::vector<int>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxel_to_targets;
+    for (int i = 0; i < (int)target.points_.size(); i++) {
+        Eigen::Vector3i voxel_index(
+                int(floor(target.points_[i](0) * inv_voxel_size)),
+                int(floor(target.points_[i](1) * inv_voxel_size)),
+                int(floor(target.points_[i](2) * inv_voxel_size)));
+        voxel_to_targets[voxel_index].push_back(i);
+    }
+    std::vector<int> misses;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points_.size(); i++) {
+        Eigen::Vector3i voxel_index(int(floor(points_[i](0) * inv_voxel_size)),
+                                    int(floor(points_[i](1) * inv_voxel_size)),
+                                    int(floor(points_[i](2) * inv_voxel_size)));
+        double min_dist2 = std::numeric_limits<double>::max();
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto it = voxel_to_targets.find(
+                            voxel_index + Eigen::Vector3i(dx, dy, dz));
+                    if (it == voxel_to_targets.end()) continue;
+                    for (int tidx : it->second) {
+                        double dist2 = (points_[i] - target.points_[tidx])
+                                               .squaredNorm();
+                        min_dist2 = std::min(min_dist2, dist2);
+                    }
+                }
+            }
+        }
+        if (min_dist2 == std::numeric_limits<double>::max()) {
+            distances[i] = -1.0;  // no neighbor in voxel range, resolved below
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            { misses.push_back(i); }
+        } else {
+            distances[i] = std::sqrt(min_dist2);
+        }
+    }
+    // Query points far from every target voxel take the exact path; the
+    // KD-tree is only built if at least one such point exists.
+    if (!misses.empty()) {
+        KDTreeFlann kdtree;
+        kdtree.SetGeometry(target);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int m = 0; m < (int)misses.size(); m++) {
+            int i = misses[m];
+            std::vector<int> indices(1);
+            std::vector<double> dists(1);
+            if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
+                distances[i] = 0.0;
+            } else {
+                distances[i] = std::sqrt(dists[0]);
+            }
+        }
+    }
+    return distances;
+}
+
+std::vector<double> PointCloud::ComputeDistanceToTriangleMesh(
+        const TriangleMesh &mesh, bool signed_distance) const {
+    if (!mesh.HasTriangles()) {
+        utility::LogError(
+                "[ComputeDistanceToTriangleMesh] mesh has no triangles.");
+    }
+    std::vector<double> distances(points_.size());
+    TriangleMeshBVH bvh(mesh);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)points_.size(); i++) {
+        Eigen::Vector3d closest_point;
+        int triangle_index;
+        double dist = bvh.ClosestPoint(points_[i], closest_point,
+                                       triangle_index);
+        if (signed_distance) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[triangle_index];
+            const Eigen::Vector3d &vertex0 = mesh.vertices_[triangle(0)];
+            Eigen::Vector3d face_normal =
+                    (mesh.vertices_[triangle(1)] - vertex0)
+                            .cross(mesh.vertices_[triangle(2)] - vertex0);
+            if (face_normal.dot(points_[i] - closest_point) < 0.0) {
+                dist = -dist;
+            }
+        }
+        distances[i] = dist;
+    }
+    return distances;
+}
+
 PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
                                               bool remove_infinite) {
     bool has_normal = HasNormals();
@@ -345,6 +472,187 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
     return output;
 }
 
+std::shared_ptr<PointCloud> PointCloud::VoxelDownSampleParallel(
+        double voxel_size) const {
+    auto output = std::make_shared<PointCloud>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSampleParallel] voxel_size <= 0.");
+    }
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSampleParallel] voxel_size is too small.");
+    }
+    const int64_t num_points = (int64_t)points_.size();
+#ifdef _OPENMP
+    const int num_shards = std::max(omp_get_max_threads(), 1);
+#else
+    const int num_shards = 1;
+#endif
+    // Phase 1: compute voxel indices and shard assignments in parallel.
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+    std::vector<int> shard_of_point(num_points);
+    utility::hash_eigen<Eigen::Vector3i> hasher;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
+        voxel_indices[i] = Eigen::Vector3i(int(floor(ref_coord(0))),
+                                           int(floor(ref_coord(1))),
+                                           int(floor(ref_coord(2))));
+        shard_of_point[i] = int(hasher(voxel_indices[i]) % num_shards);
+    }
+    // Phase 2: each shard accumulates the voxels hashed to it. A voxel index
+    // maps to exactly one shard, so the shard maps never share keys and no
+    // locking is needed.
+    std::vector<std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
+                                   utility::hash_eigen<Eigen::Vector3i>>>
+            shard_maps(num_shards);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int shard = 0; shard < num_shards; shard++) {
+        auto &map = shard_maps[shard];
+        map.reserve(size_t(num_points / num_shards + 1));
+        for (int64_t i = 0; i < num_points; i++) {
+            if (shard_of_point[i] == shard) {
+                map[voxel_indices[i]].AddPoint(*this, (int)i);
+            }
+        }
+    }
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+    size_t num_output_points = 0;
+    for (const auto &map : shard_maps) {
+        num_output_points += map.size();
+    }
+    output->points_.resize(num_output_points);
+    if (has_normals) output->normals_.resize(num_output_points);
+    if (has_colors) output->colors_.resize(num_output_points);
+    std::vector<size_t> shard_offsets(num_shards + 1, 0);
+    for (int shard = 0; shard < num_shards; shard++) {
+        shard_offsets[shard + 1] = shard_offsets[shard] +
+                                   shard_maps[shard].size();
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int shard = 0; shard < num_shards; shard++) {
+        size_t k = shard_offsets[shard];
+        for (const auto &accpoint : shard_maps[shard]) {
+            output->points_[k] = accpoint.second.GetAveragePoint();
+            if (has_normals) {
+                output->normals_[k] = accpoint.second.GetAverageNormal();
+            }
+            if (has_colors) {
+                output->colors_[k] = accpoint.second.GetAverageColor();
+            }
+            k++;
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)output->points_.size());
+    return output;
+}
+
+std::shared_ptr<PointCloud> PointCloud::VoxelDownSampleAndEstimateNormals(
+        double voxel_size) const {
+    auto output = std::make_shared<PointCloud>();
+    if (voxel_size <= 0.0) {
+        utility::LogError(
+                "[VoxelDownSampleAndEstimateNormals] voxel_size <= 0.");
+    }
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError(
+                "[VoxelDownSampleAndEstimateNormals] voxel_size is too "
+                "small.");
+    }
+    // Per-voxel first and second moments, accumulated in a single pass.
+    struct AccumulatedMoments {
+        int count_ = 0;
+        Eigen::Vector3d sum_ = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d outer_sum_ = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d color_ = Eigen::Vector3d::Zero();
+    };
+    std::unordered_map<Eigen::Vector3i, AccumulatedMoments,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxelindex_to_moments;
+    bool has_colors = HasColors();
+    for (size_t i = 0; i < points_.size(); i++) {
+        Eigen::Vector3d ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
+        Eigen::Vector3i voxel_index(int(floor(ref_coord(0))),
+                                    int(floor(ref_coord(1))),
+                                    int(floor(ref_coord(2))));
+        auto &acc = voxelindex_to_moments[voxel_index];
+        acc.count_++;
+        acc.sum_ += points_[i];
+        acc.outer_sum_ += points_[i] * points_[i].transpose();
+        if (has_colors) {
+            acc.color_ += colors_[i];
+        }
+    }
+    output->points_.reserve(voxelindex_to_moments.size());
+    output->normals_.reserve(voxelindex_to_moments.size());
+    if (has_colors) {
+        output->colors_.reserve(voxelindex_to_moments.size());
+    }
+    for (const auto &voxel : voxelindex_to_moments) {
+        const auto &acc = voxel.second;
+        output->points_.push_back(acc.sum_ / double(acc.count_));
+        if (has_colors) {
+            output->colors_.push_back(acc.color_ / double(acc.count_));
+        }
+        // Gather moments from the voxel itself; widen to the 26-neighborhood
+        // when the voxel holds too few points to span a plane.
+        int count = acc.count_;
+        Eigen::Vector3d sum = acc.sum_;
+        Eigen::Matrix3d outer_sum = acc.outer_sum_;
+        if (count < 3) {
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dz = -1; dz <= 1; dz++) {
+                        if (dx == 0 && dy == 0 && dz == 0) continue;
+                        auto it = voxelindex_to_moments.find(
+                                voxel.first + Eigen::Vector3i(dx, dy, dz));
+                        if (it != voxelindex_to_moments.end()) {
+                            count += it->second.count_;
+                            sum += it->second.sum_;
+                            outer_sum += it->second.outer_sum_;
+                        }
+                    }
+                }
+            }
+        }
+        Eigen::Vector3d normal(0.0, 0.0, 1.0);
+        if (count >= 3) {
+            Eigen::Vector3d mean = sum / double(count);
+            Eigen::Matrix3d covariance =
+                    outer_sum / double(count) - mean * mean.transpose();
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+            solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+            normal = solver.eigenvectors().col(0);
+            if (normal.norm() == 0.0) {
+                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+            }
+        }
+        output->normals_.push_back(normal);
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)output->points_.size());
+    return output;
+}
+
 std::tuple<std::shared_ptr<PointCloud>,
            Eigen::MatrixXi,
            std::vector<std::vector<int>>>
@@ -417,6 +725,66 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
     return std::make_tuple(output, cubic_id, original_indices);
 }
 
+std::shared_ptr<PointCloud> PointCloud::PoissonDiskDownSample(
+        double min_distance, int seed /* = -1 */) const {
+    if (min_distance <= 0.0) {
+        utility::LogError("[PoissonDiskDownSample] min_distance <= 0.");
+    }
+    if (points_.empty()) {
+        return std::make_shared<PointCloud>();
+    }
+    // Uniform acceptance grid with cell size min_distance; any conflicting
+    // accepted sample must lie in the 27-cell neighborhood.
+    const double inv_cell_size = 1.0 / min_distance;
+    const double min_distance2 = min_distance * min_distance;
+    std::unordered_map<Eigen::Vector3i, std::vector<size_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            grid;
+
+    // Visit points in random order so the accepted set is not biased by the
+    // acquisition order of the cloud.
+    std::vector<size_t> order(points_.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (seed == -1) {
+        std::random_device rd;
+        seed = (int)rd();
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<size_t> selected;
+    for (size_t pidx : order) {
+        const Eigen::Vector3d &point = points_[pidx];
+        Eigen::Vector3i cell(int(floor(point(0) * inv_cell_size)),
+                             int(floor(point(1) * inv_cell_size)),
+                             int(floor(point(2) * inv_cell_size)));
+        bool conflict = false;
+        for (int dx = -1; dx <= 1 && !conflict; dx++) {
+            for (int dy = -1; dy <= 1 && !conflict; dy++) {
+                for (int dz = -1; dz <= 1 && !conflict; dz++) {
+                    auto it = grid.find(cell + Eigen::Vector3i(dx, dy, dz));
+                    if (it == grid.end()) continue;
+                    for (size_t sidx : it->second) {
+                        if ((points_[sidx] - point).squaredNorm() <
+                            min_distance2) {
+                            conflict = true;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        if (!conflict) {
+            grid[cell].push_back(pidx);
+            selected.push_back(pidx);
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)selected.size());
+    return SelectByIndex(selected);
+}
+
 std::shared_ptr<PointCloud> PointCloud::UniformDownSample(
         size_t every_k_points) const {
     if (every_k_points == 0) {
@@ -450,13 +818,20 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
 
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
 PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    return RemoveRadiusOutliers(nb_points, search_radius, kdtree);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points,
+                                 double search_radius,
+                                 const KDTreeFlann &kdtree) const {
     if (nb_points < 1 || search_radius <= 0) {
         utility::LogError(
                 "[RemoveRadiusOutliers] Illegal input parameters,"
                 "number of points and radius must be positive");
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
     std::vector<bool> mask = std::vector<bool>(points_.size());
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
@@ -480,6 +855,19 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
 PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
                                       double std_ratio) const {
+    if (points_.size() == 0) {
+        return std::make_tuple(std::make_shared<PointCloud>(),
+                               std::vector<size_t>());
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    return RemoveStatisticalOutliers(nb_neighbors, std_ratio, kdtree);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
+                                      double std_ratio,
+                                      const KDTreeFlann &kdtree) const {
     if (nb_neighbors < 1 || std_ratio <= 0) {
         utility::LogError(
                 "[RemoveStatisticalOutliers] Illegal input parameters, number "
@@ -489,13 +877,11 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
     std::vector<size_t> indices;
     size_t valid_distances = 0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) reduction(+ : valid_distances)
 #endif
     for (int i = 0; i < int(points_.size()); i++) {
         std::vector<int> tmp_indices;
@@ -618,21 +1004,23 @@ PointCloud::ComputeConvexHull() const {
     return Qhull::ComputeConvexHull(points_);
 }
 
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
-                               const double radius) const {
-    if (radius <= 0) {
-        utility::LogError(
-                "[HiddenPointRemoval] radius must be larger than zero.");
-    }
+namespace {
 
+// Shared implementation of the hidden point removal operator; the caller
+// provides the spherical projection buffer so batched evaluation can reuse
+// one allocation per thread.
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+HiddenPointRemovalImpl(const std::vector<Eigen::Vector3d> &points,
+                       const Eigen::Vector3d &camera_location,
+                       const double radius,
+                       std::vector<Eigen::Vector3d> &spherical_projection) {
     // perform spherical projection
-    std::vector<Eigen::Vector3d> spherical_projection;
-    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
-        Eigen::Vector3d projected_point = points_[pidx] - camera_location;
+    spherical_projection.resize(points.size());
+    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+        Eigen::Vector3d projected_point = points[pidx] - camera_location;
         double norm = projected_point.norm();
-        spherical_projection.push_back(
-                projected_point + 2 * (radius - norm) * projected_point / norm);
+        spherical_projection[pidx] =
+                projected_point + 2 * (radius - norm) * projected_point / norm;
     }
 
     // add origin
@@ -649,7 +1037,7 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     size_t origin_vidx = pt_map.size();
     for (size_t vidx = 0; vidx < pt_map.size(); vidx++) {
         size_t pidx = pt_map[vidx];
-        visible_mesh->vertices_[vidx] = points_[pidx];
+        visible_mesh->vertices_[vidx] = points[pidx];
         if (pidx == origin_pidx) {
             origin_vidx = vidx;
             visible_mesh->vertices_[vidx] = camera_location;
@@ -680,5 +1068,48 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     return std::make_tuple(visible_mesh, pt_map);
 }
 
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
+                               const double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+    std::vector<Eigen::Vector3d> spherical_projection;
+    return HiddenPointRemovalImpl(points_, camera_location, radius,
+                                  spherical_projection);
+}
+
+std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+PointCloud::HiddenPointRemovalBatch(
+        const std::vector<Eigen::Vector3d> &camera_locations,
+        const double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemovalBatch] radius must be larger than zero.");
+    }
+    std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+            results(camera_locations.size());
+    // Viewpoints are independent; each thread reuses one projection buffer
+    // across the viewpoints it evaluates.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<Eigen::Vector3d> spherical_projection;
+        spherical_projection.reserve(points_.size() + 1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int i = 0; i < (int)camera_locations.size(); i++) {
+            results[i] = HiddenPointRemovalImpl(points_, camera_locations[i],
+                                                radius, spherical_projection);
+        }
+    }
+    return results;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -27,10 +27,14 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <functional>
 #include <memory>
+#include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/Geometry3D.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
 
@@ -43,6 +47,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class KDTreeFlann;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -70,6 +75,19 @@ public:
     Eigen::Vector3d GetCenter() const override;
     AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
     OrientedBoundingBox GetOrientedBoundingBox() const override;
+
+    /// \brief Computes oriented bounding boxes for many point segments of
+    /// this cloud in one call.
+    ///
+    /// Each segment is a list of indices into this cloud (e.g. one segmented
+    /// object); segments are processed in parallel, so computing OBBs for
+    /// thousands of objects sharing one parent cloud scales across cores
+    /// instead of paying a serial hull + eigen decomposition per call.
+    ///
+    /// \param segments Per-segment point indices into this cloud.
+    /// \return One OrientedBoundingBox per segment, in input order.
+    std::vector<OrientedBoundingBox> GetOrientedBoundingBoxes(
+            const std::vector<std::vector<size_t>> &segments) const;
     PointCloud &Transform(const Eigen::Matrix4d &transformation) override;
     PointCloud &Translate(const Eigen::Vector3d &translation,
                           bool relative = true) override;
@@ -139,6 +157,31 @@ public:
     /// smaller value leads to denser output point cloud.
     std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
 
+    /// \brief Multi-threaded variant of VoxelDownSample.
+    ///
+    /// Points are binned into shards keyed by the hash of their voxel index
+    /// and each shard is accumulated by its own thread, so the downsampling
+    /// scales across cores on large point clouds. The result contains the
+    /// same voxels as VoxelDownSample, in unspecified order.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid,
+    /// smaller value leads to denser output point cloud.
+    std::shared_ptr<PointCloud> VoxelDownSampleParallel(
+            double voxel_size) const;
+
+    /// \brief Fused voxel downsampling and normal estimation.
+    ///
+    /// Accumulates per-voxel point sums and covariances in the same pass that
+    /// bins points into voxels, then derives each output normal from the
+    /// covariance of its voxel (augmented with the 26 neighboring voxels when
+    /// the voxel itself holds too few points). Walks the input once and
+    /// builds no KD-tree, unlike running VoxelDownSample followed by
+    /// EstimateNormals.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid.
+    std::shared_ptr<PointCloud> VoxelDownSampleAndEstimateNormals(
+            double voxel_size) const;
+
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
     /// Also records point cloud index before downsampling.
@@ -155,6 +198,21 @@ public:
                             const Eigen::Vector3d &max_bound,
                             bool approximate_class = false) const;
 
+    /// \brief Blue-noise style downsampling with a minimum distance
+    /// guarantee.
+    ///
+    /// Performs Poisson-disk (dart throwing) sampling: points are visited in
+    /// random order and accepted if no previously accepted point lies within
+    /// \p min_distance. Candidate checks use a uniform grid of cell size
+    /// \p min_distance rather than a KD-tree, so the sampler runs in
+    /// near-linear time and yields the even distributions voxel downsampling
+    /// cannot provide.
+    ///
+    /// \param min_distance Minimum distance between sampled points.
+    /// \param seed Seed for the sampling order; -1 draws a random seed.
+    std::shared_ptr<PointCloud> PoissonDiskDownSample(double min_distance,
+                                                      int seed = -1) const;
+
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// uniformly.
     ///
@@ -189,6 +247,15 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
+    /// \brief Overload of RemoveRadiusOutliers querying a pre-built KD-tree.
+    ///
+    /// Lets consecutive filter passes over the same cloud share one index
+    /// build. \p kdtree must have been constructed from this point cloud.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveRadiusOutliers(size_t nb_points,
+                         double search_radius,
+                         const KDTreeFlann &kdtree) const;
+
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
     ///
@@ -197,6 +264,16 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveStatisticalOutliers(size_t nb_neighbors, double std_ratio) const;
 
+    /// \brief Overload of RemoveStatisticalOutliers querying a pre-built
+    /// KD-tree.
+    ///
+    /// Lets consecutive filter passes over the same cloud share one index
+    /// build. \p kdtree must have been constructed from this point cloud.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveStatisticalOutliers(size_t nb_neighbors,
+                              double std_ratio,
+                              const KDTreeFlann &kdtree) const;
+
     /// \brief Function to compute the normals of a point cloud.
     ///
     /// Normals are oriented with respect to the input point cloud if normals
@@ -206,7 +283,30 @@ public:
     /// search. \param fast_normal_computation If true, the normal estiamtion
     /// uses a non-iterative method to extract the eigenvector from the
     /// covariance matrix. This is faster, but is not as numerical stable.
+    /// \param num_threads If positive, caps the number of threads used by
+    /// this call; 0 uses the global setting (utility::SetNumThreads).
     void EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true,
+            int num_threads = 0);
+
+    /// \brief Incremental variant of EstimateNormals for growing clouds.
+    ///
+    /// Only the points with index >= \p start_index are (re-)estimated,
+    /// querying \p kdtree instead of rebuilding a spatial index, so appending
+    /// a frame to a map cloud costs O(new_points * k) rather than O(N * k).
+    /// The caller owns \p kdtree and is responsible for keeping it consistent
+    /// with the cloud (typically rebuilt every few frames). Normals of
+    /// pre-existing points are left untouched.
+    ///
+    /// \param kdtree Persistent KD-tree built over this point cloud.
+    /// \param start_index Index of the first point whose normal is estimated.
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    /// \param fast_normal_computation See EstimateNormals.
+    void EstimateNormalsIncremental(
+            const KDTreeFlann &kdtree,
+            size_t start_index,
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
@@ -242,6 +342,38 @@ public:
     /// \param target The target point cloud.
     std::vector<double> ComputePointCloudDistance(const PointCloud &target);
 
+    /// \brief Approximate variant of ComputePointCloudDistance.
+    ///
+    /// The target is binned into a voxel hash of resolution
+    /// \p approx_voxel_size; each query scans the query point's voxel and its
+    /// 26 neighbors for the closest target point. Query points with no target
+    /// point within that neighborhood fall back to an exact KD-tree query.
+    /// With a voxel size near the expected point spacing this trades a small
+    /// distance error for much higher throughput than the exact KNN path.
+    ///
+    /// \param target The target point cloud.
+    /// \param approx_voxel_size Resolution of the voxel hash built over the
+    /// target; must be positive.
+    std::vector<double> ComputePointCloudDistanceApprox(
+            const PointCloud &target, double approx_voxel_size);
+
+    /// \brief Function to compute the distance from each point to the
+    /// surface of a triangle mesh.
+    ///
+    /// The triangles of \p mesh are indexed with a TriangleMeshBVH and the
+    /// closest-point queries are evaluated in parallel, so the cloud does
+    /// not have to be exported to external tools for point-to-mesh
+    /// validation.
+    ///
+    /// \param mesh The target triangle mesh, must have triangles.
+    /// \param signed_distance If true, the distance is negated for points
+    /// on the back side of the closest triangle, determined by the face
+    /// normal of that triangle. The sign is exact where the closest point
+    /// lies in a triangle interior and approximate near sharp edges and
+    /// vertices.
+    std::vector<double> ComputeDistanceToTriangleMesh(
+            const TriangleMesh &mesh, bool signed_distance = false) const;
+
     /// Function to compute the mean and covariance matrix
     /// of a point cloud.
     std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance()
@@ -274,6 +406,24 @@ public:
     HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                        const double radius) const;
 
+    /// \brief Batched HiddenPointRemoval over many candidate viewpoints.
+    ///
+    /// Runs the operator for every camera location in one call, evaluating
+    /// viewpoints in parallel and reusing one spherical-projection buffer per
+    /// thread instead of reallocating it per pose. Intended for view-planning
+    /// loops that score hundreds of candidate viewpoints against the same
+    /// cloud.
+    ///
+    /// \param camera_locations Viewpoints to evaluate.
+    /// \param radius The radius of the spherical projection, shared by all
+    /// viewpoints.
+    /// \return For each viewpoint, the visible mesh and visible point
+    /// indices, in input order.
+    std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+    HiddenPointRemovalBatch(
+            const std::vector<Eigen::Vector3d> &camera_locations,
+            const double radius) const;
+
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
@@ -285,9 +435,64 @@ public:
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
+    /// \param num_threads If positive, caps the number of threads used by
+    /// this call; 0 uses the global setting (utility::SetNumThreads).
     std::vector<int> ClusterDBSCAN(double eps,
                                    size_t min_points,
-                                   bool print_progress = false) const;
+                                   bool print_progress = false,
+                                   int num_threads = 0) const;
+
+    /// \brief Memory-bounded variant of ClusterDBSCAN.
+    ///
+    /// Instead of precomputing every neighbor list up front, neighbor queries
+    /// run on demand against the KDTree and results are kept in a cache whose
+    /// size is capped at \p max_cache_bytes. When the cache is full it is
+    /// flushed and neighbor lists are recomputed as needed, trading some
+    /// recomputation for a hard memory bound. Produces the same labels as
+    /// ClusterDBSCAN.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param max_cache_bytes Upper bound on the memory used for cached
+    /// neighbor lists.
+    /// \param print_progress If `true` the progress is visualized in the
+    /// console.
+    std::vector<int> ClusterDBSCANStreaming(double eps,
+                                            size_t min_points,
+                                            size_t max_cache_bytes,
+                                            bool print_progress = false) const;
+
+    /// \brief Variant of ClusterDBSCAN that emits each cluster as soon
+    /// as its expansion finishes.
+    ///
+    /// Once a cluster's expansion completes its membership can no longer
+    /// change, so \p on_cluster is invoked right away with the cluster
+    /// label, the indices of its points and their axis-aligned bounding
+    /// box (accumulated on the fly during expansion). This lets
+    /// per-cluster downstream work start while the remaining points are
+    /// still being clustered, instead of waiting for the full label
+    /// vector. The callback runs on the clustering thread; long-running
+    /// work should be handed off to another thread from inside it.
+    /// Produces the same labels as ClusterDBSCAN.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param on_cluster Called once per completed cluster with the
+    /// cluster label, the point indices and the cluster bounding box.
+    /// Noise points are not reported.
+    /// \param print_progress If `true` the progress is visualized in the
+    /// console.
+    /// \param num_threads If positive, caps the number of threads used by
+    /// this call; 0 uses the global setting (utility::SetNumThreads).
+    std::vector<int> ClusterDBSCANWithCallback(
+            double eps,
+            size_t min_points,
+            const std::function<void(int,
+                                     const std::vector<size_t> &,
+                                     const AxisAlignedBoundingBox &)>
+                    &on_cluster,
+            bool print_progress = false,
+            int num_threads = 0) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
@@ -303,6 +508,31 @@ public:
             const int ransac_n = 3,
             const int num_iterations = 100) const;
 
+    /// \brief Segment multiple planes from the PointCloud in one pass.
+    ///
+    /// Equivalent to calling SegmentPlane repeatedly and removing the inliers
+    /// after each call, but operates on a shared index mask instead of
+    /// rebuilding point subsets, so no intermediate point clouds are
+    /// allocated. Extraction stops early when a plane has fewer than
+    /// \p min_plane_points inliers.
+    ///
+    /// \param num_planes Maximum number of planes to extract.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Number of iterations per plane.
+    /// \param min_plane_points Minimum number of inliers for a plane to be
+    /// accepted.
+    /// \return A list of (plane model, inlier indices) tuples; indices are
+    /// into the original point cloud.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const int num_planes,
+                  const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const size_t min_plane_points = 3) const;
+
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
     ///
@@ -362,6 +592,32 @@ public:
     std::shared_ptr<PointCloud> CreateFromVoxelGrid(
             const VoxelGrid &voxel_grid);
 
+    /// \brief Creates a PointCloud from core::Tensor attributes.
+    ///
+    /// Each attribute is a (N, 3) tensor of dtype Float64 or Float32.
+    /// Float64 CPU tensors are imported with one flat copy per
+    /// attribute; Float32 tensors are converted in a single parallel
+    /// pass and CUDA tensors are first copied to the host. This is the
+    /// bridge for running tensor kernels on geometry without a
+    /// per-element round trip through user code.
+    ///
+    /// \param points Point coordinates, shape (N, 3).
+    /// \param normals Optional point normals, shape (N, 3).
+    /// \param colors Optional point colors, shape (N, 3).
+    static PointCloud FromTensor(const core::Tensor &points,
+                                 const core::Tensor &normals = core::Tensor(),
+                                 const core::Tensor &colors = core::Tensor());
+
+    /// \brief Returns zero-copy tensor views over the point attributes.
+    ///
+    /// The map contains a (N, 3) Float64 CPU tensor for each non-empty
+    /// attribute, under the keys "points", "normals" and "colors". The
+    /// tensors alias the PointCloud's own storage: writes through them
+    /// are visible in the PointCloud and no data is copied. They remain
+    /// valid only as long as this PointCloud is alive and the attribute
+    /// vectors are not resized.
+    std::unordered_map<std::string, core::Tensor> ToTensorMap();
+
 public:
     /// Points coordinates.
     std::vector<Eigen::Vector3d> points_;
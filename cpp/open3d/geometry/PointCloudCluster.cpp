@@ -27,47 +27,230 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <Eigen/Dense>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ThreadPool.h"
 
 namespace open3d {
 namespace geometry {
 
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+                                           bool print_progress,
+                                           int num_threads) const {
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
+    // All searches use the same radius, so the hash grid beats a k-d
+    // tree both in build and in query time here.
+    FixedRadiusSearch grid(points_, eps);
 
     // precompute all neighbours
     utility::LogDebug("Precompute Neighbours");
     utility::ConsoleProgressBar progress_bar(
             points_.size(), "Precompute Neighbours", print_progress);
     std::vector<std::vector<int>> nbs(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
+    std::mutex progress_mutex;
+    utility::ThreadPool::GetInstance().ParallelForRange(
+            0, int64_t(points_.size()), [&](int64_t lo, int64_t hi) {
+                std::vector<double> dists2;
+                for (int64_t idx = lo; idx < hi; ++idx) {
+                    grid.SearchRadius(points_[idx], nbs[idx], dists2);
+                }
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                for (int64_t c = lo; c < hi; ++c) {
+                    ++progress_bar;
+                }
+            },
+            num_threads);
+    utility::LogDebug("Done Precompute Neighbours");
+
+    // set all labels to undefined (-2)
+    utility::LogDebug("Compute Clusters");
+    progress_bar.reset(points_.size(), "Clustering", print_progress);
+    std::vector<int> labels(points_.size(), -2);
+    int cluster_label = 0;
+    for (size_t idx = 0; idx < points_.size(); ++idx) {
+        if (labels[idx] != -2) {  // label is not undefined
+            continue;
+        }
+
+        // check density
+        if (nbs[idx].size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
+
+        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
+        std::unordered_set<int> nbs_visited;
+        nbs_visited.insert(int(idx));
+
+        labels[idx] = cluster_label;
+        ++progress_bar;
+        while (!nbs_next.empty()) {
+            int nb = *nbs_next.begin();
+            nbs_next.erase(nbs_next.begin());
+            nbs_visited.insert(nb);
+
+            if (labels[nb] == -1) {  // noise label
+                labels[nb] = cluster_label;
+                ++progress_bar;
+            }
+            if (labels[nb] != -2) {  // not undefined label
+                continue;
+            }
+            labels[nb] = cluster_label;
+            ++progress_bar;
+
+            if (nbs[nb].size() >= min_points) {
+                for (int qnb : nbs[nb]) {
+                    if (nbs_visited.count(qnb) == 0) {
+                        nbs_next.insert(qnb);
+                    }
+                }
+            }
+        }
+
+        cluster_label++;
+    }
+
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    return labels;
+}
+
+std::vector<int> PointCloud::ClusterDBSCANStreaming(
+        double eps,
+        size_t min_points,
+        size_t max_cache_bytes,
+        bool print_progress) const {
+    FixedRadiusSearch grid(points_, eps);
+
+    utility::LogDebug("Compute Clusters (streaming)");
+    utility::ConsoleProgressBar progress_bar(points_.size(), "Clustering",
+                                             print_progress);
+
+    // Bounded cache of neighbor lists. When the cap would be exceeded the
+    // whole cache is flushed and subsequent queries recompute; a cache entry
+    // accounts for the neighbor indices plus approximate map overhead.
+    std::unordered_map<int, std::vector<int>> nb_cache;
+    size_t cached_bytes = 0;
+    const size_t entry_overhead =
+            sizeof(std::pair<int, std::vector<int>>) + 2 * sizeof(void *);
+    auto query_neighbors = [&](int idx) -> const std::vector<int> & {
+        auto it = nb_cache.find(idx);
+        if (it != nb_cache.end()) {
+            return it->second;
+        }
+        std::vector<int> nbs;
         std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+        grid.SearchRadius(points_[idx], nbs, dists2);
+        size_t entry_bytes = nbs.size() * sizeof(int) + entry_overhead;
+        if (cached_bytes + entry_bytes > max_cache_bytes && !nb_cache.empty()) {
+            nb_cache.clear();
+            cached_bytes = 0;
+        }
+        cached_bytes += entry_bytes;
+        return nb_cache.emplace(idx, std::move(nbs)).first->second;
+    };
+
+    // Same expansion loop as ClusterDBSCAN, with on-the-fly neighbor queries.
+    std::vector<int> labels(points_.size(), -2);
+    int cluster_label = 0;
+    for (size_t idx = 0; idx < points_.size(); ++idx) {
+        if (labels[idx] != -2) {  // label is not undefined
+            continue;
+        }
+
+        // check density
+        if (query_neighbors(int(idx)).size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { ++progress_bar; }
+        const std::vector<int> &seed_nbs = query_neighbors(int(idx));
+        std::unordered_set<int> nbs_next(seed_nbs.begin(), seed_nbs.end());
+        std::unordered_set<int> nbs_visited;
+        nbs_visited.insert(int(idx));
+
+        labels[idx] = cluster_label;
+        ++progress_bar;
+        while (!nbs_next.empty()) {
+            int nb = *nbs_next.begin();
+            nbs_next.erase(nbs_next.begin());
+            nbs_visited.insert(nb);
+
+            if (labels[nb] == -1) {  // noise label
+                labels[nb] = cluster_label;
+                ++progress_bar;
+            }
+            if (labels[nb] != -2) {  // not undefined label
+                continue;
+            }
+            labels[nb] = cluster_label;
+            ++progress_bar;
+
+            const std::vector<int> &nb_nbs = query_neighbors(nb);
+            if (nb_nbs.size() >= min_points) {
+                for (int qnb : nb_nbs) {
+                    if (nbs_visited.count(qnb) == 0) {
+                        nbs_next.insert(qnb);
+                    }
+                }
+            }
+        }
+
+        cluster_label++;
     }
+
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    return labels;
+}
+
+std::vector<int> PointCloud::ClusterDBSCANWithCallback(
+        double eps,
+        size_t min_points,
+        const std::function<void(int,
+                                 const std::vector<size_t> &,
+                                 const AxisAlignedBoundingBox &)> &on_cluster,
+        bool print_progress,
+        int num_threads) const {
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
+    FixedRadiusSearch grid(points_, eps);
+
+    // precompute all neighbours
+    utility::LogDebug("Precompute Neighbours");
+    utility::ConsoleProgressBar progress_bar(
+            points_.size(), "Precompute Neighbours", print_progress);
+    std::vector<std::vector<int>> nbs(points_.size());
+    std::mutex progress_mutex;
+    utility::ThreadPool::GetInstance().ParallelForRange(
+            0, int64_t(points_.size()), [&](int64_t lo, int64_t hi) {
+                std::vector<double> dists2;
+                for (int64_t idx = lo; idx < hi; ++idx) {
+                    grid.SearchRadius(points_[idx], nbs[idx], dists2);
+                }
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                for (int64_t c = lo; c < hi; ++c) {
+                    ++progress_bar;
+                }
+            },
+            num_threads);
     utility::LogDebug("Done Precompute Neighbours");
 
-    // set all labels to undefined (-2)
+    // Same expansion loop as ClusterDBSCAN, but each cluster's members
+    // and bounds are accumulated as points join, and the cluster is
+    // emitted right after its expansion finishes. Finished clusters
+    // never change: later iterations only relabel points that are
+    // undefined (-2) or noise (-1).
     utility::LogDebug("Compute Clusters");
     progress_bar.reset(points_.size(), "Clustering", print_progress);
     std::vector<int> labels(points_.size(), -2);
     int cluster_label = 0;
+    std::vector<size_t> cluster_indices;
     for (size_t idx = 0; idx < points_.size(); ++idx) {
         if (labels[idx] != -2) {  // label is not undefined
             continue;
@@ -83,7 +266,17 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
         std::unordered_set<int> nbs_visited;
         nbs_visited.insert(int(idx));
 
+        cluster_indices.clear();
+        Eigen::Vector3d min_bound = points_[idx];
+        Eigen::Vector3d max_bound = points_[idx];
+        auto add_member = [&](size_t member_idx) {
+            cluster_indices.push_back(member_idx);
+            min_bound = min_bound.cwiseMin(points_[member_idx]);
+            max_bound = max_bound.cwiseMax(points_[member_idx]);
+        };
+
         labels[idx] = cluster_label;
+        add_member(idx);
         ++progress_bar;
         while (!nbs_next.empty()) {
             int nb = *nbs_next.begin();
@@ -92,12 +285,14 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
 
             if (labels[nb] == -1) {  // noise label
                 labels[nb] = cluster_label;
+                add_member(size_t(nb));
                 ++progress_bar;
             }
             if (labels[nb] != -2) {  // not undefined label
                 continue;
             }
             labels[nb] = cluster_label;
+            add_member(size_t(nb));
             ++progress_bar;
 
             if (nbs[nb].size() >= min_points) {
@@ -109,6 +304,10 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
             }
         }
 
+        if (on_cluster) {
+            on_cluster(cluster_label, cluster_indices,
+                       AxisAlignedBoundingBox(min_bound, max_bound));
+        }
         cluster_label++;
     }
 
@@ -39,107 +39,197 @@ namespace open3d {
 namespace {
 using namespace geometry;
 
-int CountValidDepthPixels(const Image &depth, int stride) {
-    int num_valid_pixels = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) num_valid_pixels += 1;
+/// Returns per-row output offsets into the point array: row r of the
+/// (strided) depth image writes its points starting at row_offsets[r].
+/// With project_valid_depth_only the valid pixels are counted per row in
+/// parallel, otherwise every strided pixel produces an output point.
+/// Depth samples of type TD are metric after division by depth_scale; a
+/// pixel is valid if it is positive and below depth_trunc.
+template <typename TD>
+std::vector<int> BuildDepthRowOffsets(const Image &depth,
+                                      int stride,
+                                      bool project_valid_depth_only,
+                                      double depth_scale,
+                                      double depth_trunc) {
+    const int num_rows = (depth.height_ + stride - 1) / stride;
+    const int num_cols = (depth.width_ + stride - 1) / stride;
+    const double depth_scale_inv = 1.0 / depth_scale;
+    std::vector<int> row_offsets(num_rows + 1, 0);
+    if (project_valid_depth_only) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int r = 0; r < num_rows; r++) {
+            const TD *p = (const TD *)(depth.data_.data() +
+                                       r * stride * depth.BytesPerLine());
+            int num_valid_pixels = 0;
+            for (int j = 0; j < depth.width_; j += stride) {
+                if (p[j] > 0 && p[j] * depth_scale_inv < depth_trunc) {
+                    num_valid_pixels += 1;
+                }
+            }
+            row_offsets[r + 1] = num_valid_pixels;
+        }
+        for (int r = 0; r < num_rows; r++) {
+            row_offsets[r + 1] += row_offsets[r];
+        }
+    } else {
+        for (int r = 0; r < num_rows; r++) {
+            row_offsets[r + 1] = (r + 1) * num_cols;
         }
     }
-    return num_valid_pixels;
+    return row_offsets;
 }
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
-        const Image &depth,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        int stride,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
+/// Inner projection loop, specialized at compile time for the common case
+/// of an identity extrinsic so the per-point 4x4 transform drops out. The
+/// depth sample type is a template parameter so raw uint16 depth is
+/// projected directly, with the scale applied in the kernel instead of in
+/// a float conversion pass over the whole image.
+template <typename TD, bool kIdentityPose>
+void ProjectDepthRows(const Image &depth,
+                      const camera::PinholeCameraIntrinsic &intrinsic,
+                      const Eigen::Matrix4d &camera_pose,
+                      double depth_scale,
+                      double depth_trunc,
+                      int stride,
+                      bool project_valid_depth_only,
+                      const std::vector<int> &row_offsets,
+                      std::vector<Eigen::Vector3d> &points) {
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels =
-                int(depth.height_ / stride) * int(depth.width_ / stride);
-    } else {
-        num_valid_pixels = CountValidDepthPixels(depth, stride);
-    }
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
+    const double depth_scale_inv = 1.0 / depth_scale;
+    const int num_rows = int(row_offsets.size()) - 1;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int r = 0; r < num_rows; r++) {
+        const int i = r * stride;
+        const TD *p = (const TD *)(depth.data_.data() +
+                                   i * depth.BytesPerLine());
+        int cnt = row_offsets[r];
         for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
+            double z = p[j] * depth_scale_inv;
+            if (p[j] > 0 && z < depth_trunc) {
                 double x = (j - principal_point.first) * z / focal_length.first;
                 double y =
                         (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
+                if (kIdentityPose) {
+                    points[cnt++] = Eigen::Vector3d(x, y, z);
+                } else {
+                    Eigen::Vector4d point =
+                            camera_pose * Eigen::Vector4d(x, y, z, 1.0);
+                    points[cnt++] = point.block<3, 1>(0, 0);
+                }
             } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt++] = Eigen::Vector3d(x, y, z);
+                double nan = std::numeric_limits<float>::quiet_NaN();
+                points[cnt++] = Eigen::Vector3d(nan, nan, nan);
             }
         }
     }
-    return pointcloud;
 }
 
-template <typename TC, int NC>
-std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
-        const RGBDImage &image,
+template <typename TD>
+std::shared_ptr<PointCloud> CreatePointCloudFromDepthImageT(
+        const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
+        double depth_scale,
+        double depth_trunc,
+        int stride,
         bool project_valid_depth_only) {
     auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels = image.depth_.height_ * image.depth_.width_;
+    std::vector<int> row_offsets = BuildDepthRowOffsets<TD>(
+            depth, stride, project_valid_depth_only, depth_scale, depth_trunc);
+    pointcloud->points_.resize(row_offsets.back());
+    if (extrinsic.isIdentity(0.0)) {
+        ProjectDepthRows<TD, true>(depth, intrinsic,
+                                   Eigen::Matrix4d::Identity(), depth_scale,
+                                   depth_trunc, stride,
+                                   project_valid_depth_only, row_offsets,
+                                   pointcloud->points_);
     } else {
-        num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
+        Eigen::Matrix4d camera_pose = extrinsic.inverse();
+        ProjectDepthRows<TD, false>(depth, intrinsic, camera_pose, depth_scale,
+                                    depth_trunc, stride,
+                                    project_valid_depth_only, row_offsets,
+                                    pointcloud->points_);
     }
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
-    int cnt = 0;
+    return pointcloud;
+}
+
+template <typename TC, int NC, bool kIdentityPose>
+void ProjectRGBDRows(const RGBDImage &image,
+                     const camera::PinholeCameraIntrinsic &intrinsic,
+                     const Eigen::Matrix4d &camera_pose,
+                     bool project_valid_depth_only,
+                     const std::vector<int> &row_offsets,
+                     std::vector<Eigen::Vector3d> &points,
+                     std::vector<Eigen::Vector3d> &colors) {
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    const double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (int i = 0; i < image.depth_.height_; i++) {
-        float *p = (float *)(image.depth_.data_.data() +
-                             i * image.depth_.BytesPerLine());
-        TC *pc = (TC *)(image.color_.data_.data() +
-                        i * image.color_.BytesPerLine());
+        const float *p = (const float *)(image.depth_.data_.data() +
+                                         i * image.depth_.BytesPerLine());
+        const TC *pc = (const TC *)(image.color_.data_.data() +
+                                    i * image.color_.BytesPerLine());
+        int cnt = row_offsets[i];
         for (int j = 0; j < image.depth_.width_; j++, p++, pc += NC) {
             if (*p > 0) {
                 double z = (double)(*p);
                 double x = (j - principal_point.first) * z / focal_length.first;
                 double y =
                         (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
+                if (kIdentityPose) {
+                    points[cnt] = Eigen::Vector3d(x, y, z);
+                } else {
+                    Eigen::Vector4d point =
+                            camera_pose * Eigen::Vector4d(x, y, z, 1.0);
+                    points[cnt] = point.block<3, 1>(0, 0);
+                }
+                colors[cnt++] =
                         Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
                         scale;
             } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt] = Eigen::Vector3d(x, y, z);
-                pointcloud->colors_[cnt++] =
+                double nan = std::numeric_limits<float>::quiet_NaN();
+                points[cnt] = Eigen::Vector3d(nan, nan, nan);
+                colors[cnt++] =
                         Eigen::Vector3d(std::numeric_limits<TC>::quiet_NaN(),
                                         std::numeric_limits<TC>::quiet_NaN(),
                                         std::numeric_limits<TC>::quiet_NaN());
             }
         }
     }
+}
+
+template <typename TC, int NC>
+std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        bool project_valid_depth_only) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    std::vector<int> row_offsets = BuildDepthRowOffsets<float>(
+            image.depth_, 1, project_valid_depth_only, 1.0,
+            std::numeric_limits<double>::infinity());
+    pointcloud->points_.resize(row_offsets.back());
+    pointcloud->colors_.resize(row_offsets.back());
+    if (extrinsic.isIdentity(0.0)) {
+        ProjectRGBDRows<TC, NC, true>(
+                image, intrinsic, Eigen::Matrix4d::Identity(),
+                project_valid_depth_only, row_offsets, pointcloud->points_,
+                pointcloud->colors_);
+    } else {
+        Eigen::Matrix4d camera_pose = extrinsic.inverse();
+        ProjectRGBDRows<TC, NC, false>(image, intrinsic, camera_pose,
+                                       project_valid_depth_only, row_offsets,
+                                       pointcloud->points_,
+                                       pointcloud->colors_);
+    }
     return pointcloud;
 }
 
@@ -156,14 +246,16 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
         bool project_valid_depth_only) {
     if (depth.num_of_channels_ == 1) {
         if (depth.bytes_per_channel_ == 2) {
-            auto float_depth =
-                    depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(
-                    *float_depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
+            // Raw uint16 depth is projected directly, with depth_scale and
+            // depth_trunc applied in the kernel; no float image is created.
+            return CreatePointCloudFromDepthImageT<uint16_t>(
+                    depth, intrinsic, extrinsic, depth_scale, depth_trunc,
+                    stride, project_valid_depth_only);
         } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(
-                    depth, intrinsic, extrinsic, stride,
+            // Float depth is metric and truncated already.
+            return CreatePointCloudFromDepthImageT<float>(
+                    depth, intrinsic, extrinsic, 1.0,
+                    std::numeric_limits<double>::infinity(), stride,
                     project_valid_depth_only);
         }
     }
@@ -30,11 +30,11 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
-#include <random>
 #include <unordered_set>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace geometry {
@@ -138,22 +138,14 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         const int ransac_n /* = 3 */,
         const int num_iterations /* = 100 */) const {
     RANSACResult result;
-    double error = 0;
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
+    // Initialize the best plane model ax + by + cz + d = 0.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
     // Initialize consensus set.
     std::vector<size_t> inliers;
 
     size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
 
     // Return if ransac_n is less than the required plane model parameters.
     if (ransac_n < 3) {
@@ -166,32 +158,56 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         return std::make_tuple(best_plane_model, inliers);
     }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+    // Hypotheses are independent, so iterations are distributed over threads;
+    // each thread draws from its own counter-based stream and keeps a
+    // running best, merged at the end.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        utility::random::Philox &rng = utility::random::GetThreadLocalEngine();
+        RANSACResult local_result;
+        Eigen::Vector4d local_best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+        std::vector<size_t> local_inliers;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int itr = 0; itr < num_iterations; itr++) {
+            // Sample three distinct points for the minimal plane model.
+            size_t sample[3];
+            utility::random::SampleWithoutReplacement(rng, num_points, 3,
+                                                      sample);
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
-        }
+            Eigen::Vector4d itr_plane_model =
+                    TriangleMesh::ComputeTrianglePlane(points_[sample[0]],
+                                                       points_[sample[1]],
+                                                       points_[sample[2]]);
+            if (itr_plane_model.isZero(0)) {
+                continue;
+            }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+            double itr_error = 0;
+            local_inliers.clear();
+            auto this_result = EvaluateRANSACBasedOnDistance(
+                    points_, itr_plane_model, local_inliers,
+                    distance_threshold, itr_error);
+            if (this_result.fitness_ > local_result.fitness_ ||
+                (this_result.fitness_ == local_result.fitness_ &&
+                 this_result.inlier_rmse_ < local_result.inlier_rmse_)) {
+                local_result = this_result;
+                local_best_plane_model = itr_plane_model;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical(SegmentPlaneReduction)
+#endif
+        {
+            if (local_result.fitness_ > result.fitness_ ||
+                (local_result.fitness_ == result.fitness_ &&
+                 local_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = local_result;
+                best_plane_model = local_best_plane_model;
+            }
         }
     }
 
@@ -215,5 +231,107 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     return std::make_tuple(best_plane_model, inliers);
 }
 
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const int num_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const size_t min_plane_points /* = 3 */) const {
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+        return planes;
+    }
+    if (num_planes <= 0) {
+        utility::LogError("num_planes should be positive.");
+        return planes;
+    }
+
+    utility::random::Philox &rng = utility::random::GetThreadLocalEngine();
+
+    // Indices of the points not yet claimed by an extracted plane. RANSAC
+    // samples from and evaluates against this shared active set, so no point
+    // subsets are copied between planes.
+    std::vector<size_t> active(points_.size());
+    std::iota(std::begin(active), std::end(active), 0);
+
+    for (int plane_idx = 0; plane_idx < num_planes; ++plane_idx) {
+        size_t num_active = active.size();
+        if (num_active < std::max(size_t(ransac_n), min_plane_points)) {
+            break;
+        }
+
+        RANSACResult result;
+        Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+        for (int itr = 0; itr < num_iterations; itr++) {
+            for (int i = 0; i < 3; ++i) {
+                std::swap(active[i],
+                          active[rng.BoundedUInt32(uint32_t(num_active))]);
+            }
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points_[active[0]], points_[active[1]],
+                    points_[active[2]]);
+            if (plane_model.isZero(0)) {
+                continue;
+            }
+
+            double error = 0;
+            size_t inlier_num = 0;
+            for (size_t idx : active) {
+                Eigen::Vector4d point(points_[idx](0), points_[idx](1),
+                                      points_[idx](2), 1);
+                double distance = std::abs(plane_model.dot(point));
+                if (distance < distance_threshold) {
+                    error += distance;
+                    inlier_num++;
+                }
+            }
+
+            RANSACResult this_result;
+            if (inlier_num > 0) {
+                this_result.fitness_ =
+                        (double)inlier_num / (double)num_active;
+                this_result.inlier_rmse_ =
+                        error / std::sqrt((double)inlier_num);
+            }
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = plane_model;
+            }
+        }
+        if (best_plane_model.isZero(0)) {
+            break;
+        }
+
+        // Collect the final inliers of this plane and shrink the active set.
+        std::vector<size_t> inliers;
+        std::vector<size_t> remaining;
+        remaining.reserve(num_active);
+        for (size_t idx : active) {
+            Eigen::Vector4d point(points_[idx](0), points_[idx](1),
+                                  points_[idx](2), 1);
+            if (std::abs(best_plane_model.dot(point)) < distance_threshold) {
+                inliers.emplace_back(idx);
+            } else {
+                remaining.emplace_back(idx);
+            }
+        }
+        if (inliers.size() < min_plane_points) {
+            break;
+        }
+        best_plane_model = GetPlaneFromPoints(points_, inliers);
+        utility::LogDebug(
+                "RANSAC plane {:d} | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
+                plane_idx, inliers.size(), result.fitness_,
+                result.inlier_rmse_);
+        planes.emplace_back(best_plane_model, std::move(inliers));
+        active = std::move(remaining);
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,303 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloudSoA.h"
+
+#include <Eigen/Eigenvalues>
+#include <limits>
+#include <unordered_map>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Accumulates sums of one float channel group per voxel; mirrors
+// AccumulatedPoint in PointCloud.cpp for the SoA layout.
+struct AccumulatedChannels {
+    int count_ = 0;
+    float x_ = 0, y_ = 0, z_ = 0;
+    float nx_ = 0, ny_ = 0, nz_ = 0;
+    float r_ = 0, g_ = 0, b_ = 0;
+};
+
+}  // namespace
+
+PointCloudSoA &PointCloudSoA::Clear() {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    nx_.clear();
+    ny_.clear();
+    nz_.clear();
+    r_.clear();
+    g_.clear();
+    b_.clear();
+    return *this;
+}
+
+void PointCloudSoA::Resize(size_t num_points) {
+    x_.resize(num_points);
+    y_.resize(num_points);
+    z_.resize(num_points);
+    if (!nx_.empty()) {
+        nx_.resize(num_points);
+        ny_.resize(num_points);
+        nz_.resize(num_points);
+    }
+    if (!r_.empty()) {
+        r_.resize(num_points);
+        g_.resize(num_points);
+        b_.resize(num_points);
+    }
+}
+
+PointCloudSoA &PointCloudSoA::Transform(
+        const Eigen::Matrix4d &transformation) {
+    const Eigen::Matrix4f t = transformation.cast<float>();
+    const float t00 = t(0, 0), t01 = t(0, 1), t02 = t(0, 2), t03 = t(0, 3);
+    const float t10 = t(1, 0), t11 = t(1, 1), t12 = t(1, 2), t13 = t(1, 3);
+    const float t20 = t(2, 0), t21 = t(2, 1), t22 = t(2, 2), t23 = t(2, 3);
+    float *px = x_.data(), *py = y_.data(), *pz = z_.data();
+    const int64_t n = (int64_t)x_.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < n; i++) {
+        const float x = px[i], y = py[i], z = pz[i];
+        px[i] = t00 * x + t01 * y + t02 * z + t03;
+        py[i] = t10 * x + t11 * y + t12 * z + t13;
+        pz[i] = t20 * x + t21 * y + t22 * z + t23;
+    }
+    if (HasNormals()) {
+        float *pnx = nx_.data(), *pny = ny_.data(), *pnz = nz_.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < n; i++) {
+            const float x = pnx[i], y = pny[i], z = pnz[i];
+            pnx[i] = t00 * x + t01 * y + t02 * z;
+            pny[i] = t10 * x + t11 * y + t12 * z;
+            pnz[i] = t20 * x + t21 * y + t22 * z;
+        }
+    }
+    return *this;
+}
+
+std::shared_ptr<PointCloudSoA> PointCloudSoA::VoxelDownSample(
+        double voxel_size) const {
+    auto output = std::make_shared<PointCloudSoA>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
+    }
+    if (IsEmpty()) {
+        return output;
+    }
+    float min_x = x_[0], min_y = y_[0], min_z = z_[0];
+    for (size_t i = 1; i < x_.size(); i++) {
+        min_x = std::min(min_x, x_[i]);
+        min_y = std::min(min_y, y_[i]);
+        min_z = std::min(min_z, z_[i]);
+    }
+    const float inv_voxel_size = float(1.0 / voxel_size);
+    const float bx = min_x - float(voxel_size) * 0.5f;
+    const float by = min_y - float(voxel_size) * 0.5f;
+    const float bz = min_z - float(voxel_size) * 0.5f;
+    const bool has_normals = HasNormals();
+    const bool has_colors = HasColors();
+    std::unordered_map<Eigen::Vector3i, AccumulatedChannels,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxelindex_to_accpoint;
+    for (size_t i = 0; i < x_.size(); i++) {
+        Eigen::Vector3i voxel_index(int(floor((x_[i] - bx) * inv_voxel_size)),
+                                    int(floor((y_[i] - by) * inv_voxel_size)),
+                                    int(floor((z_[i] - bz) * inv_voxel_size)));
+        auto &acc = voxelindex_to_accpoint[voxel_index];
+        acc.count_++;
+        acc.x_ += x_[i];
+        acc.y_ += y_[i];
+        acc.z_ += z_[i];
+        if (has_normals) {
+            acc.nx_ += nx_[i];
+            acc.ny_ += ny_[i];
+            acc.nz_ += nz_[i];
+        }
+        if (has_colors) {
+            acc.r_ += r_[i];
+            acc.g_ += g_[i];
+            acc.b_ += b_[i];
+        }
+    }
+    for (const auto &accpoint : voxelindex_to_accpoint) {
+        const auto &acc = accpoint.second;
+        const float inv_count = 1.0f / float(acc.count_);
+        output->x_.push_back(acc.x_ * inv_count);
+        output->y_.push_back(acc.y_ * inv_count);
+        output->z_.push_back(acc.z_ * inv_count);
+        if (has_normals) {
+            output->nx_.push_back(acc.nx_ * inv_count);
+            output->ny_.push_back(acc.ny_ * inv_count);
+            output->nz_.push_back(acc.nz_ * inv_count);
+        }
+        if (has_colors) {
+            output->r_.push_back(acc.r_ * inv_count);
+            output->g_.push_back(acc.g_ * inv_count);
+            output->b_.push_back(acc.b_ * inv_count);
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)x_.size(), (int)output->x_.size());
+    return output;
+}
+
+void PointCloudSoA::EstimateNormals(const KDTreeSearchParam &search_param) {
+    const size_t n = x_.size();
+    Eigen::MatrixXd data(3, n);
+    for (size_t i = 0; i < n; i++) {
+        data(0, i) = x_[i];
+        data(1, i) = y_[i];
+        data(2, i) = z_[i];
+    }
+    KDTreeFlann kdtree(data);
+    nx_.resize(n);
+    ny_.resize(n);
+    nz_.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < (int64_t)n; i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        Eigen::Vector3f normal(0.0, 0.0, 1.0);
+        // Materialize the query so the call binds to the explicitly
+        // instantiated Eigen::Vector3d overload of Search.
+        if (kdtree.Search(Eigen::Vector3d(data.col(i)), search_param, indices,
+                          distance2) >= 3) {
+            // Accumulate the covariance in float over the SoA channels so
+            // the inner loop vectorizes.
+            float mx = 0, my = 0, mz = 0;
+            for (int idx : indices) {
+                mx += x_[idx];
+                my += y_[idx];
+                mz += z_[idx];
+            }
+            const float inv_count = 1.0f / float(indices.size());
+            mx *= inv_count;
+            my *= inv_count;
+            mz *= inv_count;
+            float cxx = 0, cxy = 0, cxz = 0, cyy = 0, cyz = 0, czz = 0;
+            for (int idx : indices) {
+                const float dx = x_[idx] - mx;
+                const float dy = y_[idx] - my;
+                const float dz = z_[idx] - mz;
+                cxx += dx * dx;
+                cxy += dx * dy;
+                cxz += dx * dz;
+                cyy += dy * dy;
+                cyz += dy * dz;
+                czz += dz * dz;
+            }
+            Eigen::Matrix3f covariance;
+            covariance << cxx, cxy, cxz, cxy, cyy, cyz, cxz, cyz, czz;
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> solver;
+            solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+            normal = solver.eigenvectors().col(0);
+            if (normal.norm() == 0.0f) {
+                normal = Eigen::Vector3f(0.0, 0.0, 1.0);
+            }
+        }
+        nx_[i] = normal(0);
+        ny_[i] = normal(1);
+        nz_[i] = normal(2);
+    }
+}
+
+std::shared_ptr<PointCloudSoA> PointCloudSoA::FromLegacy(
+        const PointCloud &pcd) {
+    auto output = std::make_shared<PointCloudSoA>();
+    const size_t n = pcd.points_.size();
+    output->x_.resize(n);
+    output->y_.resize(n);
+    output->z_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        output->x_[i] = float(pcd.points_[i](0));
+        output->y_[i] = float(pcd.points_[i](1));
+        output->z_[i] = float(pcd.points_[i](2));
+    }
+    if (pcd.HasNormals()) {
+        output->nx_.resize(n);
+        output->ny_.resize(n);
+        output->nz_.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            output->nx_[i] = float(pcd.normals_[i](0));
+            output->ny_[i] = float(pcd.normals_[i](1));
+            output->nz_[i] = float(pcd.normals_[i](2));
+        }
+    }
+    if (pcd.HasColors()) {
+        output->r_.resize(n);
+        output->g_.resize(n);
+        output->b_.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            output->r_[i] = float(pcd.colors_[i](0));
+            output->g_[i] = float(pcd.colors_[i](1));
+            output->b_[i] = float(pcd.colors_[i](2));
+        }
+    }
+    return output;
+}
+
+std::shared_ptr<PointCloud> PointCloudSoA::ToLegacy() const {
+    auto output = std::make_shared<PointCloud>();
+    const size_t n = x_.size();
+    output->points_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        output->points_[i] = Eigen::Vector3d(x_[i], y_[i], z_[i]);
+    }
+    if (HasNormals()) {
+        output->normals_.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            output->normals_[i] = Eigen::Vector3d(nx_[i], ny_[i], nz_[i]);
+        }
+    }
+    if (HasColors()) {
+        output->colors_.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            output->colors_[i] = Eigen::Vector3d(r_[i], g_[i], b_[i]);
+        }
+    }
+    return output;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class PointCloudSoA
+///
+/// \brief Structure-of-arrays storage for large point clouds.
+///
+/// Stores point attributes as separate contiguous float channels (x/y/z,
+/// nx/ny/nz, r/g/b) instead of interleaved Eigen::Vector3d elements. The
+/// per-channel layout allows the per-point kernels implemented here
+/// (Transform, VoxelDownSample, EstimateNormals) to be auto-vectorized and
+/// roughly halves the memory footprint compared to geometry::PointCloud.
+/// Use FromLegacy/ToLegacy to move between the two representations.
+class PointCloudSoA {
+public:
+    PointCloudSoA() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_points Number of points to preallocate in each channel.
+    explicit PointCloudSoA(size_t num_points) { Resize(num_points); }
+
+    /// Returns the number of points.
+    size_t size() const { return x_.size(); }
+    /// Returns `true` if the point cloud contains no points.
+    bool IsEmpty() const { return x_.empty(); }
+    /// Returns `true` if the point cloud contains point normals.
+    bool HasNormals() const {
+        return !x_.empty() && nx_.size() == x_.size();
+    }
+    /// Returns `true` if the point cloud contains point colors.
+    bool HasColors() const { return !x_.empty() && r_.size() == x_.size(); }
+
+    /// Removes all points.
+    PointCloudSoA &Clear();
+    /// Resizes all allocated channels to \p num_points points.
+    void Resize(size_t num_points);
+
+    /// \brief Applies the 4x4 transformation matrix to all point coordinates
+    /// and rotates normals when present.
+    ///
+    /// \param transformation 4x4 matrix for transformation.
+    PointCloudSoA &Transform(const Eigen::Matrix4d &transformation);
+
+    /// \brief Downsamples the point cloud on a voxel grid, averaging point
+    /// coordinates, normals and colors per occupied voxel.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid.
+    std::shared_ptr<PointCloudSoA> VoxelDownSample(double voxel_size) const;
+
+    /// \brief Estimates per-point normals from local covariance, writing the
+    /// result to the nx/ny/nz channels.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    void EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
+
+    /// Returns the i-th point as an Eigen vector.
+    Eigen::Vector3d GetPoint(size_t i) const {
+        return Eigen::Vector3d(x_[i], y_[i], z_[i]);
+    }
+
+    /// \brief Creates SoA storage from a geometry::PointCloud, converting the
+    /// double-precision channels to float.
+    static std::shared_ptr<PointCloudSoA> FromLegacy(const PointCloud &pcd);
+    /// Converts back to the interleaved geometry::PointCloud representation.
+    std::shared_ptr<PointCloud> ToLegacy() const;
+
+public:
+    /// Contiguous per-axis point coordinates.
+    std::vector<float> x_, y_, z_;
+    /// Contiguous per-axis point normals; empty if not present.
+    std::vector<float> nx_, ny_, nz_;
+    /// Contiguous per-channel point colors; empty if not present.
+    std::vector<float> r_, g_, b_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
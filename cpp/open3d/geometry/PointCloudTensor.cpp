@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// A std::vector<Eigen::Vector3d> is a contiguous array of 3 * N doubles,
+// which is what lets the bridges below copy flat or alias the storage.
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+              "Eigen::Vector3d is expected to be packed.");
+
+/// Imports a (N, 3) Float64 or Float32 tensor into \p dst. Float64 CPU
+/// tensors are copied with one std::memcpy; Float32 tensors are
+/// converted in a single parallel pass; CUDA tensors are copied to the
+/// host first.
+void TensorToVector3dVector(const core::Tensor &tensor,
+                            const std::string &name,
+                            std::vector<Eigen::Vector3d> &dst) {
+    if (tensor.NumDims() != 2 || tensor.GetShape()[1] != 3) {
+        utility::LogError("Attribute \"{}\" must have shape (N, 3), but {} "
+                          "was given.",
+                          name, tensor.GetShape().ToString());
+    }
+    core::Tensor cpu_tensor =
+            tensor.GetDevice().GetType() == core::Device::DeviceType::CPU
+                    ? tensor.Contiguous()
+                    : tensor.Copy(core::Device("CPU:0"));
+    int64_t num_points = cpu_tensor.GetShape()[0];
+    dst.resize(num_points);
+    if (cpu_tensor.GetDtype() == core::Dtype::Float64) {
+        // Cast through void*: Eigen::Vector3d is trivially copyable in
+        // effect (see the static_assert above) but not in the type
+        // system, and GCC rejects the direct memcpy as class-memaccess.
+        std::memcpy(static_cast<void *>(dst.data()), cpu_tensor.GetDataPtr(),
+                    num_points * 3 * sizeof(double));
+    } else if (cpu_tensor.GetDtype() == core::Dtype::Float32) {
+        const float *src_ptr =
+                static_cast<const float *>(cpu_tensor.GetDataPtr());
+        double *dst_ptr = reinterpret_cast<double *>(dst.data());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_points * 3; i++) {
+            dst_ptr[i] = static_cast<double>(src_ptr[i]);
+        }
+    } else {
+        utility::LogError("Attribute \"{}\" must be of dtype Float64 or "
+                          "Float32, but {} was given.",
+                          name, core::DtypeUtil::ToString(tensor.GetDtype()));
+    }
+}
+
+/// Returns a (N, 3) Float64 tensor aliasing \p vec without copying. The
+/// blob carries a no-op deleter, so the tensor never frees the memory;
+/// the caller guarantees the vector outlives the view.
+core::Tensor Vector3dVectorToTensorView(std::vector<Eigen::Vector3d> &vec) {
+    core::SizeVector shape{static_cast<int64_t>(vec.size()), 3};
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"),
+                                             static_cast<void *>(vec.data()),
+                                             [](void *) {});
+    return core::Tensor(shape, core::Tensor::DefaultStrides(shape),
+                        vec.data(), core::Dtype::Float64, blob);
+}
+
+}  // unnamed namespace
+
+PointCloud PointCloud::FromTensor(const core::Tensor &points,
+                                  const core::Tensor &normals,
+                                  const core::Tensor &colors) {
+    PointCloud pcd;
+    TensorToVector3dVector(points, "points", pcd.points_);
+    if (normals.GetBlob() != nullptr) {
+        TensorToVector3dVector(normals, "normals", pcd.normals_);
+        if (pcd.normals_.size() != pcd.points_.size()) {
+            utility::LogError("Expected {} normals, but {} were given.",
+                              pcd.points_.size(), pcd.normals_.size());
+        }
+    }
+    if (colors.GetBlob() != nullptr) {
+        TensorToVector3dVector(colors, "colors", pcd.colors_);
+        if (pcd.colors_.size() != pcd.points_.size()) {
+            utility::LogError("Expected {} colors, but {} were given.",
+                              pcd.points_.size(), pcd.colors_.size());
+        }
+    }
+    return pcd;
+}
+
+std::unordered_map<std::string, core::Tensor> PointCloud::ToTensorMap() {
+    std::unordered_map<std::string, core::Tensor> tensor_map;
+    if (HasPoints()) {
+        tensor_map.emplace("points", Vector3dVectorToTensorView(points_));
+    }
+    if (HasNormals()) {
+        tensor_map.emplace("normals", Vector3dVectorToTensorView(normals_));
+    }
+    if (HasColors()) {
+        tensor_map.emplace("colors", Vector3dVectorToTensorView(colors_));
+    }
+    return tensor_map;
+}
+
+}  // namespace geometry
+}  // namespace open3d
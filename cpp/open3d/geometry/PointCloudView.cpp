@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloudView.h"
+
+#include <numeric>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+PointCloudView::PointCloudView(const PointCloud &parent,
+                               std::vector<size_t> indices)
+    : parent_(&parent), indices_(std::move(indices)) {
+    for (size_t idx : indices_) {
+        if (idx >= parent.points_.size()) {
+            utility::LogError(
+                    "[PointCloudView] Index {:d} out of range (parent has "
+                    "{:d} points).",
+                    idx, parent.points_.size());
+        }
+    }
+}
+
+PointCloudView::PointCloudView(const PointCloud &parent)
+    : parent_(&parent), indices_(parent.points_.size()) {
+    std::iota(indices_.begin(), indices_.end(), 0);
+}
+
+PointCloudView PointCloudView::Crop(const PointCloud &parent,
+                                    const AxisAlignedBoundingBox &bbox) {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[PointCloudView::Crop] AxisAlignedBoundingBox either has "
+                "zeros size, or has wrong bounds.");
+    }
+    std::vector<size_t> indices =
+            bbox.GetPointIndicesWithinBoundingBox(parent.points_);
+    return PointCloudView(parent, std::move(indices));
+}
+
+bool PointCloudView::HasNormals() const { return parent_->HasNormals(); }
+
+bool PointCloudView::HasColors() const { return parent_->HasColors(); }
+
+const Eigen::Vector3d &PointCloudView::GetPoint(size_t i) const {
+    return parent_->points_[indices_[i]];
+}
+
+const Eigen::Vector3d &PointCloudView::GetNormal(size_t i) const {
+    return parent_->normals_[indices_[i]];
+}
+
+const Eigen::Vector3d &PointCloudView::GetColor(size_t i) const {
+    return parent_->colors_[indices_[i]];
+}
+
+Eigen::Vector3d PointCloudView::GetMinBound() const {
+    if (indices_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3d min_bound = GetPoint(0);
+    for (size_t i = 1; i < indices_.size(); i++) {
+        min_bound = min_bound.array().min(GetPoint(i).array()).matrix();
+    }
+    return min_bound;
+}
+
+Eigen::Vector3d PointCloudView::GetMaxBound() const {
+    if (indices_.empty()) {
+        return Eigen::Vector3d(0.0, 0.0, 0.0);
+    }
+    Eigen::Vector3d max_bound = GetPoint(0);
+    for (size_t i = 1; i < indices_.size(); i++) {
+        max_bound = max_bound.array().max(GetPoint(i).array()).matrix();
+    }
+    return max_bound;
+}
+
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d>
+PointCloudView::ComputeMeanAndCovariance() const {
+    if (indices_.empty()) {
+        return std::make_tuple(Eigen::Vector3d::Zero(),
+                               Eigen::Matrix3d::Identity());
+    }
+    Eigen::Matrix<double, 9, 1> cumulants;
+    cumulants.setZero();
+    for (size_t i = 0; i < indices_.size(); i++) {
+        const Eigen::Vector3d &point = GetPoint(i);
+        cumulants(0) += point(0);
+        cumulants(1) += point(1);
+        cumulants(2) += point(2);
+        cumulants(3) += point(0) * point(0);
+        cumulants(4) += point(0) * point(1);
+        cumulants(5) += point(0) * point(2);
+        cumulants(6) += point(1) * point(1);
+        cumulants(7) += point(1) * point(2);
+        cumulants(8) += point(2) * point(2);
+    }
+    cumulants /= (double)indices_.size();
+    Eigen::Vector3d mean(cumulants(0), cumulants(1), cumulants(2));
+    Eigen::Matrix3d covariance;
+    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
+    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
+    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
+    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
+    covariance(1, 0) = covariance(0, 1);
+    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
+    covariance(2, 0) = covariance(0, 2);
+    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
+    covariance(2, 1) = covariance(1, 2);
+    return std::make_tuple(mean, covariance);
+}
+
+PointCloudView PointCloudView::SelectByIndex(
+        const std::vector<size_t> &indices) const {
+    std::vector<size_t> parent_indices;
+    parent_indices.reserve(indices.size());
+    for (size_t i : indices) {
+        if (i >= indices_.size()) {
+            utility::LogError(
+                    "[PointCloudView::SelectByIndex] Index {:d} out of range "
+                    "(view has {:d} points).",
+                    i, indices_.size());
+        }
+        parent_indices.push_back(indices_[i]);
+    }
+    return PointCloudView(*parent_, std::move(parent_indices));
+}
+
+std::shared_ptr<PointCloud> PointCloudView::ToPointCloud() const {
+    return parent_->SelectByIndex(indices_);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class AxisAlignedBoundingBox;
+class PointCloud;
+
+/// \class PointCloudView
+///
+/// \brief Non-owning, index-based view over a parent PointCloud.
+///
+/// A view stores only a list of indices into its parent, so cropping or
+/// selecting a subset does not copy point, normal or color data. The parent
+/// must outlive the view and must not be resized while views reference it.
+/// Views can be materialized into stand-alone point clouds with
+/// ToPointCloud() when a downstream API requires one.
+class PointCloudView {
+public:
+    /// \brief Creates a view over \p parent selecting \p indices.
+    ///
+    /// \param parent The point cloud the view refers into.
+    /// \param indices Indices of the viewed points.
+    PointCloudView(const PointCloud &parent, std::vector<size_t> indices);
+
+    /// \brief Creates a view over all points of \p parent.
+    explicit PointCloudView(const PointCloud &parent);
+
+    /// \brief Creates a view of the points of \p parent inside \p bbox
+    /// without copying attribute data.
+    static PointCloudView Crop(const PointCloud &parent,
+                               const AxisAlignedBoundingBox &bbox);
+
+    /// Returns the number of points in the view.
+    size_t size() const { return indices_.size(); }
+    /// Returns `true` if the view selects no points.
+    bool IsEmpty() const { return indices_.empty(); }
+    /// Returns `true` if the parent has point normals.
+    bool HasNormals() const;
+    /// Returns `true` if the parent has point colors.
+    bool HasColors() const;
+
+    /// Returns the parent index of the i-th viewed point.
+    size_t GetIndex(size_t i) const { return indices_[i]; }
+    /// Returns the i-th viewed point (by reference into the parent).
+    const Eigen::Vector3d &GetPoint(size_t i) const;
+    /// Returns the normal of the i-th viewed point.
+    const Eigen::Vector3d &GetNormal(size_t i) const;
+    /// Returns the color of the i-th viewed point.
+    const Eigen::Vector3d &GetColor(size_t i) const;
+
+    /// Returns the parent point cloud.
+    const PointCloud &GetParent() const { return *parent_; }
+    /// Returns the parent indices selected by the view.
+    const std::vector<size_t> &GetIndices() const { return indices_; }
+
+    Eigen::Vector3d GetMinBound() const;
+    Eigen::Vector3d GetMaxBound() const;
+
+    /// Function to compute the mean and covariance matrix of the viewed
+    /// points.
+    std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance()
+            const;
+
+    /// \brief Restricts the view further with indices relative to the view.
+    ///
+    /// \param indices Indices into this view (not into the parent).
+    PointCloudView SelectByIndex(const std::vector<size_t> &indices) const;
+
+    /// Materializes the view into an owning point cloud (copies data).
+    std::shared_ptr<PointCloud> ToPointCloud() const;
+
+private:
+    const PointCloud *parent_;
+    std::vector<size_t> indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -38,25 +38,18 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Runs qhull on a raw coordinate buffer (x0 y0 z0 x1 y1 z1 ...) and
+/// extracts the hull mesh. Each call uses its own qhull instance, so
+/// independent hulls can be computed concurrently.
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
+ComputeConvexHullFromBuffer(const double* qhull_points_data, int num_points) {
     auto convex_hull = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
-    }
-
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(), "Qt");
+    qhull.runQhull("", 3, num_points, qhull_points_data, "Qt");
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     convex_hull->triangles_.resize(facets.count());
@@ -101,6 +94,79 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
     return std::make_tuple(convex_hull, pt_map);
 }
 
+/// Shared implementation of the batched hull computation. The coordinates
+/// of each point set are written directly into a per-thread scratch buffer
+/// that is reused across hulls, so small hulls do not allocate per call.
+template <class EigenVector3>
+std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+ComputeConvexHullBatchImpl(
+        const std::vector<std::vector<EigenVector3>>& batch_points) {
+    std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+            hulls(batch_points.size());
+    int num_failures = 0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : num_failures)
+#endif
+    {
+        std::vector<double> scratch;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int bidx = 0; bidx < int(batch_points.size()); ++bidx) {
+            const std::vector<EigenVector3>& points = batch_points[bidx];
+            scratch.resize(points.size() * 3);
+            for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+                const EigenVector3& pt = points[pidx];
+                scratch[pidx * 3 + 0] = double(pt(0));
+                scratch[pidx * 3 + 1] = double(pt(1));
+                scratch[pidx * 3 + 2] = double(pt(2));
+            }
+            try {
+                hulls[bidx] = ComputeConvexHullFromBuffer(
+                        scratch.data(), int(points.size()));
+            } catch (const std::exception&) {
+                hulls[bidx] = std::make_tuple(std::make_shared<TriangleMesh>(),
+                                              std::vector<size_t>());
+                num_failures++;
+            }
+        }
+    }
+    if (num_failures > 0) {
+        utility::LogWarning(
+                "[ComputeConvexHullBatch] qhull failed on {:d} of {:d} point "
+                "sets, returning empty hulls for those.",
+                num_failures, int(batch_points.size()));
+    }
+    return hulls;
+}
+
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points) {
+    std::vector<double> qhull_points_data(points.size() * 3);
+    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
+        const auto& pt = points[pidx];
+        qhull_points_data[pidx * 3 + 0] = pt(0);
+        qhull_points_data[pidx * 3 + 1] = pt(1);
+        qhull_points_data[pidx * 3 + 2] = pt(2);
+    }
+    return ComputeConvexHullFromBuffer(qhull_points_data.data(),
+                                       int(points.size()));
+}
+
+std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+Qhull::ComputeConvexHullBatch(
+        const std::vector<std::vector<Eigen::Vector3d>>& batch_points) {
+    return ComputeConvexHullBatchImpl(batch_points);
+}
+
+std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+Qhull::ComputeConvexHullBatch(
+        const std::vector<std::vector<Eigen::Vector3f>>& batch_points) {
+    return ComputeConvexHullBatchImpl(batch_points);
+}
+
 std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
 Qhull::ComputeDelaunayTetrahedralization(
         const std::vector<Eigen::Vector3d>& points) {
@@ -41,6 +41,33 @@ public:
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
     ComputeConvexHull(const std::vector<Eigen::Vector3d>& points);
 
+    /// \brief Computes the convex hull of many independent point sets.
+    ///
+    /// The hulls are computed across OpenMP threads and the per-hull qhull
+    /// input buffer is reused within each thread, which avoids the repeated
+    /// allocations of calling ComputeConvexHull in a loop over many small
+    /// point sets. Point sets that fail (e.g. degenerate input) yield an
+    /// empty mesh in the result instead of throwing.
+    ///
+    /// \param batch_points One point set per hull to compute.
+    /// \return One (hull mesh, point map) tuple per input point set, in the
+    /// same order.
+    static std::vector<
+            std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+    ComputeConvexHullBatch(
+            const std::vector<std::vector<Eigen::Vector3d>>& batch_points);
+
+    /// \brief Computes the convex hull of many independent float point sets.
+    ///
+    /// Same as the double overload, but the float coordinates are written
+    /// directly into the qhull input buffer without an intermediate
+    /// double-precision point list. qhull itself always computes in double
+    /// precision.
+    static std::vector<
+            std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+    ComputeConvexHullBatch(
+            const std::vector<std::vector<Eigen::Vector3f>>& batch_points);
+
     static std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
     ComputeDelaunayTetrahedralization(
             const std::vector<Eigen::Vector3d>& points);
@@ -49,17 +49,40 @@ Eigen::Vector2d RGBDImage::GetMaxBound() const {
 
 RGBDImagePyramid RGBDImage::FilterPyramid(
         const RGBDImagePyramid &rgbd_image_pyramid, Image::FilterType type) {
-    RGBDImagePyramid rgbd_image_pyramid_filtered;
-    rgbd_image_pyramid_filtered.clear();
     int num_of_levels = (int)rgbd_image_pyramid.size();
+    // The format check is hoisted out of the filter loop so that Filter
+    // cannot throw from inside the parallel region below.
     for (int level = 0; level < num_of_levels; level++) {
-        auto color_level = rgbd_image_pyramid[level]->color_;
-        auto depth_level = rgbd_image_pyramid[level]->depth_;
-        auto color_level_filtered = color_level.Filter(type);
-        auto depth_level_filtered = depth_level.Filter(type);
-        auto rgbd_image_level_filtered = std::make_shared<RGBDImage>(
-                RGBDImage(*color_level_filtered, *depth_level_filtered));
-        rgbd_image_pyramid_filtered.push_back(rgbd_image_level_filtered);
+        const RGBDImage &rgbd_image_level = *rgbd_image_pyramid[level];
+        if (rgbd_image_level.color_.num_of_channels_ != 1 ||
+            rgbd_image_level.color_.bytes_per_channel_ != 4 ||
+            rgbd_image_level.depth_.num_of_channels_ != 1 ||
+            rgbd_image_level.depth_.bytes_per_channel_ != 4) {
+            utility::LogError("[FilterPyramid] Unsupported image format.");
+        }
+    }
+    // Every color and depth level is filtered independently of the others,
+    // so the 2 * num_of_levels filter runs form one flat task list; dynamic
+    // scheduling balances the shrinking level sizes.
+    std::vector<std::shared_ptr<Image>> color_filtered(num_of_levels);
+    std::vector<std::shared_ptr<Image>> depth_filtered(num_of_levels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int task = 0; task < 2 * num_of_levels; task++) {
+        int level = task / 2;
+        if (task % 2 == 0) {
+            color_filtered[level] =
+                    rgbd_image_pyramid[level]->color_.Filter(type);
+        } else {
+            depth_filtered[level] =
+                    rgbd_image_pyramid[level]->depth_.Filter(type);
+        }
+    }
+    RGBDImagePyramid rgbd_image_pyramid_filtered;
+    for (int level = 0; level < num_of_levels; level++) {
+        rgbd_image_pyramid_filtered.push_back(std::make_shared<RGBDImage>(
+                RGBDImage(*color_filtered[level], *depth_filtered[level])));
     }
     return rgbd_image_pyramid_filtered;
 }
@@ -68,10 +91,36 @@ RGBDImagePyramid RGBDImage::CreatePyramid(
         size_t num_of_levels,
         bool with_gaussian_filter_for_color /* = true */,
         bool with_gaussian_filter_for_depth /* = false */) const {
-    ImagePyramid color_pyramid =
-            color_.CreatePyramid(num_of_levels, with_gaussian_filter_for_color);
-    ImagePyramid depth_pyramid =
-            depth_.CreatePyramid(num_of_levels, with_gaussian_filter_for_depth);
+    // The format check is hoisted out of Image::CreatePyramid so that it
+    // cannot throw from inside the parallel sections below.
+    if (color_.num_of_channels_ != 1 || color_.bytes_per_channel_ != 4 ||
+        depth_.num_of_channels_ != 1 || depth_.bytes_per_channel_ != 4) {
+        utility::LogError("[CreatePyramid] Unsupported image format.");
+    }
+    // Each pyramid is a serial chain (every level is built from the one
+    // above), but the color and depth chains are independent, so they run
+    // as two overlapping sections.
+    ImagePyramid color_pyramid;
+    ImagePyramid depth_pyramid;
+#ifdef _OPENMP
+#pragma omp parallel sections
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+        {
+            color_pyramid = color_.CreatePyramid(
+                    num_of_levels, with_gaussian_filter_for_color);
+        }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+        {
+            depth_pyramid = depth_.CreatePyramid(
+                    num_of_levels, with_gaussian_filter_for_depth);
+        }
+    }
     RGBDImagePyramid rgbd_image_pyramid;
     rgbd_image_pyramid.clear();
     for (size_t level = 0; level < num_of_levels; level++) {
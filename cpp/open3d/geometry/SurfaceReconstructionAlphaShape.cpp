@@ -32,8 +32,11 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
+#include <numeric>
+#include <tuple>
 
 namespace open3d {
 namespace geometry {
@@ -75,7 +78,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
             "[CreateFromPointCloudAlphaShape] done init triangle mesh");
 
     std::vector<double> vsqn(tetra_mesh->vertices_.size());
-    for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(vsqn.size()); ++vidx) {
         vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
     }
 
@@ -83,7 +89,16 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
             "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
             "satisfy constraint");
     const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
+    // The circumradius test is independent per tetrahedron, so the filter
+    // runs in parallel into a flag array; the triangles of the surviving
+    // tetrahedra are then written to their precomputed offsets, which keeps
+    // the output order identical to the serial version.
+    std::vector<char> tetra_valid(tetra_mesh->tetras_.size(), 1);
+    bool has_invalid_tetra = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(tetra_mesh->tetras_.size()); ++tidx) {
         const auto& tetra = tetra_mesh->tetras_[tidx];
         // clang-format off
         Eigen::Matrix4d tmp;
@@ -114,23 +129,42 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogError(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            has_invalid_tetra = true;
+            tetra_valid[tidx] = 0;
+            continue;
         }
         double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
                    (2 * std::abs(a));
+        tetra_valid[tidx] = r <= alpha ? 1 : 0;
+    }
+    if (has_invalid_tetra) {
+        utility::LogError(
+                "[CreateFromPointCloudAlphaShape] invalid tetra in TetraMesh");
+    }
 
-        if (r <= alpha) {
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(2)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(1), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(0), tetra(2), tetra(3)));
-            mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                    tetra(1), tetra(2), tetra(3)));
+    std::vector<size_t> triangle_offsets(tetra_mesh->tetras_.size() + 1, 0);
+    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
+        triangle_offsets[tidx + 1] =
+                triangle_offsets[tidx] + (tetra_valid[tidx] ? 4 : 0);
+    }
+    mesh->triangles_.resize(triangle_offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(tetra_mesh->tetras_.size()); ++tidx) {
+        if (!tetra_valid[tidx]) {
+            continue;
         }
+        const auto& tetra = tetra_mesh->tetras_[tidx];
+        size_t offset = triangle_offsets[tidx];
+        mesh->triangles_[offset + 0] =
+                TriangleMesh::GetOrderedTriangle(tetra(0), tetra(1), tetra(2));
+        mesh->triangles_[offset + 1] =
+                TriangleMesh::GetOrderedTriangle(tetra(0), tetra(1), tetra(3));
+        mesh->triangles_[offset + 2] =
+                TriangleMesh::GetOrderedTriangle(tetra(0), tetra(2), tetra(3));
+        mesh->triangles_[offset + 3] =
+                TriangleMesh::GetOrderedTriangle(tetra(1), tetra(2), tetra(3));
     }
     utility::LogDebug(
             "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
@@ -139,23 +173,38 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
     utility::LogDebug(
             "[CreateFromPointCloudAlphaShape] remove triangles within "
             "the mesh");
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
-        } else {
-            triangle_count[triangle] += 1;
+    // Interior triangles are shared by two tetrahedra and occur twice in the
+    // list; surface triangles occur once. Sorting an index array groups the
+    // occurrences without the hash map, and groups are marked in parallel.
+    const size_t num_triangles = mesh->triangles_.size();
+    std::vector<size_t> order(num_triangles);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        const Eigen::Vector3i& tl = mesh->triangles_[lhs];
+        const Eigen::Vector3i& tr = mesh->triangles_[rhs];
+        return std::make_tuple(tl(0), tl(1), tl(2)) <
+               std::make_tuple(tr(0), tr(1), tr(2));
+    });
+    auto same_triangle = [&](size_t lhs, size_t rhs) {
+        return mesh->triangles_[order[lhs]] == mesh->triangles_[order[rhs]];
+    };
+    std::vector<char> triangle_keep(num_triangles, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int oidx = 0; oidx < int(num_triangles); ++oidx) {
+        bool unique = (oidx == 0 || !same_triangle(oidx - 1, oidx)) &&
+                      (oidx + 1 == int(num_triangles) ||
+                       !same_triangle(oidx, oidx + 1));
+        if (unique) {
+            triangle_keep[order[oidx]] = 1;
         }
     }
 
     size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
+    for (size_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (triangle_keep[tidx]) {
+            mesh->triangles_[to_idx] = mesh->triangles_[tidx];
             to_idx++;
         }
     }
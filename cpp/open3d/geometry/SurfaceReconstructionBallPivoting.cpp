@@ -25,15 +25,20 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/geometry/IntersectionTest.h"
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
 
 #include <Eigen/Dense>
 
+#include <cmath>
 #include <iostream>
 #include <list>
+#include <unordered_map>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace open3d {
 namespace geometry {
@@ -157,10 +162,65 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
     }
 }
 
+/// Uniform grid over the input points for fixed-radius neighbor lookups.
+/// Ball pivoting only ever queries radii that are known before a pass
+/// starts, so a flat voxel hash with a cell size matched to the query
+/// radius replaces the per-edge KD-tree searches.
+class BallPivotingNeighborGrid {
+public:
+    void Build(const std::vector<Eigen::Vector3d>& points, double cell_size) {
+        points_ = &points;
+        cell_size_ = cell_size;
+        grid_.clear();
+        grid_.reserve(points.size());
+        for (size_t idx = 0; idx < points.size(); ++idx) {
+            grid_[CellOf(points[idx])].push_back(static_cast<int>(idx));
+        }
+    }
+
+    void SearchRadius(const Eigen::Vector3d& query,
+                      double radius,
+                      std::vector<int>& indices) const {
+        indices.clear();
+        int reach = int(std::ceil(radius / cell_size_));
+        Eigen::Vector3i center_cell = CellOf(query);
+        double radius2 = radius * radius;
+        for (int dx = -reach; dx <= reach; dx++) {
+            for (int dy = -reach; dy <= reach; dy++) {
+                for (int dz = -reach; dz <= reach; dz++) {
+                    auto it = grid_.find(center_cell +
+                                         Eigen::Vector3i(dx, dy, dz));
+                    if (it == grid_.end()) {
+                        continue;
+                    }
+                    for (int idx : it->second) {
+                        if (((*points_)[idx] - query).squaredNorm() <=
+                            radius2) {
+                            indices.push_back(idx);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    Eigen::Vector3i CellOf(const Eigen::Vector3d& point) const {
+        return Eigen::Vector3i(int(std::floor(point(0) / cell_size_)),
+                               int(std::floor(point(1) / cell_size_)),
+                               int(std::floor(point(2) / cell_size_)));
+    }
+
+    const std::vector<Eigen::Vector3d>* points_ = nullptr;
+    double cell_size_ = 1.0;
+    std::unordered_map<Eigen::Vector3i, std::vector<int>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            grid_;
+};
+
 class BallPivoting {
 public:
-    BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+    BallPivoting(const PointCloud& pcd) : has_normals_(pcd.HasNormals()) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
@@ -359,8 +419,7 @@ public:
         a /= a.norm();
 
         std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
+        grid_.SearchRadius(mp, 2 * radius, indices);
         utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
                           indices.size());
 
@@ -575,8 +634,7 @@ public:
         utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
                           radius);
         std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        grid_.SearchRadius(v->point_, 2 * radius, indices);
         if (indices.size() < 3u) {
             return false;
         }
@@ -681,9 +739,21 @@ public:
                         "got an invalid, negative radius as parameter");
             }
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
+            // The neighbor grid covers the largest query radius of this
+            // pass, so all lookups stay within the 27-cell neighborhood.
+            grid_.Build(mesh_->vertices_, 2 * radius);
+
+            // update radius => update border edges; the per-edge ball test
+            // is read-only and runs in parallel, the lists are updated
+            // serially afterwards.
+            std::vector<BallPivotingEdgePtr> border(border_edges_.begin(),
+                                                    border_edges_.end());
+            std::vector<bool> reactivate(border.size(), false);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int eidx = 0; eidx < (int)border.size(); eidx++) {
+                const BallPivotingEdgePtr& edge = border[eidx];
                 BallPivotingTrianglePtr triangle = edge->triangle0_;
                 utility::LogDebug(
                         "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
@@ -697,8 +767,7 @@ public:
                                       triangle->vert2_->idx_, radius, center)) {
                     utility::LogDebug("[Run]   yes, we can work on this");
                     std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
+                    grid_.SearchRadius(center, radius, indices);
                     bool empty_ball = true;
                     for (auto idx : indices) {
                         if (idx != triangle->vert0_->idx_ &&
@@ -710,18 +779,20 @@ public:
                             break;
                         }
                     }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+                    reactivate[eidx] = empty_ball;
+                }
+            }
+            border_edges_.clear();
+            for (size_t eidx = 0; eidx < border.size(); eidx++) {
+                if (reactivate[eidx]) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    border[eidx]->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(border[eidx]);
+                } else {
+                    border_edges_.push_back(border[eidx]);
                 }
-                ++it;
             }
 
             // do the reconstruction
@@ -740,7 +811,7 @@ public:
 
 private:
     bool has_normals_;
-    KDTreeFlann kdtree_;
+    BallPivotingNeighborGrid grid_;
     std::list<BallPivotingEdgePtr> edge_front_;
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
@@ -375,18 +375,30 @@ void ExtractMesh(
     }
 
     mesh->resetIterator();
-    out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
-        Vertex v;
-        mesh->nextOutOfCorePoint(v);
-        v.point = iXForm * v.point;
-        out_mesh->vertices_.push_back(
-                Eigen::Vector3d(v.point[0], v.point[1], v.point[2]));
-        out_mesh->vertex_normals_.push_back(v.normal_);
-        out_mesh->vertex_colors_.push_back(v.color_);
-        out_densities.push_back(v.w_);
+    // The out-of-core iterators are sequential, so the vertices are drained
+    // into a flat buffer first; the per-vertex transform and conversion is
+    // then done in parallel on the thread pool of the reconstruction.
+    size_t n_vertices = mesh->outOfCorePointCount();
+    std::vector<Vertex> vertex_buffer(n_vertices);
+    for (size_t vidx = 0; vidx < n_vertices; ++vidx) {
+        mesh->nextOutOfCorePoint(vertex_buffer[vidx]);
     }
-    for (size_t tidx = 0; tidx < mesh->polygonCount(); ++tidx) {
+    out_mesh->vertices_.resize(n_vertices);
+    out_mesh->vertex_normals_.resize(n_vertices);
+    out_mesh->vertex_colors_.resize(n_vertices);
+    out_densities.resize(n_vertices);
+    ThreadPool::Parallel_for(0, n_vertices, [&](unsigned int, size_t vidx) {
+        Vertex& v = vertex_buffer[vidx];
+        v.point = iXForm * v.point;
+        out_mesh->vertices_[vidx] =
+                Eigen::Vector3d(v.point[0], v.point[1], v.point[2]);
+        out_mesh->vertex_normals_[vidx] = v.normal_;
+        out_mesh->vertex_colors_[vidx] = v.color_;
+        out_densities[vidx] = v.w_;
+    });
+    size_t n_polygons = mesh->polygonCount();
+    out_mesh->triangles_.reserve(n_polygons);
+    for (size_t tidx = 0; tidx < n_polygons; ++tidx) {
         std::vector<CoredVertexIndex<node_index_type>> triangle;
         mesh->nextPolygon(triangle);
         if (triangle.size() != 3) {
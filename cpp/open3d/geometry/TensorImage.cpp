@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TensorImage.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/ImageOp.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+core::kernel::ImageFilterType ToKernelFilterType(Image::FilterType type) {
+    switch (type) {
+        case Image::FilterType::Gaussian3:
+            return core::kernel::ImageFilterType::Gaussian3;
+        case Image::FilterType::Gaussian5:
+            return core::kernel::ImageFilterType::Gaussian5;
+        case Image::FilterType::Gaussian7:
+            return core::kernel::ImageFilterType::Gaussian7;
+        case Image::FilterType::Sobel3Dx:
+            return core::kernel::ImageFilterType::Sobel3Dx;
+        case Image::FilterType::Sobel3Dy:
+            return core::kernel::ImageFilterType::Sobel3Dy;
+        default:
+            utility::LogError("[TensorImage] Unsupported filter type.");
+    }
+    return core::kernel::ImageFilterType::Gaussian3;
+}
+
+void CheckSingleChannelFloat(const core::Tensor &data, const char *op) {
+    if (data.NumDims() != 3 || data.GetShape()[2] != 1 ||
+        data.GetDtype() != core::Dtype::Float32) {
+        utility::LogError("[{}] A single channel Float32 image is required.",
+                          op);
+    }
+}
+
+}  // unnamed namespace
+
+TensorImage::TensorImage(int64_t rows,
+                         int64_t cols,
+                         int64_t channels,
+                         core::Dtype dtype,
+                         const core::Device &device /* = CPU:0 */) {
+    if (rows < 0 || cols < 0 || channels < 1) {
+        utility::LogError(
+                "[TensorImage] Invalid size ({}, {}, {}).", rows, cols,
+                channels);
+    }
+    data_ = core::Tensor(core::SizeVector{rows, cols, channels}, dtype,
+                         device);
+}
+
+TensorImage::TensorImage(const core::Tensor &tensor) {
+    if (tensor.NumDims() == 2) {
+        data_ = tensor.Contiguous().Reshape(
+                {tensor.GetShape()[0], tensor.GetShape()[1], 1});
+    } else if (tensor.NumDims() == 3) {
+        data_ = tensor.Contiguous();
+    } else {
+        utility::LogError("[TensorImage] A (rows, cols, channels) or "
+                          "(rows, cols) tensor is required, but shape {} was "
+                          "given.",
+                          tensor.GetShape().ToString());
+    }
+}
+
+TensorImage TensorImage::FromLegacyImage(
+        const Image &image, const core::Device &device /* = CPU:0 */) {
+    if (!image.HasData()) {
+        utility::LogError("[TensorImage] Cannot import an empty image.");
+    }
+    const int64_t rows = image.height_;
+    const int64_t cols = image.width_;
+    const int64_t channels = image.num_of_channels_;
+    const int64_t num_values = rows * cols * channels;
+
+    core::Tensor cpu_data;
+    if (image.bytes_per_channel_ == 1) {
+        cpu_data = core::Tensor(core::SizeVector{rows, cols, channels},
+                                core::Dtype::UInt8,
+                                core::Device("CPU:0"));
+        std::memcpy(cpu_data.GetDataPtr(), image.data_.data(), num_values);
+    } else if (image.bytes_per_channel_ == 2) {
+        // 16-bit values are imported as Float32; the conversion is
+        // exact and keeps the raw (unscaled) values, as
+        // Image::CreateFloatImage() does for 16-bit input.
+        cpu_data = core::Tensor(core::SizeVector{rows, cols, channels},
+                                core::Dtype::Float32,
+                                core::Device("CPU:0"));
+        const uint16_t *src =
+                reinterpret_cast<const uint16_t *>(image.data_.data());
+        float *dst = static_cast<float *>(cpu_data.GetDataPtr());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_values; i++) {
+            dst[i] = float(src[i]);
+        }
+    } else if (image.bytes_per_channel_ == 4) {
+        cpu_data = core::Tensor(core::SizeVector{rows, cols, channels},
+                                core::Dtype::Float32,
+                                core::Device("CPU:0"));
+        std::memcpy(cpu_data.GetDataPtr(), image.data_.data(),
+                    num_values * sizeof(float));
+    } else {
+        utility::LogError("[TensorImage] Unsupported image format with {} "
+                          "bytes per channel.",
+                          image.bytes_per_channel_);
+    }
+
+    TensorImage output;
+    output.data_ = device.GetType() == core::Device::DeviceType::CPU
+                           ? cpu_data
+                           : cpu_data.Copy(device);
+    return output;
+}
+
+std::shared_ptr<Image> TensorImage::ToLegacyImage() const {
+    auto output = std::make_shared<Image>();
+    if (data_.NumDims() == 0) {
+        return output;
+    }
+    core::Tensor cpu_data =
+            data_.GetDevice().GetType() == core::Device::DeviceType::CPU
+                    ? data_.Contiguous()
+                    : data_.Copy(core::Device("CPU:0"));
+
+    int bytes_per_channel;
+    if (cpu_data.GetDtype() == core::Dtype::UInt8) {
+        bytes_per_channel = 1;
+    } else if (cpu_data.GetDtype() == core::Dtype::Float32) {
+        bytes_per_channel = 4;
+    } else {
+        utility::LogError("[TensorImage] Cannot export dtype {} to a legacy "
+                          "image.",
+                          core::DtypeUtil::ToString(cpu_data.GetDtype()));
+    }
+    output->Prepare(int(GetCols()), int(GetRows()), int(GetChannels()),
+                    bytes_per_channel);
+    std::memcpy(output->data_.data(), cpu_data.GetDataPtr(),
+                output->data_.size());
+    return output;
+}
+
+TensorImage TensorImage::Filter(Image::FilterType type) const {
+    CheckSingleChannelFloat(data_, "Filter");
+    TensorImage output(GetRows(), GetCols(), 1, core::Dtype::Float32,
+                       GetDevice());
+    core::kernel::ImageFilter(data_, output.data_, ToKernelFilterType(type));
+    return output;
+}
+
+TensorImage TensorImage::Downsample() const {
+    CheckSingleChannelFloat(data_, "Downsample");
+    TensorImage output(GetRows() / 2, GetCols() / 2, 1, core::Dtype::Float32,
+                       GetDevice());
+    core::kernel::ImageDownsample(data_, output.data_);
+    return output;
+}
+
+TensorImage TensorImage::ConvertDepthToFloatImage(
+        double depth_scale /* = 1000.0*/, double depth_trunc /* = 3.0*/)
+        const {
+    if (data_.NumDims() != 3 || data_.GetShape()[2] != 1) {
+        utility::LogError("[ConvertDepthToFloatImage] A single channel "
+                          "image is required.");
+    }
+    TensorImage output(GetRows(), GetCols(), 1, core::Dtype::Float32,
+                       GetDevice());
+    core::kernel::ImageToFloat(data_, output.data_, depth_scale, depth_trunc);
+    return output;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Image.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class TensorImage
+///
+/// \brief A core::Tensor backed image that can live on any device.
+///
+/// The pixel data is a contiguous (rows, cols, channels) tensor, so a
+/// TensorImage on a CUDA device can be filtered, downsampled and
+/// depth-converted without round-tripping through host memory. It is
+/// interconvertible with the CPU-only geometry::Image: UInt8 and
+/// Float32 channels map directly, and 16-bit legacy channels are
+/// imported as Float32 with their raw values (exact, since every
+/// uint16 is representable as a float).
+class TensorImage {
+public:
+    /// \brief Default constructor; creates an empty image.
+    TensorImage() {}
+
+    /// \brief Constructs an uninitialized image of the given size.
+    ///
+    /// \param rows Number of rows (image height).
+    /// \param cols Number of columns (image width).
+    /// \param channels Number of channels.
+    /// \param dtype Pixel data type.
+    /// \param device Device where the pixel data lives.
+    TensorImage(int64_t rows,
+                int64_t cols,
+                int64_t channels,
+                core::Dtype dtype,
+                const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Wraps an existing (rows, cols, channels) or (rows, cols)
+    /// tensor as an image; the data is shared when the tensor is
+    /// contiguous and copied otherwise.
+    explicit TensorImage(const core::Tensor &tensor);
+
+    /// \brief Imports a geometry::Image, optionally onto a device.
+    static TensorImage FromLegacyImage(
+            const Image &image,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Exports to a geometry::Image on the host.
+    std::shared_ptr<Image> ToLegacyImage() const;
+
+    int64_t GetRows() const {
+        return data_.NumDims() == 0 ? 0 : data_.GetShape()[0];
+    }
+    int64_t GetCols() const {
+        return data_.NumDims() == 0 ? 0 : data_.GetShape()[1];
+    }
+    int64_t GetChannels() const {
+        return data_.NumDims() == 0 ? 0 : data_.GetShape()[2];
+    }
+    core::Dtype GetDtype() const { return data_.GetDtype(); }
+    core::Device GetDevice() const { return data_.GetDevice(); }
+
+    /// Returns the underlying (rows, cols, channels) tensor.
+    core::Tensor AsTensor() const { return data_; }
+
+    /// \brief Separable filter on a single channel Float32 image,
+    /// executed on the image's device. The coefficients and border
+    /// handling match geometry::Image::Filter().
+    TensorImage Filter(Image::FilterType type) const;
+
+    /// \brief 2x2 box downsample of a single channel Float32 image to
+    /// half resolution, executed on the image's device.
+    TensorImage Downsample() const;
+
+    /// \brief Converts a single channel UInt8 or Float32 depth image
+    /// to metric Float32 depth on the image's device, dividing by
+    /// \p depth_scale and zeroing values >= \p depth_trunc, as in
+    /// geometry::Image::ConvertDepthToFloatImage().
+    TensorImage ConvertDepthToFloatImage(double depth_scale = 1000.0,
+                                         double depth_trunc = 3.0) const;
+
+protected:
+    core::Tensor data_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -30,8 +30,11 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -42,6 +45,8 @@
 #endif
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace geometry {
@@ -96,6 +101,7 @@ TriangleMesh &TriangleMesh::operator+=(const TriangleMesh &mesh) {
     if (HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
+    InvalidateAdjacencyCache();
     if (HasTriangleUvs() || HasTextures() || HasTriangleMaterialIds()) {
         utility::LogError(
                 "[TriangleMesh] copy of uvs and texture and per-triangle "
@@ -112,7 +118,10 @@ TriangleMesh TriangleMesh::operator+(const TriangleMesh &mesh) const {
 TriangleMesh &TriangleMesh::ComputeTriangleNormals(
         bool normalized /* = true*/) {
     triangle_normals_.resize(triangles_.size());
-    for (size_t i = 0; i < triangles_.size(); i++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)triangles_.size(); i++) {
         auto &triangle = triangles_[i];
         Eigen::Vector3d v01 = vertices_[triangle(1)] - vertices_[triangle(0)];
         Eigen::Vector3d v02 = vertices_[triangle(2)] - vertices_[triangle(0)];
@@ -128,12 +137,37 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
     if (!HasTriangleNormals()) {
         ComputeTriangleNormals(false);
     }
-    vertex_normals_.resize(vertices_.size(), Eigen::Vector3d::Zero());
+    vertex_normals_.resize(vertices_.size());
+    // Atomic-free segmented reduction: bucket the triangle corners by vertex
+    // with a counting sort, then gather per vertex in parallel. This avoids
+    // per-thread copies of the accumulator (prohibitive on large meshes) and
+    // keeps the summation order independent of the number of threads.
+    std::vector<int> offsets(vertices_.size() + 1, 0);
+    for (const auto &triangle : triangles_) {
+        offsets[triangle(0) + 1]++;
+        offsets[triangle(1) + 1]++;
+        offsets[triangle(2) + 1]++;
+    }
+    for (size_t vidx = 1; vidx < offsets.size(); vidx++) {
+        offsets[vidx] += offsets[vidx - 1];
+    }
+    std::vector<int> corner_triangles(triangles_.size() * 3);
+    std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
     for (size_t i = 0; i < triangles_.size(); i++) {
-        auto &triangle = triangles_[i];
-        vertex_normals_[triangle(0)] += triangle_normals_[i];
-        vertex_normals_[triangle(1)] += triangle_normals_[i];
-        vertex_normals_[triangle(2)] += triangle_normals_[i];
+        const auto &triangle = triangles_[i];
+        corner_triangles[cursor[triangle(0)]++] = int(i);
+        corner_triangles[cursor[triangle(1)]++] = int(i);
+        corner_triangles[cursor[triangle(2)]++] = int(i);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < (int)vertices_.size(); vidx++) {
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        for (int cidx = offsets[vidx]; cidx < offsets[vidx + 1]; cidx++) {
+            normal += triangle_normals_[corner_triangles[cidx]];
+        }
+        vertex_normals_[vidx] = normal;
     }
     if (normalized) {
         NormalizeNormals();
@@ -141,6 +175,62 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
     return *this;
 }
 
+namespace {
+
+/// Builds a compact CSR vertex adjacency from the triangle list. The
+/// neighbor indices of vertex v are indices[offsets[v]] to
+/// indices[offsets[v] + 1] - 1, sorted and deduplicated.
+void BuildAdjacencyCSR(const std::vector<Eigen::Vector3i> &triangles,
+                       size_t num_vertices,
+                       std::vector<int> &offsets,
+                       std::vector<int> &indices) {
+    std::vector<int> counts(num_vertices + 1, 0);
+    for (const auto &triangle : triangles) {
+        counts[triangle(0) + 1] += 2;
+        counts[triangle(1) + 1] += 2;
+        counts[triangle(2) + 1] += 2;
+    }
+    for (size_t vidx = 1; vidx <= num_vertices; vidx++) {
+        counts[vidx] += counts[vidx - 1];
+    }
+    std::vector<int> raw(counts.back());
+    std::vector<int> cursor(counts.begin(), counts.end() - 1);
+    for (const auto &triangle : triangles) {
+        raw[cursor[triangle(0)]++] = triangle(1);
+        raw[cursor[triangle(0)]++] = triangle(2);
+        raw[cursor[triangle(1)]++] = triangle(0);
+        raw[cursor[triangle(1)]++] = triangle(2);
+        raw[cursor[triangle(2)]++] = triangle(0);
+        raw[cursor[triangle(2)]++] = triangle(1);
+    }
+    // Sort and deduplicate every vertex range in parallel, then compact.
+    std::vector<int> unique_counts(num_vertices, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < (int)num_vertices; vidx++) {
+        auto begin = raw.begin() + counts[vidx];
+        auto end = raw.begin() + counts[vidx + 1];
+        std::sort(begin, end);
+        unique_counts[vidx] = int(std::distance(begin, std::unique(begin, end)));
+    }
+    offsets.assign(num_vertices + 1, 0);
+    for (size_t vidx = 0; vidx < num_vertices; vidx++) {
+        offsets[vidx + 1] = offsets[vidx] + unique_counts[vidx];
+    }
+    indices.resize(offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < (int)num_vertices; vidx++) {
+        std::copy(raw.begin() + counts[vidx],
+                  raw.begin() + counts[vidx] + unique_counts[vidx],
+                  indices.begin() + offsets[vidx]);
+    }
+}
+
+}  // namespace
+
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
@@ -155,6 +245,26 @@ TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
     return *this;
 }
 
+void TriangleMesh::UpdateAdjacencyCache() const {
+    if (!adjacency_csr_dirty_ &&
+        adjacency_csr_offsets_.size() == vertices_.size() + 1) {
+        return;
+    }
+    BuildAdjacencyCSR(triangles_, vertices_.size(), adjacency_csr_offsets_,
+                      adjacency_csr_indices_);
+    adjacency_csr_dirty_ = false;
+}
+
+const std::vector<int> &TriangleMesh::GetAdjacencyOffsets() const {
+    UpdateAdjacencyCache();
+    return adjacency_csr_offsets_;
+}
+
+const std::vector<int> &TriangleMesh::GetAdjacencyIndices() const {
+    UpdateAdjacencyCache();
+    return adjacency_csr_indices_;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
         int number_of_iterations, double strength, FilterScope scope) const {
     bool filter_vertex =
@@ -176,16 +286,20 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const std::vector<int> &adjacency_offsets = GetAdjacencyOffsets();
+    const std::vector<int> &adjacency_indices = GetAdjacencyIndices();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < (int)mesh->vertices_.size(); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int aidx = adjacency_offsets[vidx];
+                 aidx < adjacency_offsets[vidx + 1]; ++aidx) {
+                int nbidx = adjacency_indices[aidx];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -197,7 +311,8 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size =
+                    adjacency_offsets[vidx + 1] - adjacency_offsets[vidx];
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -247,16 +362,20 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const std::vector<int> &adjacency_offsets = GetAdjacencyOffsets();
+    const std::vector<int> &adjacency_indices = GetAdjacencyIndices();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < (int)mesh->vertices_.size(); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int aidx = adjacency_offsets[vidx];
+                 aidx < adjacency_offsets[vidx + 1]; ++aidx) {
+                int nbidx = adjacency_indices[aidx];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -268,7 +387,8 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size =
+                    adjacency_offsets[vidx + 1] - adjacency_offsets[vidx];
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -297,17 +417,23 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const std::vector<int> &adjacency_offsets,
+        const std::vector<int> &adjacency_indices,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < (int)mesh->vertices_.size(); ++vidx) {
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
+        for (int aidx = adjacency_offsets[vidx];
+             aidx < adjacency_offsets[vidx + 1]; ++aidx) {
+            int nbidx = adjacency_indices[aidx];
             auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
             double dist = diff.norm();
             double weight = 1. / (dist + 1e-12);
@@ -363,15 +489,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+
+    // The cached CSR adjacency is shared by all iterations; the two vertex
+    // buffers are swapped in place, so the loop is free of allocations.
+    const std::vector<int> &adjacency_offsets = GetAdjacencyOffsets();
+    const std::vector<int> &adjacency_indices = GetAdjacencyIndices();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_indices, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -405,21 +533,24 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+
+    // As in FilterSmoothLaplacian, the cached CSR adjacency is shared by
+    // all iterations and both smoothing passes run on swapped buffers.
+    const std::vector<int> &adjacency_offsets = GetAdjacencyOffsets();
+    const std::vector<int> &adjacency_indices = GetAdjacencyIndices();
+
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_indices, lambda, filter_vertex,
+                                    filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, adjacency_offsets,
+                                    adjacency_indices, mu, filter_vertex,
+                                    filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -435,11 +566,48 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         double surface_area,
         bool use_triangle_normal,
         int seed) {
-    // triangle areas to cdf
-    triangle_areas[0] /= surface_area;
-    for (size_t tidx = 1; tidx < triangles_.size(); ++tidx) {
-        triangle_areas[tidx] =
-                triangle_areas[tidx] / surface_area + triangle_areas[tidx - 1];
+    // Build an alias table (Vose's method) over the triangle areas, so
+    // drawing a triangle is O(1) instead of a binary search in a cdf.
+    const size_t num_triangles = triangles_.size();
+    std::vector<double> prob(num_triangles);
+    std::vector<int> alias(num_triangles);
+    {
+        std::vector<double> scaled(num_triangles);
+        std::vector<int> small, large;
+        small.reserve(num_triangles);
+        large.reserve(num_triangles);
+        for (size_t tidx = 0; tidx < num_triangles; ++tidx) {
+            scaled[tidx] = triangle_areas[tidx] / surface_area *
+                           double(num_triangles);
+            if (scaled[tidx] < 1.0) {
+                small.push_back(int(tidx));
+            } else {
+                large.push_back(int(tidx));
+            }
+        }
+        while (!small.empty() && !large.empty()) {
+            int s = small.back();
+            int l = large.back();
+            small.pop_back();
+            large.pop_back();
+            prob[s] = scaled[s];
+            alias[s] = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            if (scaled[l] < 1.0) {
+                small.push_back(l);
+            } else {
+                large.push_back(l);
+            }
+        }
+        // Leftovers are 1 up to rounding.
+        for (int l : large) {
+            prob[l] = 1.0;
+            alias[l] = l;
+        }
+        for (int s : small) {
+            prob[s] = 1.0;
+            alias[s] = s;
+        }
     }
 
     // sample point cloud
@@ -449,8 +617,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         std::random_device rd;
         seed = rd();
     }
-    std::mt19937 mt(seed);
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal || use_triangle_normal) {
@@ -462,35 +628,42 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        size_t n = size_t(std::round(triangle_areas[tidx] * number_of_points));
-        while (point_idx < n) {
-            double r1 = dist(mt);
-            double r2 = dist(mt);
-            double a = (1 - std::sqrt(r1));
-            double b = std::sqrt(r1) * (1 - r2);
-            double c = std::sqrt(r1) * r2;
-
-            const Eigen::Vector3i &triangle = triangles_[tidx];
-            pcd->points_[point_idx] = a * vertices_[triangle(0)] +
-                                      b * vertices_[triangle(1)] +
-                                      c * vertices_[triangle(2)];
-            if (has_vert_normal && !use_triangle_normal) {
-                pcd->normals_[point_idx] = a * vertex_normals_[triangle(0)] +
-                                           b * vertex_normals_[triangle(1)] +
-                                           c * vertex_normals_[triangle(2)];
-            }
-            if (use_triangle_normal) {
-                pcd->normals_[point_idx] = triangle_normals_[tidx];
-            }
-            if (has_vert_color) {
-                pcd->colors_[point_idx] = a * vertex_colors_[triangle(0)] +
-                                          b * vertex_colors_[triangle(1)] +
-                                          c * vertex_colors_[triangle(2)];
-            }
-
-            point_idx++;
+    // Each sample draws from its own Philox counter stream, so the
+    // result is identical for a fixed seed no matter how the loop is
+    // scheduled across threads.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t point_idx = 0; point_idx < int64_t(number_of_points);
+         ++point_idx) {
+        utility::random::Philox rng((uint64_t)(uint32_t)seed,
+                                    (uint64_t)point_idx);
+        uint32_t slot = rng.BoundedUInt32((uint32_t)num_triangles);
+        size_t tidx = rng.NextUniformDouble() < prob[slot]
+                              ? slot
+                              : size_t(alias[slot]);
+        double r1 = rng.NextUniformDouble();
+        double r2 = rng.NextUniformDouble();
+        double a = (1 - std::sqrt(r1));
+        double b = std::sqrt(r1) * (1 - r2);
+        double c = std::sqrt(r1) * r2;
+
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        pcd->points_[point_idx] = a * vertices_[triangle(0)] +
+                                  b * vertices_[triangle(1)] +
+                                  c * vertices_[triangle(2)];
+        if (has_vert_normal && !use_triangle_normal) {
+            pcd->normals_[point_idx] = a * vertex_normals_[triangle(0)] +
+                                       b * vertex_normals_[triangle(1)] +
+                                       c * vertex_normals_[triangle(2)];
+        }
+        if (use_triangle_normal) {
+            pcd->normals_[point_idx] = triangle_normals_[tidx];
+        }
+        if (has_vert_color) {
+            pcd->colors_[point_idx] = a * vertex_colors_[triangle(0)] +
+                                      b * vertex_colors_[triangle(1)] +
+                                      c * vertex_colors_[triangle(2)];
         }
     }
 
@@ -569,7 +742,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
 
     std::vector<double> weights(pcl->points_.size());
     std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
 
     auto WeightFcn = [&](double d2) {
         double d = std::sqrt(d2);
@@ -579,24 +751,59 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
+    // All elimination queries use the fixed radius r_max, so the
+    // neighborhoods and their pairwise weight contributions are precomputed
+    // once over a uniform grid. Deleting a sample then only subtracts the
+    // cached contribution from each surviving neighbor instead of
+    // re-querying a KD-tree and re-summing the whole neighborhood.
+    std::unordered_map<Eigen::Vector3i, std::vector<int>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            grid;
+    auto CellOf = [&](const Eigen::Vector3d &point) {
+        return Eigen::Vector3i(int(std::floor(point(0) / r_max)),
+                               int(std::floor(point(1) / r_max)),
+                               int(std::floor(point(2) / r_max)));
+    };
+    for (size_t pidx = 0; pidx < pcl->points_.size(); ++pidx) {
+        grid[CellOf(pcl->points_[pidx])].push_back(int(pidx));
+    }
+    std::vector<std::vector<std::pair<int, double>>> neighbors(
+            pcl->points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx0 = 0; pidx0 < (int)pcl->points_.size(); pidx0++) {
+        const Eigen::Vector3d &point = pcl->points_[pidx0];
+        Eigen::Vector3i center_cell = CellOf(point);
         double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
-                continue;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto it = grid.find(center_cell +
+                                        Eigen::Vector3i(dx, dy, dz));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (int pidx1 : it->second) {
+                        if (pidx0 == pidx1) {
+                            continue;
+                        }
+                        double d2 =
+                                (point - pcl->points_[pidx1]).squaredNorm();
+                        if (d2 > r_max * r_max) {
+                            continue;
+                        }
+                        double pair_weight = WeightFcn(d2);
+                        neighbors[pidx0].emplace_back(pidx1, pair_weight);
+                        weight += pair_weight;
+                    }
+                }
             }
-            weight += WeightFcn(dists2[nbidx]);
         }
-
         weights[pidx0] = weight;
-    };
+    }
 
-    // init weights and priority queue
+    // init priority queue
     typedef std::tuple<int, double> QueueEntry;
     auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
         return std::get<1>(a) < std::get<1>(b);
@@ -605,7 +812,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                         decltype(WeightCmp)>
             queue(WeightCmp);
     for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
         queue.push(QueueEntry(int(pidx0), weights[pidx0]));
     };
 
@@ -627,12 +833,12 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         current_number_of_points--;
 
         // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
+        for (const auto &nb : neighbors[pidx]) {
+            if (deleted[nb.first]) {
+                continue;
+            }
+            weights[nb.first] -= nb.second;
+            queue.push(QueueEntry(nb.first, weights[nb.first]));
         }
     }
 
@@ -699,6 +905,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
             ComputeAdjacencyList();
         }
     }
+    InvalidateAdjacencyCache();
     utility::LogDebug(
             "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
             (int)(old_vertex_num - k));
@@ -751,6 +958,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
     if (k < old_triangle_num && HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
+    InvalidateAdjacencyCache();
     utility::LogDebug(
             "[RemoveDuplicatedTriangles] {:d} triangles have been removed.",
             (int)(old_triangle_num - k));
@@ -793,6 +1001,7 @@ TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
+        InvalidateAdjacencyCache();
     }
     utility::LogDebug(
             "[RemoveUnreferencedVertices] {:d} vertices have been removed.",
@@ -824,6 +1033,7 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
     if (k < old_triangle_num && HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
+    InvalidateAdjacencyCache();
     utility::LogDebug(
             "[RemoveDegenerateTriangles] {:d} triangles have been "
             "removed.",
@@ -908,6 +1118,7 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
             triangle_normals_.resize(to_tidx);
         }
     }
+    InvalidateAdjacencyCache();
     return *this;
 }
 
@@ -983,6 +1194,7 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
         triangle(1) = new_vert_mapping[triangle(1)];
         triangle(2) = new_vert_mapping[triangle(2)];
     }
+    InvalidateAdjacencyCache();
 
     if (HasTriangleNormals()) {
         ComputeTriangleNormals();
@@ -1228,29 +1440,87 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    if (triangles_.empty()) {
+        return non_manifold_edges;
+    }
+
+    // Group the 3T edge slots by their smaller vertex with a parallel
+    // counting sort, then scan each vertex's bucket; this replaces the
+    // serial hash map of edge -> triangle list, which dominates the
+    // runtime on large meshes
+    int64_t num_edges = int64_t(triangles_.size()) * 3;
+    int64_t num_vertices = int64_t(vertices_.size());
+    std::vector<int32_t> edge_vert0(num_edges);
+    std::vector<int32_t> edge_vert1(num_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t tidx = 0; tidx < int64_t(triangles_.size()); tidx++) {
+        const auto &triangle = triangles_[tidx];
+        for (int e = 0; e < 3; e++) {
+            int vert0 = triangle(e);
+            int vert1 = triangle((e + 1) % 3);
+            edge_vert0[tidx * 3 + e] = std::min(vert0, vert1);
+            edge_vert1[tidx * 3 + e] = std::max(vert0, vert1);
         }
     }
+    std::vector<int64_t> sorted_indices(num_edges);
+    std::vector<int64_t> bucket_offsets(num_vertices + 1);
+    utility::CountingSort(edge_vert0.data(), edge_vert0.data() + num_edges,
+                          num_vertices, sorted_indices.data(),
+                          bucket_offsets.data());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<Eigen::Vector2i> edges_private;
+        std::vector<int> bucket;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 4096) nowait
+#endif
+        for (int64_t vidx = 0; vidx < num_vertices; vidx++) {
+            bucket.clear();
+            for (int64_t i = bucket_offsets[vidx]; i < bucket_offsets[vidx + 1];
+                 i++) {
+                bucket.push_back(edge_vert1[sorted_indices[i]]);
+            }
+            std::sort(bucket.begin(), bucket.end());
+            for (size_t i = 0; i < bucket.size();) {
+                size_t j = i;
+                while (j < bucket.size() && bucket[j] == bucket[i]) {
+                    j++;
+                }
+                size_t count = j - i;
+                if ((allow_boundary_edges && (count < 1 || count > 2)) ||
+                    (!allow_boundary_edges && count != 2)) {
+                    edges_private.push_back(
+                            Eigen::Vector2i(int(vidx), bucket[i]));
+                }
+                i = j;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            non_manifold_edges.insert(non_manifold_edges.end(),
+                                      edges_private.begin(),
+                                      edges_private.end());
+        }
+    }
+    // deterministic order independent of the thread schedule
+    std::sort(non_manifold_edges.begin(), non_manifold_edges.end(),
+              [](const Eigen::Vector2i &lhs, const Eigen::Vector2i &rhs) {
+                  return lhs(0) != rhs(0) ? lhs(0) < rhs(0) : lhs(1) < rhs(1);
+              });
     return non_manifold_edges;
 }
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            return false;
-        }
-    }
-    return true;
+    return GetNonManifoldEdges(allow_boundary_edges).empty();
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
@@ -1316,32 +1586,77 @@ bool TriangleMesh::IsVertexManifold() const {
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
     std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
+    if (triangles_.empty()) {
+        return self_intersecting_triangles;
+    }
 
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
+    // BVH broadphase: each triangle only runs the exact test against
+    // the triangles whose bounds overlap its own, instead of all T^2
+    // pairs, and the triangles are processed in parallel
+    TriangleMeshBVH bvh(*this);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<Eigen::Vector2i> pairs_private;
+        std::vector<int> candidates;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256) nowait
+#endif
+        for (int64_t tidx0 = 0; tidx0 < int64_t(triangles_.size()); ++tidx0) {
+            const Eigen::Vector3i &tria_p = triangles_[tidx0];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            candidates.clear();
+            // The triangle-triangle test tolerates an epsilon of
+            // coplanarity, so pad the query box by the same amount or
+            // grazing contacts would be pruned before they are tested.
+            const Eigen::Vector3d pad = Eigen::Vector3d::Constant(1e-6);
+            bvh.QueryBoxOverlaps(p0.cwiseMin(p1).cwiseMin(p2) - pad,
+                                 p0.cwiseMax(p1).cwiseMax(p2) + pad,
+                                 candidates);
+            for (int tidx1 : candidates) {
+                // each pair is tested once, by its lower-index triangle
+                if (tidx1 <= tidx0) {
+                    continue;
+                }
+                const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                // check if neighbour triangle
+                if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+                    tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+                    tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+                    tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+                    tria_p(2) == tria_q(2)) {
+                    continue;
+                }
+
+                // check for intersection
+                const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
+                const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
+                const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
+                if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1,
+                                                         q2)) {
+                    pairs_private.push_back(
+                            Eigen::Vector2i(int(tidx0), tidx1));
+                }
             }
         }
-    }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            self_intersecting_triangles.insert(
+                    self_intersecting_triangles.end(), pairs_private.begin(),
+                    pairs_private.end());
+        }
+    }
+    // deterministic order independent of the thread schedule
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &lhs, const Eigen::Vector2i &rhs) {
+                  return lhs(0) != rhs(0) ? lhs(0) < rhs(0) : lhs(1) < rhs(1);
+              });
     return self_intersecting_triangles;
 }
 
@@ -1384,7 +1699,43 @@ TriangleMesh::ClusterConnectedTriangles() const {
 
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
     auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
+
+    // Lock-free union-find over the shared-edge relation. Roots are always
+    // linked towards the smaller triangle index, so the root of every
+    // component is its smallest triangle and the cluster ids assigned below
+    // match the ones of the previous sequential BFS.
+    std::vector<std::atomic<int>> parents(triangles_.size());
+    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
+        parents[tidx] = int(tidx);
+    }
+    auto Find = [&parents](int tidx) {
+        while (true) {
+            int parent = parents[tidx];
+            int grandparent = parents[parent];
+            if (parent == grandparent) {
+                return parent;
+            }
+            // path halving
+            parents[tidx].compare_exchange_weak(parent, grandparent);
+            tidx = grandparent;
+        }
+    };
+    auto Union = [&parents, &Find](int tidx0, int tidx1) {
+        while (true) {
+            int root0 = Find(tidx0);
+            int root1 = Find(tidx1);
+            if (root0 == root1) {
+                return;
+            }
+            if (root0 > root1) {
+                std::swap(root0, root1);
+            }
+            int expected = root1;
+            if (parents[root1].compare_exchange_strong(expected, root0)) {
+                return;
+            }
+        }
+    };
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -1392,50 +1743,41 @@ TriangleMesh::ClusterConnectedTriangles() const {
         const auto &triangle = triangles_[tidx];
         for (auto tnb :
              edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
+            Union(tidx, tnb);
         }
         for (auto tnb :
              edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
+            Union(tidx, tnb);
         }
         for (auto tnb :
              edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
+            Union(tidx, tnb);
         }
     }
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
-    int cluster_idx = 0;
+    std::vector<double> triangle_areas(triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        if (triangle_clusters[tidx] != -1) {
-            continue;
-        }
-
-        std::queue<int> triangle_queue;
-        int cluster_n_triangles = 0;
-        double cluster_area = 0;
-
-        triangle_queue.push(tidx);
-        triangle_clusters[tidx] = cluster_idx;
-        while (!triangle_queue.empty()) {
-            int cluster_tidx = triangle_queue.front();
-            triangle_queue.pop();
-
-            cluster_n_triangles++;
-            cluster_area += GetTriangleArea(cluster_tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
 
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
-                }
-            }
+    int cluster_idx = 0;
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        int root = Find(tidx);
+        if (root == tidx) {
+            triangle_clusters[tidx] = cluster_idx;
+            num_triangles.push_back(0);
+            areas.push_back(0);
+            cluster_idx++;
+        } else {
+            triangle_clusters[tidx] = triangle_clusters[root];
         }
-
-        num_triangles.push_back(cluster_n_triangles);
-        areas.push_back(cluster_area);
-        cluster_idx++;
+        num_triangles[triangle_clusters[tidx]]++;
+        areas[triangle_clusters[tidx]] += triangle_areas[tidx];
     }
 
     utility::LogDebug(
@@ -1482,6 +1824,7 @@ void TriangleMesh::RemoveTrianglesByMask(
     if (has_tri_normal) {
         triangle_normals_.resize(to_tidx);
     }
+    InvalidateAdjacencyCache();
 }
 
 void TriangleMesh::RemoveVerticesByIndex(
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -39,11 +40,23 @@
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
+
+namespace camera {
+class PinholeCameraIntrinsic;
+}
+
 namespace geometry {
 
 class PointCloud;
 class TetraMesh;
 
+/// \brief Opaque cache for DeformAsRigidAsPossible.
+///
+/// Holds the factorized system matrix and the cotangent edge weights so that
+/// consecutive deformations of the same mesh with the same constraint
+/// indices can skip the setup. Defined in TriangleMeshDeformation.cpp.
+class ArapSolverCache;
+
 /// \class TriangleMesh
 ///
 /// \brief Triangle mesh contains vertices and triangles represented by the
@@ -135,6 +148,26 @@ public:
     /// needed.
     TriangleMesh &ComputeAdjacencyList();
 
+    /// \brief Returns the offsets of the cached CSR vertex adjacency.
+    ///
+    /// The neighbor indices of vertex v are
+    /// GetAdjacencyIndices()[GetAdjacencyOffsets()[v]] up to
+    /// GetAdjacencyIndices()[GetAdjacencyOffsets()[v + 1] - 1], sorted and
+    /// deduplicated. The adjacency is built on first access and reused until
+    /// the cache is invalidated by a topology edit. The lazy build is not
+    /// thread-safe; trigger it once before accessing from multiple threads.
+    const std::vector<int> &GetAdjacencyOffsets() const;
+
+    /// \brief Returns the neighbor indices of the cached CSR vertex
+    /// adjacency, see GetAdjacencyOffsets.
+    const std::vector<int> &GetAdjacencyIndices() const;
+
+    /// \brief Marks the cached CSR adjacency as stale.
+    ///
+    /// Called by the topology-editing member functions; call it manually
+    /// after modifying triangles_ directly.
+    void InvalidateAdjacencyCache() { adjacency_csr_dirty_ = true; }
+
     /// \brief Function that removes duplicated verties, i.e., vertices that
     /// have identical coordinates.
     TriangleMesh &RemoveDuplicatedVertices();
@@ -418,6 +451,48 @@ public:
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
             int target_number_of_triangles) const;
 
+    /// Overload of SimplifyQuadricDecimation that never collapses edges
+    /// touching a locked vertex. Used to keep partition boundaries intact in
+    /// the parallel variant, and useful on its own to pin feature vertices.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param locked_vertices per-vertex flags; locked vertices keep their
+    /// position and are never removed.
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
+            int target_number_of_triangles,
+            const std::vector<bool> &locked_vertices) const;
+
+    /// \brief Parallel quadric decimation over spatial partitions.
+    ///
+    /// Bins triangles into slabs along the longest bounding-box axis,
+    /// simplifies the slabs concurrently with their shared boundary vertices
+    /// locked, and stitches the results by welding the unchanged boundary
+    /// vertices. Error ordering is per-partition rather than global, which
+    /// is a good trade for LOD generation on very large meshes.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param num_partitions number of spatial slabs; 0 uses the number of
+    /// hardware threads.
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles, int num_partitions = 0) const;
+
+    /// \brief Generates a chain of LOD meshes in a single decimation pass.
+    ///
+    /// Equivalent to calling SimplifyQuadricDecimation once per target, but
+    /// the quadrics, edge queue, and connectivity are built once and reused
+    /// across levels, so all LODs are emitted from one collapse sequence.
+    /// \param target_number_of_triangles triangle budgets of the LOD levels.
+    /// The returned meshes are ordered from most to least detailed,
+    /// independent of the order of the targets.
+    /// \param locked_vertices optional per-vertex flags; locked vertices keep
+    /// their position and are never removed.
+    std::vector<std::shared_ptr<TriangleMesh>> BuildLODChain(
+            const std::vector<int> &target_number_of_triangles,
+            const std::vector<bool> &locked_vertices =
+                    std::vector<bool>()) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -452,6 +527,27 @@ public:
     std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
     ClusterConnectedTriangles() const;
 
+    /// \brief Renders a depth image of the mesh seen from the given view
+    /// by ray casting, without any GL or GPU dependency.
+    ///
+    /// Each pixel casts a ray through a TriangleMeshBVH in parallel, so
+    /// synthetic depth frames (e.g. simulated laser scans for training
+    /// data) can be produced headlessly on CPU nodes instead of through
+    /// a Visualizer. The returned image is a single channel float image
+    /// with the camera z depth in meters, like an input depth frame;
+    /// pixels whose rays miss the mesh are set to 0.
+    ///
+    /// \param intrinsic Camera intrinsic parameters, defines the image
+    /// size and the pixel rays.
+    /// \param extrinsic World-to-camera transformation, the same
+    /// convention as PointCloud::CreateFromDepthImage.
+    /// \param depth_max Hits beyond this camera z depth are treated as
+    /// misses.
+    std::shared_ptr<Image> SimulateDepthImage(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = std::numeric_limits<double>::infinity()) const;
+
     /// \brief This function removes the triangles with index in
     /// \p triangle_indices. Call \ref RemoveUnreferencedVertices to clean up
     /// vertices afterwards.
@@ -496,6 +592,12 @@ public:
     /// functional.
     /// \param energy energy model that should be optimized
     /// \param smoothed_alpha alpha parameter of the smoothed ARAP model
+    /// \param cache Optional cache that holds the factorized system matrix
+    /// and the edge weights. If the same cache object is passed to
+    /// consecutive calls with unchanged mesh topology, vertex positions, and
+    /// constraint indices (only the constraint positions may differ), the
+    /// expensive factorization is reused. The cache is (re)filled on the
+    /// first call and whenever it does not match the input.
     /// \return The deformed TriangleMesh
     std::shared_ptr<TriangleMesh> DeformAsRigidAsPossible(
             const std::vector<int> &constraint_vertex_indices,
@@ -503,7 +605,8 @@ public:
             size_t max_iter,
             DeformAsRigidAsPossibleEnergy energy =
                     DeformAsRigidAsPossibleEnergy::Spokes,
-            double smoothed_alpha = 0.01) const;
+            double smoothed_alpha = 0.01,
+            std::shared_ptr<ArapSolverCache> *cache = nullptr) const;
 
     /// \brief Alpha shapes are a generalization of the convex hull. With
     /// decreasing alpha value the shape schrinks and creates cavities.
@@ -716,7 +819,8 @@ protected:
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const std::vector<int> &adjacency_offsets,
+            const std::vector<int> &adjacency_indices,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -833,6 +937,15 @@ public:
     std::vector<int> triangle_material_ids_;
     /// Textures of the image.
     std::vector<Image> textures_;
+
+private:
+    /// Rebuilds the cached CSR adjacency if it is stale.
+    void UpdateAdjacencyCache() const;
+
+    /// Cached CSR vertex adjacency, see GetAdjacencyOffsets.
+    mutable std::vector<int> adjacency_csr_offsets_;
+    mutable std::vector<int> adjacency_csr_indices_;
+    mutable bool adjacency_csr_dirty_ = true;
 };
 
 }  // namespace geometry
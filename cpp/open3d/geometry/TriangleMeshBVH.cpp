@@ -0,0 +1,483 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Möller-Trumbore ray-triangle intersection. Returns true and sets \p t if
+/// the ray hits the triangle at a non-negative parametric distance.
+bool RayTriangle(const Eigen::Vector3d& origin,
+                 const Eigen::Vector3d& direction,
+                 const Eigen::Vector3d& vert0,
+                 const Eigen::Vector3d& vert1,
+                 const Eigen::Vector3d& vert2,
+                 double& t) {
+    const Eigen::Vector3d edge1 = vert1 - vert0;
+    const Eigen::Vector3d edge2 = vert2 - vert0;
+    const Eigen::Vector3d pvec = direction.cross(edge2);
+    double det = edge1.dot(pvec);
+    if (std::abs(det) < 1e-12) {
+        return false;
+    }
+    double inv_det = 1.0 / det;
+    const Eigen::Vector3d tvec = origin - vert0;
+    double u = tvec.dot(pvec) * inv_det;
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+    const Eigen::Vector3d qvec = tvec.cross(edge1);
+    double v = direction.dot(qvec) * inv_det;
+    if (v < 0.0 || u + v > 1.0) {
+        return false;
+    }
+    double hit = edge2.dot(qvec) * inv_det;
+    if (hit < 0.0) {
+        return false;
+    }
+    t = hit;
+    return true;
+}
+
+/// Slab test of a ray against an axis aligned box; \p t_max limits the
+/// search to hits closer than the best one found so far.
+bool RayAABB(const Eigen::Vector3d& origin,
+             const Eigen::Vector3d& inv_direction,
+             const Eigen::Vector3d& min_bound,
+             const Eigen::Vector3d& max_bound,
+             double t_max) {
+    double t0 = 0;
+    double t1 = t_max;
+    for (int d = 0; d < 3; d++) {
+        double near = (min_bound(d) - origin(d)) * inv_direction(d);
+        double far = (max_bound(d) - origin(d)) * inv_direction(d);
+        if (near > far) {
+            std::swap(near, far);
+        }
+        t0 = std::max(t0, near);
+        t1 = std::min(t1, far);
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Squared distance from a point to an axis aligned box, 0 if inside.
+double PointAABBDistance2(const Eigen::Vector3d& point,
+                          const Eigen::Vector3d& min_bound,
+                          const Eigen::Vector3d& max_bound) {
+    double dist2 = 0;
+    for (int d = 0; d < 3; d++) {
+        if (point(d) < min_bound(d)) {
+            dist2 += (min_bound(d) - point(d)) * (min_bound(d) - point(d));
+        } else if (point(d) > max_bound(d)) {
+            dist2 += (point(d) - max_bound(d)) * (point(d) - max_bound(d));
+        }
+    }
+    return dist2;
+}
+
+/// Closest point on a triangle to a query point, cf. Ericson,
+/// "Real-Time Collision Detection", chapter 5.1.5.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d& query,
+                                       const Eigen::Vector3d& vert0,
+                                       const Eigen::Vector3d& vert1,
+                                       const Eigen::Vector3d& vert2) {
+    const Eigen::Vector3d ab = vert1 - vert0;
+    const Eigen::Vector3d ac = vert2 - vert0;
+    const Eigen::Vector3d ap = query - vert0;
+    double d1 = ab.dot(ap);
+    double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return vert0;
+    }
+
+    const Eigen::Vector3d bp = query - vert1;
+    double d3 = ab.dot(bp);
+    double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return vert1;
+    }
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return vert0 + d1 / (d1 - d3) * ab;
+    }
+
+    const Eigen::Vector3d cp = query - vert2;
+    double d5 = ab.dot(cp);
+    double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return vert2;
+    }
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return vert0 + d2 / (d2 - d6) * ac;
+    }
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        return vert1 + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (vert2 - vert1);
+    }
+
+    double denom = 1.0 / (va + vb + vc);
+    return vert0 + ab * vb * denom + ac * vc * denom;
+}
+
+}  // namespace
+
+int TriangleMeshBVH::BuildRange(
+        const std::vector<Eigen::Vector3d>& centroids,
+        const std::vector<Eigen::Vector3d>& tri_min_bounds,
+        const std::vector<Eigen::Vector3d>& tri_max_bounds,
+        int begin,
+        int end,
+        int grain_size,
+        std::vector<PendingSubtree>* pending,
+        std::vector<Node>& nodes) {
+    int node_index = int(nodes.size());
+    nodes.emplace_back();
+
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector3d max_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+    Eigen::Vector3d centroid_min = min_bound;
+    Eigen::Vector3d centroid_max = max_bound;
+    for (int idx = begin; idx < end; idx++) {
+        int tidx = triangle_indices_[idx];
+        min_bound = min_bound.cwiseMin(tri_min_bounds[tidx]);
+        max_bound = max_bound.cwiseMax(tri_max_bounds[tidx]);
+        centroid_min = centroid_min.cwiseMin(centroids[tidx]);
+        centroid_max = centroid_max.cwiseMax(centroids[tidx]);
+    }
+    nodes[node_index].min_bound_ = min_bound;
+    nodes[node_index].max_bound_ = max_bound;
+
+    int axis;
+    (centroid_max - centroid_min).maxCoeff(&axis);
+    if (end - begin <= leaf_size_ ||
+        centroid_max(axis) == centroid_min(axis)) {
+        nodes[node_index].begin_ = begin;
+        nodes[node_index].end_ = end;
+        return node_index;
+    }
+
+    if (pending != nullptr && end - begin <= grain_size) {
+        // Defer this subtree; it is completed in parallel by the caller.
+        pending->push_back({node_index, begin, end});
+        return node_index;
+    }
+
+    int mid = begin + (end - begin) / 2;
+    std::nth_element(triangle_indices_.begin() + begin,
+                     triangle_indices_.begin() + mid,
+                     triangle_indices_.begin() + end, [&](int t0, int t1) {
+                         return centroids[t0](axis) < centroids[t1](axis);
+                     });
+    int left = BuildRange(centroids, tri_min_bounds, tri_max_bounds, begin,
+                          mid, grain_size, pending, nodes);
+    int right = BuildRange(centroids, tri_min_bounds, tri_max_bounds, mid,
+                           end, grain_size, pending, nodes);
+    nodes[node_index].left_ = left;
+    nodes[node_index].right_ = right;
+    return node_index;
+}
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh& mesh,
+                                 int leaf_size /* = 4 */)
+    : mesh_(&mesh), leaf_size_(std::max(leaf_size, 1)) {
+    int num_triangles = int(mesh.triangles_.size());
+    if (num_triangles == 0) {
+        return;
+    }
+
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+    std::vector<Eigen::Vector3d> tri_min_bounds(num_triangles);
+    std::vector<Eigen::Vector3d> tri_max_bounds(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i& tria = mesh.triangles_[tidx];
+        const Eigen::Vector3d& vert0 = mesh.vertices_[tria(0)];
+        const Eigen::Vector3d& vert1 = mesh.vertices_[tria(1)];
+        const Eigen::Vector3d& vert2 = mesh.vertices_[tria(2)];
+        tri_min_bounds[tidx] = vert0.cwiseMin(vert1).cwiseMin(vert2);
+        tri_max_bounds[tidx] = vert0.cwiseMax(vert1).cwiseMax(vert2);
+        centroids[tidx] = (vert0 + vert1 + vert2) / 3.0;
+    }
+
+    triangle_indices_.resize(num_triangles);
+    std::iota(triangle_indices_.begin(), triangle_indices_.end(), 0);
+
+#ifdef _OPENMP
+    const int num_threads = std::max(omp_get_max_threads(), 1);
+#else
+    const int num_threads = 1;
+#endif
+    // The top of the tree is split serially until the subtrees are small
+    // enough to be load balanced, the subtrees are then built concurrently
+    // into local node arrays and spliced into the contiguous array.
+    int grain_size =
+            std::max(num_triangles / (4 * num_threads), 4 * leaf_size_);
+    std::vector<PendingSubtree> pending;
+    BuildRange(centroids, tri_min_bounds, tri_max_bounds, 0, num_triangles,
+               grain_size, num_threads > 1 ? &pending : nullptr, nodes_);
+
+    if (pending.empty()) {
+        return;
+    }
+    std::vector<std::vector<Node>> subtree_nodes(pending.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int job = 0; job < (int)pending.size(); job++) {
+        BuildRange(centroids, tri_min_bounds, tri_max_bounds,
+                   pending[job].begin, pending[job].end, 0, nullptr,
+                   subtree_nodes[job]);
+    }
+    for (size_t job = 0; job < pending.size(); job++) {
+        const std::vector<Node>& local = subtree_nodes[job];
+        // The local root (index 0) replaces the deferred node; the
+        // remaining local nodes are appended, so local index k maps to
+        // offset + k - 1.
+        int offset = int(nodes_.size());
+        Node root = local[0];
+        if (root.left_ >= 0) {
+            root.left_ += offset - 1;
+            root.right_ += offset - 1;
+        }
+        nodes_[pending[job].node_index] = root;
+        for (size_t k = 1; k < local.size(); k++) {
+            Node node = local[k];
+            if (node.left_ >= 0) {
+                node.left_ += offset - 1;
+                node.right_ += offset - 1;
+            }
+            nodes_.push_back(node);
+        }
+    }
+}
+
+bool TriangleMeshBVH::RayCast(const Eigen::Vector3d& origin,
+                              const Eigen::Vector3d& direction,
+                              double& t,
+                              int& triangle_index) const {
+    if (nodes_.empty()) {
+        return false;
+    }
+    Eigen::Vector3d inv_direction(1.0 / direction(0), 1.0 / direction(1),
+                                  1.0 / direction(2));
+    double best_t = std::numeric_limits<double>::max();
+    int best_tidx = -1;
+    std::vector<int> stack = {0};
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (!RayAABB(origin, inv_direction, node.min_bound_, node.max_bound_,
+                     best_t)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (int idx = node.begin_; idx < node.end_; idx++) {
+                int tidx = triangle_indices_[idx];
+                const Eigen::Vector3i& tria = mesh_->triangles_[tidx];
+                double hit_t;
+                if (RayTriangle(origin, direction, mesh_->vertices_[tria(0)],
+                                mesh_->vertices_[tria(1)],
+                                mesh_->vertices_[tria(2)], hit_t) &&
+                    hit_t < best_t) {
+                    best_t = hit_t;
+                    best_tidx = tidx;
+                }
+            }
+        } else {
+            stack.push_back(node.left_);
+            stack.push_back(node.right_);
+        }
+    }
+    if (best_tidx < 0) {
+        return false;
+    }
+    t = best_t;
+    triangle_index = best_tidx;
+    return true;
+}
+
+double TriangleMeshBVH::ClosestPoint(const Eigen::Vector3d& query,
+                                     Eigen::Vector3d& closest_point,
+                                     int& triangle_index) const {
+    if (nodes_.empty()) {
+        utility::LogError("[TriangleMeshBVH::ClosestPoint] BVH is empty.");
+    }
+    double best_dist2 = std::numeric_limits<double>::max();
+    std::vector<int> stack = {0};
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (PointAABBDistance2(query, node.min_bound_, node.max_bound_) >=
+            best_dist2) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (int idx = node.begin_; idx < node.end_; idx++) {
+                int tidx = triangle_indices_[idx];
+                const Eigen::Vector3i& tria = mesh_->triangles_[tidx];
+                Eigen::Vector3d candidate = ClosestPointOnTriangle(
+                        query, mesh_->vertices_[tria(0)],
+                        mesh_->vertices_[tria(1)], mesh_->vertices_[tria(2)]);
+                double dist2 = (candidate - query).squaredNorm();
+                if (dist2 < best_dist2) {
+                    best_dist2 = dist2;
+                    closest_point = candidate;
+                    triangle_index = tidx;
+                }
+            }
+        } else {
+            // Visit the nearer child first to tighten the bound early.
+            double left_dist2 = PointAABBDistance2(
+                    query, nodes_[node.left_].min_bound_,
+                    nodes_[node.left_].max_bound_);
+            double right_dist2 = PointAABBDistance2(
+                    query, nodes_[node.right_].min_bound_,
+                    nodes_[node.right_].max_bound_);
+            if (left_dist2 < right_dist2) {
+                stack.push_back(node.right_);
+                stack.push_back(node.left_);
+            } else {
+                stack.push_back(node.left_);
+                stack.push_back(node.right_);
+            }
+        }
+    }
+    return std::sqrt(best_dist2);
+}
+
+void TriangleMeshBVH::QueryBoxOverlaps(
+        const Eigen::Vector3d& min_bound,
+        const Eigen::Vector3d& max_bound,
+        std::vector<int>& triangle_indices) const {
+    if (nodes_.empty()) {
+        return;
+    }
+    std::vector<int> stack = {0};
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (!IntersectionTest::AABBAABB(node.min_bound_, node.max_bound_,
+                                        min_bound, max_bound)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (int idx = node.begin_; idx < node.end_; idx++) {
+                int tidx = triangle_indices_[idx];
+                const Eigen::Vector3i& tria = mesh_->triangles_[tidx];
+                const Eigen::Vector3d& v0 = mesh_->vertices_[tria(0)];
+                const Eigen::Vector3d& v1 = mesh_->vertices_[tria(1)];
+                const Eigen::Vector3d& v2 = mesh_->vertices_[tria(2)];
+                if (IntersectionTest::AABBAABB(
+                            v0.cwiseMin(v1).cwiseMin(v2),
+                            v0.cwiseMax(v1).cwiseMax(v2), min_bound,
+                            max_bound)) {
+                    triangle_indices.push_back(tidx);
+                }
+            }
+        } else {
+            stack.push_back(node.left_);
+            stack.push_back(node.right_);
+        }
+    }
+}
+
+bool TriangleMeshBVH::IntersectsMesh(const TriangleMeshBVH& other) const {
+    if (nodes_.empty() || other.nodes_.empty()) {
+        return false;
+    }
+    std::vector<std::pair<int, int>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        int nidx0, nidx1;
+        std::tie(nidx0, nidx1) = stack.back();
+        stack.pop_back();
+        const Node& node0 = nodes_[nidx0];
+        const Node& node1 = other.nodes_[nidx1];
+        if (!IntersectionTest::AABBAABB(node0.min_bound_, node0.max_bound_,
+                                        node1.min_bound_, node1.max_bound_)) {
+            continue;
+        }
+        if (node0.IsLeaf() && node1.IsLeaf()) {
+            for (int idx0 = node0.begin_; idx0 < node0.end_; idx0++) {
+                const Eigen::Vector3i& tria0 =
+                        mesh_->triangles_[triangle_indices_[idx0]];
+                for (int idx1 = node1.begin_; idx1 < node1.end_; idx1++) {
+                    const Eigen::Vector3i& tria1 =
+                            other.mesh_
+                                    ->triangles_[other.triangle_indices_
+                                                         [idx1]];
+                    if (IntersectionTest::TriangleTriangle3d(
+                                mesh_->vertices_[tria0(0)],
+                                mesh_->vertices_[tria0(1)],
+                                mesh_->vertices_[tria0(2)],
+                                other.mesh_->vertices_[tria1(0)],
+                                other.mesh_->vertices_[tria1(1)],
+                                other.mesh_->vertices_[tria1(2)])) {
+                        return true;
+                    }
+                }
+            }
+        } else if (node1.IsLeaf() ||
+                   (!node0.IsLeaf() &&
+                    (node0.max_bound_ - node0.min_bound_).squaredNorm() >=
+                            (node1.max_bound_ - node1.min_bound_)
+                                    .squaredNorm())) {
+            stack.push_back({node0.left_, nidx1});
+            stack.push_back({node0.right_, nidx1});
+        } else {
+            stack.push_back({nidx0, node1.left_});
+            stack.push_back({nidx0, node1.right_});
+        }
+    }
+    return false;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh.
+///
+/// The hierarchy is a binary tree stored as a contiguous node array built
+/// with median splits along the longest centroid axis. It accelerates
+/// ray casts, closest-point queries, and mesh-vs-mesh intersection tests
+/// that would otherwise loop over all triangles.
+///
+/// The BVH does not copy the mesh; it keeps a pointer to it. The mesh must
+/// outlive the BVH and must not be modified while the BVH is in use.
+class TriangleMeshBVH {
+public:
+    /// \brief Node of the hierarchy.
+    ///
+    /// Inner nodes reference their children by index into the node array,
+    /// leaf nodes reference a range of the reordered triangle index array.
+    struct Node {
+        /// Minimum corner of the node bounding box.
+        Eigen::Vector3d min_bound_;
+        /// Maximum corner of the node bounding box.
+        Eigen::Vector3d max_bound_;
+        /// Index of the left child, -1 for leaf nodes.
+        int left_ = -1;
+        /// Index of the right child, -1 for leaf nodes.
+        int right_ = -1;
+        /// First triangle of the leaf range.
+        int begin_ = 0;
+        /// One past the last triangle of the leaf range.
+        int end_ = 0;
+
+        bool IsLeaf() const { return left_ < 0; }
+    };
+
+    TriangleMeshBVH() = default;
+
+    /// \brief Builds a BVH over the triangles of \p mesh.
+    ///
+    /// The per-triangle bounds are computed in parallel and the subtrees
+    /// below a size threshold are built concurrently.
+    /// \param mesh The mesh to build the hierarchy over.
+    /// \param leaf_size Maximum number of triangles per leaf node.
+    TriangleMeshBVH(const TriangleMesh &mesh, int leaf_size = 4);
+
+    /// Returns true if the BVH has been built over a non-empty mesh.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// \brief Casts a ray and returns the nearest triangle hit.
+    ///
+    /// \param origin Origin of the ray.
+    /// \param direction Direction of the ray, need not be normalized.
+    /// \param t Parametric hit distance along \p direction, only valid if
+    /// the function returns true.
+    /// \param triangle_index Index of the hit triangle, only valid if the
+    /// function returns true.
+    /// \return true if the ray hits a triangle.
+    bool RayCast(const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 double &t,
+                 int &triangle_index) const;
+
+    /// \brief Finds the point on the mesh closest to \p query.
+    ///
+    /// \param query The query point.
+    /// \param closest_point The closest point on the mesh surface.
+    /// \param triangle_index Index of the triangle containing the closest
+    /// point.
+    /// \return The distance from \p query to the mesh surface.
+    double ClosestPoint(const Eigen::Vector3d &query,
+                        Eigen::Vector3d &closest_point,
+                        int &triangle_index) const;
+
+    /// \brief Collects the triangles whose bounds overlap a query box.
+    ///
+    /// Appends the indices of all triangles whose bounding box overlaps
+    /// [\p min_bound, \p max_bound] to \p triangle_indices, in no
+    /// particular order. Used as the broadphase of the mesh
+    /// self-intersection test.
+    void QueryBoxOverlaps(const Eigen::Vector3d &min_bound,
+                          const Eigen::Vector3d &max_bound,
+                          std::vector<int> &triangle_indices) const;
+
+    /// \brief Tests if the meshes of two hierarchies intersect.
+    ///
+    /// Performs a dual traversal of both hierarchies and runs exact
+    /// triangle-triangle tests only on leaf pairs with overlapping bounds.
+    bool IntersectsMesh(const TriangleMeshBVH &other) const;
+
+    /// Returns the contiguous node array, the root is node 0.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+
+    /// Returns the triangle indices, reordered so that every leaf node
+    /// references a contiguous range.
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+private:
+    /// Subtree that is split off during the serial top-level build and
+    /// completed in parallel afterwards.
+    struct PendingSubtree {
+        int node_index;
+        int begin;
+        int end;
+    };
+
+    int BuildRange(const std::vector<Eigen::Vector3d> &centroids,
+                   const std::vector<Eigen::Vector3d> &tri_min_bounds,
+                   const std::vector<Eigen::Vector3d> &tri_max_bounds,
+                   int begin,
+                   int end,
+                   int grain_size,
+                   std::vector<PendingSubtree> *pending,
+                   std::vector<Node> &nodes);
+
+    const TriangleMesh *mesh_ = nullptr;
+    int leaf_size_ = 4;
+    std::vector<Node> nodes_;
+    std::vector<int> triangle_indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
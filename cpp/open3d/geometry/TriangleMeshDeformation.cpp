@@ -35,21 +35,62 @@
 namespace open3d {
 namespace geometry {
 
+/// \brief Cache for DeformAsRigidAsPossible.
+///
+/// The system matrix of the global step depends only on the mesh topology,
+/// the cotangent edge weights of the undeformed mesh, and the set of
+/// constrained vertex indices. When handles are dragged interactively only
+/// the constraint positions change, so the factorization and the edge
+/// weights can be reused across calls.
+class ArapSolverCache {
+public:
+    bool Matches(const TriangleMesh &mesh,
+                 const std::vector<int> &constraint_vertex_indices) const {
+        return num_vertices_ == mesh.vertices_.size() &&
+               num_triangles_ == mesh.triangles_.size() &&
+               constraint_indices_ == constraint_vertex_indices;
+    }
+
+    size_t num_vertices_ = 0;
+    size_t num_triangles_ = 0;
+    std::vector<int> constraint_indices_;
+    std::unordered_map<Eigen::Vector2i,
+                       double,
+                       utility::hash_eigen<Eigen::Vector2i>>
+            edge_weights_;
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver_;
+};
+
 std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         const std::vector<int> &constraint_vertex_indices,
         const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
         size_t max_iter,
         DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
+        double smoothed_alpha,
+        std::shared_ptr<ArapSolverCache> *cache) const {
     auto prime = std::make_shared<TriangleMesh>();
     prime->vertices_ = this->vertices_;
     prime->triangles_ = this->triangles_;
 
+    bool cache_valid = cache != nullptr && *cache != nullptr &&
+                       (*cache)->Matches(*this, constraint_vertex_indices);
+    std::shared_ptr<ArapSolverCache> solver_cache;
+    if (cache_valid) {
+        solver_cache = *cache;
+        utility::LogDebug("[DeformAsRigidAsPossible] reusing cached solver");
+    } else {
+        solver_cache = std::make_shared<ArapSolverCache>();
+    }
+
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+    const std::vector<int> &adjacency_offsets = this->GetAdjacencyOffsets();
+    const std::vector<int> &adjacency_indices = this->GetAdjacencyIndices();
+    if (!cache_valid) {
+        auto edges_to_vertices = prime->GetEdgeToVerticesMap();
+        solver_cache->edge_weights_ = prime->ComputeEdgeWeightsCot(
+                edges_to_vertices, /*min_weight=*/0);
+    }
+    const auto &edge_weights = solver_cache->edge_weights_;
     utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
 
     std::unordered_map<int, Eigen::Vector3d> constraints;
@@ -71,38 +112,52 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
     }
 
     // Build system matrix L and its solver
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
-    std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> &solver =
+            solver_cache->solver_;
+    if (!cache_valid) {
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] setting up system matrix L");
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (int i = 0; i < int(vertices_.size()); ++i) {
+            if (constraints.count(i) > 0) {
+                triplets.push_back(Eigen::Triplet<double>(i, i, 1));
+            } else {
+                double W = 0;
+                for (int aidx = adjacency_offsets[i];
+                     aidx < adjacency_offsets[i + 1]; ++aidx) {
+                    int j = adjacency_indices[aidx];
+                    double w = edge_weights.at(GetOrderedEdge(i, j));
+                    triplets.push_back(Eigen::Triplet<double>(i, j, -w));
+                    W += w;
+                }
+                if (W > 0) {
+                    triplets.push_back(Eigen::Triplet<double>(i, i, W));
+                }
             }
         }
-    }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
-    L.setFromTriplets(triplets.begin(), triplets.end());
-    utility::LogDebug(
-            "[DeformAsRigidAsPossible] done setting up system matrix L");
-
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError(
-                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
-    } else {
+        Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+        L.setFromTriplets(triplets.begin(), triplets.end());
         utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
+                "[DeformAsRigidAsPossible] done setting up system matrix L");
+
+        utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
+        solver.analyzePattern(L);
+        solver.factorize(L);
+        if (solver.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Failed to build solver "
+                    "(factorize)");
+        } else {
+            utility::LogDebug(
+                    "[DeformAsRigidAsPossible] done setting up sparse solver");
+        }
+
+        solver_cache->num_vertices_ = vertices_.size();
+        solver_cache->num_triangles_ = triangles_.size();
+        solver_cache->constraint_indices_ = constraint_vertex_indices;
+        if (cache != nullptr) {
+            *cache = solver_cache;
+        }
     }
 
     std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
@@ -121,10 +176,12 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
             int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
+            for (int aidx = adjacency_offsets[i];
+                 aidx < adjacency_offsets[i + 1]; ++aidx) {
+                int j = adjacency_indices[aidx];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
+                double w = edge_weights.at(GetOrderedEdge(i, j));
                 S += w * (e0 * e1.transpose());
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     R += Rs_old[j];
@@ -160,8 +217,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             if (constraints.count(i) > 0) {
                 bi = constraints[i];
             } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
+                for (int aidx = adjacency_offsets[i];
+                 aidx < adjacency_offsets[i + 1]; ++aidx) {
+                    int j = adjacency_indices[aidx];
+                    double w = edge_weights.at(GetOrderedEdge(i, j));
                     bi += w / 2 *
                           ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
                 }
@@ -187,9 +246,14 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         // Compute energy and log
         double energy = 0;
         double reg = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg)
+#endif
         for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
+            for (int aidx = adjacency_offsets[i];
+                 aidx < adjacency_offsets[i + 1]; ++aidx) {
+                int j = adjacency_indices[aidx];
+                double w = edge_weights.at(GetOrderedEdge(i, j));
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
                 Eigen::Vector3d diff = e1 - Rs[i] * e0;
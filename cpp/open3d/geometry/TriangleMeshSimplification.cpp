@@ -27,10 +27,16 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <queue>
 #include <tuple>
+#include <unordered_map>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -265,6 +271,21 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
 
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         int target_number_of_triangles) const {
+    return SimplifyQuadricDecimation(target_number_of_triangles,
+                                     std::vector<bool>());
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
+        int target_number_of_triangles,
+        const std::vector<bool> &locked_vertices) const {
+    return BuildLODChain(std::vector<int>{target_number_of_triangles},
+                         locked_vertices)
+            .front();
+}
+
+std::vector<std::shared_ptr<TriangleMesh>> TriangleMesh::BuildLODChain(
+        const std::vector<int> &target_number_of_triangles,
+        const std::vector<bool> &locked_vertices) const {
     if (HasTriangleUvs()) {
         utility::LogWarning(
                 "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
@@ -346,6 +367,11 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     auto AddEdge = [&](int vidx0, int vidx1, bool update) {
         int min = std::min(vidx0, vidx1);
         int max = std::max(vidx0, vidx1);
+        // Edges with a locked endpoint are never collapse candidates.
+        if (!locked_vertices.empty() &&
+            (locked_vertices[min] || locked_vertices[max])) {
+            return;
+        }
         Eigen::Vector2i edge(min, max);
         if (update || vbars.count(edge) == 0) {
             const Quadric& Q0 = Qs[min];
@@ -389,7 +415,53 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
     int n_triangles = int(triangles_.size());
-    while (n_triangles > target_number_of_triangles && !queue.empty()) {
+
+    // Compacts the current working state into a standalone mesh without
+    // touching the decimation state, so collapsing can continue afterwards.
+    auto ExtractCurrentMesh = [&]() {
+        auto lod = std::make_shared<TriangleMesh>();
+        std::vector<int> vert_remapping(mesh->vertices_.size(), -1);
+        for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
+            if (vertices_deleted[idx]) {
+                continue;
+            }
+            vert_remapping[idx] = int(lod->vertices_.size());
+            lod->vertices_.push_back(mesh->vertices_[idx]);
+            if (has_vert_normal) {
+                lod->vertex_normals_.push_back(mesh->vertex_normals_[idx]);
+            }
+            if (has_vert_color) {
+                lod->vertex_colors_.push_back(mesh->vertex_colors_[idx]);
+            }
+        }
+        for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
+            if (triangles_deleted[idx]) {
+                continue;
+            }
+            const Eigen::Vector3i& tria = mesh->triangles_[idx];
+            lod->triangles_.push_back(Eigen::Vector3i(vert_remapping[tria(0)],
+                                                      vert_remapping[tria(1)],
+                                                      vert_remapping[tria(2)]));
+        }
+        if (HasTriangleNormals()) {
+            lod->ComputeTriangleNormals();
+        }
+        return lod;
+    };
+
+    // The targets are visited from most to least detailed; each time the
+    // triangle count drops to the next target a snapshot is emitted and the
+    // collapse sequence continues with the same quadrics and queue.
+    std::vector<int> targets = target_number_of_triangles;
+    std::sort(targets.begin(), targets.end(),
+              [](int a, int b) { return a > b; });
+    std::vector<std::shared_ptr<TriangleMesh>> lods;
+    lods.reserve(targets.size());
+    while (lods.size() < targets.size()) {
+        if (n_triangles <= targets[lods.size()] || queue.empty()) {
+            lods.push_back(ExtractCurrentMesh());
+            continue;
+        }
         // retrieve edge from queue
         double cost;
         int vidx0, vidx1;
@@ -504,46 +576,145 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         }
     }
 
-    // Apply changes to the triangle mesh
-    int next_free = 0;
-    std::unordered_map<int, int> vert_remapping;
-    for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
-        if (!vertices_deleted[idx]) {
-            vert_remapping[int(idx)] = next_free;
-            mesh->vertices_[next_free] = mesh->vertices_[idx];
-            if (has_vert_normal) {
-                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
-            }
-            next_free++;
-        }
+    return lods;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles, int num_partitions /* = 0 */) const {
+    if (num_partitions <= 0) {
+#ifdef _OPENMP
+        num_partitions = std::max(omp_get_max_threads(), 1);
+#else
+        num_partitions = 1;
+#endif
     }
-    mesh->vertices_.resize(next_free);
-    if (has_vert_normal) {
-        mesh->vertex_normals_.resize(next_free);
+    if (num_partitions == 1 || triangles_.empty()) {
+        return SimplifyQuadricDecimation(target_number_of_triangles);
     }
-    if (has_vert_color) {
-        mesh->vertex_colors_.resize(next_free);
+
+    // Bin triangles into slabs along the longest bounding-box axis.
+    Eigen::Vector3d min_bound = GetMinBound();
+    Eigen::Vector3d extent = GetMaxBound() - min_bound;
+    int axis;
+    extent.maxCoeff(&axis);
+    if (extent(axis) <= 0.0) {
+        return SimplifyQuadricDecimation(target_number_of_triangles);
+    }
+    std::vector<int> triangle_bin(triangles_.size());
+    std::vector<std::vector<int>> bin_triangles(num_partitions);
+    for (size_t tidx = 0; tidx < triangles_.size(); tidx++) {
+        const Eigen::Vector3i &tria = triangles_[tidx];
+        double centroid = (vertices_[tria(0)](axis) +
+                           vertices_[tria(1)](axis) +
+                           vertices_[tria(2)](axis)) /
+                          3.0;
+        int bin = std::min(int((centroid - min_bound(axis)) / extent(axis) *
+                               num_partitions),
+                           num_partitions - 1);
+        triangle_bin[tidx] = bin;
+        bin_triangles[bin].push_back(int(tidx));
     }
 
-    next_free = 0;
-    for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
-        if (!triangles_deleted[idx]) {
-            Eigen::Vector3i tria = mesh->triangles_[idx];
-            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
-            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
-            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
-            next_free++;
+    // A vertex shared by triangles of different bins is a partition boundary
+    // vertex; it is locked during per-bin simplification so the slabs can be
+    // stitched back without cracks.
+    std::vector<int> vertex_bin(vertices_.size(), -1);
+    std::vector<bool> vertex_on_boundary(vertices_.size(), false);
+    for (size_t tidx = 0; tidx < triangles_.size(); tidx++) {
+        for (int k = 0; k < 3; k++) {
+            int vidx = triangles_[tidx](k);
+            if (vertex_bin[vidx] == -1) {
+                vertex_bin[vidx] = triangle_bin[tidx];
+            } else if (vertex_bin[vidx] != triangle_bin[tidx]) {
+                vertex_on_boundary[vidx] = true;
+            }
         }
     }
-    mesh->triangles_.resize(next_free);
 
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+
+    // Simplify the slabs concurrently.
+    std::vector<std::shared_ptr<TriangleMesh>> bin_meshes(num_partitions);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int bin = 0; bin < num_partitions; bin++) {
+        if (bin_triangles[bin].empty()) {
+            bin_meshes[bin] = std::make_shared<TriangleMesh>();
+            continue;
+        }
+        TriangleMesh submesh;
+        std::unordered_map<int, int> global_to_local;
+        std::vector<bool> locked;
+        submesh.triangles_.reserve(bin_triangles[bin].size());
+        for (int tidx : bin_triangles[bin]) {
+            Eigen::Vector3i local_tria;
+            for (int k = 0; k < 3; k++) {
+                int vidx = triangles_[tidx](k);
+                auto it = global_to_local.find(vidx);
+                if (it == global_to_local.end()) {
+                    int local_vidx = int(submesh.vertices_.size());
+                    global_to_local[vidx] = local_vidx;
+                    submesh.vertices_.push_back(vertices_[vidx]);
+                    if (has_vert_normal) {
+                        submesh.vertex_normals_.push_back(
+                                vertex_normals_[vidx]);
+                    }
+                    if (has_vert_color) {
+                        submesh.vertex_colors_.push_back(vertex_colors_[vidx]);
+                    }
+                    locked.push_back(vertex_on_boundary[vidx]);
+                    local_tria(k) = local_vidx;
+                } else {
+                    local_tria(k) = it->second;
+                }
+            }
+            submesh.triangles_.push_back(local_tria);
+        }
+        int bin_target = int(int64_t(target_number_of_triangles) *
+                             int64_t(bin_triangles[bin].size()) /
+                             int64_t(triangles_.size()));
+        bin_meshes[bin] =
+                submesh.SimplifyQuadricDecimation(bin_target, locked);
+    }
+
+    // Stitch: concatenate the slabs and weld the boundary vertices, which
+    // kept their exact positions, by position identity.
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::unordered_map<Eigen::Vector3d, int,
+                       utility::hash_eigen<Eigen::Vector3d>>
+            position_to_vidx;
+    for (const auto &bin_mesh : bin_meshes) {
+        std::vector<int> remap(bin_mesh->vertices_.size());
+        for (size_t vidx = 0; vidx < bin_mesh->vertices_.size(); vidx++) {
+            const Eigen::Vector3d &vert = bin_mesh->vertices_[vidx];
+            auto it = position_to_vidx.find(vert);
+            if (it != position_to_vidx.end()) {
+                remap[vidx] = it->second;
+            } else {
+                int new_vidx = int(mesh->vertices_.size());
+                position_to_vidx[vert] = new_vidx;
+                mesh->vertices_.push_back(vert);
+                if (has_vert_normal) {
+                    mesh->vertex_normals_.push_back(
+                            bin_mesh->vertex_normals_[vidx]);
+                }
+                if (has_vert_color) {
+                    mesh->vertex_colors_.push_back(
+                            bin_mesh->vertex_colors_[vidx]);
+                }
+                remap[vidx] = new_vidx;
+            }
+        }
+        for (const auto &tria : bin_mesh->triangles_) {
+            mesh->triangles_.push_back(Eigen::Vector3i(
+                    remap[tria(0)], remap[tria(1)], remap[tria(2)]));
+        }
+    }
     if (HasTriangleNormals()) {
         mesh->ComputeTriangleNormals();
     }
-
     return mesh;
 }
 
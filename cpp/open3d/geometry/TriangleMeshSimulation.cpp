@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+std::shared_ptr<Image> TriangleMesh::SimulateDepthImage(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_max /* = infinity */) const {
+    auto depth_map = std::make_shared<Image>();
+    depth_map->Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    if (!HasTriangles()) {
+        utility::LogWarning("[SimulateDepthImage] mesh has no triangles.");
+        std::fill(depth_map->data_.begin(), depth_map->data_.end(), 0);
+        return depth_map;
+    }
+    TriangleMeshBVH bvh(*this);
+    const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = camera_to_world.block<3, 1>(0, 3);
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    // Each pixel casts an independent ray and writes only its own depth
+    // entry.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            // The ray direction has unit camera z, so the ray parameter
+            // returned by the BVH is the camera z depth directly.
+            Eigen::Vector3d dir =
+                    rotation *
+                    Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1.0);
+            double t;
+            int triangle_index;
+            float depth_value = 0.0f;
+            if (bvh.RayCast(origin, dir, t, triangle_index) &&
+                t <= depth_max) {
+                depth_value = (float)t;
+            }
+            *depth_map->PointerAt<float>(u, v) = depth_value;
+        }
+    }
+    return depth_map;
+}
+
+}  // namespace geometry
+}  // namespace open3d
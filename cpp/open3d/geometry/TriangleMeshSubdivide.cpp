@@ -27,14 +27,180 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <algorithm>
+#include <atomic>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+// Unique-edge structure of a triangle list, built from flat sorted
+// edge arrays instead of per-edge hash maps; the arrays are both much
+// smaller than the equivalent unordered_map of sets and parallel to
+// build. Edge ids are deterministic: edges are numbered by (smaller
+// vertex, larger vertex) in ascending order.
+struct SubdivisionEdges {
+    // smaller / larger vertex of each unique edge
+    std::vector<int> vert0;
+    std::vector<int> vert1;
+    // CSR ranges: the triangles adjacent to edge e are
+    // triangles[tri_offsets[e], tri_offsets[e + 1])
+    std::vector<int64_t> tri_offsets;
+    std::vector<int> triangles;
+    // unique edge id of each triangle edge slot; slot tidx*3+e is the
+    // edge between corners e and (e+1)%3 of triangle tidx
+    std::vector<int> slot_edge;
+    // CSR ranges of the unique neighbour vertices of each vertex, with
+    // the connecting edge id alongside for boundary lookups; only
+    // filled when requested
+    std::vector<int64_t> nb_offsets;
+    std::vector<int> nb_verts;
+    std::vector<int> nb_edges;
+
+    int64_t NumEdges() const { return int64_t(vert0.size()); }
+    bool IsBoundaryEdge(int64_t eidx) const {
+        return tri_offsets[eidx + 1] - tri_offsets[eidx] < 2;
+    }
+};
+
+SubdivisionEdges BuildSubdivisionEdges(
+        const std::vector<Eigen::Vector3i>& triangles,
+        int64_t num_vertices,
+        bool build_vertex_neighbours) {
+    SubdivisionEdges edges;
+    int64_t num_slots = int64_t(triangles.size()) * 3;
+    std::vector<int32_t> slot_min(num_slots);
+    std::vector<int32_t> slot_max(num_slots);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t tidx = 0; tidx < int64_t(triangles.size()); tidx++) {
+        const auto& triangle = triangles[tidx];
+        for (int e = 0; e < 3; e++) {
+            int vidx0 = triangle(e);
+            int vidx1 = triangle((e + 1) % 3);
+            slot_min[tidx * 3 + e] = std::min(vidx0, vidx1);
+            slot_max[tidx * 3 + e] = std::max(vidx0, vidx1);
+        }
+    }
+
+    // group the slots by their smaller vertex, then sort each group by
+    // the larger vertex; runs of equal (min, max) are the unique edges
+    std::vector<int64_t> sorted_slots(num_slots);
+    std::vector<int64_t> bucket_offsets(num_vertices + 1);
+    utility::CountingSort(slot_min.data(), slot_min.data() + num_slots,
+                          num_vertices, sorted_slots.data(),
+                          bucket_offsets.data());
+
+    std::vector<int64_t> edge_base(num_vertices + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 4096)
+#endif
+    for (int64_t vidx = 0; vidx < num_vertices; vidx++) {
+        auto begin = sorted_slots.begin() + bucket_offsets[vidx];
+        auto end = sorted_slots.begin() + bucket_offsets[vidx + 1];
+        std::sort(begin, end, [&](int64_t lhs, int64_t rhs) {
+            return slot_max[lhs] != slot_max[rhs]
+                           ? slot_max[lhs] < slot_max[rhs]
+                           : lhs < rhs;
+        });
+        int64_t uniques = 0;
+        int prev = -1;
+        for (auto it = begin; it != end; ++it) {
+            if (slot_max[*it] != prev) {
+                prev = slot_max[*it];
+                uniques++;
+            }
+        }
+        edge_base[vidx + 1] = uniques;
+    }
+    for (int64_t vidx = 0; vidx < num_vertices; vidx++) {
+        edge_base[vidx + 1] += edge_base[vidx];
+    }
+    int64_t num_edges = edge_base[num_vertices];
+
+    edges.vert0.resize(num_edges);
+    edges.vert1.resize(num_edges);
+    edges.tri_offsets.resize(num_edges + 1);
+    edges.triangles.resize(num_slots);
+    edges.slot_edge.resize(num_slots);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 4096)
+#endif
+    for (int64_t vidx = 0; vidx < num_vertices; vidx++) {
+        int64_t eidx = edge_base[vidx] - 1;
+        int prev = -1;
+        for (int64_t i = bucket_offsets[vidx]; i < bucket_offsets[vidx + 1];
+             i++) {
+            int64_t slot = sorted_slots[i];
+            if (slot_max[slot] != prev) {
+                prev = slot_max[slot];
+                eidx++;
+                edges.vert0[eidx] = int(vidx);
+                edges.vert1[eidx] = prev;
+                edges.tri_offsets[eidx] = i;
+            }
+            edges.triangles[i] = int(slot / 3);
+            edges.slot_edge[slot] = int(eidx);
+        }
+    }
+    edges.tri_offsets[num_edges] = num_slots;
+
+    if (build_vertex_neighbours) {
+        std::vector<int64_t> nb_counts(num_vertices, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t eidx = 0; eidx < num_edges; eidx++) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            nb_counts[edges.vert0[eidx]]++;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            nb_counts[edges.vert1[eidx]]++;
+        }
+        edges.nb_offsets.resize(num_vertices + 1);
+        edges.nb_offsets[0] = 0;
+        utility::InclusivePrefixSum(nb_counts.data(),
+                                    nb_counts.data() + num_vertices,
+                                    edges.nb_offsets.data() + 1);
+        edges.nb_verts.resize(edges.nb_offsets[num_vertices]);
+        edges.nb_edges.resize(edges.nb_offsets[num_vertices]);
+        std::vector<int64_t> cursors(edges.nb_offsets.begin(),
+                                     edges.nb_offsets.begin() + num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t eidx = 0; eidx < num_edges; eidx++) {
+            int vidx0 = edges.vert0[eidx];
+            int vidx1 = edges.vert1[eidx];
+            int64_t pos;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            pos = cursors[vidx0]++;
+            edges.nb_verts[pos] = vidx1;
+            edges.nb_edges[pos] = int(eidx);
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            pos = cursors[vidx1]++;
+            edges.nb_verts[pos] = vidx0;
+            edges.nb_edges[pos] = int(eidx);
+        }
+    }
+
+    return edges;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -51,49 +217,55 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
+        int64_t num_vertices = int64_t(mesh->vertices_.size());
+        auto edges = BuildSubdivisionEdges(mesh->triangles_, num_vertices,
+                                           /*build_vertex_neighbours=*/false);
+        int64_t num_edges = edges.NumEdges();
+
+        // the output sizes are exact, so every array is resized once
+        // up front; edge e gets the new vertex num_vertices + e
+        mesh->vertices_.resize(num_vertices + num_edges);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(num_vertices + num_edges);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(num_vertices + num_edges);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t eidx = 0; eidx < num_edges; eidx++) {
+            int vidx0 = edges.vert0[eidx];
+            int vidx1 = edges.vert1[eidx];
+            mesh->vertices_[num_vertices + eidx] =
+                    0.5 * (mesh->vertices_[vidx0] + mesh->vertices_[vidx1]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[num_vertices + eidx] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[num_vertices + eidx] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
+        }
+
+        std::vector<Eigen::Vector3i> new_triangles(4 *
+                                                   mesh->triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t tidx = 0; tidx < int64_t(mesh->triangles_.size());
+             tidx++) {
             const auto& triangle = mesh->triangles_[tidx];
             int vidx0 = triangle(0);
             int vidx1 = triangle(1);
             int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
+            int vidx01 = int(num_vertices + edges.slot_edge[tidx * 3 + 0]);
+            int vidx12 = int(num_vertices + edges.slot_edge[tidx * 3 + 1]);
+            int vidx20 = int(num_vertices + edges.slot_edge[tidx * 3 + 2]);
             new_triangles[tidx * 4 + 0] =
                     Eigen::Vector3i(vidx0, vidx01, vidx20);
             new_triangles[tidx * 4 + 1] =
@@ -103,7 +275,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
             new_triangles[tidx * 4 + 3] =
                     Eigen::Vector3i(vidx01, vidx12, vidx20);
         }
-        mesh->triangles_ = new_triangles;
+        mesh->triangles_ = std::move(new_triangles);
     }
 
     if (HasTriangleNormals()) {
@@ -120,89 +292,132 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
+    auto old_mesh = std::make_shared<TriangleMesh>();
+    old_mesh->vertices_ = vertices_;
+    old_mesh->vertex_colors_ = vertex_colors_;
+    old_mesh->vertex_normals_ = vertex_normals_;
+    old_mesh->triangles_ = triangles_;
 
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        int64_t num_vertices = int64_t(old_mesh->vertices_.size());
+        auto edges = BuildSubdivisionEdges(old_mesh->triangles_, num_vertices,
+                                           /*build_vertex_neighbours=*/true);
+        int64_t num_edges = edges.NumEdges();
+
+        bool non_manifold = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t eidx = 0; eidx < num_edges; eidx++) {
+            if (edges.tri_offsets[eidx + 1] - edges.tri_offsets[eidx] > 2) {
+                non_manifold = true;
+            }
         }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+        if (non_manifold) {
+            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
         }
 
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
+        // the output sizes are exact, so every array is resized once
+        // up front; edge e gets the new vertex num_vertices + e
+        auto new_mesh = std::make_shared<TriangleMesh>();
+        new_mesh->vertices_.resize(num_vertices + num_edges);
         if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
+            new_mesh->vertex_normals_.resize(num_vertices + num_edges);
         }
         if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
+            new_mesh->vertex_colors_.resize(num_vertices + num_edges);
         }
+        new_mesh->triangles_.resize(4 * old_mesh->triangles_.size());
+
+        // smooth the old vertices
+        std::atomic<bool> boundary_warning(false);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t vidx = 0; vidx < num_vertices; vidx++) {
+            int64_t nb_begin = edges.nb_offsets[vidx];
+            int64_t nb_end = edges.nb_offsets[vidx + 1];
+            int64_t degree = nb_end - nb_begin;
+            if (degree == 0) {
+                // isolated vertex, copy through
+                new_mesh->vertices_[vidx] = old_mesh->vertices_[vidx];
+                if (has_vert_normal) {
+                    new_mesh->vertex_normals_[vidx] =
+                            old_mesh->vertex_normals_[vidx];
+                }
+                if (has_vert_color) {
+                    new_mesh->vertex_colors_[vidx] =
+                            old_mesh->vertex_colors_[vidx];
+                }
+                continue;
+            }
 
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+            int64_t num_boundary_nbs = 0;
+            for (int64_t i = nb_begin; i < nb_end; i++) {
+                if (edges.IsBoundaryEdge(edges.nb_edges[i])) {
+                    num_boundary_nbs++;
+                }
+            }
+            // in manifold meshes this should not happen
+            if (num_boundary_nbs > 2) {
+                boundary_warning = true;
+            }
+
+            double beta, alpha;
+            if (num_boundary_nbs >= 2) {
+                beta = 1. / 8.;
+                alpha = 1. - num_boundary_nbs * beta;
+            } else if (degree == 3) {
+                beta = 3. / 16.;
+                alpha = 1. - degree * beta;
+            } else {
+                beta = 3. / (8. * degree);
+                alpha = 1. - degree * beta;
+            }
+
+            new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
+                new_mesh->vertex_normals_[vidx] =
+                        alpha * old_mesh->vertex_normals_[vidx];
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
-            }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
+                new_mesh->vertex_colors_[vidx] =
+                        alpha * old_mesh->vertex_colors_[vidx];
             }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
+            for (int64_t i = nb_begin; i < nb_end; i++) {
+                if (num_boundary_nbs >= 2 &&
+                    !edges.IsBoundaryEdge(edges.nb_edges[i])) {
+                    continue;
+                }
+                int nb = edges.nb_verts[i];
+                new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+                if (has_vert_normal) {
+                    new_mesh->vertex_normals_[vidx] +=
+                            beta * old_mesh->vertex_normals_[nb];
+                }
+                if (has_vert_color) {
+                    new_mesh->vertex_colors_[vidx] +=
+                            beta * old_mesh->vertex_colors_[nb];
+                }
             }
         }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
+        if (boundary_warning) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
+        }
+
+        // compute the new edge vertices
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t eidx = 0; eidx < num_edges; eidx++) {
+            int vidx0 = edges.vert0[eidx];
+            int vidx1 = edges.vert1[eidx];
             Eigen::Vector3d new_vert =
                     old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
             Eigen::Vector3d new_normal;
@@ -216,8 +431,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                             old_mesh->vertex_colors_[vidx1];
             }
 
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
+            int64_t tri_begin = edges.tri_offsets[eidx];
+            int64_t tri_end = edges.tri_offsets[eidx + 1];
+            if (tri_end - tri_begin < 2) {
                 new_vert *= 0.5;
                 if (has_vert_normal) {
                     new_normal *= 0.5;
@@ -233,10 +449,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 if (has_vert_color) {
                     new_color *= 3. / 8.;
                 }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
+                double scale = 1. / (4. * (tri_end - tri_begin));
+                for (int64_t i = tri_begin; i < tri_end; i++) {
+                    const auto& tria = old_mesh->triangles_[edges.triangles[i]];
                     int vidx2 =
                             (tria(0) != vidx0 && tria(0) != vidx1)
                                     ? tria(0)
@@ -253,120 +468,39 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 }
             }
 
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
+            new_mesh->vertices_[num_vertices + eidx] = new_vert;
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
+                new_mesh->vertex_normals_[num_vertices + eidx] = new_normal;
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
+                new_mesh->vertex_colors_[num_vertices + eidx] = new_color;
             }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
-    auto old_mesh = std::make_shared<TriangleMesh>();
-    old_mesh->vertices_ = vertices_;
-    old_mesh->vertex_colors_ = vertex_colors_;
-    old_mesh->vertex_normals_ = vertex_normals_;
-    old_mesh->triangles_ = triangles_;
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
-        auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
-        }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
-
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
+        // emit the four sub-triangles of every face
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t tidx = 0; tidx < int64_t(old_mesh->triangles_.size());
+             tidx++) {
             const auto& triangle = old_mesh->triangles_[tidx];
             int vidx0 = triangle(0);
             int vidx1 = triangle(1);
             int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
+            int vidx01 = int(num_vertices + edges.slot_edge[tidx * 3 + 0]);
+            int vidx12 = int(num_vertices + edges.slot_edge[tidx * 3 + 1]);
+            int vidx20 = int(num_vertices + edges.slot_edge[tidx * 3 + 2]);
+            new_mesh->triangles_[tidx * 4 + 0] =
+                    Eigen::Vector3i(vidx0, vidx01, vidx20);
+            new_mesh->triangles_[tidx * 4 + 1] =
+                    Eigen::Vector3i(vidx01, vidx1, vidx12);
+            new_mesh->triangles_[tidx * 4 + 2] =
+                    Eigen::Vector3i(vidx12, vidx2, vidx20);
+            new_mesh->triangles_[tidx * 4 + 3] =
+                    Eigen::Vector3i(vidx01, vidx12, vidx20);
         }
 
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (HasTriangleNormals()) {
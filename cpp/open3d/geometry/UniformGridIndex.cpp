@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/UniformGridIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+UniformGridIndex::UniformGridIndex() {}
+
+UniformGridIndex::UniformGridIndex(const Geometry &geometry,
+                                   double cell_size) {
+    SetGeometry(geometry, cell_size);
+}
+
+Eigen::Vector3i UniformGridIndex::CellOf(const Eigen::Vector3d &point) const {
+    return Eigen::Vector3i(int(std::floor(point(0) * inv_cell_size_)),
+                           int(std::floor(point(1) * inv_cell_size_)),
+                           int(std::floor(point(2) * inv_cell_size_)));
+}
+
+bool UniformGridIndex::SetMatrixData(const Eigen::MatrixXd &data,
+                                     double cell_size) {
+    if (cell_size <= 0.0) {
+        utility::LogWarning("[UniformGridIndex] cell_size must be positive.");
+        return false;
+    }
+    if (data.rows() != 3 || data.cols() == 0) {
+        utility::LogWarning("[UniformGridIndex] Failed due to no data.");
+        return false;
+    }
+    cell_size_ = cell_size;
+    inv_cell_size_ = 1.0 / cell_size;
+    points_.resize(data.cols());
+    grid_.clear();
+    grid_.reserve(data.cols());
+    for (int i = 0; i < (int)data.cols(); i++) {
+        points_[i] = data.col(i);
+        grid_[CellOf(points_[i])].push_back(i);
+    }
+    return true;
+}
+
+bool UniformGridIndex::SetGeometry(const Geometry &geometry,
+                                   double cell_size) {
+    switch (geometry.GetGeometryType()) {
+        case Geometry::GeometryType::PointCloud:
+            return SetMatrixData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const PointCloud &)geometry)
+                                    .points_.data(),
+                            3, ((const PointCloud &)geometry).points_.size()),
+                    cell_size);
+        case Geometry::GeometryType::TriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+            return SetMatrixData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const TriangleMesh &)geometry)
+                                    .vertices_.data(),
+                            3,
+                            ((const TriangleMesh &)geometry).vertices_.size()),
+                    cell_size);
+        default:
+            utility::LogWarning(
+                    "[UniformGridIndex::SetGeometry] Unsupported Geometry "
+                    "type.");
+            return false;
+    }
+}
+
+int UniformGridIndex::Search(const Eigen::Vector3d &query,
+                             const KDTreeSearchParam &param,
+                             std::vector<int> &indices,
+                             std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    query, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    query, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2);
+        case KDTreeSearchParam::SearchType::Knn:
+        default:
+            utility::LogWarning(
+                    "[UniformGridIndex::Search] Only radius-bounded search "
+                    "is supported.");
+            return -1;
+    }
+    return -1;
+}
+
+int UniformGridIndex::SearchRadius(const Eigen::Vector3d &query,
+                                   double radius,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    if (cell_size_ <= 0.0 || radius <= 0.0) {
+        return -1;
+    }
+    indices.clear();
+    distance2.clear();
+    const double radius2 = radius * radius;
+    const Eigen::Vector3i min_cell =
+            CellOf(query - Eigen::Vector3d::Constant(radius));
+    const Eigen::Vector3i max_cell =
+            CellOf(query + Eigen::Vector3d::Constant(radius));
+    for (int x = min_cell(0); x <= max_cell(0); x++) {
+        for (int y = min_cell(1); y <= max_cell(1); y++) {
+            for (int z = min_cell(2); z <= max_cell(2); z++) {
+                auto it = grid_.find(Eigen::Vector3i(x, y, z));
+                if (it == grid_.end()) continue;
+                for (int idx : it->second) {
+                    double dist2 = (points_[idx] - query).squaredNorm();
+                    if (dist2 <= radius2) {
+                        indices.push_back(idx);
+                        distance2.push_back(dist2);
+                    }
+                }
+            }
+        }
+    }
+    return (int)indices.size();
+}
+
+int UniformGridIndex::SearchHybrid(const Eigen::Vector3d &query,
+                                   double radius,
+                                   int max_nn,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    if (max_nn < 0) {
+        return -1;
+    }
+    int k = SearchRadius(query, radius, indices, distance2);
+    if (k <= max_nn) {
+        return k;
+    }
+    // Keep only the max_nn closest matches, sorted by distance as
+    // KDTreeFlann::SearchHybrid returns them.
+    std::vector<int> order(indices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + max_nn, order.end(),
+                      [&distance2](int a, int b) {
+                          return distance2[a] < distance2[b];
+                      });
+    std::vector<int> top_indices(max_nn);
+    std::vector<double> top_distance2(max_nn);
+    for (int i = 0; i < max_nn; i++) {
+        top_indices[i] = indices[order[i]];
+        top_distance2[i] = distance2[order[i]];
+    }
+    indices = std::move(top_indices);
+    distance2 = std::move(top_distance2);
+    return max_nn;
+}
+
+}  // namespace geometry
+}  // namespace open3d
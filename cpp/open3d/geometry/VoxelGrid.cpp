@@ -26,8 +26,13 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
 
 #include "open3d/camera/PinholeCameraParameters.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -213,52 +218,113 @@ void VoxelGrid::AddVoxel(const Voxel &voxel) {
 
 std::vector<bool> VoxelGrid::CheckIfIncluded(
         const std::vector<Eigen::Vector3d> &queries) {
-    std::vector<bool> output;
-    output.resize(queries.size());
-    size_t i = 0;
-    for (auto &query_double : queries) {
-        auto query = GetVoxel(query_double);
-        output[i] = voxels_.count(query) > 0;
-        i++;
+    // std::vector<bool> packs bits, so the parallel loop writes into a
+    // byte buffer and the result is converted afterwards.
+    std::vector<std::uint8_t> included(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(queries.size()); i++) {
+        auto query = GetVoxel(queries[i]);
+        included[i] = voxels_.count(query) > 0 ? 1 : 0;
+    }
+    return std::vector<bool>(included.begin(), included.end());
+}
+
+std::vector<bool> VoxelGrid::CheckIfIncludedBulk(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    auto less_key = [](const Eigen::Vector3i &lhs, const Eigen::Vector3i &rhs) {
+        if (lhs(0) != rhs(0)) return lhs(0) < rhs(0);
+        if (lhs(1) != rhs(1)) return lhs(1) < rhs(1);
+        return lhs(2) < rhs(2);
+    };
+    std::vector<Eigen::Vector3i> voxel_keys;
+    voxel_keys.reserve(voxels_.size());
+    for (const auto &voxel : voxels_) {
+        voxel_keys.push_back(voxel.first);
+    }
+    tbb::parallel_sort(voxel_keys.begin(), voxel_keys.end(), less_key);
+
+    std::vector<std::pair<Eigen::Vector3i, int64_t>> query_keys(
+            queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(queries.size()); i++) {
+        query_keys[i] = std::make_pair(GetVoxel(queries[i]), i);
+    }
+    tbb::parallel_sort(query_keys.begin(), query_keys.end(),
+                       [&less_key](const std::pair<Eigen::Vector3i, int64_t>
+                                           &lhs,
+                                   const std::pair<Eigen::Vector3i, int64_t>
+                                           &rhs) {
+                           return less_key(lhs.first, rhs.first);
+                       });
+
+    // Merge the sorted query keys against the sorted voxel keys; each
+    // chunk positions its voxel cursor with one binary search and then
+    // advances both sides linearly.
+    std::vector<std::uint8_t> included(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t chunk = 0; chunk < 256; chunk++) {
+        int64_t begin = int64_t(queries.size()) * chunk / 256;
+        int64_t end = int64_t(queries.size()) * (chunk + 1) / 256;
+        if (begin >= end) continue;
+        auto voxel_itr =
+                std::lower_bound(voxel_keys.begin(), voxel_keys.end(),
+                                 query_keys[begin].first, less_key);
+        for (int64_t i = begin; i < end; i++) {
+            const Eigen::Vector3i &key = query_keys[i].first;
+            while (voxel_itr != voxel_keys.end() &&
+                   less_key(*voxel_itr, key)) {
+                ++voxel_itr;
+            }
+            included[query_keys[i].second] =
+                    (voxel_itr != voxel_keys.end() &&
+                     !less_key(key, *voxel_itr))
+                            ? 1
+                            : 0;
+        }
     }
-    return output;
+    return std::vector<bool>(included.begin(), included.end());
 }
 
 void VoxelGrid::CreateFromOctree(const Octree &octree) {
     // TODO: currently only handles color leaf nodes
-    // Get leaf nodes and their node_info
-    std::unordered_map<std::shared_ptr<OctreeColorLeafNode>,
-                       std::shared_ptr<OctreeNodeInfo>>
-            map_node_to_node_info;
-    auto f_collect_nodes =
-            [&map_node_to_node_info](
-                    const std::shared_ptr<OctreeNode> &node,
-                    const std::shared_ptr<OctreeNodeInfo> &node_info) -> void {
-        if (auto color_leaf_node =
-                    std::dynamic_pointer_cast<OctreeColorLeafNode>(node)) {
-            map_node_to_node_info[color_leaf_node] = node_info;
-        }
-    };
-    octree.Traverse(f_collect_nodes);
+    // Collect leaf cells into flat arrays with a single iterative walk,
+    // avoiding the per-node callback and OctreeNodeInfo allocation of
+    // Octree::Traverse.
+    std::vector<Eigen::Vector3d> centers;
+    std::vector<double> sizes;
+    std::vector<Eigen::Vector3d> colors;
+    octree.CollectColorLeaves(centers, sizes, colors);
 
     // Prepare dimensions for voxel
     origin_ = octree.origin_;
     voxels_.clear();
-    for (const auto &it : map_node_to_node_info) {
-        voxel_size_ = std::min(voxel_size_, it.second->size_);
+    voxel_size_ = octree.size_;
+    for (const double &size : sizes) {
+        voxel_size_ = std::min(voxel_size_, size);
     }
 
-    // Convert nodes to voxels
-    for (const auto &it : map_node_to_node_info) {
-        const std::shared_ptr<OctreeColorLeafNode> &node = it.first;
-        const std::shared_ptr<OctreeNodeInfo> &node_info = it.second;
-        Eigen::Array3d node_center =
-                Eigen::Array3d(node_info->origin_) + node_info->size_ / 2.0;
-        Eigen::Vector3i grid_index =
-                Eigen::floor((node_center - Eigen::Array3d(origin_)) /
+    // Convert leaf cells to voxels; grid indices are computed in parallel,
+    // only the hash map insertion is serial.
+    std::vector<Eigen::Vector3i> grid_indices(centers.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < int64_t(centers.size()); i++) {
+        grid_indices[i] =
+                Eigen::floor((Eigen::Array3d(centers[i]) -
+                              Eigen::Array3d(origin_)) /
                              voxel_size_)
                         .cast<int>();
-        AddVoxel(Voxel(grid_index, node->color_));
+    }
+    voxels_.reserve(centers.size());
+    for (size_t i = 0; i < centers.size(); i++) {
+        AddVoxel(Voxel(grid_indices[i], colors[i]));
     }
 }
 
@@ -313,6 +379,78 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
     return *this;
 }
 
+VoxelGrid &VoxelGrid::CarveDepthMaps(
+        const std::vector<Image> &depth_maps,
+        const std::vector<camera::PinholeCameraParameters> &camera_parameters,
+        bool keep_voxels_outside_image) {
+    if (depth_maps.size() != camera_parameters.size()) {
+        utility::LogError(
+                "[VoxelGrid] number of depth maps ({:d}) and camera "
+                "parameters ({:d}) differ",
+                depth_maps.size(), camera_parameters.size());
+    }
+    for (size_t fidx = 0; fidx < depth_maps.size(); fidx++) {
+        if (depth_maps[fidx].height_ !=
+                    camera_parameters[fidx].intrinsic_.height_ ||
+            depth_maps[fidx].width_ !=
+                    camera_parameters[fidx].intrinsic_.width_) {
+            utility::LogError(
+                    "[VoxelGrid] provided depth_map dimensions are not "
+                    "compatible with the provided camera_parameters");
+        }
+    }
+
+    // Snapshot the voxel keys so the carve decisions can be computed in
+    // parallel; voxels are erased serially afterwards.
+    std::vector<Eigen::Vector3i> keys;
+    keys.reserve(voxels_.size());
+    for (const auto &voxel : voxels_) {
+        keys.push_back(voxel.first);
+    }
+    std::vector<char> carve_flags(keys.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)keys.size(); i++) {
+        auto pts = GetVoxelBoundingPoints(keys[i]);
+        // A voxel is removed as soon as one frame carves it; a frame carves
+        // the voxel if none of its corners survives the frame's test.
+        for (size_t fidx = 0; fidx < depth_maps.size() && !carve_flags[i];
+             fidx++) {
+            auto rot = camera_parameters[fidx].extrinsic_.block<3, 3>(0, 0);
+            auto trans = camera_parameters[fidx].extrinsic_.block<3, 1>(0, 3);
+            auto intrinsic =
+                    camera_parameters[fidx].intrinsic_.intrinsic_matrix_;
+            bool carve = true;
+            for (auto &x : pts) {
+                auto x_trans = rot * x + trans;
+                auto uvz = intrinsic * x_trans;
+                double z = uvz(2);
+                double u = uvz(0) / z;
+                double v = uvz(1) / z;
+                double d;
+                bool within_boundary;
+                std::tie(within_boundary, d) =
+                        depth_maps[fidx].FloatValueAt(u, v);
+                if ((!within_boundary && keep_voxels_outside_image) ||
+                    (within_boundary && d > 0 && z >= d)) {
+                    carve = false;
+                    break;
+                }
+            }
+            if (carve) {
+                carve_flags[i] = 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (carve_flags[i]) {
+            voxels_.erase(keys[i]);
+        }
+    }
+    return *this;
+}
+
 VoxelGrid &VoxelGrid::CarveSilhouette(
         const Image &silhouette_mask,
         const camera::PinholeCameraParameters &camera_parameter,
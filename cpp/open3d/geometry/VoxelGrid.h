@@ -136,9 +136,19 @@ public:
 
     /// Element-wise check if a query in the list is included in the VoxelGrid
     /// Queries are double precision and are mapped to the closest voxel.
+    /// The queries are probed in parallel.
     std::vector<bool> CheckIfIncluded(
             const std::vector<Eigen::Vector3d> &queries);
 
+    /// \brief Bulk variant of CheckIfIncluded for large query batches.
+    ///
+    /// Instead of a hash probe per query, the voxel keys and the query
+    /// keys are sorted in parallel and merged, which streams through
+    /// memory and is considerably faster when the batch has millions of
+    /// queries. The result is identical to CheckIfIncluded.
+    std::vector<bool> CheckIfIncludedBulk(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
     /// Remove all voxels from the VoxelGrid where none of the boundary points
     /// of the voxel projects to depth value that is smaller, or equal than the
     /// projected depth of the boundary point. If keep_voxels_outside_image is
@@ -167,6 +177,23 @@ public:
             const camera::PinholeCameraParameters &camera_parameter,
             bool keep_voxels_outside_image);
 
+    /// \brief Batched carving against a sequence of depth maps.
+    ///
+    /// Equivalent to calling CarveDepthMap once per frame, but sweeps the
+    /// voxel set a single time: each voxel is tested against all frames (with
+    /// early exit on the first carving frame) in parallel, so the voxel data
+    /// stays hot in cache instead of the hash map being re-walked per frame.
+    ///
+    /// \param depth_maps Depth maps, one per frame.
+    /// \param camera_parameters Camera parameters, one per frame.
+    /// \param keep_voxels_outside_image Project all voxels to a valid
+    /// location.
+    VoxelGrid &CarveDepthMaps(
+            const std::vector<Image> &depth_maps,
+            const std::vector<camera::PinholeCameraParameters>
+                    &camera_parameters,
+            bool keep_voxels_outside_image);
+
     /// Create VoxelGrid from Octree
     ///
     /// \param octree The input Octree.
@@ -216,6 +243,36 @@ public:
             const Eigen::Vector3d &min_bound,
             const Eigen::Vector3d &max_bound);
 
+    /// Parallel variant of CreateFromPointCloud. Points are accumulated into
+    /// per-thread local maps that are merged at the end, so per-frame
+    /// voxelization scales across cores.
+    ///
+    /// \param input The input PointCloud.
+    /// \param voxel_size Voxel size of of the VoxelGrid construction.
+    /// \param capacity_hint Expected number of occupied voxels; used to
+    /// reserve the hash maps up front and avoid rehashing. 0 derives a hint
+    /// from the point count.
+    static std::shared_ptr<VoxelGrid> CreateFromPointCloudParallel(
+            const PointCloud &input,
+            double voxel_size,
+            size_t capacity_hint = 0);
+
+    /// Parallel variant of CreateFromPointCloudWithinBounds; see
+    /// CreateFromPointCloudParallel.
+    ///
+    /// \param input The input PointCloud.
+    /// \param voxel_size Voxel size of of the VoxelGrid construction.
+    /// \param min_bound Minimum boundary point for the VoxelGrid to create.
+    /// \param max_bound Maximum boundary point for the VoxelGrid to create.
+    /// \param capacity_hint Expected number of occupied voxels; 0 derives a
+    /// hint from the point count.
+    static std::shared_ptr<VoxelGrid> CreateFromPointCloudWithinBoundsParallel(
+            const PointCloud &input,
+            double voxel_size,
+            const Eigen::Vector3d &min_bound,
+            const Eigen::Vector3d &max_bound,
+            size_t capacity_hint = 0);
+
     /// Creates a VoxelGrid from a given TriangleMesh. No color information is
     /// converted. The bounds of the created VoxelGrid are computed from the
     /// TriangleMesh.
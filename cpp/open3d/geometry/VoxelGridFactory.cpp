@@ -26,6 +26,9 @@
 
 #include <numeric>
 #include <unordered_map>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
@@ -105,6 +108,101 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     return output;
 }
 
+std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBoundsParallel(
+        const PointCloud &input,
+        double voxel_size,
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound,
+        size_t capacity_hint /* = 0 */) {
+    auto output = std::make_shared<VoxelGrid>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelGridFromPointCloud] voxel_size <= 0.");
+    }
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (max_bound - min_bound).maxCoeff()) {
+        utility::LogError("[VoxelGridFromPointCloud] voxel_size is too small.");
+    }
+    output->voxel_size_ = voxel_size;
+    output->origin_ = min_bound;
+    bool has_colors = input.HasColors();
+    if (capacity_hint == 0) {
+        // Rough default: assume a quarter of the points land in distinct
+        // voxels.
+        capacity_hint = input.points_.size() / 4 + 1;
+    }
+#ifdef _OPENMP
+    const int num_threads = std::max(omp_get_max_threads(), 1);
+#else
+    const int num_threads = 1;
+#endif
+    // Per-thread local accumulation over disjoint point ranges; the local
+    // maps are merged below (counts and color sums add up).
+    std::vector<std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
+                                   utility::hash_eigen<Eigen::Vector3i>>>
+            local_maps(num_threads);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+#ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+#else
+        const int tid = 0;
+#endif
+        auto &local = local_maps[tid];
+        local.reserve(capacity_hint / num_threads + 1);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < (int)input.points_.size(); i++) {
+            Eigen::Vector3d ref_coord =
+                    (input.points_[i] - min_bound) / voxel_size;
+            Eigen::Vector3i voxel_index(int(floor(ref_coord(0))),
+                                        int(floor(ref_coord(1))),
+                                        int(floor(ref_coord(2))));
+            if (has_colors) {
+                local[voxel_index].Add(voxel_index, input.colors_[i]);
+            } else {
+                local[voxel_index].Add(voxel_index);
+            }
+        }
+    }
+    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxelindex_to_accpoint;
+    voxelindex_to_accpoint.reserve(capacity_hint);
+    for (auto &local : local_maps) {
+        for (auto &accpoint : local) {
+            auto &merged = voxelindex_to_accpoint[accpoint.first];
+            merged.voxel_index_ = accpoint.first;
+            merged.color_ += accpoint.second.color_;
+            merged.num_of_points_ += accpoint.second.num_of_points_;
+        }
+    }
+    for (auto accpoint : voxelindex_to_accpoint) {
+        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
+        const Eigen::Vector3d &color =
+                has_colors ? accpoint.second.GetAverageColor()
+                           : Eigen::Vector3d(0, 0, 0);
+        output->AddVoxel(geometry::Voxel(grid_index, color));
+    }
+    utility::LogDebug(
+            "Pointcloud is voxelized from {:d} points to {:d} voxels.",
+            (int)input.points_.size(), (int)output->voxels_.size());
+    return output;
+}
+
+std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudParallel(
+        const PointCloud &input,
+        double voxel_size,
+        size_t capacity_hint /* = 0 */) {
+    Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    return CreateFromPointCloudWithinBoundsParallel(
+            input, voxel_size, min_bound, max_bound, capacity_hint);
+}
+
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloud(
         const PointCloud &input, double voxel_size) {
     Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
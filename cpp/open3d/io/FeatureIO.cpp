@@ -34,11 +34,17 @@ namespace io {
 
 bool ReadFeature(const std::string &filename,
                  pipelines::registration::Feature &feature) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "cbin") {
+        return ReadFeatureFromCBIN(filename, feature);
+    }
     return ReadFeatureFromBIN(filename, feature);
 }
 
 bool WriteFeature(const std::string &filename,
                   const pipelines::registration::Feature &feature) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "cbin") {
+        return WriteFeatureToCBIN(filename, feature);
+    }
     return WriteFeatureToBIN(filename, feature);
 }
 
@@ -49,5 +49,16 @@ bool ReadFeatureFromBIN(const std::string &filename,
 bool WriteFeatureToBIN(const std::string &filename,
                        const pipelines::registration::Feature &feature);
 
+/// Reads a feature from the compressed binary container (.cbin).
+bool ReadFeatureFromCBIN(const std::string &filename,
+                         pipelines::registration::Feature &feature);
+
+/// Writes a feature to the compressed binary container (.cbin). The
+/// container is chunk compressed and carries dimension and count
+/// metadata, which makes it considerably smaller than the raw BIN
+/// format while keeping random access to the data.
+bool WriteFeatureToCBIN(const std::string &filename,
+                        const pipelines::registration::Feature &feature);
+
 }  // namespace io
 }  // namespace open3d
@@ -27,7 +27,14 @@
 #include "FileFormatIO.h"
 
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 
 namespace open3d {
@@ -57,5 +64,129 @@ FileGeometry ReadFileGeometryType(const std::string& path) {
     }
 }
 
+// Appends one row of values_per_line doubles to values for every line in
+// [first, last) whose first fields all parse as decimal numbers; other
+// lines are skipped, like the sscanf readers this replaces. The buffer
+// must be NUL terminated so that strtod cannot run past its end.
+static void ParseDoubleLines(const char* first,
+                             const char* last,
+                             int values_per_line,
+                             std::vector<double>& values) {
+    std::vector<double> row(values_per_line);
+    const char* line = first;
+    while (line < last) {
+        const char* line_end = static_cast<const char*>(
+                std::memchr(line, '\n', last - line));
+        if (line_end == nullptr) {
+            line_end = last;
+        }
+        const char* p = line;
+        int parsed = 0;
+        while (parsed < values_per_line) {
+            while (p < line_end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+                p++;
+            }
+            // Any other whitespace would let strtod skip across the line
+            // break and steal a value from the next line.
+            if (p == line_end || std::isspace((unsigned char)*p)) {
+                break;
+            }
+            char* number_end;
+            row[parsed] = std::strtod(p, &number_end);
+            if (number_end == p) {
+                break;
+            }
+            p = number_end;
+            parsed++;
+        }
+        if (parsed == values_per_line) {
+            values.insert(values.end(), row.begin(), row.end());
+        }
+        line = line_end + 1;
+    }
+}
+
+bool ReadASCIIDoubleTable(const std::string& filename,
+                          int values_per_line,
+                          std::vector<double>& values,
+                          const std::function<bool(double)>& update_progress) {
+    values.clear();
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return false;
+    }
+    utility::SampledProgressReporter reporter(update_progress);
+    const int64_t file_size = file.GetFileSize();
+    reporter.SetTotal(file_size);
+
+    // The extra NUL byte terminates the buffer so that strtod in
+    // ParseDoubleLines cannot read past the end of the last line.
+    std::vector<char> buffer(size_t(file_size) + 1);
+    if (file_size > 0 &&
+        fread(buffer.data(), 1, size_t(file_size), file.GetFILE()) !=
+                size_t(file_size)) {
+        return false;
+    }
+    buffer[size_t(file_size)] = '\0';
+
+    // Every chunk begins right after a newline, so splitting the buffer
+    // never splits a line; chunks parse independently into per-chunk
+    // vectors that are concatenated in file order afterwards.
+    const int64_t chunk_bytes = 4 << 20;
+    const int num_chunks = int(
+            std::max(int64_t(1), (file_size + chunk_bytes - 1) / chunk_bytes));
+    std::vector<std::vector<double>> chunk_values(num_chunks);
+    std::atomic<int64_t> processed_bytes{0};
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        const char* data = buffer.data();
+        const char* buffer_end = data + file_size;
+        const char* first = data + int64_t(chunk) * chunk_bytes;
+        const char* last = data + std::min(int64_t(chunk + 1) * chunk_bytes,
+                                           file_size);
+        // Both boundaries advance to the next line start, so the chunk
+        // that owns the preceding bytes parses the straddling line.
+        if (chunk > 0) {
+            while (first < buffer_end && first[-1] != '\n') {
+                first++;
+            }
+        }
+        while (last < buffer_end && last[-1] != '\n') {
+            last++;
+        }
+        // Parse in line-aligned blocks and report each block through a
+        // shared byte counter: the counts stay monotone across threads
+        // and the reporter sees fine-grained progress even when the
+        // whole file fits into a single chunk.
+        const int64_t block_bytes = 64 << 10;
+        const char* block_first = first;
+        while (block_first < last) {
+            const char* block_last =
+                    std::min(block_first + block_bytes, last);
+            while (block_last < last && block_last[-1] != '\n') {
+                block_last++;
+            }
+            ParseDoubleLines(block_first, block_last, values_per_line,
+                             chunk_values[chunk]);
+            reporter.Update(
+                    processed_bytes.fetch_add(block_last - block_first) +
+                    (block_last - block_first));
+            block_first = block_last;
+        }
+    }
+    size_t num_values = 0;
+    for (const auto& cv : chunk_values) {
+        num_values += cv.size();
+    }
+    values.reserve(num_values);
+    for (const auto& cv : chunk_values) {
+        values.insert(values.end(), cv.begin(), cv.end());
+    }
+    reporter.Finish();
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace open3d {
 namespace io {
@@ -54,5 +56,19 @@ FileGeometry ReadFileGeometryTypeXYZ(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZN(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZRGB(const std::string& path);
 
+/// \brief Reads a whitespace separated table of decimal values in parallel.
+///
+/// Block-reads the file and splits it into newline aligned chunks that are
+/// parsed on all threads. Every line whose first \p values_per_line fields
+/// parse as decimal numbers appends one row of \p values_per_line doubles
+/// to \p values; other lines are skipped, matching the per-line sscanf
+/// readers this replaces. Rows keep their file order. \p update_progress
+/// is invoked with the percentage of bytes parsed.
+/// \return true unless the file cannot be opened or read.
+bool ReadASCIIDoubleTable(const std::string& filename,
+                          int values_per_line,
+                          std::vector<double>& values,
+                          const std::function<bool(double)>& update_progress);
+
 }  // namespace io
 }  // namespace open3d
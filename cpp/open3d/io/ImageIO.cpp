@@ -26,10 +26,12 @@
 
 #include "open3d/io/ImageIO.h"
 
+#include <thread>
 #include <unordered_map>
 
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
 
@@ -82,6 +84,62 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
     return map_itr->second(filename, image);
 }
 
+bool ReadImageBatch(const std::vector<std::string> &filenames,
+                    std::vector<geometry::Image> &images,
+                    std::function<bool(double)> update_progress /* = {}*/,
+                    int n_threads /* = -1*/) {
+    // Not cleared on purpose: slots that already hold an image of the
+    // right size keep their buffer and the decoders write into it.
+    images.resize(filenames.size());
+    if (filenames.empty()) {
+        return true;
+    }
+    if (n_threads <= 0) {
+        n_threads = int(std::thread::hardware_concurrency());
+    }
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(int64_t(filenames.size()));
+
+    int num_failures = 0;
+    int64_t num_finished = 0;
+    bool stop = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+#endif
+    for (int fidx = 0; fidx < int(filenames.size()); fidx++) {
+        if (stop) {
+            continue;
+        }
+        bool file_ok = false;
+        try {
+            file_ok = ReadImage(filenames[fidx], images[fidx]);
+        } catch (const std::exception &) {
+            file_ok = false;
+        }
+#ifdef _OPENMP
+#pragma omp critical(ReadImageBatchProgress)
+#endif
+        {
+            if (!file_ok) {
+                num_failures++;
+            }
+            num_finished++;
+            if (!reporter.Update(num_finished)) {
+                stop = true;
+            }
+        }
+    }
+    if (num_failures > 0) {
+        utility::LogWarning(
+                "Read geometry::Image batch failed on {:d} of {:d} files.",
+                num_failures, int(filenames.size()));
+    }
+    if (!stop) {
+        reporter.Finish();
+    }
+    return num_failures == 0 && !stop;
+}
+
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = 90*/) {
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "open3d/geometry/Image.h"
 
@@ -43,6 +45,23 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// \brief Reads a batch of image files concurrently.
+///
+/// The files decode on \p n_threads worker threads (one per hardware
+/// thread if n_threads <= 0). \p images is resized to match \p filenames
+/// but its existing elements are reused: when a slot already holds an
+/// image of the same size, the decoder writes into its buffer without
+/// reallocating, so a loader that passes the same vector every epoch
+/// pays the allocation cost only once. \p update_progress reports the
+/// number of completed files; returning false from it stops the batch
+/// before the remaining files are dispatched.
+/// \return return true if every file was read successfully and the batch
+/// was not cancelled, false otherwise.
+bool ReadImageBatch(const std::vector<std::string> &filenames,
+                    std::vector<geometry::Image> &images,
+                    std::function<bool(double)> update_progress = {},
+                    int n_threads = -1);
+
 /// The general entrance for writing an Image to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports quality, the parameter will be used.
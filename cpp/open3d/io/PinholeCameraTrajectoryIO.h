@@ -68,5 +68,18 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads a trajectory from the binary format (.btraj). Fixed-size
+/// records loaded with a single bulk read, orders of magnitude faster
+/// than the per-camera JSON parse for large trajectories.
+bool ReadPinholeCameraTrajectoryFromBTRAJ(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes a trajectory to the binary format (.btraj). The file is in
+/// host byte order and not portable between endiannesses.
+bool WritePinholeCameraTrajectoryToBTRAJ(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
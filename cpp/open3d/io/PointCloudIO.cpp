@@ -26,12 +26,17 @@
 
 #include "open3d/io/PointCloudIO.h"
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <thread>
 #include <unordered_map>
 
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -51,6 +56,8 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"cbin", ReadPointCloudFromCBIN},
+                {"tpcd", ReadPointCloudFromTPCD},
         };
 
 static const std::unordered_map<
@@ -65,7 +72,20 @@ static const std::unordered_map<
                 {"ply", WritePointCloudToPLY},
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
+                {"cbin", WritePointCloudToCBIN},
+                {"tpcd", WritePointCloudToTPCD},
         };
+
+// Packs a color into the float representation PCD stores in its "rgb"
+// field; identical to the conversion in FilePCD.cpp.
+float PackRGBToPCDFloat(const Eigen::Vector3d &color) {
+    auto rgb = utility::ColorToUint8(color);
+    std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
+    float value;
+    std::memcpy(&value, rgba, 4);
+    return value;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -82,6 +102,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params) {
+    utility::ProfilerZone zone("ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -129,6 +150,321 @@ bool ReadPointCloud(const std::string &filename,
     return ReadPointCloud(filename, pointcloud, p);
 }
 
+bool ReadPointCloudRegion(const std::string &filename,
+                          const geometry::AxisAlignedBoundingBox &bbox,
+                          geometry::PointCloud &pointcloud,
+                          const ReadPointCloudOption &params) {
+    std::string format = params.format;
+    if (format == "auto") {
+        format = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    if (format != "tpcd") {
+        utility::LogWarning(
+                "Read geometry::PointCloud region failed: format {} has no "
+                "spatial index, only tpcd supports region reads.",
+                format);
+        return false;
+    }
+    bool success = ReadPointCloudRegionFromTPCD(filename, bbox, pointcloud,
+                                                params);
+    utility::LogDebug("Read geometry::PointCloud region: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    if (params.remove_nan_points || params.remove_infinite_points) {
+        pointcloud.RemoveNonFinitePoints(params.remove_nan_points,
+                                         params.remove_infinite_points);
+    }
+    return success;
+}
+
+bool ReadPointCloudBatch(const std::vector<std::string> &filenames,
+                         std::vector<geometry::PointCloud> &pointclouds,
+                         const ReadPointCloudOption &params /* = {}*/,
+                         int n_threads /* = -1*/) {
+    pointclouds.clear();
+    pointclouds.resize(filenames.size());
+    if (filenames.empty()) {
+        return true;
+    }
+    if (n_threads <= 0) {
+        n_threads = int(std::thread::hardware_concurrency());
+    }
+    // Per-file progress callbacks from concurrent readers would
+    // interleave, so the files are read silently and the shared reporter
+    // counts completed files instead.
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(int64_t(filenames.size()));
+    ReadPointCloudOption file_params = params;
+    file_params.print_progress = false;
+    file_params.update_progress = {};
+
+    int num_failures = 0;
+    int64_t num_finished = 0;
+    bool stop = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+#endif
+    for (int fidx = 0; fidx < int(filenames.size()); fidx++) {
+        if (stop) {
+            continue;
+        }
+        bool file_ok = false;
+        try {
+            file_ok = ReadPointCloud(filenames[fidx], pointclouds[fidx],
+                                     file_params);
+        } catch (const std::exception &) {
+            file_ok = false;
+        }
+#ifdef _OPENMP
+#pragma omp critical(ReadPointCloudBatchProgress)
+#endif
+        {
+            if (!file_ok) {
+                num_failures++;
+            }
+            num_finished++;
+            if (!reporter.Update(num_finished)) {
+                stop = true;
+            }
+        }
+    }
+    if (num_failures > 0) {
+        utility::LogWarning(
+                "Read geometry::PointCloud batch failed on {:d} of {:d} "
+                "files.",
+                num_failures, int(filenames.size()));
+    }
+    if (!stop) {
+        reporter.Finish();
+    }
+    return num_failures == 0 && !stop;
+}
+
+PointCloudStreamWriter::~PointCloudStreamWriter() { Close(); }
+
+std::string PointCloudStreamWriter::GenerateHeader(int64_t num_points) const {
+    // The counts are zero padded to a fixed width so that the header
+    // keeps the same length for any point count and can be patched in
+    // place when the writer closes or resumes.
+    char count_lines[128];
+    std::string header;
+    if (format_ == "pcd") {
+        header += "# .PCD v0.7 - Point Cloud Data file format\n";
+        header += "VERSION 0.7\n";
+        std::string fields = "x y z";
+        std::string sizes = "4 4 4";
+        std::string types = "F F F";
+        std::string counts = "1 1 1";
+        if (write_normals_) {
+            fields += " normal_x normal_y normal_z";
+            sizes += " 4 4 4";
+            types += " F F F";
+            counts += " 1 1 1";
+        }
+        if (write_colors_) {
+            fields += " rgb";
+            sizes += " 4";
+            types += " F";
+            counts += " 1";
+        }
+        header += "FIELDS " + fields + "\n";
+        header += "SIZE " + sizes + "\n";
+        header += "TYPE " + types + "\n";
+        header += "COUNT " + counts + "\n";
+        snprintf(count_lines, sizeof(count_lines),
+                 "WIDTH %012lld\nHEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\n"
+                 "POINTS %012lld\nDATA binary\n",
+                 (long long)num_points, (long long)num_points);
+        header += count_lines;
+    } else {
+        header += "ply\n";
+        header += "format binary_little_endian 1.0\n";
+        header += "comment Created by Open3D\n";
+        snprintf(count_lines, sizeof(count_lines),
+                 "element vertex %012lld\n", (long long)num_points);
+        header += count_lines;
+        header += "property double x\nproperty double y\nproperty double z\n";
+        if (write_normals_) {
+            header += "property double nx\nproperty double ny\n";
+            header += "property double nz\n";
+        }
+        if (write_colors_) {
+            header += "property uchar red\nproperty uchar green\n";
+            header += "property uchar blue\n";
+        }
+        header += "end_header\n";
+    }
+    return header;
+}
+
+bool PointCloudStreamWriter::Open(const std::string &filename,
+                                  bool write_normals,
+                                  bool write_colors) {
+    if (file_ != nullptr) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: a file is already "
+                "open.");
+        return false;
+    }
+    format_ = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (format_ != "ply" && format_ != "pcd") {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: unknown file "
+                "extension {} for file {}.",
+                format_, filename);
+        return false;
+    }
+    if (format_ == "ply") {
+        // The vertex records go out in host byte order, so the PLY
+        // little-endian header is only correct on little-endian hosts.
+        const std::uint16_t probe = 0x0001;
+        if (*reinterpret_cast<const std::uint8_t *>(&probe) != 1) {
+            utility::LogWarning(
+                    "Stream write geometry::PointCloud failed: PLY append "
+                    "requires a little-endian host.");
+            return false;
+        }
+    }
+    write_normals_ = write_normals;
+    write_colors_ = write_colors;
+    num_points_ = 0;
+
+    // Resume an existing file if there is one; its header must match
+    // this writer's layout byte for byte, otherwise it cannot be patched
+    // in place.
+    FILE *existing = fopen(filename.c_str(), "r+b");
+    if (existing != nullptr) {
+        const std::string expected = GenerateHeader(0);
+        std::vector<char> buffer(expected.size());
+        size_t num_read = fread(buffer.data(), 1, buffer.size(), existing);
+        std::string head(buffer.data(), num_read);
+        const std::string count_key =
+                format_ == "pcd" ? "\nPOINTS " : "element vertex ";
+        long long count = -1;
+        size_t key_pos = head.find(count_key);
+        if (key_pos != std::string::npos) {
+            count = strtoll(head.c_str() + key_pos + count_key.size(),
+                            nullptr, 10);
+        }
+        if (count < 0 || GenerateHeader(count) != head ||
+            fseek(existing, 0, SEEK_END) != 0) {
+            fclose(existing);
+            utility::LogWarning(
+                    "Stream write geometry::PointCloud failed: {} was not "
+                    "created by PointCloudStreamWriter or stores a different "
+                    "attribute layout.",
+                    filename);
+            return false;
+        }
+        num_points_ = count;
+        file_ = existing;
+        return true;
+    }
+
+    file_ = fopen(filename.c_str(), "wb");
+    if (file_ == nullptr) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: unable to open "
+                "file: {}",
+                filename);
+        return false;
+    }
+    const std::string header = GenerateHeader(0);
+    if (fwrite(header.data(), 1, header.size(), file_) != header.size()) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: unable to write "
+                "file: {}",
+                filename);
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool PointCloudStreamWriter::AppendPointCloud(
+        const geometry::PointCloud &pointcloud) {
+    if (file_ == nullptr) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: no file is open.");
+        return false;
+    }
+    if ((write_normals_ && !pointcloud.HasNormals()) ||
+        (write_colors_ && !pointcloud.HasColors())) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: chunk misses "
+                "attributes the file stores.");
+        return false;
+    }
+    const size_t num_points = pointcloud.points_.size();
+    // Pack the whole chunk and write it with a single fwrite.
+    std::vector<char> buffer;
+    if (format_ == "pcd") {
+        const int floats_per_point =
+                3 + (write_normals_ ? 3 : 0) + (write_colors_ ? 1 : 0);
+        buffer.resize(num_points * floats_per_point * sizeof(float));
+        float *data = reinterpret_cast<float *>(buffer.data());
+        for (size_t i = 0; i < num_points; i++) {
+            for (int c = 0; c < 3; c++) {
+                *data++ = (float)pointcloud.points_[i](c);
+            }
+            if (write_normals_) {
+                for (int c = 0; c < 3; c++) {
+                    *data++ = (float)pointcloud.normals_[i](c);
+                }
+            }
+            if (write_colors_) {
+                *data++ = PackRGBToPCDFloat(pointcloud.colors_[i]);
+            }
+        }
+    } else {
+        const size_t point_size = (write_normals_ ? 6 : 3) * sizeof(double) +
+                                  (write_colors_ ? 3 : 0);
+        buffer.resize(num_points * point_size);
+        char *data = buffer.data();
+        for (size_t i = 0; i < num_points; i++) {
+            std::memcpy(data, pointcloud.points_[i].data(),
+                        3 * sizeof(double));
+            data += 3 * sizeof(double);
+            if (write_normals_) {
+                std::memcpy(data, pointcloud.normals_[i].data(),
+                            3 * sizeof(double));
+                data += 3 * sizeof(double);
+            }
+            if (write_colors_) {
+                auto rgb = utility::ColorToUint8(pointcloud.colors_[i]);
+                std::memcpy(data, rgb.data(), 3);
+                data += 3;
+            }
+        }
+    }
+    if (fwrite(buffer.data(), 1, buffer.size(), file_) != buffer.size()) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: unable to write "
+                "chunk.");
+        return false;
+    }
+    num_points_ += int64_t(num_points);
+    return true;
+}
+
+bool PointCloudStreamWriter::Close() {
+    if (file_ == nullptr) {
+        return true;
+    }
+    const std::string header = GenerateHeader(num_points_);
+    bool success = fseek(file_, 0, SEEK_SET) == 0 &&
+                   fwrite(header.data(), 1, header.size(), file_) ==
+                           header.size();
+    success = fclose(file_) == 0 && success;
+    file_ = nullptr;
+    if (!success) {
+        utility::LogWarning(
+                "Stream write geometry::PointCloud failed: unable to patch "
+                "the header counts.");
+    }
+    return success;
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
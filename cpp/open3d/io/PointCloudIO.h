@@ -26,8 +26,10 @@
 
 #pragma once
 
+#include <cstdio>
 #include <string>
 
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 
 namespace open3d {
@@ -85,6 +87,35 @@ bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params = {});
 
+/// \brief Reads the part of a point cloud file inside \p bbox.
+///
+/// Only formats with a spatial index support this; currently that is
+/// the tiled .tpcd format, whose tile directory lets the reader stream
+/// just the tiles that intersect \p bbox instead of the whole file.
+/// Points of border tiles that fall outside \p bbox are dropped.
+/// \return return true if the read function is successful, false
+/// otherwise.
+bool ReadPointCloudRegion(const std::string &filename,
+                          const geometry::AxisAlignedBoundingBox &bbox,
+                          geometry::PointCloud &pointcloud,
+                          const ReadPointCloudOption &params = {});
+
+/// \brief Reads a batch of point cloud files concurrently.
+///
+/// Format detection and decoding of the individual files run on
+/// \p n_threads worker threads (one per hardware thread if n_threads <=
+/// 0), which keeps the storage device busy when many small tiles are
+/// loaded. \p params applies to every file, except that its
+/// update_progress callback reports the number of completed files
+/// instead of per-file progress; returning false from it stops the batch
+/// before the remaining files are dispatched.
+/// \return return true if every file was read successfully and the batch
+/// was not cancelled, false otherwise.
+bool ReadPointCloudBatch(const std::vector<std::string> &filenames,
+                         std::vector<geometry::PointCloud> &pointclouds,
+                         const ReadPointCloudOption &params = {},
+                         int n_threads = -1);
+
 /// \struct WritePointCloudOption
 /// \brief Optional parameters to WritePointCloud
 struct WritePointCloudOption {
@@ -139,6 +170,54 @@ bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params = {});
 
+/// \class PointCloudStreamWriter
+/// \brief Writes a point cloud to a file incrementally.
+///
+/// Unlike WritePointCloud, which rewrites the whole file on every call,
+/// this writer opens the file once, appends chunks of points as they
+/// arrive and patches the counts in the header when it is closed, so
+/// sinking a stream to disk costs O(points) instead of rewriting the
+/// file per chunk. Supported formats are binary PLY and uncompressed
+/// binary PCD, selected by the file extension; the records match the
+/// ones WritePointCloud produces for these formats. Whether normals and
+/// colors are stored is fixed when the file is opened. Open() resumes a
+/// file previously produced by this writer and keeps appending to it.
+class PointCloudStreamWriter {
+public:
+    PointCloudStreamWriter() = default;
+    ~PointCloudStreamWriter();
+
+    PointCloudStreamWriter(const PointCloudStreamWriter &) = delete;
+    PointCloudStreamWriter &operator=(const PointCloudStreamWriter &) = delete;
+
+    /// \brief Creates \p filename, or resumes it if it already exists.
+    ///
+    /// Resuming requires that the existing file was written by this
+    /// class with the same attribute layout; the header of any other
+    /// file cannot be patched in place.
+    /// \return true if the file is ready for AppendPointCloud.
+    bool Open(const std::string &filename,
+              bool write_normals,
+              bool write_colors);
+    /// \brief Appends the points of \p pointcloud to the open file.
+    /// The cloud must carry the attributes chosen in Open().
+    bool AppendPointCloud(const geometry::PointCloud &pointcloud);
+    /// \brief Patches the header counts and closes the file.
+    /// Called by the destructor if the file is still open.
+    bool Close();
+    /// Number of points written to the file so far.
+    int64_t GetNumPoints() const { return num_points_; }
+
+private:
+    std::string GenerateHeader(int64_t num_points) const;
+
+    FILE *file_ = nullptr;
+    std::string format_;
+    bool write_normals_ = false;
+    bool write_colors_ = false;
+    int64_t num_points_ = 0;
+};
+
 bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -187,5 +266,26 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudFromCBIN(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool WritePointCloudToCBIN(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
+bool ReadPointCloudFromTPCD(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool ReadPointCloudRegionFromTPCD(const std::string &filename,
+                                  const geometry::AxisAlignedBoundingBox &bbox,
+                                  geometry::PointCloud &pointcloud,
+                                  const ReadPointCloudOption &params);
+
+bool WritePointCloudToTPCD(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace open3d
@@ -26,6 +26,9 @@
 
 #include "open3d/io/PoseGraphIO.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <unordered_map>
 
 #include "open3d/io/IJsonConvertibleIO.h"
@@ -48,12 +51,119 @@ bool WritePoseGraphToJSON(
     return WriteIJsonConvertibleToJSON(filename, pose_graph);
 }
 
+// Compact binary checkpoint format: magic, version, node and edge
+// counts, then fixed size records in host byte order. Serializing it
+// is a handful of bulk fwrites, which keeps checkpointing large graphs
+// from stalling on JSON generation.
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'G', 'R', 'P', 'H'};
+const std::uint32_t kPoseGraphBINVersion = 1;
+
+bool WritePoseGraphToBIN(
+        const std::string &filename,
+        const pipelines::registration::PoseGraph &pose_graph) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == nullptr) {
+        utility::LogWarning(
+                "Write BIN failed: unable to open file: {}", filename);
+        return false;
+    }
+    bool success = true;
+    const std::uint64_t num_nodes = pose_graph.nodes_.size();
+    const std::uint64_t num_edges = pose_graph.edges_.size();
+    success = success && fwrite(kPoseGraphBINMagic, 1, 8, file) == 8;
+    success = success &&
+              fwrite(&kPoseGraphBINVersion, sizeof(std::uint32_t), 1, file) ==
+                      1;
+    success = success &&
+              fwrite(&num_nodes, sizeof(std::uint64_t), 1, file) == 1;
+    success = success &&
+              fwrite(&num_edges, sizeof(std::uint64_t), 1, file) == 1;
+    for (std::uint64_t i = 0; success && i < num_nodes; i++) {
+        success = fwrite(pose_graph.nodes_[i].pose_.data(), sizeof(double),
+                         16, file) == 16;
+    }
+    for (std::uint64_t i = 0; success && i < num_edges; i++) {
+        const auto &edge = pose_graph.edges_[i];
+        const std::int32_t source = edge.source_node_id_;
+        const std::int32_t target = edge.target_node_id_;
+        const std::uint8_t uncertain = edge.uncertain_ ? 1 : 0;
+        success = fwrite(&source, sizeof(std::int32_t), 1, file) == 1 &&
+                  fwrite(&target, sizeof(std::int32_t), 1, file) == 1 &&
+                  fwrite(edge.transformation_.data(), sizeof(double), 16,
+                         file) == 16 &&
+                  fwrite(edge.information_.data(), sizeof(double), 36,
+                         file) == 36 &&
+                  fwrite(&uncertain, sizeof(std::uint8_t), 1, file) == 1 &&
+                  fwrite(&edge.confidence_, sizeof(double), 1, file) == 1;
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning(
+                "Write BIN failed: unable to write file: {}", filename);
+    }
+    return success;
+}
+
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning(
+                "Read BIN failed: unable to open file: {}", filename);
+        return false;
+    }
+    char magic[8];
+    std::uint32_t version = 0;
+    std::uint64_t num_nodes = 0;
+    std::uint64_t num_edges = 0;
+    bool success = fread(magic, 1, 8, file) == 8 &&
+                   memcmp(magic, kPoseGraphBINMagic, 8) == 0 &&
+                   fread(&version, sizeof(std::uint32_t), 1, file) == 1 &&
+                   version == kPoseGraphBINVersion &&
+                   fread(&num_nodes, sizeof(std::uint64_t), 1, file) == 1 &&
+                   fread(&num_edges, sizeof(std::uint64_t), 1, file) == 1;
+    if (success) {
+        pose_graph.nodes_.resize(num_nodes);
+        pose_graph.edges_.resize(num_edges);
+    }
+    for (std::uint64_t i = 0; success && i < num_nodes; i++) {
+        success = fread(pose_graph.nodes_[i].pose_.data(), sizeof(double), 16,
+                        file) == 16;
+    }
+    for (std::uint64_t i = 0; success && i < num_edges; i++) {
+        auto &edge = pose_graph.edges_[i];
+        std::int32_t source = -1;
+        std::int32_t target = -1;
+        std::uint8_t uncertain = 0;
+        success = fread(&source, sizeof(std::int32_t), 1, file) == 1 &&
+                  fread(&target, sizeof(std::int32_t), 1, file) == 1 &&
+                  fread(edge.transformation_.data(), sizeof(double), 16,
+                        file) == 16 &&
+                  fread(edge.information_.data(), sizeof(double), 36, file) ==
+                          36 &&
+                  fread(&uncertain, sizeof(std::uint8_t), 1, file) == 1 &&
+                  fread(&edge.confidence_, sizeof(double), 1, file) == 1;
+        edge.source_node_id_ = source;
+        edge.target_node_id_ = target;
+        edge.uncertain_ = uncertain != 0;
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning(
+                "Read BIN failed: unable to parse file: {}", filename);
+        pose_graph.nodes_.clear();
+        pose_graph.edges_.clear();
+    }
+    return success;
+}
+
 static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &,
                            pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"bin", ReadPoseGraphFromBIN},
         };
 
 static const std::unordered_map<
@@ -62,6 +172,7 @@ static const std::unordered_map<
                            const pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"bin", WritePoseGraphToBIN},
         };
 
 }  // unnamed namespace
@@ -116,5 +227,66 @@ bool WritePoseGraph(const std::string &filename,
     return map_itr->second(filename, pose_graph);
 }
 
+AsyncPoseGraphWriter::AsyncPoseGraphWriter()
+    : worker_(&AsyncPoseGraphWriter::WorkerLoop, this) {}
+
+AsyncPoseGraphWriter::~AsyncPoseGraphWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    pending_cv_.notify_one();
+    worker_.join();
+}
+
+void AsyncPoseGraphWriter::Write(
+        const std::string &filename,
+        const pipelines::registration::PoseGraph &pose_graph) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (has_pending_) {
+            utility::LogDebug(
+                    "[AsyncPoseGraphWriter] Dropping a stale checkpoint for "
+                    "{}.",
+                    pending_filename_);
+        }
+        pending_filename_ = filename;
+        pending_graph_ = pose_graph;
+        has_pending_ = true;
+    }
+    pending_cv_.notify_one();
+}
+
+bool AsyncPoseGraphWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return !has_pending_ && !writing_; });
+    return all_succeeded_;
+}
+
+void AsyncPoseGraphWriter::WorkerLoop() {
+    for (;;) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        pending_cv_.wait(lock, [this] { return has_pending_ || shutdown_; });
+        if (!has_pending_) {
+            break;
+        }
+        // Take the checkpoint out of the slot so a new one can be
+        // queued while this one is on its way to the disk.
+        std::string filename = std::move(pending_filename_);
+        pipelines::registration::PoseGraph graph = std::move(pending_graph_);
+        has_pending_ = false;
+        writing_ = true;
+        lock.unlock();
+        bool success = WritePoseGraph(filename, graph);
+        lock.lock();
+        writing_ = false;
+        if (!success) {
+            all_succeeded_ = false;
+        }
+        lock.unlock();
+        done_cv_.notify_all();
+    }
+}
+
 }  // namespace io
 }  // namespace open3d
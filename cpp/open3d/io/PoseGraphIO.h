@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "open3d/pipelines/registration/PoseGraph.h"
 
@@ -51,5 +54,49 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+/// \class AsyncPoseGraphWriter
+/// \brief Writes pose graph checkpoints on a background thread.
+///
+/// Write() copies the graph into a pending slot and returns
+/// immediately; a worker thread serializes the slot with WritePoseGraph
+/// (any registered format, e.g. .json or the binary .bin checkpoints).
+/// The slot is double buffered: if a new checkpoint arrives while the
+/// previous one is still waiting, the stale one is dropped, so an
+/// optimization loop that checkpoints every iteration never stalls on
+/// disk and the newest state always wins.
+class AsyncPoseGraphWriter {
+public:
+    AsyncPoseGraphWriter();
+    /// Drains the pending checkpoint before shutting the worker down.
+    ~AsyncPoseGraphWriter();
+
+    AsyncPoseGraphWriter(const AsyncPoseGraphWriter &) = delete;
+    AsyncPoseGraphWriter &operator=(const AsyncPoseGraphWriter &) = delete;
+
+    /// \brief Queues \p pose_graph to be written to \p filename.
+    /// Costs one copy of the graph; the disk write happens on the
+    /// worker thread. A checkpoint still pending from a previous call
+    /// is replaced.
+    void Write(const std::string &filename,
+               const pipelines::registration::PoseGraph &pose_graph);
+    /// \brief Blocks until the queued checkpoint has reached the disk.
+    /// \return true if every completed write succeeded so far.
+    bool Flush();
+
+private:
+    void WorkerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable pending_cv_;
+    std::condition_variable done_cv_;
+    std::string pending_filename_;
+    pipelines::registration::PoseGraph pending_graph_;
+    bool has_pending_ = false;
+    bool writing_ = false;
+    bool shutdown_ = false;
+    bool all_succeeded_ = true;
+    std::thread worker_;
+};
+
 }  // namespace io
 }  // namespace open3d
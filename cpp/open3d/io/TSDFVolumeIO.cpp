@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Checkpoint format for ScalableTSDFVolume, all fields in host byte
+// order:
+//   magic "O3DTSDF\0", uint32 version
+//   float64 voxel_length, float64 sdf_trunc
+//   int32 color_type, int32 volume_unit_resolution
+//   int32 depth_sampling_stride, uint64 num_units
+//   per unit: int32 x, y, z, uint64 payload_size, payload
+// A payload is the unit's tsdf, weight and (when colored) color arrays
+// concatenated and lzf compressed; a payload whose size equals the
+// uncompressed size is stored verbatim. The reader keeps the payloads
+// compressed and lets the volume inflate them lazily on access.
+
+#include "open3d/io/TSDFVolumeIO.h"
+
+#include <liblzf/lzf.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char kTSDFMagic[8] = {'O', '3', 'D', 'T', 'S', 'D', 'F', '\0'};
+const std::uint32_t kTSDFVersion = 1;
+
+std::uint64_t UnitPayloadBytes(
+        int volume_unit_resolution,
+        pipelines::integration::TSDFVolumeColorType color_type) {
+    const std::uint64_t voxel_num = (std::uint64_t)volume_unit_resolution *
+                                    volume_unit_resolution *
+                                    volume_unit_resolution;
+    std::uint64_t bytes = voxel_num * 2 * sizeof(float);
+    if (color_type != pipelines::integration::TSDFVolumeColorType::NoColor) {
+        bytes += voxel_num * sizeof(Eigen::Vector3f);
+    }
+    return bytes;
+}
+
+bool WriteVolumeUnit(FILE *file,
+                     const Eigen::Vector3i &index,
+                     const std::vector<char> &payload) {
+    const std::int32_t key[3] = {index(0), index(1), index(2)};
+    const std::uint64_t payload_size = payload.size();
+    return fwrite(key, sizeof(std::int32_t), 3, file) == 3 &&
+           fwrite(&payload_size, sizeof(std::uint64_t), 1, file) == 1 &&
+           fwrite(payload.data(), 1, payload.size(), file) == payload.size();
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+std::shared_ptr<pipelines::integration::ScalableTSDFVolume>
+CreateScalableTSDFVolumeFromFile(const std::string &filename) {
+    auto volume = std::make_shared<pipelines::integration::ScalableTSDFVolume>(
+            4.0 / 512.0, 0.04,
+            pipelines::integration::TSDFVolumeColorType::RGB8);
+    ReadScalableTSDFVolume(filename, *volume);
+    return volume;
+}
+
+bool ReadScalableTSDFVolume(
+        const std::string &filename,
+        pipelines::integration::ScalableTSDFVolume &volume) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read TSDF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    char magic[8];
+    std::uint32_t version;
+    double voxel_length, sdf_trunc;
+    std::int32_t color_type, volume_unit_resolution, depth_sampling_stride;
+    std::uint64_t num_units;
+    bool success =
+            fread(magic, 1, 8, file) == 8 &&
+            std::memcmp(magic, kTSDFMagic, 8) == 0 &&
+            fread(&version, sizeof(std::uint32_t), 1, file) == 1 &&
+            version == kTSDFVersion &&
+            fread(&voxel_length, sizeof(double), 1, file) == 1 &&
+            fread(&sdf_trunc, sizeof(double), 1, file) == 1 &&
+            fread(&color_type, sizeof(std::int32_t), 1, file) == 1 &&
+            fread(&volume_unit_resolution, sizeof(std::int32_t), 1, file) ==
+                    1 &&
+            fread(&depth_sampling_stride, sizeof(std::int32_t), 1, file) ==
+                    1 &&
+            fread(&num_units, sizeof(std::uint64_t), 1, file) == 1;
+    if (!success) {
+        utility::LogWarning("Read TSDF failed: unrecognized header in {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    volume.voxel_length_ = voxel_length;
+    volume.sdf_trunc_ = sdf_trunc;
+    volume.color_type_ =
+            (pipelines::integration::TSDFVolumeColorType)color_type;
+    volume.volume_unit_resolution_ = volume_unit_resolution;
+    volume.volume_unit_length_ = voxel_length * volume_unit_resolution;
+    volume.depth_sampling_stride_ = depth_sampling_stride;
+    volume.Reset();
+    const std::uint64_t raw_bytes =
+            UnitPayloadBytes(volume_unit_resolution, volume.color_type_);
+    for (std::uint64_t i = 0; success && i < num_units; i++) {
+        std::int32_t key[3];
+        std::uint64_t payload_size;
+        success = fread(key, sizeof(std::int32_t), 3, file) == 3 &&
+                  fread(&payload_size, sizeof(std::uint64_t), 1, file) == 1 &&
+                  payload_size > 0 && payload_size <= raw_bytes;
+        if (success) {
+            std::vector<char> payload(payload_size);
+            success = fread(payload.data(), 1, payload_size, file) ==
+                      payload_size;
+            if (success) {
+                volume.pending_volume_units_[Eigen::Vector3i(
+                        key[0], key[1], key[2])] = std::move(payload);
+            }
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read TSDF failed: truncated file {}", filename);
+        volume.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool WriteScalableTSDFVolume(
+        const std::string &filename,
+        const pipelines::integration::ScalableTSDFVolume &volume) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == nullptr) {
+        utility::LogWarning("Write TSDF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::int32_t color_type = (std::int32_t)volume.color_type_;
+    const std::int32_t volume_unit_resolution =
+            volume.volume_unit_resolution_;
+    const std::int32_t depth_sampling_stride = volume.depth_sampling_stride_;
+    std::uint64_t num_units = volume.pending_volume_units_.size();
+    for (const auto &unit : volume.volume_units_) {
+        if (unit.second.volume_) {
+            num_units++;
+        }
+    }
+    bool success =
+            fwrite(kTSDFMagic, 1, 8, file) == 8 &&
+            fwrite(&kTSDFVersion, sizeof(std::uint32_t), 1, file) == 1 &&
+            fwrite(&volume.voxel_length_, sizeof(double), 1, file) == 1 &&
+            fwrite(&volume.sdf_trunc_, sizeof(double), 1, file) == 1 &&
+            fwrite(&color_type, sizeof(std::int32_t), 1, file) == 1 &&
+            fwrite(&volume_unit_resolution, sizeof(std::int32_t), 1, file) ==
+                    1 &&
+            fwrite(&depth_sampling_stride, sizeof(std::int32_t), 1, file) ==
+                    1 &&
+            fwrite(&num_units, sizeof(std::uint64_t), 1, file) == 1;
+    const std::uint64_t raw_bytes = UnitPayloadBytes(
+            volume.volume_unit_resolution_, volume.color_type_);
+    std::vector<char> raw(raw_bytes);
+    std::vector<char> compressed(raw_bytes);
+    for (auto unit_itr = volume.volume_units_.begin();
+         success && unit_itr != volume.volume_units_.end(); ++unit_itr) {
+        if (!unit_itr->second.volume_) {
+            continue;
+        }
+        const auto &unit_volume = *unit_itr->second.volume_;
+        const size_t tsdf_bytes =
+                unit_volume.voxel_tsdf_.size() * sizeof(float);
+        const size_t weight_bytes =
+                unit_volume.voxel_weight_.size() * sizeof(float);
+        const size_t color_bytes =
+                unit_volume.voxel_color_.size() * sizeof(Eigen::Vector3f);
+        std::memcpy(raw.data(), unit_volume.voxel_tsdf_.data(), tsdf_bytes);
+        std::memcpy(raw.data() + tsdf_bytes, unit_volume.voxel_weight_.data(),
+                    weight_bytes);
+        if (color_bytes > 0) {
+            std::memcpy(raw.data() + tsdf_bytes + weight_bytes,
+                        unit_volume.voxel_color_.data(), color_bytes);
+        }
+        // A payload that lzf cannot shrink is stored verbatim; the size
+        // equal to raw_bytes identifies it on read.
+        unsigned int compressed_size =
+                lzf_compress(raw.data(), (unsigned int)raw_bytes,
+                             compressed.data(), (unsigned int)raw_bytes - 1);
+        if (compressed_size == 0) {
+            success = WriteVolumeUnit(file, unit_itr->first, raw);
+        } else {
+            compressed.resize(compressed_size);
+            success = WriteVolumeUnit(file, unit_itr->first, compressed);
+            compressed.resize(raw_bytes);
+        }
+    }
+    // Units restored lazily and never touched are still compressed; pass
+    // them through as they are.
+    for (auto pending_itr = volume.pending_volume_units_.begin();
+         success && pending_itr != volume.pending_volume_units_.end();
+         ++pending_itr) {
+        success = WriteVolumeUnit(file, pending_itr->first,
+                                  pending_itr->second);
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write TSDF failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+namespace open3d {
+namespace io {
+
+/// Factory function to create a ScalableTSDFVolume from a checkpoint file.
+/// Return an empty volume if fail to read the file.
+std::shared_ptr<pipelines::integration::ScalableTSDFVolume>
+CreateScalableTSDFVolumeFromFile(const std::string &filename);
+
+/// \brief Read a ScalableTSDFVolume checkpoint written by
+/// WriteScalableTSDFVolume().
+///
+/// The volume is Reset() and its integration parameters are replaced by
+/// the ones stored in the file. The compressed volume units are kept in
+/// pending_volume_units_ and decompressed lazily on first access, so
+/// restoring a checkpoint costs file I/O plus only the units the caller
+/// actually touches afterwards.
+/// \return If the read function is successful.
+bool ReadScalableTSDFVolume(const std::string &filename,
+                            pipelines::integration::ScalableTSDFVolume &volume);
+
+/// \brief Write a ScalableTSDFVolume checkpoint.
+///
+/// Every volume unit is compressed independently, so checkpointing a
+/// building-scale volume stays a bulk sequential write. Units that were
+/// read lazily and never touched are passed through in their compressed
+/// form without being decompressed first.
+/// \return If the write function is successful.
+bool WriteScalableTSDFVolume(
+        const std::string &filename,
+        const pipelines::integration::ScalableTSDFVolume &volume);
+
+}  // namespace io
+}  // namespace open3d
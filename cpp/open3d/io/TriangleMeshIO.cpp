@@ -42,7 +42,14 @@ static const std::unordered_map<
                 const std::string &, geometry::TriangleMesh &, bool)>>
         file_extension_to_trianglemesh_read_function{
                 {"ply", ReadTriangleMeshFromPLY},
-                {"stl", ReadTriangleMeshFromSTL},
+                // The default argument of ReadTriangleMeshFromSTL does
+                // not survive the conversion to std::function.
+                {"stl",
+                 [](const std::string &filename, geometry::TriangleMesh &mesh,
+                    bool print_progress) {
+                     return ReadTriangleMeshFromSTL(filename, mesh,
+                                                    print_progress);
+                 }},
                 {"obj", ReadTriangleMeshFromOBJ},
                 {"off", ReadTriangleMeshFromOFF},
                 {"gltf", ReadTriangleMeshFromGLTF},
@@ -74,9 +74,15 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+/// Reads a binary STL file. STL stores a triangle soup, so every
+/// triangle gets three private vertices; with \p weld_vertices enabled
+/// coinciding vertices are merged into an indexed mesh, which
+/// algorithms like SimplifyQuadricDecimation need to see shared
+/// vertices.
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
-                             bool print_progress);
+                             bool print_progress,
+                             bool weld_vertices = false);
 
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "open3d/io/FeatureIO.h"
@@ -36,21 +37,23 @@ namespace open3d {
 namespace {
 using namespace io;
 
-bool ReadMatrixXdFromBINFile(FILE *file, Eigen::MatrixXd &mat) {
+bool ReadMatrixXdFromBINFile(const char *data,
+                             size_t size,
+                             Eigen::MatrixXd &mat) {
     uint32_t rows, cols;
-    if (fread(&rows, sizeof(uint32_t), 1, file) < 1) {
+    if (size < 2 * sizeof(uint32_t)) {
         utility::LogWarning("Read BIN failed: unexpected EOF.");
         return false;
     }
-    if (fread(&cols, sizeof(uint32_t), 1, file) < 1) {
+    std::memcpy(&rows, data, sizeof(uint32_t));
+    std::memcpy(&cols, data + sizeof(uint32_t), sizeof(uint32_t));
+    size_t num_bytes = sizeof(double) * rows * cols;
+    if (size < 2 * sizeof(uint32_t) + num_bytes) {
         utility::LogWarning("Read BIN failed: unexpected EOF.");
         return false;
     }
     mat.resize(rows, cols);
-    if (fread(mat.data(), sizeof(double), rows * cols, file) < rows * cols) {
-        utility::LogWarning("Read BIN failed: unexpected EOF.");
-        return false;
-    }
+    std::memcpy(mat.data(), data + 2 * sizeof(uint32_t), num_bytes);
     return true;
 }
 
@@ -78,15 +81,16 @@ namespace io {
 
 bool ReadFeatureFromBIN(const std::string &filename,
                         pipelines::registration::Feature &feature) {
-    FILE *fid = utility::filesystem::FOpen(filename, "rb");
-    if (fid == NULL) {
+    utility::filesystem::MemoryMappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read BIN failed: unable to open file: {}",
                             filename);
         return false;
     }
-    bool success = ReadMatrixXdFromBINFile(fid, feature.data_);
-    fclose(fid);
-    return success;
+    file.Advise(utility::filesystem::MemoryMappedFile::AccessPattern::
+                        Sequential);
+    return ReadMatrixXdFromBINFile(static_cast<const char *>(file.GetData()),
+                                   file.GetSize(), feature.data_);
 }
 
 bool WriteFeatureToBIN(const std::string &filename,
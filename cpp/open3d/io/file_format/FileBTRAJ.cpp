@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Binary camera trajectory format (.btraj).
+//
+// The JSON trajectory format parses one object tree per camera, which
+// is far too slow for trajectories with hundreds of thousands of
+// poses. This format stores fixed-size records that are read and
+// written with a single bulk transfer.
+//
+// Layout, all fields in host byte order:
+//   magic "O3DBTRAJ", uint32 version, uint64 num_cameras
+//   per camera:
+//     int32 width, int32 height
+//     9 doubles  intrinsic matrix (column-major)
+//     16 doubles extrinsic matrix (column-major)
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+
+const char kBTRAJMagic[8] = {'O', '3', 'D', 'B', 'T', 'R', 'A', 'J'};
+const std::uint32_t kBTRAJVersion = 1;
+
+// Fixed-size on-disk record; plain doubles so the whole trajectory can
+// be moved with one fread/fwrite.
+struct BTRAJRecord {
+    std::int32_t width;
+    std::int32_t height;
+    double intrinsic[9];
+    double extrinsic[16];
+};
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPinholeCameraTrajectoryFromBTRAJ(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read BTRAJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    char magic[8];
+    std::uint32_t version;
+    std::uint64_t num_cameras;
+    if (fread(magic, sizeof(magic), 1, file) != 1 ||
+        std::memcmp(magic, kBTRAJMagic, sizeof(magic)) != 0 ||
+        fread(&version, sizeof(version), 1, file) != 1 ||
+        version != kBTRAJVersion ||
+        fread(&num_cameras, sizeof(num_cameras), 1, file) != 1) {
+        utility::LogWarning("Read BTRAJ failed: unrecognized format.");
+        fclose(file);
+        return false;
+    }
+    std::vector<BTRAJRecord> records(num_cameras);
+    if (num_cameras > 0 && fread(records.data(), sizeof(BTRAJRecord),
+                                 num_cameras, file) != num_cameras) {
+        utility::LogWarning("Read BTRAJ failed: truncated file.");
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+
+    trajectory.parameters_.resize(num_cameras);
+    for (std::uint64_t i = 0; i < num_cameras; i++) {
+        const BTRAJRecord &record = records[i];
+        camera::PinholeCameraParameters &parameter =
+                trajectory.parameters_[i];
+        parameter.intrinsic_.width_ = record.width;
+        parameter.intrinsic_.height_ = record.height;
+        std::memcpy(parameter.intrinsic_.intrinsic_matrix_.data(),
+                    record.intrinsic, sizeof(record.intrinsic));
+        std::memcpy(parameter.extrinsic_.data(), record.extrinsic,
+                    sizeof(record.extrinsic));
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBTRAJ(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write BTRAJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::uint64_t num_cameras = trajectory.parameters_.size();
+    std::vector<BTRAJRecord> records(num_cameras);
+    for (std::uint64_t i = 0; i < num_cameras; i++) {
+        const camera::PinholeCameraParameters &parameter =
+                trajectory.parameters_[i];
+        BTRAJRecord &record = records[i];
+        record.width = parameter.intrinsic_.width_;
+        record.height = parameter.intrinsic_.height_;
+        std::memcpy(record.intrinsic,
+                    parameter.intrinsic_.intrinsic_matrix_.data(),
+                    sizeof(record.intrinsic));
+        std::memcpy(record.extrinsic, parameter.extrinsic_.data(),
+                    sizeof(record.extrinsic));
+    }
+    if (fwrite(kBTRAJMagic, sizeof(kBTRAJMagic), 1, file) != 1 ||
+        fwrite(&kBTRAJVersion, sizeof(kBTRAJVersion), 1, file) != 1 ||
+        fwrite(&num_cameras, sizeof(num_cameras), 1, file) != 1 ||
+        (num_cameras > 0 && fwrite(records.data(), sizeof(BTRAJRecord),
+                                   num_cameras, file) != num_cameras)) {
+        utility::LogWarning("Write BTRAJ failed: unable to write file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -37,55 +37,96 @@
 namespace open3d {
 namespace io {
 
-// Adapts an array of bytes to an array of T. Will advance of byte_stride each
-// elements.
+// Bulk-converts a (possibly strided) accessor of T vec3 elements into
+// Eigen::Vector3d slots; a flat loop over a preallocated destination
+// instead of a virtual call and push_back per element. scale folds the
+// normalization of integer color components into the copy.
 template <typename T>
-struct ArrayAdapter {
-    // Pointer to the bytes
-    const unsigned char* data_ptr;
-    // Number of elements in the array
-    const size_t elem_count;
-    // Stride in bytes between two elements
-    const size_t stride;
-
-    // Construct an array adapter.
-    // \param ptr Pointer to the start of the data, with offset applied
-    // \param count Number of elements in the array
-    // \param byte_stride Stride betweens elements in the array
-    ArrayAdapter(const unsigned char* ptr, size_t count, size_t byte_stride)
-        : data_ptr(ptr), elem_count(count), stride(byte_stride) {}
-
-    // Returns a *copy* of a single element. Can't be used to modify it.
-    T operator[](size_t pos) const {
-        if (pos >= elem_count)
-            throw std::out_of_range(
-                    "Tried to access beyond the last element of an array "
-                    "adapter with count " +
-                    std::to_string(elem_count) +
-                    " while getting element number " + std::to_string(pos));
-        return *(reinterpret_cast<const T*>(data_ptr + pos * stride));
+static void CopyVec3Accessor(const unsigned char* data,
+                             size_t count,
+                             size_t byte_stride,
+                             double scale,
+                             Eigen::Vector3d* dst) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(count); i++) {
+        const T* v = reinterpret_cast<const T*>(data + i * byte_stride);
+        dst[i] = Eigen::Vector3d(v[0] * scale, v[1] * scale, v[2] * scale);
     }
-};
-
-// Interface of any adapted array that returns integer data
-struct IntArrayBase {
-    virtual ~IntArrayBase() = default;
-    virtual unsigned int operator[](size_t) const = 0;
-    virtual size_t size() const = 0;
-};
-
-// An array that loads integer types, and returns them as int
-template <class T>
-struct IntArray : public IntArrayBase {
-    ArrayAdapter<T> adapter;
-
-    IntArray(const ArrayAdapter<T>& a) : adapter(a) {}
-    unsigned int operator[](size_t position) const override {
-        return static_cast<unsigned int>(adapter[position]);
+}
+
+// Assembles triangles from a (possibly strided) index accessor of
+// component type T, following the glTF primitive mode. dst must provide
+// one slot per output triangle.
+template <typename T>
+static void CopyTriangleIndices(const unsigned char* data,
+                                size_t byte_stride,
+                                int mode,
+                                size_t index_count,
+                                Eigen::Vector3i* dst) {
+    auto index_at = [data, byte_stride](size_t i) {
+        return static_cast<int>(static_cast<unsigned int>(
+                *reinterpret_cast<const T*>(data + i * byte_stride)));
+    };
+    switch (mode) {
+        case TINYGLTF_MODE_TRIANGLES:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int t = 0; t < int(index_count / 3); t++) {
+                dst[t] = Eigen::Vector3i(index_at(3 * t + 0),
+                                         index_at(3 * t + 1),
+                                         index_at(3 * t + 2));
+            }
+            break;
+        case TINYGLTF_MODE_TRIANGLE_STRIP:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 2; i < int(index_count); i++) {
+                dst[i - 2] = Eigen::Vector3i(index_at(i - 2), index_at(i - 1),
+                                             index_at(i));
+            }
+            break;
+        case TINYGLTF_MODE_TRIANGLE_FAN:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 2; i < int(index_count); i++) {
+                dst[i - 2] = Eigen::Vector3i(index_at(0), index_at(i - 1),
+                                             index_at(i));
+            }
+            break;
     }
+}
 
-    size_t size() const override { return adapter.elem_count; }
-};
+static bool IsSupportedIndexComponentType(int component_type) {
+    switch (component_type) {
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        case TINYGLTF_COMPONENT_TYPE_INT:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Number of triangles a primitive mode produces from index_count indices.
+static size_t TriangleCountFromIndices(int mode, size_t index_count) {
+    switch (mode) {
+        case TINYGLTF_MODE_TRIANGLES:
+            return index_count / 3;
+        case TINYGLTF_MODE_TRIANGLE_STRIP:
+        case TINYGLTF_MODE_TRIANGLE_FAN:
+            return index_count >= 2 ? index_count - 2 : 0;
+        default:
+            return 0;
+    }
+}
 
 FileGeometry ReadFileGeometryTypeGLTF(const std::string& path) {
     return FileGeometry(CONTAINS_TRIANGLES | CONTAINS_POINTS);
@@ -129,220 +170,178 @@ bool ReadTriangleMeshFromGLTF(const std::string& filename,
             mesh_temp.Clear();
             const tinygltf::Mesh& gltf_mesh = model.meshes[gltf_node.mesh];
 
-            for (const tinygltf::Primitive& primitive : gltf_mesh.primitives) {
+            // First pass: per-primitive output offsets, so every accessor
+            // bulk-copies into a preallocated slice of the mesh arrays
+            // instead of growing them element by element.
+            const size_t num_primitives = gltf_mesh.primitives.size();
+            std::vector<size_t> vertex_offsets(num_primitives + 1, 0);
+            std::vector<size_t> normal_offsets(num_primitives + 1, 0);
+            std::vector<size_t> color_offsets(num_primitives + 1, 0);
+            std::vector<size_t> triangle_offsets(num_primitives + 1, 0);
+            for (size_t p = 0; p < num_primitives; p++) {
+                const tinygltf::Primitive& primitive = gltf_mesh.primitives[p];
+                size_t num_vertices = 0;
+                size_t num_normals = 0;
+                size_t num_colors = 0;
+                size_t num_triangles = 0;
                 for (const auto& attribute : primitive.attributes) {
+                    const tinygltf::Accessor& accessor =
+                            model.accessors[attribute.second];
                     if (attribute.first == "POSITION") {
-                        tinygltf::Accessor& positions_accessor =
-                                model.accessors[attribute.second];
-                        tinygltf::BufferView& positions_view =
-                                model.bufferViews[positions_accessor
-                                                          .bufferView];
-                        const tinygltf::Buffer& positions_buffer =
-                                model.buffers[positions_view.buffer];
-                        const float* positions = reinterpret_cast<const float*>(
-                                &positions_buffer
-                                         .data[positions_view.byteOffset +
-                                               positions_accessor.byteOffset]);
-
-                        for (size_t i = 0; i < positions_accessor.count; ++i) {
-                            mesh_temp.vertices_.push_back(Eigen::Vector3d(
-                                    positions[i * 3 + 0], positions[i * 3 + 1],
-                                    positions[i * 3 + 2]));
+                        num_vertices = accessor.count;
+                    } else if (attribute.first == "NORMAL") {
+                        num_normals = accessor.count;
+                    } else if (attribute.first == "COLOR_0") {
+                        switch (accessor.componentType) {
+                            case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                                num_colors = accessor.count;
+                                break;
+                            default:
+                                break;
                         }
                     }
+                }
+                if (primitive.indices >= 0 &&
+                    IsSupportedIndexComponentType(
+                            model.accessors[primitive.indices]
+                                    .componentType)) {
+                    num_triangles = TriangleCountFromIndices(
+                            primitive.mode,
+                            model.accessors[primitive.indices].count);
+                }
+                vertex_offsets[p + 1] = vertex_offsets[p] + num_vertices;
+                normal_offsets[p + 1] = normal_offsets[p] + num_normals;
+                color_offsets[p + 1] = color_offsets[p] + num_colors;
+                triangle_offsets[p + 1] = triangle_offsets[p] + num_triangles;
+            }
+            mesh_temp.vertices_.resize(vertex_offsets[num_primitives]);
+            mesh_temp.vertex_normals_.resize(normal_offsets[num_primitives]);
+            mesh_temp.vertex_colors_.resize(color_offsets[num_primitives]);
+            mesh_temp.triangles_.resize(triangle_offsets[num_primitives]);
+
+            // Second pass: copy the accessor data. The copy helpers run
+            // their element loops on all threads, which also covers the
+            // common single-primitive file.
+            for (size_t p = 0; p < num_primitives; p++) {
+                const tinygltf::Primitive& primitive = gltf_mesh.primitives[p];
+                for (const auto& attribute : primitive.attributes) {
+                    const tinygltf::Accessor& accessor =
+                            model.accessors[attribute.second];
+                    const tinygltf::BufferView& view =
+                            model.bufferViews[accessor.bufferView];
+                    const tinygltf::Buffer& buffer = model.buffers[view.buffer];
+                    const unsigned char* data = buffer.data.data() +
+                                                view.byteOffset +
+                                                accessor.byteOffset;
+                    // According to glTF 2.0 specs: when byteStride==0, it
+                    // means that accessor elements are tightly packed.
+                    size_t byte_stride = view.byteStride;
+                    if (byte_stride == 0) {
+                        byte_stride = accessor.type *
+                                      tinygltf::GetComponentSizeInBytes(
+                                              accessor.componentType);
+                    }
+
+                    if (attribute.first == "POSITION") {
+                        CopyVec3Accessor<float>(
+                                data, accessor.count, byte_stride, 1.0,
+                                mesh_temp.vertices_.data() + vertex_offsets[p]);
+                    }
 
                     if (attribute.first == "NORMAL") {
-                        tinygltf::Accessor& normals_accessor =
-                                model.accessors[attribute.second];
-                        tinygltf::BufferView& normals_view =
-                                model.bufferViews[normals_accessor.bufferView];
-                        const tinygltf::Buffer& normals_buffer =
-                                model.buffers[normals_view.buffer];
-                        const float* normals = reinterpret_cast<const float*>(
-                                &normals_buffer
-                                         .data[normals_view.byteOffset +
-                                               normals_accessor.byteOffset]);
-
-                        for (size_t i = 0; i < normals_accessor.count; ++i) {
-                            mesh_temp.vertex_normals_.push_back(Eigen::Vector3d(
-                                    normals[i * 3 + 0], normals[i * 3 + 1],
-                                    normals[i * 3 + 2]));
-                        }
+                        CopyVec3Accessor<float>(
+                                data, accessor.count, byte_stride, 1.0,
+                                mesh_temp.vertex_normals_.data() +
+                                        normal_offsets[p]);
                     }
 
                     if (attribute.first == "COLOR_0") {
-                        tinygltf::Accessor& colors_accessor =
-                                model.accessors[attribute.second];
-                        tinygltf::BufferView& colors_view =
-                                model.bufferViews[colors_accessor.bufferView];
-                        const tinygltf::Buffer& colors_buffer =
-                                model.buffers[colors_view.buffer];
-
-                        size_t byte_stride = colors_view.byteStride;
-                        if (byte_stride == 0) {
-                            // According to glTF 2.0 specs:
-                            // When byteStride==0, it means that accessor
-                            // elements are tightly packed.
-                            byte_stride =
-                                    colors_accessor.type *
-                                    tinygltf::GetComponentSizeInBytes(
-                                            colors_accessor.componentType);
-                        }
-                        switch (colors_accessor.componentType) {
-                            case TINYGLTF_COMPONENT_TYPE_FLOAT: {
-                                for (size_t i = 0; i < colors_accessor.count;
-                                     ++i) {
-                                    const float* colors =
-                                            reinterpret_cast<const float*>(
-                                                    colors_buffer.data.data() +
-                                                    colors_view.byteOffset +
-                                                    i * byte_stride);
-                                    mesh_temp.vertex_colors_.emplace_back(
-                                            colors[0], colors[1], colors[2]);
-                                }
+                        Eigen::Vector3d* colors =
+                                mesh_temp.vertex_colors_.data() +
+                                color_offsets[p];
+                        switch (accessor.componentType) {
+                            case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                                CopyVec3Accessor<float>(data, accessor.count,
+                                                        byte_stride, 1.0,
+                                                        colors);
                                 break;
-                            }
-                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-                                double max_val = (double)
-                                        std::numeric_limits<uint8_t>::max();
-                                for (size_t i = 0; i < colors_accessor.count;
-                                     ++i) {
-                                    const uint8_t* colors =
-                                            reinterpret_cast<const uint8_t*>(
-                                                    colors_buffer.data.data() +
-                                                    colors_view.byteOffset +
-                                                    i * byte_stride);
-                                    mesh_temp.vertex_colors_.emplace_back(
-                                            colors[0] / max_val,
-                                            colors[1] / max_val,
-                                            colors[2] / max_val);
-                                }
+                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                                CopyVec3Accessor<uint8_t>(
+                                        data, accessor.count, byte_stride,
+                                        1.0 / std::numeric_limits<
+                                                      uint8_t>::max(),
+                                        colors);
                                 break;
-                            }
-                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-                                double max_val = (double)
-                                        std::numeric_limits<uint16_t>::max();
-                                for (size_t i = 0; i < colors_accessor.count;
-                                     ++i) {
-                                    const uint16_t* colors =
-                                            reinterpret_cast<const uint16_t*>(
-                                                    colors_buffer.data.data() +
-                                                    colors_view.byteOffset +
-                                                    i * byte_stride);
-                                    mesh_temp.vertex_colors_.emplace_back(
-                                            colors[0] / max_val,
-                                            colors[1] / max_val,
-                                            colors[2] / max_val);
-                                }
+                            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                                CopyVec3Accessor<uint16_t>(
+                                        data, accessor.count, byte_stride,
+                                        1.0 / std::numeric_limits<
+                                                      uint16_t>::max(),
+                                        colors);
                                 break;
-                            }
-                            default: {
+                            default:
                                 utility::LogWarning(
                                         "Unrecognized component type for "
                                         "vertex colors");
                                 break;
-                            }
                         }
                     }
                 }
 
                 // Load triangles
-                std::unique_ptr<IntArrayBase> indices_array_pointer = nullptr;
-                {
+                if (primitive.indices >= 0) {
                     const tinygltf::Accessor& indices_accessor =
                             model.accessors[primitive.indices];
                     const tinygltf::BufferView& indices_view =
                             model.bufferViews[indices_accessor.bufferView];
                     const tinygltf::Buffer& indices_buffer =
                             model.buffers[indices_view.buffer];
-                    const auto data_address = indices_buffer.data.data() +
-                                              indices_view.byteOffset +
-                                              indices_accessor.byteOffset;
-                    const auto byte_stride =
+                    const unsigned char* data_address =
+                            indices_buffer.data.data() +
+                            indices_view.byteOffset +
+                            indices_accessor.byteOffset;
+                    const size_t byte_stride =
                             indices_accessor.ByteStride(indices_view);
-                    const auto count = indices_accessor.count;
+                    const size_t count = indices_accessor.count;
+                    Eigen::Vector3i* triangles =
+                            mesh_temp.triangles_.data() + triangle_offsets[p];
 
-                    // Allocate the index array in the pointer-to-base
-                    // declared in the parent scope
                     switch (indices_accessor.componentType) {
                         case TINYGLTF_COMPONENT_TYPE_BYTE:
-                            indices_array_pointer =
-                                    std::unique_ptr<IntArray<char>>(
-                                            new IntArray<char>(
-                                                    ArrayAdapter<char>(
-                                                            data_address, count,
-                                                            byte_stride)));
+                            CopyTriangleIndices<char>(data_address, byte_stride,
+                                                      primitive.mode, count,
+                                                      triangles);
                             break;
                         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
-                            indices_array_pointer =
-                                    std::unique_ptr<IntArray<unsigned char>>(
-                                            new IntArray<unsigned char>(
-                                                    ArrayAdapter<unsigned char>(
-                                                            data_address, count,
-                                                            byte_stride)));
+                            CopyTriangleIndices<unsigned char>(
+                                    data_address, byte_stride, primitive.mode,
+                                    count, triangles);
                             break;
                         case TINYGLTF_COMPONENT_TYPE_SHORT:
-                            indices_array_pointer =
-                                    std::unique_ptr<IntArray<short>>(
-                                            new IntArray<short>(
-                                                    ArrayAdapter<short>(
-                                                            data_address, count,
-                                                            byte_stride)));
+                            CopyTriangleIndices<short>(
+                                    data_address, byte_stride, primitive.mode,
+                                    count, triangles);
                             break;
                         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
-                            indices_array_pointer = std::unique_ptr<
-                                    IntArray<unsigned short>>(
-                                    new IntArray<unsigned short>(
-                                            ArrayAdapter<unsigned short>(
-                                                    data_address, count,
-                                                    byte_stride)));
+                            CopyTriangleIndices<unsigned short>(
+                                    data_address, byte_stride, primitive.mode,
+                                    count, triangles);
                             break;
                         case TINYGLTF_COMPONENT_TYPE_INT:
-                            indices_array_pointer =
-                                    std::unique_ptr<IntArray<int>>(
-                                            new IntArray<int>(ArrayAdapter<int>(
-                                                    data_address, count,
-                                                    byte_stride)));
+                            CopyTriangleIndices<int>(data_address, byte_stride,
+                                                     primitive.mode, count,
+                                                     triangles);
                             break;
                         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-                            indices_array_pointer =
-                                    std::unique_ptr<IntArray<unsigned int>>(
-                                            new IntArray<unsigned int>(
-                                                    ArrayAdapter<unsigned int>(
-                                                            data_address, count,
-                                                            byte_stride)));
+                            CopyTriangleIndices<unsigned int>(
+                                    data_address, byte_stride, primitive.mode,
+                                    count, triangles);
                             break;
                         default:
                             break;
                     }
-                    const auto& indices = *indices_array_pointer;
-
-                    switch (primitive.mode) {
-                        case TINYGLTF_MODE_TRIANGLES:
-                            for (size_t i = 0; i < indices_accessor.count;
-                                 i += 3) {
-                                mesh_temp.triangles_.push_back(Eigen::Vector3i(
-                                        indices[i], indices[i + 1],
-                                        indices[i + 2]));
-                            }
-                            break;
-                        case TINYGLTF_MODE_TRIANGLE_STRIP:
-                            for (size_t i = 2; i < indices_accessor.count;
-                                 ++i) {
-                                mesh_temp.triangles_.push_back(Eigen::Vector3i(
-                                        indices[i - 2], indices[i - 1],
-                                        indices[i]));
-                            }
-                            break;
-                        case TINYGLTF_MODE_TRIANGLE_FAN:
-                            for (size_t i = 2; i < indices_accessor.count;
-                                 ++i) {
-                                mesh_temp.triangles_.push_back(Eigen::Vector3i(
-                                        indices[0], indices[i - 1],
-                                        indices[i]));
-                            }
-                            break;
-                    }
                 }
             }
 
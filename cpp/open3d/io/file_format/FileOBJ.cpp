@@ -24,9 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <numeric>
 #include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/ImageIO.h"
@@ -37,6 +42,23 @@
 #include <tiny_obj_loader.h>
 
 namespace open3d {
+
+namespace {
+
+// One face vertex that carries a usable normal; collected during the
+// parallel face loop and resolved into per-vertex normals afterwards.
+struct VertexNormalRef {
+    // Vertex the normal belongs to, or -1 when the face vertex has no
+    // usable normal index.
+    int vertex_index;
+    int normal_index;
+    // Position in the serial traversal order; the smallest order wins so
+    // that the result matches the old first-write-wins scatter.
+    int64_t order;
+};
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeOBJ(const std::string& path) {
@@ -70,83 +92,209 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
     mesh.Clear();
 
     // copy vertex and data
-    for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
-        tinyobj::real_t vx = attrib.vertices[vidx + 0];
-        tinyobj::real_t vy = attrib.vertices[vidx + 1];
-        tinyobj::real_t vz = attrib.vertices[vidx + 2];
-        mesh.vertices_.push_back(Eigen::Vector3d(vx, vy, vz));
+    mesh.vertices_.resize(attrib.vertices.size() / 3);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(mesh.vertices_.size()); vidx++) {
+        mesh.vertices_[vidx] = Eigen::Vector3d(attrib.vertices[3 * vidx + 0],
+                                               attrib.vertices[3 * vidx + 1],
+                                               attrib.vertices[3 * vidx + 2]);
     }
 
-    for (size_t vidx = 0; vidx < attrib.colors.size(); vidx += 3) {
-        tinyobj::real_t r = attrib.colors[vidx + 0];
-        tinyobj::real_t g = attrib.colors[vidx + 1];
-        tinyobj::real_t b = attrib.colors[vidx + 2];
-        mesh.vertex_colors_.push_back(Eigen::Vector3d(r, g, b));
+    mesh.vertex_colors_.resize(attrib.colors.size() / 3);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(mesh.vertex_colors_.size()); vidx++) {
+        mesh.vertex_colors_[vidx] =
+                Eigen::Vector3d(attrib.colors[3 * vidx + 0],
+                                attrib.colors[3 * vidx + 1],
+                                attrib.colors[3 * vidx + 2]);
     }
 
-    // resize normal data and create bool indicator vector
-    mesh.vertex_normals_.resize(mesh.vertices_.size());
-    std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
-
-    // copy face data and copy normals data
-    // append face-wise uv data
+    // The face count check runs up front, so the parallel face loop below
+    // cannot return from inside the region; the per-shape face offsets
+    // give every face its own output slot.
+    std::vector<size_t> shape_face_offsets(shapes.size() + 1, 0);
     for (size_t s = 0; s < shapes.size(); s++) {
-        size_t index_offset = 0;
-        for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-            int fv = shapes[s].mesh.num_face_vertices[f];
+        for (unsigned char fv : shapes[s].mesh.num_face_vertices) {
             if (fv != 3) {
                 utility::LogWarning(
                         "Read OBJ failed: facet with number of vertices not "
                         "equal to 3");
                 return false;
             }
-
-            Eigen::Vector3i facet;
-            for (int v = 0; v < fv; v++) {
-                tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-                int vidx = idx.vertex_index;
-                facet(v) = vidx;
-
-                if (!attrib.normals.empty() && !normals_indicator[vidx] &&
-                    (3 * idx.normal_index + 2) < int(attrib.normals.size())) {
-                    tinyobj::real_t nx =
-                            attrib.normals[3 * idx.normal_index + 0];
-                    tinyobj::real_t ny =
-                            attrib.normals[3 * idx.normal_index + 1];
-                    tinyobj::real_t nz =
-                            attrib.normals[3 * idx.normal_index + 2];
-                    mesh.vertex_normals_[vidx](0) = nx;
-                    mesh.vertex_normals_[vidx](1) = ny;
-                    mesh.vertex_normals_[vidx](2) = nz;
-                    normals_indicator[vidx] = true;
+        }
+        shape_face_offsets[s + 1] =
+                shape_face_offsets[s] + shapes[s].mesh.num_face_vertices.size();
+    }
+    const size_t num_faces = shape_face_offsets.back();
+
+    // copy face data and collect normal references
+    // fill face-wise uv data
+    const bool has_normals = !attrib.normals.empty();
+    const bool has_texcoords = !attrib.texcoords.empty();
+    mesh.triangles_.resize(num_faces);
+    mesh.triangle_material_ids_.resize(num_faces);
+    if (has_texcoords) {
+        mesh.triangle_uvs_.resize(3 * num_faces);
+    }
+    std::vector<VertexNormalRef> normal_refs;
+    if (has_normals) {
+        normal_refs.resize(3 * num_faces);
+    }
+    bool all_uvs_set = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(num_faces); tidx++) {
+        const int s = int(std::upper_bound(shape_face_offsets.begin(),
+                                           shape_face_offsets.end(),
+                                           size_t(tidx)) -
+                          shape_face_offsets.begin()) -
+                      1;
+        const size_t f = size_t(tidx) - shape_face_offsets[s];
+        const tinyobj::mesh_t& shape_mesh = shapes[s].mesh;
+
+        Eigen::Vector3i facet;
+        for (int v = 0; v < 3; v++) {
+            tinyobj::index_t idx = shape_mesh.indices[3 * f + v];
+            int vidx = idx.vertex_index;
+            facet(v) = vidx;
+
+            if (has_normals) {
+                VertexNormalRef& ref = normal_refs[3 * size_t(tidx) + v];
+                if (idx.normal_index >= 0 &&
+                    3 * idx.normal_index + 2 < int(attrib.normals.size())) {
+                    ref.vertex_index = vidx;
+                    ref.normal_index = idx.normal_index;
+                    ref.order = 3 * int64_t(tidx) + v;
+                } else {
+                    ref.vertex_index = -1;
                 }
+            }
 
-                if (!attrib.texcoords.empty() &&
+            if (has_texcoords) {
+                if (idx.texcoord_index >= 0 &&
                     2 * idx.texcoord_index + 1 < int(attrib.texcoords.size())) {
-                    tinyobj::real_t tx =
-                            attrib.texcoords[2 * idx.texcoord_index + 0];
-                    tinyobj::real_t ty =
-                            attrib.texcoords[2 * idx.texcoord_index + 1];
-                    mesh.triangle_uvs_.push_back(Eigen::Vector2d(tx, ty));
+                    mesh.triangle_uvs_[3 * size_t(tidx) + v] = Eigen::Vector2d(
+                            attrib.texcoords[2 * idx.texcoord_index + 0],
+                            attrib.texcoords[2 * idx.texcoord_index + 1]);
+                } else {
+                    // benign race: only ever flipped to false
+                    all_uvs_set = false;
                 }
             }
-            mesh.triangles_.push_back(facet);
-            mesh.triangle_material_ids_.push_back(
-                    shapes[s].mesh.material_ids[f]);
-            index_offset += fv;
         }
+        mesh.triangles_[tidx] = facet;
+        mesh.triangle_material_ids_[tidx] = shape_mesh.material_ids[f];
     }
 
-    // if not all normals have been set, then remove the vertex normals
-    bool all_normals_set =
-            std::accumulate(normals_indicator.begin(), normals_indicator.end(),
-                            true, [](bool a, bool b) { return a && b; });
-    if (!all_normals_set) {
-        mesh.vertex_normals_.clear();
+    if (has_normals) {
+        // First-write-wins scatter of the collected normal references.
+        // The references are partitioned into buckets of disjoint vertex
+        // ranges, so every bucket owns a private slice of vertex_normals_
+        // and the buckets resolve on all threads; keeping the reference
+        // with the smallest traversal order makes the result identical
+        // to the serial scatter this replaces.
+        const int64_t num_vertices = int64_t(mesh.vertices_.size());
+        int num_slots = 1;
+#ifdef _OPENMP
+        num_slots = std::max(1, omp_get_max_threads());
+#endif
+        const int num_buckets = num_slots * 8;
+        const int64_t bucket_size = std::max(
+                int64_t(1), (num_vertices + num_buckets - 1) / num_buckets);
+        std::vector<std::vector<int64_t>> slot_counts(
+                num_slots, std::vector<int64_t>(num_buckets, 0));
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_slots)
+#endif
+        {
+            int slot = 0;
+#ifdef _OPENMP
+            slot = omp_get_thread_num();
+#endif
+            std::vector<int64_t>& counts = slot_counts[slot];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int i = 0; i < int(normal_refs.size()); i++) {
+                if (normal_refs[i].vertex_index >= 0) {
+                    counts[normal_refs[i].vertex_index / bucket_size]++;
+                }
+            }
+        }
+        // Turn the (bucket, slot) counts into scatter cursors; the same
+        // static schedule in both passes keeps every thread in front of
+        // the range it counted.
+        std::vector<int64_t> bucket_offsets(num_buckets + 1, 0);
+        int64_t num_refs = 0;
+        for (int b = 0; b < num_buckets; b++) {
+            bucket_offsets[b] = num_refs;
+            for (int slot = 0; slot < num_slots; slot++) {
+                int64_t count = slot_counts[slot][b];
+                slot_counts[slot][b] = num_refs;
+                num_refs += count;
+            }
+        }
+        bucket_offsets[num_buckets] = num_refs;
+        std::vector<VertexNormalRef> bucketed_refs(
+                static_cast<size_t>(num_refs));
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_slots)
+#endif
+        {
+            int slot = 0;
+#ifdef _OPENMP
+            slot = omp_get_thread_num();
+#endif
+            std::vector<int64_t>& cursors = slot_counts[slot];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int i = 0; i < int(normal_refs.size()); i++) {
+                if (normal_refs[i].vertex_index >= 0) {
+                    int b = int(normal_refs[i].vertex_index / bucket_size);
+                    bucketed_refs[cursors[b]++] = normal_refs[i];
+                }
+            }
+        }
+
+        mesh.vertex_normals_.resize(mesh.vertices_.size());
+        std::vector<int64_t> first_order(mesh.vertices_.size(), -1);
+        int64_t num_vertices_with_normal = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) \
+        reduction(+ : num_vertices_with_normal)
+#endif
+        for (int b = 0; b < num_buckets; b++) {
+            for (int64_t i = bucket_offsets[b]; i < bucket_offsets[b + 1];
+                 i++) {
+                const VertexNormalRef& ref = bucketed_refs[i];
+                int64_t& order = first_order[ref.vertex_index];
+                if (order < 0) {
+                    num_vertices_with_normal++;
+                }
+                if (order < 0 || ref.order < order) {
+                    order = ref.order;
+                    mesh.vertex_normals_[ref.vertex_index] = Eigen::Vector3d(
+                            attrib.normals[3 * ref.normal_index + 0],
+                            attrib.normals[3 * ref.normal_index + 1],
+                            attrib.normals[3 * ref.normal_index + 2]);
+                }
+            }
+        }
+
+        // if not all normals have been set, then remove the vertex normals
+        if (num_vertices_with_normal != num_vertices) {
+            mesh.vertex_normals_.clear();
+        }
     }
 
     // if not all triangles have corresponding uvs, then remove uvs
-    if (3 * mesh.triangles_.size() != mesh.triangle_uvs_.size()) {
+    if (!has_texcoords || !all_uvs_set) {
         mesh.triangle_uvs_.clear();
     }
 
@@ -158,8 +306,19 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
     using MaterialParameter =
             geometry::TriangleMesh::Material::MaterialParameter;
 
-    for (auto& material : materials) {
-        auto& meshMaterial = mesh.materials_[material.name];
+    // Decoding the texture images dominates material setup, so the
+    // materials are processed concurrently into a vector and merged into
+    // the name-keyed map serially afterwards.
+    std::vector<geometry::TriangleMesh::Material> mesh_materials(
+            materials.size());
+    std::vector<std::shared_ptr<geometry::Image>> legacy_textures(
+            materials.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int midx = 0; midx < int(materials.size()); midx++) {
+        auto& material = materials[midx];
+        auto& meshMaterial = mesh_materials[midx];
 
         meshMaterial.baseColor = MaterialParameter::CreateRGB(
                 material.diffuse[0], material.diffuse[1], material.diffuse[2]);
@@ -182,7 +341,7 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
 
             // Legacy texture map support
             if (meshMaterial.albedo) {
-                mesh.textures_.push_back(*meshMaterial.albedo->FlipVertical());
+                legacy_textures[midx] = meshMaterial.albedo->FlipVertical();
             }
         }
 
@@ -219,6 +378,13 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
         meshMaterial.baseAnisotropy = material.anisotropy;
     }
 
+    for (size_t midx = 0; midx < materials.size(); midx++) {
+        mesh.materials_[materials[midx].name] = mesh_materials[midx];
+        if (legacy_textures[midx]) {
+            mesh.textures_.push_back(*legacy_textures[midx]);
+        }
+    }
+
     return true;
 }
 
@@ -25,9 +25,17 @@
 // ----------------------------------------------------------------------------
 
 #include <liblzf/lzf.h>
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
@@ -350,7 +358,7 @@ bool ReadPCDData(FILE *file,
     if (header.has_colors) {
         pointcloud.colors_.resize(header.points);
     }
-    utility::CountingProgressReporter reporter(params.update_progress);
+    utility::SampledProgressReporter reporter(params.update_progress);
     reporter.SetTotal(header.points);
 
     if (header.datatype == PCD_DATA_ASCII) {
@@ -397,9 +405,7 @@ bool ReadPCDData(FILE *file,
                 }
             }
             idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+            reporter.Update(idx);
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
         std::unique_ptr<char[]> buffer(new char[header.pointsize]);
@@ -441,14 +447,16 @@ bool ReadPCDData(FILE *file,
                                                  field.type, field.size);
                 }
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            reporter.Update(i);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double reporter_total = 100.0;
-        reporter.SetTotal(int(reporter_total));
-        reporter.Update(int(reporter_total * 0.01));
+        // Progress is counted in unpacked elements, with the read and
+        // the decompression of the blob accounted as one field band
+        // each, so the callback rate stays proportional to the work
+        // regardless of how fast the file loads.
+        const std::int64_t field_band = header.points;
+        reporter.SetTotal(std::int64_t(header.fields.size() + 2) *
+                          field_band);
         std::uint32_t compressed_size;
         std::uint32_t uncompressed_size;
         if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
@@ -467,15 +475,14 @@ bool ReadPCDData(FILE *file,
                 "size.",
                 compressed_size, uncompressed_size);
         std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        reporter.Update(int(reporter_total * .1));
         if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
             compressed_size) {
             utility::LogWarning("[ReadPCDData] Failed to read data record.");
             pointcloud.Clear();
             return false;
         }
+        reporter.Update(field_band);
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        reporter.Update(int(reporter_total * .2));
         if (lzf_decompress(buffer_compressed.get(),
                            (unsigned int)compressed_size, buffer.get(),
                            (unsigned int)uncompressed_size) !=
@@ -484,54 +491,61 @@ bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
+        reporter.Update(2 * field_band);
+        std::int64_t unpacked_base = 2 * field_band;
         for (const auto &field : header.fields) {
             const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "x") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "y") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "z") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.points_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "normal_x") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "normal_y") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "normal_z") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             } else if (field.name == "rgb" || field.name == "rgba") {
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
+                    reporter.Update(unpacked_base + i);
                 }
             }
+            unpacked_base += field_band;
         }
     }
     reporter.Finish();
@@ -648,7 +662,7 @@ bool WritePCDData(FILE *file,
                   const WritePointCloudOption &params) {
     bool has_normal = pointcloud.HasNormals();
     bool has_color = pointcloud.HasColors();
-    utility::CountingProgressReporter reporter(params.update_progress);
+    utility::SampledProgressReporter reporter(params.update_progress);
     reporter.SetTotal(pointcloud.points_.size());
     if (header.datatype == PCD_DATA_ASCII) {
         for (size_t i = 0; i < pointcloud.points_.size(); i++) {
@@ -693,52 +707,136 @@ bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double report_total = double(pointcloud.points_.size() * 2);
-        // 0%-50% packing into buffer
-        // 50%-75% compressing buffer
-        // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
+        // The SoA columns are packed and compressed in fixed-size chunks
+        // of points that are appended to the file as they are produced,
+        // so the peak memory use stays flat regardless of the cloud size.
+        // liblzf decompresses concatenated compressed chunks back into the
+        // concatenated input, so readers still see one LZF block. The size
+        // fields in front of the data are patched once the total
+        // compressed size is known.
+        const std::uint64_t num_points = std::uint64_t(header.points);
+        const std::uint64_t buffer_bytes =
+                num_points * header.elementnum * sizeof(float);
+        if (buffer_bytes > std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning(
+                    "[WritePCDData] Point cloud is too large for the 32 bit "
+                    "size fields of compressed PCD.");
+            return false;
+        }
+        const std::uint32_t buffer_size_in_bytes = std::uint32_t(buffer_bytes);
+        const long size_field_pos = ftell(file);
+        std::uint32_t size_compressed = 0;
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+
+        // All fields written by GenerateHeader are 4 byte floats.
+        auto element_value = [&](int eidx, std::uint64_t pidx) -> float {
+            if (eidx < 3) {
+                return (float)pointcloud.points_[pidx](eidx);
             }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
+            if (has_normal && eidx < 6) {
+                return (float)pointcloud.normals_[pidx](eidx - 3);
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+            return ConvertRGBToFloat(pointcloud.colors_[pidx]);
+        };
+        // LZF itself is a serial byte stream, so the speedup comes from
+        // compressing independent chunks on all threads: each pass packs
+        // and compresses one chunk per thread in parallel and then writes
+        // the results out in order. The in-flight buffers are one chunk
+        // plus scratch per thread, so peak memory stays independent of
+        // the cloud size.
+        const std::uint64_t chunk_points = 1 << 18;
+        const std::uint64_t chunks_per_field =
+                (num_points + chunk_points - 1) / chunk_points;
+        const std::uint64_t num_chunks =
+                chunks_per_field * header.elementnum;
+        // Progress is counted in packed column values through a shared
+        // counter, so the packing threads produce monotone counts at a
+        // much finer grain than the chunks themselves.
+        reporter.SetTotal(std::int64_t(num_points) * header.elementnum);
+        std::atomic<std::uint64_t> values_packed{0};
+#ifdef _OPENMP
+        const int num_slots = std::max(1, omp_get_max_threads());
+#else
+        const int num_slots = 1;
+#endif
+        const size_t slot_points = size_t(std::min(chunk_points, num_points));
+        std::vector<std::vector<float>> chunks(num_slots);
+        std::vector<std::vector<char>> chunks_compressed(num_slots);
+        for (int slot = 0; slot < num_slots; slot++) {
+            chunks[slot].resize(slot_points);
+            chunks_compressed[slot].resize(slot_points * sizeof(float) * 2);
+        }
+        std::vector<std::uint32_t> compressed_sizes(num_slots, 0);
+        std::uint64_t total_compressed = 0;
+        for (std::uint64_t group_begin = 0; group_begin < num_chunks;
+             group_begin += num_slots) {
+            const std::uint64_t group_end = std::min(
+                    group_begin + std::uint64_t(num_slots), num_chunks);
+            bool compress_failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (std::int64_t task = std::int64_t(group_begin);
+                 task < std::int64_t(group_end); task++) {
+                const int slot = int(task - std::int64_t(group_begin));
+                const int eidx = int(std::uint64_t(task) / chunks_per_field);
+                const std::uint64_t begin =
+                        (std::uint64_t(task) % chunks_per_field) *
+                        chunk_points;
+                const std::uint64_t end =
+                        std::min(begin + chunk_points, num_points);
+                std::vector<float> &chunk = chunks[slot];
+                const std::uint64_t block_points = 4096;
+                for (std::uint64_t block = 0; block < end - begin;
+                     block += block_points) {
+                    const std::uint64_t block_end =
+                            std::min(block + block_points, end - begin);
+                    for (std::uint64_t i = block; i < block_end; i++) {
+                        chunk[i] = element_value(eidx, begin + i);
+                    }
+                    reporter.Update(
+                            values_packed.fetch_add(block_end - block) +
+                            (block_end - block));
+                }
+                compressed_sizes[slot] = lzf_compress(
+                        chunk.data(),
+                        std::uint32_t((end - begin) * sizeof(float)),
+                        chunks_compressed[slot].data(),
+                        (unsigned int)chunks_compressed[slot].size());
+                if (compressed_sizes[slot] == 0) {
+                    compress_failed = true;
+                }
+            }
+            if (compress_failed) {
+                utility::LogWarning("[WritePCDData] Failed to compress data.");
+                return false;
+            }
+            for (std::uint64_t task = group_begin; task < group_end; task++) {
+                const int slot = int(task - group_begin);
+                if (fwrite(chunks_compressed[slot].data(), 1,
+                           compressed_sizes[slot],
+                           file) != compressed_sizes[slot]) {
+                    utility::LogWarning(
+                            "[WritePCDData] Failed to write data record.");
+                    return false;
+                }
+                total_compressed += compressed_sizes[slot];
             }
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
+        if (total_compressed > std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning(
+                    "[WritePCDData] Compressed data is too large for the 32 "
+                    "bit size fields of compressed PCD.");
             return false;
         }
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
+                buffer_size_in_bytes, std::uint32_t(total_compressed));
+        size_compressed = std::uint32_t(total_compressed);
+        fseek(file, size_field_pos, SEEK_SET);
         fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        fseek(file, 0, SEEK_END);
     }
     reporter.Finish();
     return true;
@@ -26,6 +26,18 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/LineSetIO.h"
 #include "open3d/io/PointCloudIO.h"
@@ -41,10 +53,397 @@ namespace io {
 /// @cond
 namespace {
 
+#ifndef _WIN32
+
+namespace ply_fast_reader {
+
+/// Scalar property types of the PLY format.
+enum PLYScalarType {
+    PLY_SCALAR_INT8,
+    PLY_SCALAR_UINT8,
+    PLY_SCALAR_INT16,
+    PLY_SCALAR_UINT16,
+    PLY_SCALAR_INT32,
+    PLY_SCALAR_UINT32,
+    PLY_SCALAR_FLOAT32,
+    PLY_SCALAR_FLOAT64,
+};
+
+bool ParsePLYScalarType(const std::string &token, PLYScalarType &type) {
+    if (token == "char" || token == "int8") {
+        type = PLY_SCALAR_INT8;
+    } else if (token == "uchar" || token == "uint8") {
+        type = PLY_SCALAR_UINT8;
+    } else if (token == "short" || token == "int16") {
+        type = PLY_SCALAR_INT16;
+    } else if (token == "ushort" || token == "uint16") {
+        type = PLY_SCALAR_UINT16;
+    } else if (token == "int" || token == "int32") {
+        type = PLY_SCALAR_INT32;
+    } else if (token == "uint" || token == "uint32") {
+        type = PLY_SCALAR_UINT32;
+    } else if (token == "float" || token == "float32") {
+        type = PLY_SCALAR_FLOAT32;
+    } else if (token == "double" || token == "float64") {
+        type = PLY_SCALAR_FLOAT64;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+size_t PLYScalarSize(PLYScalarType type) {
+    switch (type) {
+        case PLY_SCALAR_INT8:
+        case PLY_SCALAR_UINT8:
+            return 1;
+        case PLY_SCALAR_INT16:
+        case PLY_SCALAR_UINT16:
+            return 2;
+        case PLY_SCALAR_INT32:
+        case PLY_SCALAR_UINT32:
+        case PLY_SCALAR_FLOAT32:
+            return 4;
+        case PLY_SCALAR_FLOAT64:
+            return 8;
+    }
+    return 0;
+}
+
+/// Reads one little-endian scalar from an unaligned buffer position.
+inline double PLYScalarToDouble(const uint8_t *p, PLYScalarType type) {
+    switch (type) {
+        case PLY_SCALAR_INT8: {
+            int8_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_UINT8: {
+            uint8_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_INT16: {
+            int16_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_UINT16: {
+            uint16_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_INT32: {
+            int32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_UINT32: {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_FLOAT32: {
+            float v;
+            std::memcpy(&v, p, sizeof(v));
+            return double(v);
+        }
+        case PLY_SCALAR_FLOAT64: {
+            double v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+    }
+    return 0.0;
+}
+
+struct PLYProperty {
+    std::string name;
+    PLYScalarType type;
+    /// Byte offset of the property within one element record.
+    size_t offset = 0;
+};
+
+struct PLYElement {
+    std::string name;
+    long count = 0;
+    std::vector<PLYProperty> properties;
+    /// List properties make the record size dynamic; such elements can
+    /// only be read through the generic rply path.
+    bool has_list = false;
+    /// Size in bytes of one element record (without list properties).
+    size_t stride = 0;
+};
+
+struct PLYHeader {
+    std::vector<PLYElement> elements;
+    /// Byte offset of the first element record in the file.
+    size_t data_offset = 0;
+};
+
+/// Parses the PLY header at the start of a mapped buffer. Returns false
+/// for anything the mapped fast path cannot consume, in particular ASCII
+/// and big-endian files; the caller then falls back to rply.
+bool ParsePLYHeader(const uint8_t *data, size_t size, PLYHeader &header) {
+    size_t pos = 0;
+    auto next_line = [&](std::string &line) -> bool {
+        size_t eol = pos;
+        while (eol < size && data[eol] != '\n') eol++;
+        if (eol == size) {
+            return false;
+        }
+        line.assign(reinterpret_cast<const char *>(data) + pos, eol - pos);
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        pos = eol + 1;
+        return true;
+    };
+    std::string line;
+    if (!next_line(line) || line != "ply") {
+        return false;
+    }
+    bool format_ok = false;
+    while (next_line(line)) {
+        std::istringstream iss(line);
+        std::string keyword;
+        iss >> keyword;
+        if (keyword == "comment" || keyword == "obj_info") {
+            continue;
+        } else if (keyword == "format") {
+            std::string format, version;
+            iss >> format >> version;
+            format_ok = format == "binary_little_endian" && version == "1.0";
+            if (!format_ok) {
+                return false;
+            }
+        } else if (keyword == "element") {
+            PLYElement element;
+            iss >> element.name >> element.count;
+            if (iss.fail() || element.count < 0) {
+                return false;
+            }
+            header.elements.push_back(element);
+        } else if (keyword == "property") {
+            if (header.elements.empty()) {
+                return false;
+            }
+            PLYElement &element = header.elements.back();
+            std::string type_token;
+            iss >> type_token;
+            if (type_token == "list") {
+                element.has_list = true;
+            } else {
+                PLYProperty property;
+                if (!ParsePLYScalarType(type_token, property.type)) {
+                    return false;
+                }
+                iss >> property.name;
+                if (iss.fail()) {
+                    return false;
+                }
+                property.offset = element.stride;
+                element.stride += PLYScalarSize(property.type);
+                element.properties.push_back(property);
+            }
+        } else if (keyword == "end_header") {
+            header.data_offset = pos;
+            return format_ok;
+        } else {
+            return false;
+        }
+    }
+    return false;
+}
+
+/// Read-only memory mapping of a whole file.
+struct MappedFile {
+    MappedFile(const std::string &filename) {
+        fd_ = open(filename.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return;
+        }
+        struct stat file_stat;
+        if (fstat(fd_, &file_stat) != 0 || file_stat.st_size <= 0) {
+            return;
+        }
+        size_ = size_t(file_stat.st_size);
+        void *addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (addr == MAP_FAILED) {
+            size_ = 0;
+            return;
+        }
+        data_ = static_cast<const uint8_t *>(addr);
+    }
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            munmap(const_cast<uint8_t *>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+    bool IsMapped() const { return data_ != nullptr; }
+
+    int fd_ = -1;
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/// Gathers one Vector3 column (e.g. x/y/z or nx/ny/nz) from the mapped
+/// vertex records. When the column layout matches Eigen::Vector3d exactly
+/// the records are bulk-copied; otherwise the records are converted in
+/// parallel blocks. Progress is fed to the reporter per completed block
+/// through a shared counter, so the counts stay monotone no matter which
+/// thread finishes first and the reporter sees fine-grained updates even
+/// for clouds that convert within one report interval.
+void ExtractVector3Column(const uint8_t *vertex_data,
+                          size_t stride,
+                          long num_vertices,
+                          const PLYProperty &px,
+                          const PLYProperty &py,
+                          const PLYProperty &pz,
+                          double scale,
+                          std::vector<Eigen::Vector3d> &values,
+                          utility::SampledProgressReporter *reporter) {
+    values.resize(num_vertices);
+    const long block_size = std::max(num_vertices / 256, long(512));
+    const long num_blocks = (num_vertices + block_size - 1) / block_size;
+    std::atomic<long> num_done{0};
+    if (px.type == PLY_SCALAR_FLOAT64 && py.type == PLY_SCALAR_FLOAT64 &&
+        pz.type == PLY_SCALAR_FLOAT64 && px.offset == 0 && py.offset == 8 &&
+        pz.offset == 16 && stride == sizeof(Eigen::Vector3d) && scale == 1.0) {
+        for (long block = 0; block < num_blocks; block++) {
+            const long begin = block * block_size;
+            const long end = std::min(begin + block_size, num_vertices);
+            std::memcpy(values.data() + begin,
+                        vertex_data + size_t(begin) * stride,
+                        size_t(end - begin) * stride);
+            if (reporter) {
+                reporter->Update(end);
+            }
+        }
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long block = 0; block < num_blocks; block++) {
+        const long begin = block * block_size;
+        const long end = std::min(begin + block_size, num_vertices);
+        for (long vidx = begin; vidx < end; vidx++) {
+            const uint8_t *record = vertex_data + size_t(vidx) * stride;
+            values[vidx] = Eigen::Vector3d(
+                    PLYScalarToDouble(record + px.offset, px.type) * scale,
+                    PLYScalarToDouble(record + py.offset, py.type) * scale,
+                    PLYScalarToDouble(record + pz.offset, pz.type) * scale);
+        }
+        if (reporter) {
+            reporter->Update(num_done.fetch_add(end - begin) + (end - begin));
+        }
+    }
+}
+
+/// Fast path for binary little-endian PLY point clouds: the file is
+/// memory-mapped and the vertex property columns are copied or converted
+/// directly into the destination arrays, bypassing the per-scalar rply
+/// callbacks. Returns false whenever the file needs the generic reader
+/// (ASCII or big-endian data, list properties, missing vertex element or
+/// a truncated file), in which case nothing has been written to
+/// \p pointcloud yet.
+bool TryReadPointCloudFromPLYMapped(const std::string &filename,
+                                    geometry::PointCloud &pointcloud,
+                                    const ReadPointCloudOption &params) {
+    const uint16_t endian_probe = 1;
+    if (*reinterpret_cast<const uint8_t *>(&endian_probe) != 1) {
+        // Big-endian host; the column data would need byte swapping.
+        return false;
+    }
+    MappedFile file(filename);
+    if (!file.IsMapped()) {
+        return false;
+    }
+    PLYHeader header;
+    if (!ParsePLYHeader(file.data_, file.size_, header)) {
+        return false;
+    }
+
+    // Locate the vertex records; every element stored in front of them
+    // must have a fixed record size to be skipped.
+    size_t vertex_offset = header.data_offset;
+    const PLYElement *vertex_element = nullptr;
+    for (const PLYElement &element : header.elements) {
+        if (element.name == "vertex") {
+            vertex_element = &element;
+            break;
+        }
+        if (element.has_list) {
+            return false;
+        }
+        vertex_offset += size_t(element.count) * element.stride;
+    }
+    if (vertex_element == nullptr || vertex_element->has_list ||
+        vertex_element->count <= 0) {
+        return false;
+    }
+    if (file.size_ < vertex_offset + size_t(vertex_element->count) *
+                                             vertex_element->stride) {
+        return false;
+    }
+
+    auto find_property = [&](const char *name) -> const PLYProperty * {
+        for (const PLYProperty &property : vertex_element->properties) {
+            if (property.name == name) {
+                return &property;
+            }
+        }
+        return nullptr;
+    };
+    const PLYProperty *x = find_property("x");
+    const PLYProperty *y = find_property("y");
+    const PLYProperty *z = find_property("z");
+    if (!x || !y || !z) {
+        return false;
+    }
+    const PLYProperty *nx = find_property("nx");
+    const PLYProperty *ny = find_property("ny");
+    const PLYProperty *nz = find_property("nz");
+    const PLYProperty *red = find_property("red");
+    const PLYProperty *green = find_property("green");
+    const PLYProperty *blue = find_property("blue");
+    const bool has_normals = nx && ny && nz;
+    const bool has_colors = red && green && blue;
+
+    const uint8_t *vertex_data = file.data_ + vertex_offset;
+    const long vertex_num = vertex_element->count;
+    const size_t stride = vertex_element->stride;
+
+    utility::SampledProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(vertex_num);
+
+    pointcloud.Clear();
+    ExtractVector3Column(vertex_data, stride, vertex_num, *x, *y, *z, 1.0,
+                         pointcloud.points_, &reporter);
+    if (has_normals) {
+        ExtractVector3Column(vertex_data, stride, vertex_num, *nx, *ny, *nz,
+                             1.0, pointcloud.normals_, nullptr);
+    }
+    if (has_colors) {
+        ExtractVector3Column(vertex_data, stride, vertex_num, *red, *green,
+                             *blue, 1.0 / 255.0, pointcloud.colors_, nullptr);
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace ply_fast_reader
+
+#endif  // !_WIN32
+
 namespace ply_pointcloud_reader {
 
 struct PLYReaderState {
-    utility::CountingProgressReporter *progress_bar;
+    utility::SampledProgressReporter *progress_bar;
     geometry::PointCloud *pointcloud_ptr;
     long vertex_index;
     long vertex_num;
@@ -67,9 +466,7 @@ int ReadVertexCallback(p_ply_argument argument) {
     state_ptr->pointcloud_ptr->points_[state_ptr->vertex_index](index) = value;
     if (index == 2) {  // reading 'z'
         state_ptr->vertex_index++;
-        if (state_ptr->vertex_index % 1000 == 0) {
-            state_ptr->progress_bar->Update(state_ptr->vertex_index);
-        }
+        state_ptr->progress_bar->Update(state_ptr->vertex_index);
     }
     return 1;
 }
@@ -398,6 +795,15 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+#ifndef _WIN32
+    // Binary little-endian files take the memory-mapped fast path; any
+    // file it cannot consume falls through to the rply reader below.
+    if (ply_fast_reader::TryReadPointCloudFromPLYMapped(filename, pointcloud,
+                                                        params)) {
+        return true;
+    }
+#endif
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -442,7 +848,7 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     pointcloud.normals_.resize(state.normal_num);
     pointcloud.colors_.resize(state.color_num);
 
-    utility::CountingProgressReporter reporter(params.update_progress);
+    utility::SampledProgressReporter reporter(params.update_progress);
     reporter.SetTotal(state.vertex_num);
     state.progress_bar = &reporter;
 
@@ -24,13 +24,20 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdint>
 #include <fstream>
+#include <unordered_map>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace io {
@@ -41,21 +48,19 @@ FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
 
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
-                             bool print_progress) {
+                             bool print_progress,
+                             bool weld_vertices /* = false*/) {
     FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
 
     if (!myFile) {
         utility::LogWarning("Read STL failed: unable to open file.");
-        fclose(myFile);
         return false;
     }
 
-    int num_of_triangles;
-    if (myFile) {
-        char header[80] = "";
-        fread(header, sizeof(char), 80, myFile);
-        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile);
-    } else {
+    char header[80] = "";
+    unsigned int num_of_triangles = 0;
+    if (fread(header, sizeof(char), 80, myFile) != 80 ||
+        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile) != 1) {
         utility::LogWarning("Read STL failed: unable to read header.");
         fclose(myFile);
         return false;
@@ -67,42 +72,144 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
         return false;
     }
 
+    // One bulk read of all 50 byte records; the per-record freads this
+    // replaces dominated the load time of large CAD exports.
+    std::vector<char> records(50ull * num_of_triangles);
+    if (fread(records.data(), sizeof(char), records.size(), myFile) !=
+        records.size()) {
+        utility::LogWarning("Read STL failed: not enough triangles.");
+        fclose(myFile);
+        return false;
+    }
+    fclose(myFile);
+
     mesh.vertices_.clear();
     mesh.triangles_.clear();
     mesh.triangle_normals_.clear();
-    mesh.vertices_.resize(num_of_triangles * 3);
+    mesh.vertices_.resize(size_t(num_of_triangles) * 3);
     mesh.triangles_.resize(num_of_triangles);
     mesh.triangle_normals_.resize(num_of_triangles);
 
-    utility::ConsoleProgressBar progress_bar(num_of_triangles,
+    const int chunk_size = 1 << 16;
+    const int num_chunks = int((num_of_triangles + chunk_size - 1) /
+                               chunk_size);
+    utility::ConsoleProgressBar progress_bar(num_chunks,
                                              "Reading STL: ", print_progress);
-    for (int i = 0; i < num_of_triangles; i++) {
-        char buffer[50];
-        float *float_buffer;
-        if (myFile) {
-            fread(buffer, sizeof(char), 50, myFile);
-            float_buffer = reinterpret_cast<float *>(buffer);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        const int begin = c * chunk_size;
+        const int end = std::min(begin + chunk_size, int(num_of_triangles));
+        for (int i = begin; i < end; i++) {
+            const char *buffer = records.data() + 50ull * i;
+            const float *float_buffer =
+                    reinterpret_cast<const float *>(buffer);
             mesh.triangle_normals_[i] =
-                    Eigen::Map<Eigen::Vector3f>(float_buffer).cast<double>();
+                    Eigen::Map<const Eigen::Vector3f>(float_buffer)
+                            .cast<double>();
             for (int j = 0; j < 3; j++) {
-                float_buffer = reinterpret_cast<float *>(buffer + 12 * (j + 1));
+                float_buffer = reinterpret_cast<const float *>(buffer +
+                                                               12 * (j + 1));
                 mesh.vertices_[i * 3 + j] =
-                        Eigen::Map<Eigen::Vector3f>(float_buffer)
+                        Eigen::Map<const Eigen::Vector3f>(float_buffer)
                                 .cast<double>();
             }
             mesh.triangles_[i] =
                     Eigen::Vector3i(i * 3 + 0, i * 3 + 1, i * 3 + 2);
             // ignore buffer[48] and buffer [49] because it is rarely used.
+        }
+#ifdef _OPENMP
+#pragma omp critical(ReadTriangleMeshFromSTLProgress)
+#endif
+        { ++progress_bar; }
+    }
 
-        } else {
-            utility::LogWarning("Read STL failed: not enough triangles.");
-            fclose(myFile);
-            return false;
+    if (weld_vertices) {
+        const int64_t num_vertices = mesh.vertices_.size();
+#ifdef _OPENMP
+        const int num_shards = omp_get_max_threads();
+#else
+        const int num_shards = 1;
+#endif
+        // Shard the vertices by hash so each shard can deduplicate its
+        // own disjoint subset; shard assignment depends only on the
+        // coordinates, which keeps the result independent of the thread
+        // count.
+        utility::hash_eigen<Eigen::Vector3d> hasher;
+        std::vector<int> shard_of_vertex(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_vertices; i++) {
+            shard_of_vertex[i] = int(hasher(mesh.vertices_[i]) % num_shards);
         }
-        ++progress_bar;
+        std::vector<int64_t> shard_offsets(num_shards + 1, 0);
+        for (int64_t i = 0; i < num_vertices; i++) {
+            shard_offsets[shard_of_vertex[i] + 1]++;
+        }
+        for (int s = 0; s < num_shards; s++) {
+            shard_offsets[s + 1] += shard_offsets[s];
+        }
+        std::vector<int64_t> order(num_vertices);
+        std::vector<int64_t> cursors(shard_offsets.begin(),
+                                     shard_offsets.end() - 1);
+        for (int64_t i = 0; i < num_vertices; i++) {
+            order[cursors[shard_of_vertex[i]]++] = i;
+        }
+        std::vector<int64_t> local_index(num_vertices);
+        std::vector<std::vector<int64_t>> representatives(num_shards);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int s = 0; s < num_shards; s++) {
+            std::unordered_map<Eigen::Vector3d, int64_t,
+                               utility::hash_eigen<Eigen::Vector3d>>
+                    vertex_to_index;
+            for (int64_t k = shard_offsets[s]; k < shard_offsets[s + 1]; k++) {
+                const int64_t i = order[k];
+                auto it = vertex_to_index.find(mesh.vertices_[i]);
+                if (it == vertex_to_index.end()) {
+                    const int64_t idx = int64_t(vertex_to_index.size());
+                    vertex_to_index[mesh.vertices_[i]] = idx;
+                    representatives[s].push_back(i);
+                    local_index[i] = idx;
+                } else {
+                    local_index[i] = it->second;
+                }
+            }
+        }
+        std::vector<int64_t> unique_offsets(num_shards + 1, 0);
+        for (int s = 0; s < num_shards; s++) {
+            unique_offsets[s + 1] =
+                    unique_offsets[s] + int64_t(representatives[s].size());
+        }
+        std::vector<Eigen::Vector3d> welded_vertices(unique_offsets.back());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int s = 0; s < num_shards; s++) {
+            for (size_t j = 0; j < representatives[s].size(); j++) {
+                welded_vertices[unique_offsets[s] + j] =
+                        mesh.vertices_[representatives[s][j]];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(num_of_triangles); i++) {
+            for (int j = 0; j < 3; j++) {
+                const int64_t v = int64_t(i) * 3 + j;
+                mesh.triangles_[i][j] =
+                        int(unique_offsets[shard_of_vertex[v]] +
+                            local_index[v]);
+            }
+        }
+        utility::LogDebug("Read STL: welded {:d} vertices into {:d}.",
+                          num_vertices, int64_t(welded_vertices.size()));
+        mesh.vertices_ = std::move(welded_vertices);
     }
 
-    fclose(myFile);
     return true;
 }
 
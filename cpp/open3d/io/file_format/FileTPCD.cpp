@@ -0,0 +1,369 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Tiled point cloud format (.tpcd) for out-of-core spatial queries.
+//
+// The cloud is partitioned into a uniform grid of tiles and every tile
+// is stored as one contiguous run of records. A directory at the front
+// of the file lists the bounding box, file offset and point count of
+// each tile, so a viewer can answer a spatial query by seeking to the
+// few tiles that intersect the query box instead of loading the whole
+// file.
+//
+// Layout, all fields in host byte order:
+//   magic "O3DTILED", uint32 version
+//   uint32 has_normals, uint32 has_colors, double tile_size
+//   uint64 num_points, uint64 num_tiles
+//   num_tiles x (6 doubles tile min/max bound,
+//                uint64 file offset, uint64 point count)
+//   tile payloads: per tile the point xyz doubles, then the normals and
+//   colors if present
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char kTPCDMagic[8] = {'O', '3', 'D', 'T', 'I', 'L', 'E', 'D'};
+const std::uint32_t kTPCDVersion = 1;
+// Tiles span 1/32 of the longest cloud axis by default; fine enough for
+// region queries while keeping the directory tiny.
+const int kTPCDTilesPerAxis = 32;
+
+struct TPCDHeader {
+    bool has_normals = false;
+    bool has_colors = false;
+    double tile_size = 0.0;
+    std::uint64_t num_points = 0;
+    std::vector<geometry::AxisAlignedBoundingBox> tile_bounds;
+    std::vector<std::uint64_t> tile_offsets;
+    std::vector<std::uint64_t> tile_counts;
+};
+
+bool ReadTPCDHeader(FILE *file, TPCDHeader &header) {
+    char magic[8];
+    std::uint32_t version = 0;
+    std::uint32_t has_normals = 0;
+    std::uint32_t has_colors = 0;
+    std::uint64_t num_tiles = 0;
+    if (fread(magic, 1, 8, file) != 8 || memcmp(magic, kTPCDMagic, 8) != 0 ||
+        fread(&version, sizeof(std::uint32_t), 1, file) != 1 ||
+        version != kTPCDVersion ||
+        fread(&has_normals, sizeof(std::uint32_t), 1, file) != 1 ||
+        fread(&has_colors, sizeof(std::uint32_t), 1, file) != 1 ||
+        fread(&header.tile_size, sizeof(double), 1, file) != 1 ||
+        fread(&header.num_points, sizeof(std::uint64_t), 1, file) != 1 ||
+        fread(&num_tiles, sizeof(std::uint64_t), 1, file) != 1) {
+        return false;
+    }
+    header.has_normals = has_normals != 0;
+    header.has_colors = has_colors != 0;
+    header.tile_bounds.resize(num_tiles);
+    header.tile_offsets.resize(num_tiles);
+    header.tile_counts.resize(num_tiles);
+    for (std::uint64_t t = 0; t < num_tiles; t++) {
+        auto &bound = header.tile_bounds[t];
+        if (fread(bound.min_bound_.data(), sizeof(double), 3, file) != 3 ||
+            fread(bound.max_bound_.data(), sizeof(double), 3, file) != 3 ||
+            fread(&header.tile_offsets[t], sizeof(std::uint64_t), 1, file) !=
+                    1 ||
+            fread(&header.tile_counts[t], sizeof(std::uint64_t), 1, file) !=
+                    1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Appends one tile, already positioned at its file offset, to the
+// cloud. attribute presence must match the header.
+bool ReadTPCDTile(FILE *file,
+                  const TPCDHeader &header,
+                  std::uint64_t count,
+                  geometry::PointCloud &pointcloud) {
+    size_t begin = pointcloud.points_.size();
+    pointcloud.points_.resize(begin + count);
+    if (fread(pointcloud.points_[begin].data(), sizeof(double), 3 * count,
+              file) != 3 * count) {
+        return false;
+    }
+    if (header.has_normals) {
+        pointcloud.normals_.resize(begin + count);
+        if (fread(pointcloud.normals_[begin].data(), sizeof(double), 3 * count,
+                  file) != 3 * count) {
+            return false;
+        }
+    }
+    if (header.has_colors) {
+        pointcloud.colors_.resize(begin + count);
+        if (fread(pointcloud.colors_[begin].data(), sizeof(double), 3 * count,
+                  file) != 3 * count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BoxesIntersect(const geometry::AxisAlignedBoundingBox &a,
+                    const geometry::AxisAlignedBoundingBox &b) {
+    for (int d = 0; d < 3; d++) {
+        if (a.max_bound_(d) < b.min_bound_(d) ||
+            b.max_bound_(d) < a.min_bound_(d)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PointInBox(const Eigen::Vector3d &point,
+                const geometry::AxisAlignedBoundingBox &box) {
+    return point(0) >= box.min_bound_(0) && point(0) <= box.max_bound_(0) &&
+           point(1) >= box.min_bound_(1) && point(1) <= box.max_bound_(1) &&
+           point(2) >= box.min_bound_(2) && point(2) <= box.max_bound_(2);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPointCloudFromTPCD(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read TPCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    pointcloud.Clear();
+    TPCDHeader header;
+    bool success = ReadTPCDHeader(file, header);
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal((int64_t)header.tile_bounds.size());
+    // The tiles are laid out in directory order, so a full read is one
+    // sequential sweep.
+    for (size_t t = 0; success && t < header.tile_bounds.size(); t++) {
+        success = fseek(file, (long)header.tile_offsets[t], SEEK_SET) == 0 &&
+                  ReadTPCDTile(file, header, header.tile_counts[t],
+                               pointcloud);
+        if (!reporter.Update((int64_t)(t + 1))) {
+            success = false;
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read TPCD failed: unable to parse file: {}",
+                            filename);
+        pointcloud.Clear();
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool ReadPointCloudRegionFromTPCD(
+        const std::string &filename,
+        const geometry::AxisAlignedBoundingBox &bbox,
+        geometry::PointCloud &pointcloud,
+        const ReadPointCloudOption &params) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read TPCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    pointcloud.Clear();
+    TPCDHeader header;
+    bool success = ReadTPCDHeader(file, header);
+    // Stream only the tiles whose bounds intersect the query box, then
+    // drop the points of the border tiles that fall outside it.
+    std::vector<size_t> hits;
+    for (size_t t = 0; success && t < header.tile_bounds.size(); t++) {
+        if (BoxesIntersect(header.tile_bounds[t], bbox)) {
+            hits.push_back(t);
+        }
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal((int64_t)hits.size());
+    for (size_t h = 0; success && h < hits.size(); h++) {
+        size_t t = hits[h];
+        success = fseek(file, (long)header.tile_offsets[t], SEEK_SET) == 0 &&
+                  ReadTPCDTile(file, header, header.tile_counts[t],
+                               pointcloud);
+        if (!reporter.Update((int64_t)(h + 1))) {
+            success = false;
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read TPCD failed: unable to parse file: {}",
+                            filename);
+        pointcloud.Clear();
+        return false;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        if (PointInBox(pointcloud.points_[i], bbox)) {
+            pointcloud.points_[kept] = pointcloud.points_[i];
+            if (header.has_normals) {
+                pointcloud.normals_[kept] = pointcloud.normals_[i];
+            }
+            if (header.has_colors) {
+                pointcloud.colors_[kept] = pointcloud.colors_[i];
+            }
+            kept++;
+        }
+    }
+    pointcloud.points_.resize(kept);
+    if (header.has_normals) {
+        pointcloud.normals_.resize(kept);
+    }
+    if (header.has_colors) {
+        pointcloud.colors_.resize(kept);
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool WritePointCloudToTPCD(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == nullptr) {
+        utility::LogWarning("Write TPCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::uint64_t num_points = pointcloud.points_.size();
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    double tile_size = 1.0;
+    if (num_points > 0) {
+        double max_extent = (pointcloud.GetMaxBound() - min_bound).maxCoeff();
+        if (max_extent > 0.0) {
+            tile_size = max_extent / kTPCDTilesPerAxis;
+        }
+    }
+    // Grid partition; tiles only exist where there are points, so a
+    // sparse cloud does not bloat the directory.
+    std::unordered_map<Eigen::Vector3i, std::vector<std::uint64_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            tile_to_points;
+    for (std::uint64_t i = 0; i < num_points; i++) {
+        Eigen::Vector3d cell = (pointcloud.points_[i] - min_bound) / tile_size;
+        Eigen::Vector3i key(int(std::floor(cell(0))), int(std::floor(cell(1))),
+                            int(std::floor(cell(2))));
+        tile_to_points[key].push_back(i);
+    }
+    const std::uint64_t num_tiles = tile_to_points.size();
+    const std::uint32_t has_normals = pointcloud.HasNormals() ? 1 : 0;
+    const std::uint32_t has_colors = pointcloud.HasColors() ? 1 : 0;
+    const std::uint64_t bytes_per_point =
+            (1 + (has_normals ? 1 : 0) + (has_colors ? 1 : 0)) * 3 *
+            sizeof(double);
+    bool success =
+            fwrite(kTPCDMagic, 1, 8, file) == 8 &&
+            fwrite(&kTPCDVersion, sizeof(std::uint32_t), 1, file) == 1 &&
+            fwrite(&has_normals, sizeof(std::uint32_t), 1, file) == 1 &&
+            fwrite(&has_colors, sizeof(std::uint32_t), 1, file) == 1 &&
+            fwrite(&tile_size, sizeof(double), 1, file) == 1 &&
+            fwrite(&num_points, sizeof(std::uint64_t), 1, file) == 1 &&
+            fwrite(&num_tiles, sizeof(std::uint64_t), 1, file) == 1;
+    // The directory size is known up front, which fixes the offset of
+    // the first payload byte and lets the directory be written before
+    // the tiles.
+    std::uint64_t payload_offset =
+            8 + 3 * sizeof(std::uint32_t) + sizeof(double) +
+            2 * sizeof(std::uint64_t) +
+            num_tiles * (6 * sizeof(double) + 2 * sizeof(std::uint64_t));
+    for (auto it = tile_to_points.begin();
+         success && it != tile_to_points.end(); ++it) {
+        const Eigen::Vector3d tile_min =
+                min_bound + it->first.cast<double>() * tile_size;
+        const Eigen::Vector3d tile_max = tile_min.array() + tile_size;
+        const std::uint64_t count = it->second.size();
+        success = fwrite(tile_min.data(), sizeof(double), 3, file) == 3 &&
+                  fwrite(tile_max.data(), sizeof(double), 3, file) == 3 &&
+                  fwrite(&payload_offset, sizeof(std::uint64_t), 1, file) ==
+                          1 &&
+                  fwrite(&count, sizeof(std::uint64_t), 1, file) == 1;
+        payload_offset += count * bytes_per_point;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal((int64_t)num_tiles);
+    std::vector<Eigen::Vector3d> buffer;
+    std::int64_t tiles_written = 0;
+    for (auto it = tile_to_points.begin();
+         success && it != tile_to_points.end(); ++it) {
+        const std::vector<std::uint64_t> &indices = it->second;
+        buffer.resize(indices.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            buffer[i] = pointcloud.points_[indices[i]];
+        }
+        success = fwrite(buffer[0].data(), sizeof(double), 3 * buffer.size(),
+                         file) == 3 * buffer.size();
+        if (success && has_normals) {
+            for (size_t i = 0; i < indices.size(); i++) {
+                buffer[i] = pointcloud.normals_[indices[i]];
+            }
+            success = fwrite(buffer[0].data(), sizeof(double),
+                             3 * buffer.size(), file) == 3 * buffer.size();
+        }
+        if (success && has_colors) {
+            for (size_t i = 0; i < indices.size(); i++) {
+                buffer[i] = pointcloud.colors_[indices[i]];
+            }
+            success = fwrite(buffer[0].data(), sizeof(double),
+                             3 * buffer.size(), file) == 3 * buffer.size();
+        }
+        if (!reporter.Update(++tiles_written)) {
+            success = false;
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write TPCD failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
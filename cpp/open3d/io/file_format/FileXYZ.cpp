@@ -43,28 +43,21 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        std::vector<double> values;
+        if (!ReadASCIIDoubleTable(filename, 3, values,
+                                  params.update_progress)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        size_t num_points = values.size() / 3;
+        pointcloud.points_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pointcloud.points_[i] = Eigen::Vector3d(
+                    values[3 * i + 0], values[3 * i + 1], values[3 * i + 2]);
         }
-        reporter.Finish();
 
         return true;
     } catch (const std::exception &e) {
@@ -43,30 +43,24 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        std::vector<double> values;
+        if (!ReadASCIIDoubleTable(filename, 6, values,
+                                  params.update_progress)) {
             utility::LogWarning("Read XYZN failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        size_t num_points = values.size() / 6;
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+        for (size_t i = 0; i < num_points; i++) {
+            pointcloud.points_[i] = Eigen::Vector3d(
+                    values[6 * i + 0], values[6 * i + 1], values[6 * i + 2]);
+            pointcloud.normals_[i] = Eigen::Vector3d(
+                    values[6 * i + 3], values[6 * i + 4], values[6 * i + 5]);
         }
-        reporter.Finish();
 
         return true;
     } catch (const std::exception &e) {
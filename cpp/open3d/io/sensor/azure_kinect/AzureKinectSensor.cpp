@@ -33,6 +33,7 @@
 
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/K4aPlugin.h"
+#include "open3d/utility/ThreadPool.h"
 
 namespace open3d {
 namespace io {
@@ -246,12 +247,8 @@ bool AzureKinectSensor::ListDevices() {
 
 std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
         k4a_capture_t capture, k4a_transformation_t transformation) {
-    static std::shared_ptr<geometry::Image> color_buffer = nullptr;
     static std::shared_ptr<geometry::RGBDImage> rgbd_buffer = nullptr;
 
-    if (color_buffer == nullptr) {
-        color_buffer = std::make_shared<geometry::Image>();
-    }
     if (rgbd_buffer == nullptr) {
         rgbd_buffer = std::make_shared<geometry::RGBDImage>();
     }
@@ -277,53 +274,71 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
 
     /* resize */
     rgbd_buffer->color_.Prepare(width, height, 3, sizeof(uint8_t));
-    color_buffer->Prepare(width, height, 4, sizeof(uint8_t));
-
-    tjhandle tjHandle;
-    tjHandle = tjInitDecompress();
-    if (0 !=
-        tjDecompress2(tjHandle, k4a_plugin::k4a_image_get_buffer(k4a_color),
-                      static_cast<unsigned long>(
-                              k4a_plugin::k4a_image_get_size(k4a_color)),
-                      color_buffer->data_.data(), width, 0 /* pitch */, height,
-                      TJPF_BGRA, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
-        utility::LogWarning("Failed to decompress color image.");
-        return nullptr;
-    }
-    tjDestroy(tjHandle);
-    ConvertBGRAToRGB(*color_buffer, rgbd_buffer->color_);
-
-    /* transform depth to color plane */
-    k4a_image_t k4a_transformed_depth = nullptr;
     if (transformation) {
         rgbd_buffer->depth_.Prepare(width, height, 1, sizeof(uint16_t));
-        k4a_plugin::k4a_image_create_from_buffer(
-                K4A_IMAGE_FORMAT_DEPTH16, width, height,
-                width * sizeof(uint16_t), rgbd_buffer->depth_.data_.data(),
-                width * height * sizeof(uint16_t), NULL, NULL,
-                &k4a_transformed_depth);
-        if (K4A_RESULT_SUCCEEDED !=
-            k4a_plugin::k4a_transformation_depth_image_to_color_camera(
-                    transformation, k4a_depth, k4a_transformed_depth)) {
-            utility::LogWarning(
-                    "Failed to transform depth frame to color frame.");
-            return nullptr;
-        }
     } else {
         rgbd_buffer->depth_.Prepare(
                 k4a_plugin::k4a_image_get_width_pixels(k4a_depth),
                 k4a_plugin::k4a_image_get_height_pixels(k4a_depth), 1,
                 sizeof(uint16_t));
-        memcpy(rgbd_buffer->depth_.data_.data(),
-               k4a_plugin::k4a_image_get_buffer(k4a_depth),
-               k4a_plugin::k4a_image_get_size(k4a_depth));
     }
 
-    /* process depth */
+    // The MJPEG decompression and the depth processing are independent
+    // and each takes a few milliseconds; running them on the worker
+    // pool the capture thread pays for the slower of the two instead
+    // of their sum
+    bool color_ok = true;
+    bool depth_ok = true;
+    utility::ThreadPool::GetInstance().ParallelFor(0, 2, [&](int64_t task) {
+        if (task == 0) {
+            // A decompressor handle is not thread safe but cheap to
+            // keep; one per worker thread avoids the per-frame
+            // tjInitDecompress/tjDestroy round trip
+            static thread_local tjhandle tj_handle = tjInitDecompress();
+            // Decompress straight to tightly packed RGB, skipping the
+            // BGRA staging image and the channel swizzling pass over
+            // the full frame
+            if (0 != tjDecompress2(
+                             tj_handle,
+                             k4a_plugin::k4a_image_get_buffer(k4a_color),
+                             static_cast<unsigned long>(
+                                     k4a_plugin::k4a_image_get_size(k4a_color)),
+                             rgbd_buffer->color_.data_.data(), width,
+                             0 /* pitch */, height, TJPF_RGB,
+                             TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
+                color_ok = false;
+            }
+        } else if (transformation) {
+            /* transform depth to color plane */
+            k4a_image_t k4a_transformed_depth = nullptr;
+            k4a_plugin::k4a_image_create_from_buffer(
+                    K4A_IMAGE_FORMAT_DEPTH16, width, height,
+                    width * sizeof(uint16_t), rgbd_buffer->depth_.data_.data(),
+                    width * height * sizeof(uint16_t), NULL, NULL,
+                    &k4a_transformed_depth);
+            if (K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_transformation_depth_image_to_color_camera(
+                        transformation, k4a_depth, k4a_transformed_depth)) {
+                depth_ok = false;
+            }
+            k4a_plugin::k4a_image_release(k4a_transformed_depth);
+        } else {
+            memcpy(rgbd_buffer->depth_.data_.data(),
+                   k4a_plugin::k4a_image_get_buffer(k4a_depth),
+                   k4a_plugin::k4a_image_get_size(k4a_depth));
+        }
+    });
+
     k4a_plugin::k4a_image_release(k4a_color);
     k4a_plugin::k4a_image_release(k4a_depth);
-    if (transformation) {
-        k4a_plugin::k4a_image_release(k4a_transformed_depth);
+
+    if (!color_ok) {
+        utility::LogWarning("Failed to decompress color image.");
+        return nullptr;
+    }
+    if (!depth_ok) {
+        utility::LogWarning("Failed to transform depth frame to color frame.");
+        return nullptr;
     }
 
     return rgbd_buffer;
@@ -75,7 +75,10 @@ bool MKVReader::Open(const std::string &filename) {
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    DisablePrefetch();
+    k4a_plugin::k4a_playback_close(handle_);
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -145,26 +148,35 @@ bool MKVReader::SeekTimestamp(size_t timestamp) {
         return false;
     }
 
+    // The prefetch thread owns the playback handle while it runs and
+    // has already decoded past the old position; restart it around the
+    // seek.
+    bool was_prefetching = prefetch_enabled_;
+    int buffer_size = prefetch_buffer_size_;
+    if (was_prefetching) {
+        DisablePrefetch();
+    }
+    bool success = true;
     if (K4A_RESULT_SUCCEEDED !=
         k4a_plugin::k4a_playback_seek_timestamp(handle_, timestamp,
                                                 K4A_PLAYBACK_SEEK_BEGIN)) {
         utility::LogWarning("Unable to go to timestamp {}", timestamp);
-        return false;
+        success = false;
     }
-    return true;
-}
-
-std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
-    if (!IsOpened()) {
-        utility::LogError("Null file handler. Please call Open().");
+    if (was_prefetching) {
+        EnablePrefetch(buffer_size);
     }
+    return success;
+}
 
+std::shared_ptr<geometry::RGBDImage> MKVReader::DecodeNextFrame(bool &eof) {
+    eof = false;
     k4a_capture_t k4a_capture;
     k4a_stream_result_t res =
             k4a_plugin::k4a_playback_get_next_capture(handle_, &k4a_capture);
     if (K4A_STREAM_RESULT_EOF == res) {
         utility::LogInfo("EOF reached");
-        is_eof_ = true;
+        eof = true;
         return nullptr;
     } else if (K4A_STREAM_RESULT_FAILED == res) {
         utility::LogInfo("Empty frame encountered, skip");
@@ -177,5 +189,108 @@ std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
 
     return rgbd;
 }
+
+std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+
+    if (!prefetch_enabled_) {
+        bool eof = false;
+        auto rgbd = DecodeNextFrame(eof);
+        if (eof) {
+            is_eof_ = true;
+        }
+        return rgbd;
+    }
+
+    PrefetchedFrame prefetched;
+    {
+        std::unique_lock<std::mutex> lock(prefetch_mutex_);
+        prefetch_ready_cv_.wait(lock, [this] {
+            return !prefetch_queue_.empty() || prefetch_done_;
+        });
+        if (prefetch_queue_.empty()) {
+            // The worker stopped at EOF and every buffered frame has
+            // been consumed.
+            is_eof_ = true;
+            return nullptr;
+        }
+        prefetched = std::move(prefetch_queue_.front());
+        prefetch_queue_.pop_front();
+    }
+    prefetch_space_cv_.notify_one();
+    if (prefetched.eof) {
+        is_eof_ = true;
+    }
+    return prefetched.frame;
+}
+
+void MKVReader::EnablePrefetch(int buffer_size /* = 8*/) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (prefetch_enabled_) {
+        return;
+    }
+    if (buffer_size < 1) {
+        buffer_size = 1;
+    }
+    prefetch_buffer_size_ = buffer_size;
+    prefetch_stop_ = false;
+    prefetch_done_ = false;
+    prefetch_enabled_ = true;
+    prefetch_thread_ = std::thread(&MKVReader::PrefetchLoop, this);
+}
+
+void MKVReader::DisablePrefetch() {
+    if (!prefetch_enabled_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_stop_ = true;
+    }
+    prefetch_space_cv_.notify_one();
+    prefetch_thread_.join();
+    prefetch_enabled_ = false;
+    prefetch_queue_.clear();
+}
+
+void MKVReader::PrefetchLoop() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(prefetch_mutex_);
+            prefetch_space_cv_.wait(lock, [this] {
+                return prefetch_stop_ ||
+                       int(prefetch_queue_.size()) < prefetch_buffer_size_;
+            });
+            if (prefetch_stop_) {
+                prefetch_done_ = true;
+                break;
+            }
+        }
+        PrefetchedFrame prefetched;
+        auto rgbd = DecodeNextFrame(prefetched.eof);
+        // The synchronous path hands out the decoder's internal buffer,
+        // which the next decode overwrites; queued frames have to be
+        // independent copies.
+        if (rgbd != nullptr) {
+            prefetched.frame = std::make_shared<geometry::RGBDImage>(*rgbd);
+        }
+        bool eof = prefetched.eof;
+        {
+            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+            prefetch_queue_.push_back(std::move(prefetched));
+        }
+        prefetch_ready_cv_.notify_one();
+        if (eof) {
+            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+            prefetch_done_ = true;
+            break;
+        }
+    }
+    prefetch_ready_cv_.notify_all();
+}
 }  // namespace io
 }  // namespace open3d
@@ -26,6 +26,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -45,7 +50,7 @@ class MKVReader {
 public:
     /// \brief Default Constructor.
     MKVReader();
-    virtual ~MKVReader() {}
+    virtual ~MKVReader() { DisablePrefetch(); }
 
     /// Check If the mkv file is opened.
     bool IsOpened();
@@ -64,14 +69,51 @@ public:
     /// Seek to the timestamp (in us).
     bool SeekTimestamp(size_t timestamp);
     /// Get next frame from the mkv playback and returns the RGBD object.
+    /// With prefetch enabled this pops an already decoded frame from the
+    /// ring buffer.
     std::shared_ptr<geometry::RGBDImage> NextFrame();
 
+    /// \brief Decodes frames ahead of NextFrame() on a background
+    /// thread.
+    ///
+    /// Up to \p buffer_size frames are decoded into a ring buffer while
+    /// the caller processes earlier ones, so sequential replays overlap
+    /// decoding with their own work and NextFrame() becomes a
+    /// near-zero-latency pop. Decoding stays on a single thread because
+    /// neither the playback handle nor the decompression buffers of the
+    /// k4a plugin may be shared between threads. Each prefetched frame
+    /// is an independent copy, unlike the synchronous path whose result
+    /// is overwritten by the next decode.
+    void EnablePrefetch(int buffer_size = 8);
+    /// Stop the prefetch thread and drop any buffered frames.
+    void DisablePrefetch();
+
 private:
     _k4a_playback_t *handle_;
     _k4a_transformation_t *transformation_;
     MKVMetadata metadata_;
     bool is_eof_ = false;
 
+    /// A decoded frame in the prefetch ring buffer; frame is null for
+    /// empty captures and when eof is set.
+    struct PrefetchedFrame {
+        std::shared_ptr<geometry::RGBDImage> frame;
+        bool eof = false;
+    };
+
+    void PrefetchLoop();
+    std::shared_ptr<geometry::RGBDImage> DecodeNextFrame(bool &eof);
+
+    int prefetch_buffer_size_ = 0;
+    bool prefetch_enabled_ = false;
+    bool prefetch_stop_ = false;
+    bool prefetch_done_ = false;
+    std::deque<PrefetchedFrame> prefetch_queue_;
+    std::mutex prefetch_mutex_;
+    std::condition_variable prefetch_space_cv_;
+    std::condition_variable prefetch_ready_cv_;
+    std::thread prefetch_thread_;
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
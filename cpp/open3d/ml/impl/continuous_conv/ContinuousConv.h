@@ -29,6 +29,7 @@
 #include <tbb/parallel_for.h>
 
 #include "open3d/ml/impl/continuous_conv/CoordinateTransformation.h"
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
 
 namespace open3d {
 namespace ml {
@@ -82,16 +83,34 @@ void _CConvComputeFeaturesCPU(TReal* out_features,
 
                 int range_length = r.end() - r.begin();
 
-                Eigen::Matrix<TReal, Eigen::Dynamic, 1> normalizers(
-                        range_length, 1);
+                // The block scratch comes from a thread-local slab, so
+                // processing the next block on the same thread reuses
+                // the same 64-byte aligned memory instead of going
+                // through the heap allocator for every block.
+                const size_t B_rows = in_channels * spatial_filter_size;
+                static thread_local MemorySlab scratch_slab;
+                MemoryAllocation& scratch = scratch_slab.Get(
+                        sizeof(TReal) * (range_length + B_rows * range_length +
+                                         VECSIZE * in_channels));
+
+                Eigen::Map<Eigen::Matrix<TReal, Eigen::Dynamic, 1>>
+                        normalizers(scratch.template Alloc<TReal>(range_length)
+                                            .first,
+                                    range_length, 1);
                 normalizers.setZero();
 
-                Eigen::Matrix<TReal, Eigen::Dynamic, Eigen::Dynamic> B(
-                        in_channels * spatial_filter_size, range_length);
+                Eigen::Map<Eigen::Matrix<TReal, Eigen::Dynamic,
+                                         Eigen::Dynamic>>
+                        B(scratch.template Alloc<TReal>(B_rows * range_length)
+                                  .first,
+                          B_rows, range_length);
                 B.setZero();
 
                 typedef Eigen::Array<TReal, VECSIZE, Eigen::Dynamic> Matrix;
-                Matrix infeat(VECSIZE, in_channels);
+                Eigen::Map<Matrix> infeat(
+                        scratch.template Alloc<TReal>(VECSIZE * in_channels)
+                                .first,
+                        VECSIZE, in_channels);
 
                 Eigen::Array<TReal, 3, 1> offsets_(offsets[0], offsets[1],
                                                    offsets[2]);
@@ -27,8 +27,10 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <cstring>
 
 #include "open3d/core/Atomic.h"
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -99,7 +101,16 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                             const size_t out_num_queries) {
     using namespace open3d::utility;
 
-    std::vector<uint32_t> tmp_neighbors_count(out_num_queries + 1, 0);
+    // The counts array comes from a reused thread-local slab since this
+    // function runs every training step; allocating it fresh per call
+    // was the remaining serial cost of the otherwise parallel passes.
+    static thread_local MemorySlab temp_slab;
+    MemoryAllocation& temp_alloc =
+            temp_slab.Get(sizeof(uint32_t) * (out_num_queries + 1));
+    std::pair<uint32_t*, size_t> tmp_neighbors_count_seg =
+            temp_alloc.Alloc<uint32_t>(out_num_queries + 1);
+    uint32_t* tmp_neighbors_count = tmp_neighbors_count_seg.first;
+    memset(tmp_neighbors_count, 0, sizeof(uint32_t) * (out_num_queries + 1));
 
     // count how often an idx appears in inp_neighbors_index
     tbb::parallel_for(tbb::blocked_range<size_t>(0, index_size),
@@ -111,12 +122,11 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                           }
                       });
 
-    InclusivePrefixSum(&tmp_neighbors_count[0],
-                       &tmp_neighbors_count[tmp_neighbors_count.size()],
+    InclusivePrefixSum(tmp_neighbors_count,
+                       tmp_neighbors_count + out_num_queries + 1,
                        out_neighbors_row_splits);
 
-    memset(tmp_neighbors_count.data(), 0,
-           sizeof(uint32_t) * tmp_neighbors_count.size());
+    memset(tmp_neighbors_count, 0, sizeof(uint32_t) * (out_num_queries + 1));
 
     // fill the new index vector
     tbb::parallel_for(
@@ -153,6 +163,8 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                     }
                 }
             });
+
+    temp_alloc.Free(tmp_neighbors_count_seg);
 }
 
 }  // namespace impl
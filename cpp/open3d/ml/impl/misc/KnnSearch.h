@@ -27,9 +27,11 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <cstring>
 #include <mutex>
 
 #include "open3d/core/Atomic.h"
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/ml/impl/misc/NeighborSearchCommon.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -39,6 +41,23 @@ namespace impl {
 
 namespace {
 
+/// Fingerprint of a points array for validating cached search trees.
+/// Hashes every coordinate (FNV-1a): sampling would let an in-place
+/// update of the unsampled points reuse a stale tree, and a linear
+/// pass over the coordinates is still far cheaper than a rebuild.
+template <class T>
+uint64_t PointsFingerprint(size_t num_points, const T* const points) {
+    uint64_t h = 14695981039346656037ull;
+    auto mix = [&](uint64_t v) { h = (h ^ v) * 1099511628211ull; };
+    mix(num_points);
+    for (size_t i = 0; i < num_points * 3; ++i) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &points[i], sizeof(T));
+        mix(bits);
+    }
+    return h;
+}
+
 /// Implementation of KnnSearchCPU with template params for metrics
 template <class T, class OUTPUT_ALLOCATOR, int METRIC>
 void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
@@ -65,15 +84,37 @@ void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
         return;
     }
 
-    Adaptor<T> adaptor(num_points, points);
-
     typedef nanoflann::KDTreeSingleIndexAdaptor<
             typename SelectNanoflannAdaptor<METRIC, T>::Adaptor_t, Adaptor<T>,
             3>
             KDTree_t;
 
-    KDTree_t index(3, adaptor);
-    index.buildIndex();
+    // Cache the tree of the last call. Training pipelines run this
+    // search thousands of times on the same cloud and rebuilding the
+    // tree then dominates the runtime. The cache is validated with a
+    // fingerprint of all coordinates, so a reused buffer with
+    // different points triggers a rebuild instead of hitting a stale
+    // tree.
+    struct CachedTree {
+        const T* points = nullptr;
+        size_t num_points = 0;
+        uint64_t fingerprint = 0;
+        std::unique_ptr<Adaptor<T>> adaptor;
+        std::unique_ptr<KDTree_t> index;
+    };
+    static thread_local CachedTree cached_tree;
+
+    const uint64_t fingerprint = PointsFingerprint(num_points, points);
+    if (cached_tree.points != points || cached_tree.num_points != num_points ||
+        cached_tree.fingerprint != fingerprint) {
+        cached_tree.adaptor.reset(new Adaptor<T>(num_points, points));
+        cached_tree.index.reset(new KDTree_t(3, *cached_tree.adaptor));
+        cached_tree.index->buildIndex();
+        cached_tree.points = points;
+        cached_tree.num_points = num_points;
+        cached_tree.fingerprint = fingerprint;
+    }
+    KDTree_t& index = *cached_tree.index;
 
     // temporary storage for the result
     struct Pair {
@@ -101,7 +142,15 @@ void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
     };
 
     std::mutex pairs_mutex;  // protects write access to pairs
-    std::vector<uint32_t> neighbors_count(num_queries, 0);
+
+    // reuse the slab of the last call for the temporary counts array
+    static thread_local MemorySlab temp_slab;
+    MemoryAllocation& temp_alloc =
+            temp_slab.Get(num_queries * sizeof(uint32_t));
+    std::pair<uint32_t*, size_t> neighbors_count_seg =
+            temp_alloc.Alloc<uint32_t>(num_queries);
+    uint32_t* neighbors_count = neighbors_count_seg.first;
+    std::fill(neighbors_count, neighbors_count + num_queries, 0);
 
     // compute nearest neighbors and store in pairs
     tbb::parallel_for(
@@ -136,8 +185,7 @@ void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
             });
 
     query_neighbors_row_splits[0] = 0;
-    InclusivePrefixSum(&neighbors_count[0],
-                       &neighbors_count[neighbors_count.size()],
+    InclusivePrefixSum(neighbors_count, neighbors_count + num_queries,
                        query_neighbors_row_splits + 1);
 
     int32_t* neighbors_indices_ptr;
@@ -148,7 +196,7 @@ void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
     else
         output_allocator.AllocDistances(&distances_ptr, 0);
 
-    std::fill(neighbors_count.begin(), neighbors_count.end(), 0);
+    std::fill(neighbors_count, neighbors_count + num_queries, 0);
 
     // fill output index and distance arrays
     tbb::parallel_for(tbb::blocked_range<size_t>(0, pairs.size()),
@@ -170,6 +218,8 @@ void _KnnSearchCPU(int64_t* query_neighbors_row_splits,
                               }
                           }
                       });
+
+    temp_alloc.Free(neighbors_count_seg);
 }
 
 }  // namespace
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -90,6 +91,22 @@ public:
         return std::pair<void*, size_t>(nullptr, 0);
     }
 
+    /// Returns all segments to the allocation and restores the initial
+    /// free segment. This allows reusing the memory for a new round of
+    /// allocations without reconstructing the object. The peak usage
+    /// returned by MaxUsed() is kept across calls to Reset().
+    void Reset() {
+        void* ptr = const_cast<void*>(_ptr);
+        size_t size = _size;
+        void* aligned_ptr = std::align(_alignment, 1, ptr, size);
+        size_t size_after_align =
+                (((char*)_ptr + _size) - (char*)aligned_ptr) / _alignment;
+        size_after_align *= _alignment;
+        _free_segments.clear();
+        _free_segments.push_back(
+                std::pair<void*, size_t>(aligned_ptr, size_after_align));
+    }
+
     /// Returns the largest free segment.
     std::pair<void*, size_t> AllocLargestSegment() {
         size_t size = 0;
@@ -203,6 +220,61 @@ private:
     std::vector<std::pair<void*, size_t>> _free_segments;
 };
 
+/// A slab of memory for reusing temporary allocations across calls.
+/// Get() returns a MemoryAllocation over an owned slab of at least the
+/// requested size. The slab only grows and is kept alive between calls,
+/// so repeated calls with similar sizes reuse the same memory instead of
+/// going through the heap allocator every time. Typically used as a
+/// thread_local object by functions that are called in a tight loop.
+class MemorySlab {
+public:
+    /// Creates an empty slab.
+    ///
+    /// \param alignment    The alignment for the MemoryAllocation
+    ///        objects returned by Get().
+    ///
+    explicit MemorySlab(size_t alignment = 64) : _alignment(alignment) {}
+
+    MemorySlab(const MemorySlab&) = delete;
+    MemorySlab& operator=(const MemorySlab&) = delete;
+
+    /// Returns a MemoryAllocation with at least \p size bytes of free
+    /// memory. All segments of the previously returned allocation are
+    /// implicitly freed; pointers handed out by it become invalid.
+    MemoryAllocation& Get(size_t size) {
+        // account for the start alignment of MemoryAllocation and for
+        // Alloc() rounding requests up to the alignment
+        size += 2 * _alignment;
+        if (size > _slab_size) {
+            // grow geometrically to limit the number of reallocations
+            _slab_size = std::max(size, 2 * _slab_size);
+            _slab.reset(new char[_slab_size]);
+            _allocation.reset();
+        }
+        if (_allocation) {
+            _allocation->Reset();
+        } else {
+            _allocation.reset(new MemoryAllocation(_slab.get(), _slab_size,
+                                                   _alignment));
+        }
+        return *_allocation;
+    }
+
+    /// Returns the size of the owned slab in bytes.
+    size_t SlabSize() const { return _slab_size; }
+
+private:
+    /// The alignment for the returned MemoryAllocation objects
+    const size_t _alignment;
+
+    /// The owned memory and its size
+    std::unique_ptr<char[]> _slab;
+    size_t _slab_size = 0;
+
+    /// The allocation over the current slab
+    std::unique_ptr<MemoryAllocation> _allocation;
+};
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
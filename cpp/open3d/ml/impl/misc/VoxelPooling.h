@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 #include <tbb/task_group.h>
 #include <Eigen/Core>
+#include <numeric>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/utility/Helper.h"
 
@@ -275,6 +279,52 @@ Eigen::Vector3i ComputeVoxelIndex(
     return voxel_index;
 }
 
+/// Computes the voxel index for each point, an order of the points sorted
+/// by voxel index, and the start of each voxel's run in the sorted order.
+/// This turns the per-voxel accumulation into independent segments
+/// order[splits[s]..splits[s+1]) that can be processed in parallel.
+/// Ties are broken with the point index so each voxel sees its points in
+/// the original input order.
+template <class TReal>
+void _SortPointsByVoxel(size_t num_points,
+                        const TReal* const positions,
+                        TReal inv_voxel_size,
+                        std::vector<Eigen::Vector3i>& voxel_indices,
+                        std::vector<size_t>& order,
+                        std::vector<size_t>& splits) {
+    typedef Eigen::Array<TReal, 3, 1> Vec3_t;
+
+    voxel_indices.resize(num_points);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              Eigen::Map<const Vec3_t> pos(positions + i * 3);
+                              voxel_indices[i] =
+                                      ComputeVoxelIndex(pos, inv_voxel_size);
+                          }
+                      });
+
+    order.resize(num_points);
+    std::iota(order.begin(), order.end(), size_t(0));
+    tbb::parallel_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const Eigen::Vector3i& va = voxel_indices[a];
+        const Eigen::Vector3i& vb = voxel_indices[b];
+        if (va(0) != vb(0)) return va(0) < vb(0);
+        if (va(1) != vb(1)) return va(1) < vb(1);
+        if (va(2) != vb(2)) return va(2) < vb(2);
+        return a < b;
+    });
+
+    splits.clear();
+    splits.push_back(0);
+    for (size_t i = 1; i < num_points; ++i) {
+        if (voxel_indices[order[i]] != voxel_indices[order[i - 1]]) {
+            splits.push_back(i);
+        }
+    }
+    splits.push_back(num_points);
+}
+
 // implementation for VoxelPooling with template parameter for the accumulator.
 template <class TReal, class TFeat, class ACCUMULATOR, class OUTPUT_ALLOCATOR>
 void _VoxelPooling(size_t num_inp,
@@ -294,47 +344,53 @@ void _VoxelPooling(size_t num_inp,
     typedef Eigen::Array<TReal, 3, 1> Vec3_t;
     typedef Eigen::Array<TFeat, Eigen::Dynamic, 1> FeatureVec_t;
 
-    std::unordered_map<Eigen::Vector3i, ACCUMULATOR,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    Vec3_t voxel_center;
-    Eigen::Vector3i voxel_index;
     TReal inv_voxel_size = 1 / voxel_size;
     TReal half_voxel_size = 0.5 * voxel_size;
-    for (size_t i = 0; i < num_inp; ++i) {
-        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
 
-        voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
+    // Sort the points by voxel index and accumulate each voxel's segment
+    // independently instead of walking a hash map with a single thread.
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<size_t> order;
+    std::vector<size_t> splits;
+    _SortPointsByVoxel(num_inp, inp_positions, inv_voxel_size, voxel_indices,
+                       order, splits);
 
-        voxel_center << voxel_index(0) * voxel_size + half_voxel_size,
-                voxel_index(1) * voxel_size + half_voxel_size,
-                voxel_index(2) * voxel_size + half_voxel_size;
-
-        Eigen::Map<const FeatureVec_t> feat(inp_features + in_channels * i,
-                                            in_channels);
-        voxelindex_to_accpoint[voxel_index].AddPoint(
-                pos.matrix(), voxel_center.matrix(), feat);
-    }
-
-    const size_t num_out = voxelindex_to_accpoint.size();
+    const size_t num_out = splits.size() - 1;
 
     TReal* out_pos_ptr;
     TFeat* out_feat_ptr;
     output_allocator.AllocPooledPositions(&out_pos_ptr, num_out);
     output_allocator.AllocPooledFeatures(&out_feat_ptr, num_out, in_channels);
 
-    size_t i = 0;
-    for (const auto point : voxelindex_to_accpoint) {
-        Vec3_t pos = point.second.Position();
-        Eigen::Map<Vec3_t> out_pos(out_pos_ptr + i * 3);
-        out_pos = pos;
-
-        Eigen::Map<FeatureVec_t> out_feat(out_feat_ptr + i * in_channels,
-                                          in_channels);
-        out_feat = point.second.Features();
-        ++i;
-    }
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_out),
+            [&](const tbb::blocked_range<size_t>& r) {
+                Vec3_t voxel_center;
+                for (size_t s = r.begin(); s != r.end(); ++s) {
+                    const Eigen::Vector3i& voxel_index =
+                            voxel_indices[order[splits[s]]];
+                    voxel_center << voxel_index(0) * voxel_size +
+                                            half_voxel_size,
+                            voxel_index(1) * voxel_size + half_voxel_size,
+                            voxel_index(2) * voxel_size + half_voxel_size;
+
+                    ACCUMULATOR acc;
+                    for (size_t j = splits[s]; j < splits[s + 1]; ++j) {
+                        size_t i = order[j];
+                        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
+                        Eigen::Map<const FeatureVec_t> feat(
+                                inp_features + in_channels * i, in_channels);
+                        acc.AddPoint(pos.matrix(), voxel_center.matrix(),
+                                     feat);
+                    }
+
+                    Eigen::Map<Vec3_t> out_pos(out_pos_ptr + s * 3);
+                    out_pos = acc.Position();
+                    Eigen::Map<FeatureVec_t> out_feat(
+                            out_feat_ptr + s * in_channels, in_channels);
+                    out_feat = acc.Features();
+                }
+            });
 }
 
 // implementation for VoxelPoolingBackprop with template parameter for the
@@ -357,34 +413,20 @@ void _VoxelPoolingBackprop(TFeat* features_backprop,
     typedef Eigen::Array<TReal, 3, 1> Vec3_t;
     typedef Eigen::Array<TFeat, Eigen::Dynamic, 1> FeatureVec_t;
 
-    Vec3_t voxel_size3(voxel_size, voxel_size, voxel_size);
+    TReal inv_voxel_size = 1 / voxel_size;
+    TReal half_voxel_size = 0.5 * voxel_size;
 
-    // create the two hash maps in parallel
+    // sort the input points by voxel and build the gradient hash map in
+    // parallel; the sort itself runs parallel as well
     tbb::task_group task_group;
 
-    std::unordered_map<Eigen::Vector3i, ACCUMULATOR,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<size_t> order;
+    std::vector<size_t> splits;
 
     task_group.run([&] {
-        Vec3_t voxel_center;
-        Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
-        TReal half_voxel_size = 0.5 * voxel_size;
-        for (size_t i = 0; i < num_inp; ++i) {
-            Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-            voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-            voxel_center << voxel_index(0) * voxel_size + half_voxel_size,
-                    voxel_index(1) * voxel_size + half_voxel_size,
-                    voxel_index(2) * voxel_size + half_voxel_size;
-
-            Eigen::Map<const FeatureVec_t> feat(inp_features + in_channels * i,
-                                                in_channels);
-            voxelindex_to_accpoint[voxel_index].AddPoint(
-                    pos.matrix(), voxel_center.matrix(), feat, i);
-        }
+        _SortPointsByVoxel(num_inp, inp_positions, inv_voxel_size,
+                           voxel_indices, order, splits);
     });
 
     std::unordered_map<Eigen::Vector3i, size_t,
@@ -393,7 +435,6 @@ void _VoxelPoolingBackprop(TFeat* features_backprop,
 
     task_group.run([&] {
         Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
         for (size_t i = 0; i < num_pooled; ++i) {
             Eigen::Map<const Vec3_t> pos(pooled_positions + i * 3);
 
@@ -405,54 +446,74 @@ void _VoxelPoolingBackprop(TFeat* features_backprop,
 
     task_group.wait();
 
-    if (FEAT_FN == AVERAGE) {
-        Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
-        for (size_t i = 0; i < num_inp; ++i) {
-            Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-            voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-            Eigen::Map<FeatureVec_t> feat_bp(
-                    features_backprop + in_channels * i, in_channels);
-
-            size_t grad_idx = voxelindex_to_gradindex[voxel_index];
-            int count = voxelindex_to_accpoint[voxel_index].Count();
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            feat_bp = grad / count;
-        }
-    }
-
-    if (FEAT_FN == NEAREST_NEIGHBOR) {
-        for (const auto point : voxelindex_to_accpoint) {
-            size_t idx = point.second.Index()(0);
-            Eigen::Map<FeatureVec_t> feat_bp(
-                    features_backprop + in_channels * idx, in_channels);
-
-            size_t grad_idx = voxelindex_to_gradindex[point.first];
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            feat_bp = grad;
-        }
-    }
-
-    if (FEAT_FN == MAX) {
-        for (const auto point : voxelindex_to_accpoint) {
-            size_t grad_idx = voxelindex_to_gradindex[point.first];
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            for (int i = 0; i < in_channels; ++i) {
-                size_t idx = point.second.Index()(i);
-                Eigen::Map<FeatureVec_t> feat_bp(
-                        features_backprop + in_channels * idx, in_channels);
-                feat_bp(i) = grad(i);
-            }
-        }
-    }
+    const size_t num_voxels = splits.size() - 1;
+
+    // The voxels are independent segments in the sorted order, so the
+    // scatter of the gradients runs parallel over the voxels. Each
+    // segment replays its points through the accumulator in the input
+    // order, which keeps the nearest neighbor and argmax selection of
+    // the serial version.
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_voxels),
+            [&](const tbb::blocked_range<size_t>& r) {
+                Vec3_t voxel_center;
+                for (size_t s = r.begin(); s != r.end(); ++s) {
+                    const Eigen::Vector3i& voxel_index =
+                            voxel_indices[order[splits[s]]];
+
+                    auto grad_it = voxelindex_to_gradindex.find(voxel_index);
+                    size_t grad_idx = grad_it != voxelindex_to_gradindex.end()
+                                              ? grad_it->second
+                                              : 0;
+                    Eigen::Map<const FeatureVec_t> grad(
+                            pooled_features_gradient + in_channels * grad_idx,
+                            in_channels);
+
+                    if (FEAT_FN == AVERAGE) {
+                        int count = int(splits[s + 1] - splits[s]);
+                        for (size_t j = splits[s]; j < splits[s + 1]; ++j) {
+                            Eigen::Map<FeatureVec_t> feat_bp(
+                                    features_backprop + in_channels * order[j],
+                                    in_channels);
+                            feat_bp = grad / count;
+                        }
+                        continue;
+                    }
+
+                    voxel_center << voxel_index(0) * voxel_size +
+                                            half_voxel_size,
+                            voxel_index(1) * voxel_size + half_voxel_size,
+                            voxel_index(2) * voxel_size + half_voxel_size;
+
+                    ACCUMULATOR acc;
+                    for (size_t j = splits[s]; j < splits[s + 1]; ++j) {
+                        size_t i = order[j];
+                        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
+                        Eigen::Map<const FeatureVec_t> feat(
+                                inp_features + in_channels * i, in_channels);
+                        acc.AddPoint(pos.matrix(), voxel_center.matrix(), feat,
+                                     i);
+                    }
+
+                    if (FEAT_FN == NEAREST_NEIGHBOR) {
+                        size_t idx = acc.Index()(0);
+                        Eigen::Map<FeatureVec_t> feat_bp(
+                                features_backprop + in_channels * idx,
+                                in_channels);
+                        feat_bp = grad;
+                    }
+
+                    if (FEAT_FN == MAX) {
+                        for (int i = 0; i < in_channels; ++i) {
+                            size_t idx = acc.Index()(i);
+                            Eigen::Map<FeatureVec_t> feat_bp(
+                                    features_backprop + in_channels * idx,
+                                    in_channels);
+                            feat_bp(i) = grad(i);
+                        }
+                    }
+                }
+            });
 }
 
 /// Pooling operation for point clouds. Aggregates points that are inside the
@@ -43,6 +43,17 @@ namespace open3d {
 namespace pipelines {
 namespace color_map {
 
+namespace {
+
+// Above this system dimension the per-image normal equations of the
+// non-rigid optimization are assembled and solved sparsely. A residual
+// only couples the six pose parameters with the anchors of one warping
+// cell, so JTJ stays block-sparse no matter how fine the grid is, while
+// the dense (6 + nonrigidval)^2 matrix grows quadratically.
+const int kSparseSystemMinDim = 300;
+
+}  // unnamed namespace
+
 static void OptimizeImageCoorNonrigid(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
@@ -91,31 +102,51 @@ static void OptimizeImageCoorNonrigid(
                         extrinsic, visibility_image_to_vertex[c],
                         option.image_boundary_margin_);
             };
-            Eigen::MatrixXd JTJ;
-            Eigen::VectorXd JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            nonrigidval, false);
-
             double weight = option.non_rigid_anchor_point_weight_ *
                             visibility_image_to_vertex[c].size() / n_vertex;
-            for (int j = 0; j < nonrigidval; j++) {
-                double r = weight * (warping_fields[c].flow_(j) -
-                                     warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
-                JTr(6 + j) += weight * r;
-                rr_reg += r * r;
-            }
-
             bool success;
             Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            double r2;
+            if (6 + nonrigidval >= kSparseSystemMinDim) {
+                Eigen::SparseMatrix<double> JTJ;
+                Eigen::VectorXd JTr;
+                std::tie(JTJ, JTr, r2) = ComputeJTJandJTrNonRigidSparse<
+                        Eigen::Vector14d, Eigen::Vector14i, Eigen::VectorXd>(
+                        f_lambda, int(visibility_image_to_vertex[c].size()),
+                        nonrigidval, false);
+
+                for (int j = 0; j < nonrigidval; j++) {
+                    double r = weight * (warping_fields[c].flow_(j) -
+                                         warping_fields_init[c].flow_(j));
+                    JTJ.coeffRef(6 + j, 6 + j) += weight * weight;
+                    JTr(6 + j) += weight * r;
+                    rr_reg += r * r;
+                }
+
+                std::tie(success, result) =
+                        SolveLinearSystemPSDSparse(JTJ, -JTr);
+            } else {
+                Eigen::MatrixXd JTJ;
+                Eigen::VectorXd JTr;
+                std::tie(JTJ, JTr, r2) = ComputeJTJandJTrNonRigid<
+                        Eigen::Vector14d, Eigen::Vector14i, Eigen::MatrixXd,
+                        Eigen::VectorXd>(
+                        f_lambda, int(visibility_image_to_vertex[c].size()),
+                        nonrigidval, false);
+
+                for (int j = 0; j < nonrigidval; j++) {
+                    double r = weight * (warping_fields[c].flow_(j) -
+                                         warping_fields_init[c].flow_(j));
+                    JTJ(6 + j, 6 + j) += weight * weight;
+                    JTr(6 + j) += weight * r;
+                    rr_reg += r * r;
+                }
+
+                std::tie(success, result) = utility::SolveLinearSystemPSD(
+                        JTJ, -JTr, /*prefer_sparse=*/false,
+                        /*check_symmetric=*/false,
+                        /*check_det=*/false, /*check_psd=*/false);
+            }
             Eigen::Vector6d result_pose;
             result_pose << result.block(0, 0, 6, 1);
             auto delta = utility::TransformVector6dToMatrix4d(result_pose);
@@ -220,24 +251,30 @@ static std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
                   std::vector<std::shared_ptr<geometry::Image>>>
 CreateGradientImages(
         const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd) {
-    std::vector<std::shared_ptr<geometry::Image>> images_gray;
-    std::vector<std::shared_ptr<geometry::Image>> images_dx;
-    std::vector<std::shared_ptr<geometry::Image>> images_dy;
-    std::vector<std::shared_ptr<geometry::Image>> images_color;
-    std::vector<std::shared_ptr<geometry::Image>> images_depth;
-    for (size_t i = 0; i < images_rgbd.size(); i++) {
+    auto n_images = images_rgbd.size();
+    std::vector<std::shared_ptr<geometry::Image>> images_gray(n_images);
+    std::vector<std::shared_ptr<geometry::Image>> images_dx(n_images);
+    std::vector<std::shared_ptr<geometry::Image>> images_dy(n_images);
+    std::vector<std::shared_ptr<geometry::Image>> images_color(n_images);
+    std::vector<std::shared_ptr<geometry::Image>> images_depth(n_images);
+    // The gradient pyramid of every input image is independent of the
+    // others, so the precompute is embarrassingly parallel.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n_images); i++) {
         auto gray_image = images_rgbd[i]->color_.CreateFloatImage();
         auto gray_image_filtered =
                 gray_image->Filter(geometry::Image::FilterType::Gaussian3);
-        images_gray.push_back(gray_image_filtered);
-        images_dx.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dx));
-        images_dy.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dy));
-        auto color = std::make_shared<geometry::Image>(images_rgbd[i]->color_);
-        auto depth = std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
-        images_color.push_back(color);
-        images_depth.push_back(depth);
+        images_gray[i] = gray_image_filtered;
+        images_dx[i] = gray_image_filtered->Filter(
+                geometry::Image::FilterType::Sobel3Dx);
+        images_dy[i] = gray_image_filtered->Filter(
+                geometry::Image::FilterType::Sobel3Dy);
+        images_color[i] =
+                std::make_shared<geometry::Image>(images_rgbd[i]->color_);
+        images_depth[i] =
+                std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
     }
     return std::make_tuple(images_gray, images_dx, images_dy, images_color,
                            images_depth);
@@ -247,13 +284,16 @@ static std::vector<std::shared_ptr<geometry::Image>> CreateDepthBoundaryMasks(
         const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
         const ColorMapOptimizationOption& option) {
     auto n_images = images_depth.size();
-    std::vector<std::shared_ptr<geometry::Image>> masks;
-    for (size_t i = 0; i < n_images; i++) {
+    std::vector<std::shared_ptr<geometry::Image>> masks(n_images);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n_images); i++) {
         utility::LogDebug("[MakeDepthMasks] geometry::Image {:d}/{:d}", i,
                           n_images);
-        masks.push_back(images_depth[i]->CreateDepthBoundaryMask(
+        masks[i] = images_depth[i]->CreateDepthBoundaryMask(
                 option.depth_threshold_for_discontinuity_check_,
-                option.half_dilation_kernel_size_for_discontinuity_map_));
+                option.half_dilation_kernel_size_for_discontinuity_map_);
     }
     return masks;
 }
@@ -114,12 +114,8 @@ void ColorMapOptimizationJacobian::ComputeJacobianAndResidualNonRigid(
     }
     double p = (u - ii * anchor_step) / anchor_step;
     double q = (v - jj * anchor_step) / anchor_step;
-    Eigen::Vector2d grids[4] = {
-            warping_fields.QueryFlow(ii, jj),
-            warping_fields.QueryFlow(ii, jj + 1),
-            warping_fields.QueryFlow(ii + 1, jj),
-            warping_fields.QueryFlow(ii + 1, jj + 1),
-    };
+    Eigen::Vector2d grids[4];
+    warping_fields.QueryFlowGrid(ii, jj, grids);
     Eigen::Vector2d uuvv = (1 - p) * (1 - q) * grids[0] +
                            (1 - p) * (q)*grids[1] + (p) * (1 - q) * grids[2] +
                            (p) * (q)*grids[3];
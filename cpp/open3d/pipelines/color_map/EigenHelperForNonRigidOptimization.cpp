@@ -26,6 +26,9 @@
 
 #include "open3d/pipelines/color_map/EigenHelperForNonRigidOptimization.h"
 
+#include <Eigen/Sparse>
+#include <unordered_map>
+
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -99,6 +102,104 @@ ComputeJTJandJTrNonRigid(
         int nonrigidval,
         bool verbose);
 
+template <typename VecInTypeDouble, typename VecInTypeInt, typename VecOutType>
+std::tuple<Eigen::SparseMatrix<double>, VecOutType, double>
+ComputeJTJandJTrNonRigidSparse(
+        std::function<void(int, VecInTypeDouble &, double &, VecInTypeInt &)> f,
+        int iteration_num,
+        int nonrigidval,
+        bool verbose /*=true*/) {
+    int dim = 6 + nonrigidval;
+    VecOutType JTr(dim);
+    // JTJ entries keyed by row * dim + col; only the entries a residual
+    // actually touches ever exist, which keeps memory at O(nnz) instead
+    // of O(dim^2).
+    std::unordered_map<int64_t, double> JTJ_entries;
+    double r2_sum = 0.0;
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::unordered_map<int64_t, double> JTJ_private;
+        VecOutType JTr_private(dim);
+        double r2_sum_private = 0.0;
+        JTr_private.setZero();
+        VecInTypeDouble J_r;
+        VecInTypeInt pattern;
+        double r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, pattern);
+            for (auto x = 0; x < J_r.size(); x++) {
+                for (auto y = 0; y < J_r.size(); y++) {
+                    JTJ_private[int64_t(pattern(x)) * dim + pattern(y)] +=
+                            J_r(x) * J_r(y);
+                }
+            }
+            for (auto x = 0; x < J_r.size(); x++) {
+                JTr_private(pattern(x)) += r * J_r(x);
+            }
+            r2_sum_private += r * r;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            for (const auto &entry : JTJ_private) {
+                JTJ_entries[entry.first] += entry.second;
+            }
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(JTJ_entries.size());
+    for (const auto &entry : JTJ_entries) {
+        triplets.push_back(Eigen::Triplet<double>(int(entry.first / dim),
+                                                  int(entry.first % dim),
+                                                  entry.second));
+    }
+    Eigen::SparseMatrix<double> JTJ(dim, dim);
+    JTJ.setFromTriplets(triplets.begin(), triplets.end());
+    if (verbose) {
+        utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                          r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+template std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd, double>
+ComputeJTJandJTrNonRigidSparse(
+        std::function<
+                void(int, Eigen::Vector14d &, double &, Eigen::Vector14i &)> f,
+        int iteration_num,
+        int nonrigidval,
+        bool verbose);
+
+std::tuple<bool, Eigen::VectorXd> SolveLinearSystemPSDSparse(
+        const Eigen::SparseMatrix<double> &A, const Eigen::VectorXd &b) {
+    Eigen::SimplicialCholesky<Eigen::SparseMatrix<double>> A_chol;
+    A_chol.compute(A);
+    if (A_chol.info() == Eigen::Success) {
+        Eigen::VectorXd x = A_chol.solve(b);
+        if (A_chol.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(x));
+        }
+        utility::LogWarning(
+                "Sparse Cholesky solve failed, zero vector will be returned");
+    } else {
+        utility::LogWarning(
+                "Sparse Cholesky decompose failed, zero vector will be "
+                "returned");
+    }
+    return std::make_tuple(false, Eigen::VectorXd::Zero(b.rows()));
+}
+
 }  // namespace color_map
 }  // namespace pipelines
 }  // namespace open3d
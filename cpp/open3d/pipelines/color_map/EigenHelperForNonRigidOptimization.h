@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <tuple>
 #include <vector>
 
@@ -60,6 +61,25 @@ std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
         int nonrigidval,
         bool verbose = true);
 
+/// Sparse variant of ComputeJTJandJTrNonRigid. Every residual couples
+/// the six pose parameters with the anchors of a single warping cell,
+/// so JTJ has O(nonrigidval) non-zeros and is accumulated per entry
+/// instead of into a dense (6 + nonrigidval)^2 matrix. Use this variant
+/// when the warping grid is fine and the dense system no longer fits.
+template <typename VecInTypeDouble, typename VecInTypeInt, typename VecOutType>
+std::tuple<Eigen::SparseMatrix<double>, VecOutType, double>
+ComputeJTJandJTrNonRigidSparse(
+        std::function<void(int, VecInTypeDouble &, double &, VecInTypeInt &)> f,
+        int iteration_num,
+        int nonrigidval,
+        bool verbose = true);
+
+/// Function to solve Ax=b for a sparse positive semi-definite A with
+/// sparse Cholesky. Returns a zero vector when the decomposition or the
+/// solve fails.
+std::tuple<bool, Eigen::VectorXd> SolveLinearSystemPSDSparse(
+        const Eigen::SparseMatrix<double> &A, const Eigen::VectorXd &b);
+
 }  // namespace color_map
 }  // namespace pipelines
 }  // namespace open3d
@@ -78,6 +78,57 @@ Eigen::Vector2d ImageWarpingField::GetImageWarpingField(double u,
            (p) * (q)*QueryFlow(i + 1, j + 1);
 }
 
+void ImageWarpingField::QueryFlowGrid(int i,
+                                      int j,
+                                      Eigen::Vector2d flows[4]) const {
+    if (i >= 0 && i + 1 < anchor_w_ && j >= 0 && j + 1 < anchor_h_) {
+        const double *flow = flow_.data();
+        const int idx0 = (i + j * anchor_w_) * 2;
+        const int idx1 = idx0 + anchor_w_ * 2;
+        flows[0] = Eigen::Vector2d(flow[idx0], flow[idx0 + 1]);
+        flows[1] = Eigen::Vector2d(flow[idx1], flow[idx1 + 1]);
+        flows[2] = Eigen::Vector2d(flow[idx0 + 2], flow[idx0 + 3]);
+        flows[3] = Eigen::Vector2d(flow[idx1 + 2], flow[idx1 + 3]);
+    } else {
+        flows[0] = QueryFlow(i, j);
+        flows[1] = QueryFlow(i, j + 1);
+        flows[2] = QueryFlow(i + 1, j);
+        flows[3] = QueryFlow(i + 1, j + 1);
+    }
+}
+
+void ImageWarpingField::GetImageWarpingFields(const double *u,
+                                              const double *v,
+                                              int num_queries,
+                                              double *warped_u,
+                                              double *warped_v) const {
+    const double *flow = flow_.data();
+    const double inv_anchor_step = 1.0 / anchor_step_;
+    const int stride = anchor_w_ * 2;
+    for (int k = 0; k < num_queries; k++) {
+        const int i = (int)(u[k] * inv_anchor_step);
+        const int j = (int)(v[k] * inv_anchor_step);
+        if (i >= 0 && i + 1 < anchor_w_ && j >= 0 && j + 1 < anchor_h_) {
+            const double p = (u[k] - i * anchor_step_) * inv_anchor_step;
+            const double q = (v[k] - j * anchor_step_) * inv_anchor_step;
+            const double w00 = (1 - p) * (1 - q);
+            const double w01 = (1 - p) * q;
+            const double w10 = p * (1 - q);
+            const double w11 = p * q;
+            const int idx0 = (i + j * anchor_w_) * 2;
+            const int idx1 = idx0 + stride;
+            warped_u[k] = w00 * flow[idx0] + w01 * flow[idx1] +
+                          w10 * flow[idx0 + 2] + w11 * flow[idx1 + 2];
+            warped_v[k] = w00 * flow[idx0 + 1] + w01 * flow[idx1 + 1] +
+                          w10 * flow[idx0 + 3] + w11 * flow[idx1 + 3];
+        } else {
+            const Eigen::Vector2d warped = GetImageWarpingField(u[k], v[k]);
+            warped_u[k] = warped(0);
+            warped_v[k] = warped(1);
+        }
+    }
+}
+
 bool ImageWarpingField::ConvertToJsonValue(Json::Value &value) const {
     value["class_name"] = "ImageWarpingField";
     value["version_major"] = 1;
@@ -42,6 +42,26 @@ public:
     Eigen::Vector2d QueryFlow(int i, int j) const;
     Eigen::Vector2d GetImageWarpingField(double u, double v) const;
 
+    /// \brief Fetches the four bilinear corner anchors (i, j), (i, j+1),
+    /// (i+1, j), (i+1, j+1) with a single range check.
+    ///
+    /// Equivalent to four QueryFlow() calls but indexes the flow vector
+    /// directly when the whole cell is inside the anchor grid; this is
+    /// the hot path of the non-rigid Jacobian assembly.
+    void QueryFlowGrid(int i, int j, Eigen::Vector2d flows[4]) const;
+
+    /// \brief Batched variant of GetImageWarpingField().
+    ///
+    /// Evaluates the bilinear warp of \p num_queries (u, v) query pairs
+    /// into \p warped_u / \p warped_v. Queries whose four anchors are
+    /// inside the grid take a flat auto-vectorizable path, the remainder
+    /// falls back to the scalar evaluation. The arrays must not alias.
+    void GetImageWarpingFields(const double *u,
+                               const double *v,
+                               int num_queries,
+                               double *warped_u,
+                               double *warped_v) const;
+
 public:
     bool ConvertToJsonValue(Json::Value &value) const override;
     bool ConvertFromJsonValue(const Json::Value &value) override;
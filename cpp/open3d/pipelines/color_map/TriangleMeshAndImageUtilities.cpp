@@ -70,11 +70,15 @@ CreateVertexAndImageVisibility(
     std::vector<std::vector<int>> visibility_vertex_to_image;
     visibility_vertex_to_image.resize(n_vertex);
 
+    // Iterating over vertices in the outer loop gives every thread
+    // enough work regardless of the number of cameras, and each thread
+    // writes only its own rows of visibility_vertex_to_image, so the
+    // ray tests need no synchronization at all.
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+    for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+        for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
             Eigen::Vector3d X = mesh.vertices_[vertex_id];
             float u, v, d;
             std::tie(u, v, d) =
@@ -103,11 +107,15 @@ CreateVertexAndImageVisibility(
                 depth_threshold_for_visibility_check) {
                 continue;
             }
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
+        }
+    }
+
+    // Invert the vertex-to-image map; vertex ids are visited in
+    // ascending order so every per-camera list ends up sorted.
+    for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+        for (int camera_id : visibility_vertex_to_image[vertex_id]) {
             visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
         }
     }
 
@@ -26,17 +26,88 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstring>
 #include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace pipelines {
 namespace integration {
 
+namespace {
+
+/// Decompresses a checkpointed voxel payload into \p volume. The payload
+/// is the concatenation of the tsdf, weight and (when colored) color
+/// arrays, lzf compressed unless compression did not shrink it, in which
+/// case it is stored verbatim and identified by its size.
+void InflateVolumeUnitPayload(const std::vector<char> &buffer,
+                              UniformTSDFVolume &volume) {
+    const size_t tsdf_bytes = volume.voxel_tsdf_.size() * sizeof(float);
+    const size_t weight_bytes = volume.voxel_weight_.size() * sizeof(float);
+    const size_t color_bytes =
+            volume.voxel_color_.size() * sizeof(Eigen::Vector3f);
+    const size_t raw_bytes = tsdf_bytes + weight_bytes + color_bytes;
+    std::vector<char> raw;
+    const char *payload = buffer.data();
+    if (buffer.size() != raw_bytes) {
+        raw.resize(raw_bytes);
+        if (lzf_decompress(buffer.data(), (unsigned int)buffer.size(),
+                           raw.data(), (unsigned int)raw_bytes) != raw_bytes) {
+            utility::LogError(
+                    "[ScalableTSDFVolume] Corrupted volume unit payload.");
+        }
+        payload = raw.data();
+    }
+    std::memcpy(volume.voxel_tsdf_.data(), payload, tsdf_bytes);
+    std::memcpy(volume.voxel_weight_.data(), payload + tsdf_bytes,
+                weight_bytes);
+    if (color_bytes > 0) {
+        std::memcpy(volume.voxel_color_.data(),
+                    payload + tsdf_bytes + weight_bytes, color_bytes);
+    }
+}
+
+/// Compresses the voxels of \p volume into the payload format that
+/// InflateVolumeUnitPayload() and the TSDF checkpoints consume: the
+/// concatenated tsdf, weight and (when colored) color arrays, lzf
+/// compressed unless compression does not shrink them, in which case
+/// they are stored verbatim and identified by the payload size.
+void DeflateVolumeUnitPayload(const UniformTSDFVolume &volume,
+                              std::vector<char> &buffer) {
+    const size_t tsdf_bytes = volume.voxel_tsdf_.size() * sizeof(float);
+    const size_t weight_bytes = volume.voxel_weight_.size() * sizeof(float);
+    const size_t color_bytes =
+            volume.voxel_color_.size() * sizeof(Eigen::Vector3f);
+    const size_t raw_bytes = tsdf_bytes + weight_bytes + color_bytes;
+    std::vector<char> raw(raw_bytes);
+    std::memcpy(raw.data(), volume.voxel_tsdf_.data(), tsdf_bytes);
+    std::memcpy(raw.data() + tsdf_bytes, volume.voxel_weight_.data(),
+                weight_bytes);
+    if (color_bytes > 0) {
+        std::memcpy(raw.data() + tsdf_bytes + weight_bytes,
+                    volume.voxel_color_.data(), color_bytes);
+    }
+    buffer.resize(raw_bytes);
+    unsigned int compressed_size =
+            lzf_compress(raw.data(), (unsigned int)raw_bytes, buffer.data(),
+                         (unsigned int)raw_bytes - 1);
+    if (compressed_size == 0) {
+        buffer.swap(raw);
+    } else {
+        buffer.resize(compressed_size);
+    }
+}
+
+}  // unnamed namespace
+
 ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
@@ -49,12 +120,25 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Reset() {
+    for (auto &unit : volume_units_) {
+        if (unit.second.volume_ && unit.second.volume_.use_count() == 1) {
+            volume_unit_pool_.push_back(std::move(unit.second.volume_));
+        }
+    }
+    volume_units_.clear();
+    pending_volume_units_.clear();
+    dirty_volume_units_.clear();
+    unit_meshes_.clear();
+    unit_last_access_.clear();
+    access_tick_ = 0;
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    utility::ProfilerZone zone("ScalableTSDFVolume::Integrate");
     if ((image.depth_.num_of_channels_ != 1) ||
         (image.depth_.bytes_per_channel_ != 4) ||
         (image.depth_.width_ != intrinsic.width_) ||
@@ -82,6 +166,13 @@ void ScalableTSDFVolume::Integrate(
             depth_sampling_stride_);
     std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
             touched_volume_units_;
+    std::vector<UniformTSDFVolume *> touched_volumes;
+    // The resident-unit budget is suspended until the frame has been
+    // integrated: opening one touched unit must not recycle another
+    // already collected in touched_volumes, and deflating a unit before
+    // its voxels are updated would drop this frame's contribution.
+    int resident_budget = max_resident_volume_units_;
+    max_resident_volume_units_ = 0;
     for (const auto &point : pointcloud->points_) {
         auto min_bound = LocateVolumeUnit(
                 point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
@@ -94,18 +185,104 @@ void ScalableTSDFVolume::Integrate(
                     if (touched_volume_units_.find(loc) ==
                         touched_volume_units_.end()) {
                         touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+                        dirty_volume_units_.insert(loc);
+                        touched_volumes.push_back(
+                                OpenVolumeUnit(loc).get());
                     }
                 }
             }
         }
     }
+    // The volume units update disjoint voxel blocks, so they can be
+    // integrated independently once they have all been opened.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    }
+    max_resident_volume_units_ = resident_budget;
+    EvictVolumeUnitsIfNeeded();
+}
+
+void ScalableTSDFVolume::Integrate(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_scale,
+        double depth_trunc) {
+    // Same as Integrate, but consumes raw uint16 depth; both the touched
+    // volume unit search and the per-unit voxel updates read the uint16
+    // image directly with the scale applied in-kernel.
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 2) ||
+        (image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.width_ != intrinsic.width_) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "[ScalableTSDFVolume::Integrate] Unsupported image format.");
+    }
+    auto depth2cameradistance =
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
+            image.depth_, intrinsic, extrinsic, depth_scale, depth_trunc,
+            depth_sampling_stride_);
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            touched_volume_units_;
+    std::vector<UniformTSDFVolume *> touched_volumes;
+    // See the float-depth overload: eviction is deferred until the frame
+    // has been integrated into every touched unit.
+    int resident_budget = max_resident_volume_units_;
+    max_resident_volume_units_ = 0;
+    for (const auto &point : pointcloud->points_) {
+        auto min_bound = LocateVolumeUnit(
+                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+        auto max_bound = LocateVolumeUnit(
+                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+        for (auto x = min_bound(0); x <= max_bound(0); x++) {
+            for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                    auto loc = Eigen::Vector3i(x, y, z);
+                    if (touched_volume_units_.find(loc) ==
+                        touched_volume_units_.end()) {
+                        touched_volume_units_.insert(loc);
+                        dirty_volume_units_.insert(loc);
+                        touched_volumes.push_back(
+                                OpenVolumeUnit(loc).get());
+                    }
+                }
+            }
+        }
+    }
+    // The volume units update disjoint voxel blocks, so they can be
+    // integrated independently once they have all been opened.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance,
+                depth_scale, depth_trunc);
+    }
+    max_resident_volume_units_ = resident_budget;
+    EvictVolumeUnitsIfNeeded();
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    InflatePendingVolumeUnits();
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
@@ -118,11 +295,10 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                 for (int y = 0; y < volume0.resolution_; y++) {
                     for (int z = 0; z < volume0.resolution_; z++) {
                         Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                        w0 = volume0.voxel_weight_[volume0.IndexOf(idx0)];
+                        f0 = volume0.voxel_tsdf_[volume0.IndexOf(idx0)];
                         if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
+                            c0 = volume0.voxel_color_[volume0.IndexOf(idx0)];
                         if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
                             Eigen::Vector3d p0 =
                                     Eigen::Vector3d(half_voxel_length +
@@ -139,15 +315,12 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                 p1(i) += voxel_length_;
                                 idx1(i) += 1;
                                 if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
+                                    int ind1 = volume0.IndexOf(idx1);
+                                    w1 = volume0.voxel_weight_[ind1];
+                                    f1 = volume0.voxel_tsdf_[ind1];
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
+                                        c1 = volume0.voxel_color_[ind1];
                                 } else {
                                     idx1(i) -= volume0.resolution_;
                                     index1(i) += 1;
@@ -158,18 +331,12 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                     } else {
                                         const auto &volume1 =
                                                 *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
+                                        int ind1 = volume1.IndexOf(idx1);
+                                        w1 = volume1.voxel_weight_[ind1];
+                                        f1 = volume1.voxel_tsdf_[ind1];
                                         if (color_type_ !=
                                             TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
+                                            c1 = volume1.voxel_color_[ind1];
                                     }
                                 }
                                 if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
@@ -209,156 +376,226 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
+    InflatePendingVolumeUnits();
+    auto full_mesh = std::make_shared<geometry::TriangleMesh>();
     std::unordered_map<
             Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
             std::equal_to<Eigen::Vector4i>,
             Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
             edgeindex_to_vertexindex;
-    int edge_to_index[12];
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
+            ExtractTriangleMeshUnit(unit.second, edgeindex_to_vertexindex,
+                                    *full_mesh);
+        }
+    }
+    return full_mesh;
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+ScalableTSDFVolume::ExtractTriangleMeshIncremental() {
+    InflatePendingVolumeUnits();
+    // A cube anchored in one unit reads voxels of up to seven higher
+    // neighbor units, so a changed unit also invalidates the cached
+    // meshes of its existing lower neighbors.
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            stale_units;
+    for (const auto &index : dirty_volume_units_) {
+        for (int x = 0; x <= 1; x++) {
+            for (int y = 0; y <= 1; y++) {
+                for (int z = 0; z <= 1; z++) {
+                    Eigen::Vector3i index1 =
+                            index - Eigen::Vector3i(x, y, z);
+                    if (volume_units_.count(index1) > 0) {
+                        stale_units.insert(index1);
+                    }
+                }
+            }
+        }
+    }
+    dirty_volume_units_.clear();
+    std::vector<std::pair<const VolumeUnit *, geometry::TriangleMesh *>>
+            stale_list;
+    for (const auto &index : stale_units) {
+        const auto &unit = volume_units_[index];
+        if (unit.volume_) {
+            auto &unit_mesh = unit_meshes_[index];
+            unit_mesh = std::make_shared<geometry::TriangleMesh>();
+            stale_list.push_back(std::make_pair(&unit, unit_mesh.get()));
+        }
+    }
+    // The stale units only read voxel data and write disjoint cached
+    // meshes, so they can be re-meshed independently.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)stale_list.size(); i++) {
+        std::unordered_map<
+                Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
+                std::equal_to<Eigen::Vector4i>,
+                Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
+                edgeindex_to_vertexindex;
+        ExtractTriangleMeshUnit(*stale_list[i].first, edgeindex_to_vertexindex,
+                                *stale_list[i].second);
+    }
+    auto full_mesh = std::make_shared<geometry::TriangleMesh>();
+    for (const auto &unit_mesh : unit_meshes_) {
+        const auto &part = *unit_mesh.second;
+        int vertex_offset = (int)full_mesh->vertices_.size();
+        full_mesh->vertices_.insert(full_mesh->vertices_.end(),
+                                    part.vertices_.begin(),
+                                    part.vertices_.end());
+        full_mesh->vertex_colors_.insert(full_mesh->vertex_colors_.end(),
+                                         part.vertex_colors_.begin(),
+                                         part.vertex_colors_.end());
+        for (const auto &triangle : part.triangles_) {
+            full_mesh->triangles_.push_back(
+                    triangle + Eigen::Vector3i::Constant(vertex_offset));
+        }
+    }
+    return full_mesh;
+}
+
+void ScalableTSDFVolume::ExtractTriangleMeshUnit(
+        const VolumeUnit &unit,
+        std::unordered_map<Eigen::Vector4i,
+                           int,
+                           utility::hash_eigen<Eigen::Vector4i>,
+                           std::equal_to<Eigen::Vector4i>,
+                           Eigen::aligned_allocator<
+                                   std::pair<const Eigen::Vector4i, int>>>
+                &edgeindex_to_vertexindex,
+        geometry::TriangleMesh &mesh) {
+    // implementation of marching cubes, based on
+    // http://paulbourke.net/geometry/polygonise/
+    double half_voxel_length = voxel_length_ * 0.5;
+    int edge_to_index[12];
+    const auto &volume0 = *unit.volume_;
+    const auto &index0 = unit.index_;
+    for (int x = 0; x < volume0.resolution_; x++) {
+        for (int y = 0; y < volume0.resolution_; y++) {
+            for (int z = 0; z < volume0.resolution_; z++) {
+                Eigen::Vector3i idx0(x, y, z);
+                int cube_index = 0;
+                float w[8];
+                float f[8];
+                Eigen::Vector3d c[8];
+                for (int i = 0; i < 8; i++) {
+                    Eigen::Vector3i index1 = index0;
+                    Eigen::Vector3i idx1 = idx0 + shift[i];
+                    if (idx1(0) < volume_unit_resolution_ &&
+                        idx1(1) < volume_unit_resolution_ &&
+                        idx1(2) < volume_unit_resolution_) {
+                        int ind1 = volume0.IndexOf(idx1);
+                        w[i] = volume0.voxel_weight_[ind1];
+                        f[i] = volume0.voxel_tsdf_[ind1];
+                        if (color_type_ == TSDFVolumeColorType::RGB8)
+                            c[i] = volume0.voxel_color_[ind1].cast<double>() /
+                                   255.0;
+                        else if (color_type_ ==
+                                 TSDFVolumeColorType::Gray32)
+                            c[i] = volume0.voxel_color_[ind1].cast<double>();
+                    } else {
+                        for (int j = 0; j < 3; j++) {
+                            if (idx1(j) >= volume_unit_resolution_) {
+                                idx1(j) -= volume_unit_resolution_;
+                                index1(j) += 1;
                             }
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
+                        auto unit_itr1 = volume_units_.find(index1);
+                        if (unit_itr1 == volume_units_.end()) {
+                            w[i] = 0.0f;
+                            f[i] = 0.0f;
+                        } else {
+                            const auto &volume1 =
+                                    *unit_itr1->second.volume_;
+                            int ind1 = volume1.IndexOf(idx1);
+                            w[i] = volume1.voxel_weight_[ind1];
+                            f[i] = volume1.voxel_tsdf_[ind1];
+                            if (color_type_ ==
+                                TSDFVolumeColorType::RGB8)
+                                c[i] = volume1.voxel_color_[ind1]
+                                               .cast<double>() /
+                                       255.0;
+                            else if (color_type_ ==
+                                     TSDFVolumeColorType::Gray32)
+                                c[i] = volume1.voxel_color_[ind1]
+                                               .cast<double>();
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
+                    }
+                    if (w[i] == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    } else {
+                        if (f[i] < 0.0f) {
+                            cube_index |= (1 << i);
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (edge_table[cube_index] & (1 << i)) {
+                        Eigen::Vector4i edge_index =
+                                Eigen::Vector4i(index0(0), index0(1),
+                                                index0(2), 0) *
+                                        volume_unit_resolution_ +
+                                Eigen::Vector4i(x, y, z, 0) +
+                                edge_shift[i];
+                        if (edgeindex_to_vertexindex.find(edge_index) ==
+                            edgeindex_to_vertexindex.end()) {
+                            edge_to_index[i] =
+                                    (int)mesh.vertices_.size();
+                            edgeindex_to_vertexindex[edge_index] =
+                                    (int)mesh.vertices_.size();
+                            Eigen::Vector3d pt(
+                                    half_voxel_length +
+                                            voxel_length_ *
+                                                    edge_index(0),
+                                    half_voxel_length +
+                                            voxel_length_ *
+                                                    edge_index(1),
+                                    half_voxel_length +
+                                            voxel_length_ *
+                                                    edge_index(2));
+                            double f0 = std::abs(
+                                    (double)f[edge_to_vert[i][0]]);
+                            double f1 = std::abs(
+                                    (double)f[edge_to_vert[i][1]]);
+                            pt(edge_index(3)) +=
+                                    f0 * voxel_length_ / (f0 + f1);
+                            mesh.vertices_.push_back(pt);
+                            if (color_type_ !=
+                                TSDFVolumeColorType::NoColor) {
+                                const auto &c0 = c[edge_to_vert[i][0]];
+                                const auto &c1 = c[edge_to_vert[i][1]];
+                                mesh.vertex_colors_.push_back(
+                                        (f1 * c0 + f0 * c1) /
+                                        (f0 + f1));
+                            }
+                        } else {
+                            edge_to_index[i] = edgeindex_to_vertexindex
+                                    [edge_index];
                         }
                     }
                 }
+                for (int i = 0; tri_table[cube_index][i] != -1;
+                     i += 3) {
+                    mesh.triangles_.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index]
+                                                   [i + 1]]));
+                }
             }
         }
     }
-    return mesh;
 }
 
 std::shared_ptr<geometry::PointCloud>
 ScalableTSDFVolume::ExtractVoxelPointCloud() {
+    InflatePendingVolumeUnits();
     auto voxel = std::make_shared<geometry::PointCloud>();
     for (auto &unit : volume_units_) {
         if (unit.second.volume_) {
@@ -369,18 +606,181 @@ ScalableTSDFVolume::ExtractVoxelPointCloud() {
     return voxel;
 }
 
+std::tuple<std::shared_ptr<geometry::Image>, std::shared_ptr<geometry::Image>>
+ScalableTSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                            const Eigen::Matrix4d &extrinsic,
+                            double depth_min /* = 0.1 */,
+                            double depth_max /* = 3.0 */) {
+    InflatePendingVolumeUnits();
+    auto depth_map = std::make_shared<geometry::Image>();
+    auto normal_map = std::make_shared<geometry::Image>();
+    depth_map->Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    normal_map->Prepare(intrinsic.width_, intrinsic.height_, 3, 4);
+    const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = camera_to_world.block<3, 1>(0, 3);
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    // Each pixel traces an independent ray and writes only its own depth
+    // and normal entries.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            // The ray is parametrized by camera z depth; advancing z by
+            // dz moves |dir| * dz meters along the ray.
+            Eigen::Vector3d dir =
+                    rotation *
+                    Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1.0);
+            const double dz_per_meter = 1.0 / dir.norm();
+            double z = depth_min;
+            double z_prev = 0.0;
+            float f_prev = 0.0f;
+            bool has_prev = false;
+            float depth_value = 0.0f;
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            while (z < depth_max) {
+                float f;
+                if (!SampleTSDF(origin + dir * z, f)) {
+                    // Unknown space cannot hide a surface closer than the
+                    // truncation distance.
+                    has_prev = false;
+                    z += sdf_trunc_ * dz_per_meter;
+                    continue;
+                }
+                if (f <= 0.0f) {
+                    // Entering the surface from unknown space gives no
+                    // bracketing sample to interpolate; treat as a miss.
+                    if (has_prev) {
+                        double z_hit = z_prev + (z - z_prev) * f_prev /
+                                                        (f_prev - f);
+                        depth_value = (float)z_hit;
+                        normal = GetNormalAt(origin + dir * z_hit);
+                    }
+                    break;
+                }
+                z_prev = z;
+                f_prev = f;
+                has_prev = true;
+                z += std::max((double)f * sdf_trunc_, (double)voxel_length_) *
+                     dz_per_meter;
+            }
+            *depth_map->PointerAt<float>(u, v) = depth_value;
+            for (int c = 0; c < 3; c++) {
+                *normal_map->PointerAt<float>(u, v, c) = (float)normal(c);
+            }
+        }
+    }
+    return std::make_tuple(depth_map, normal_map);
+}
+
 std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
     if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
-                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
+        if (!volume_unit_pool_.empty()) {
+            unit.volume_ = std::move(volume_unit_pool_.back());
+            volume_unit_pool_.pop_back();
+            unit.volume_->origin_ =
+                    index.cast<double>() * volume_unit_length_;
+            unit.volume_->Reset();
+        } else {
+            unit.volume_.reset(new UniformTSDFVolume(
+                    volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
+                    color_type_, index.cast<double>() * volume_unit_length_));
+        }
         unit.index_ = index;
+        auto pending_itr = pending_volume_units_.find(index);
+        if (pending_itr != pending_volume_units_.end()) {
+            InflateVolumeUnitPayload(pending_itr->second, *unit.volume_);
+            pending_volume_units_.erase(pending_itr);
+            dirty_volume_units_.insert(index);
+        }
+        unit_last_access_[index] = ++access_tick_;
+        EvictVolumeUnitsIfNeeded();
+        return volume_units_[index].volume_;
     }
+    unit_last_access_[index] = ++access_tick_;
     return unit.volume_;
 }
 
+void ScalableTSDFVolume::EvictVolumeUnitsIfNeeded() {
+    if (max_resident_volume_units_ <= 0 ||
+        (int)volume_units_.size() <= max_resident_volume_units_) {
+        return;
+    }
+    // Order the resident units by their last access and compress the
+    // least recently used ones down to the budget.
+    std::vector<std::pair<std::uint64_t, Eigen::Vector3i>> order;
+    order.reserve(volume_units_.size());
+    for (auto &unit : volume_units_) {
+        if (!unit.second.volume_) {
+            continue;
+        }
+        auto tick_itr = unit_last_access_.find(unit.first);
+        order.push_back(std::make_pair(
+                tick_itr == unit_last_access_.end() ? 0 : tick_itr->second,
+                unit.first));
+    }
+    int num_evictions =
+            (int)volume_units_.size() - max_resident_volume_units_;
+    if (num_evictions > (int)order.size()) {
+        num_evictions = (int)order.size();
+    }
+    std::partial_sort(order.begin(), order.begin() + num_evictions,
+                      order.end(),
+                      [](const std::pair<std::uint64_t, Eigen::Vector3i> &lhs,
+                         const std::pair<std::uint64_t, Eigen::Vector3i> &rhs) {
+                          return lhs.first < rhs.first;
+                      });
+    for (int i = 0; i < num_evictions; i++) {
+        const Eigen::Vector3i &index = order[i].second;
+        auto unit_itr = volume_units_.find(index);
+        DeflateVolumeUnitPayload(*unit_itr->second.volume_,
+                                 pending_volume_units_[index]);
+        if (unit_itr->second.volume_.use_count() == 1) {
+            volume_unit_pool_.push_back(std::move(unit_itr->second.volume_));
+        }
+        volume_units_.erase(unit_itr);
+        unit_last_access_.erase(index);
+    }
+}
+
+void ScalableTSDFVolume::InflatePendingVolumeUnits() {
+    if (pending_volume_units_.empty()) {
+        return;
+    }
+    // The resident-unit budget is suspended while materializing:
+    // extraction needs every unit resident at once, and evicting during
+    // this loop would recycle voxel storage the loop is about to
+    // decompress into.
+    int resident_budget = max_resident_volume_units_;
+    max_resident_volume_units_ = 0;
+    std::vector<std::pair<Eigen::Vector3i, std::vector<char>>> buffers;
+    buffers.reserve(pending_volume_units_.size());
+    for (auto &pending : pending_volume_units_) {
+        buffers.push_back(
+                std::make_pair(pending.first, std::move(pending.second)));
+    }
+    pending_volume_units_.clear();
+    std::vector<UniformTSDFVolume *> volumes(buffers.size());
+    for (size_t i = 0; i < buffers.size(); i++) {
+        volumes[i] = OpenVolumeUnit(buffers[i].first).get();
+        dirty_volume_units_.insert(buffers[i].first);
+    }
+    // The units decompress into disjoint voxel storage.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)buffers.size(); i++) {
+        InflateVolumeUnitPayload(buffers[i].second, *volumes[i]);
+    }
+    max_resident_volume_units_ = resident_budget;
+}
+
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -421,7 +821,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = volume0.voxel_tsdf_[volume0.IndexOf(idx1)];
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -434,7 +834,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                 f[i] = 0.0f;
             } else {
                 const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
+                f[i] = volume1.voxel_tsdf_[volume1.IndexOf(idx1)];
             }
         }
     }
@@ -444,6 +844,66 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                    r(1) * ((1 - r(2)) * f[2] + r(2) * f[6]));
 }
 
+bool ScalableTSDFVolume::SampleTSDF(const Eigen::Vector3d &p, float &tsdf) {
+    Eigen::Vector3d p_locate =
+            p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
+    Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
+    auto unit_itr = volume_units_.find(index0);
+    if (unit_itr == volume_units_.end() || !unit_itr->second.volume_) {
+        return false;
+    }
+    const auto &volume0 = *unit_itr->second.volume_;
+    Eigen::Vector3i idx0;
+    Eigen::Vector3d p_grid =
+            (p_locate - index0.cast<double>() * volume_unit_length_) /
+            voxel_length_;
+    for (int i = 0; i < 3; i++) {
+        idx0(i) = (int)std::floor(p_grid(i));
+        if (idx0(i) < 0) idx0(i) = 0;
+        if (idx0(i) >= volume_unit_resolution_)
+            idx0(i) = volume_unit_resolution_ - 1;
+    }
+    Eigen::Vector3d r = p_grid - idx0.cast<double>();
+    float f[8];
+    for (int i = 0; i < 8; i++) {
+        Eigen::Vector3i index1 = index0;
+        Eigen::Vector3i idx1 = idx0 + shift[i];
+        if (idx1(0) < volume_unit_resolution_ &&
+            idx1(1) < volume_unit_resolution_ &&
+            idx1(2) < volume_unit_resolution_) {
+            int ind1 = volume0.IndexOf(idx1);
+            if (volume0.voxel_weight_[ind1] == 0.0f) {
+                return false;
+            }
+            f[i] = volume0.voxel_tsdf_[ind1];
+        } else {
+            for (int j = 0; j < 3; j++) {
+                if (idx1(j) >= volume_unit_resolution_) {
+                    idx1(j) -= volume_unit_resolution_;
+                    index1(j) += 1;
+                }
+            }
+            auto unit_itr1 = volume_units_.find(index1);
+            if (unit_itr1 == volume_units_.end() ||
+                !unit_itr1->second.volume_) {
+                return false;
+            }
+            const auto &volume1 = *unit_itr1->second.volume_;
+            int ind1 = volume1.IndexOf(idx1);
+            if (volume1.voxel_weight_[ind1] == 0.0f) {
+                return false;
+            }
+            f[i] = volume1.voxel_tsdf_[ind1];
+        }
+    }
+    tsdf = (float)((1 - r(0)) *
+                           ((1 - r(1)) * ((1 - r(2)) * f[0] + r(2) * f[4]) +
+                            r(1) * ((1 - r(2)) * f[3] + r(2) * f[7])) +
+                   r(0) * ((1 - r(1)) * ((1 - r(2)) * f[1] + r(2) * f[5]) +
+                           r(1) * ((1 - r(2)) * f[2] + r(2) * f[6])));
+    return true;
+}
+
 }  // namespace integration
 }  // namespace pipelines
 
@@ -26,8 +26,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "open3d/pipelines/integration/TSDFVolume.h"
 #include "open3d/utility/Helper.h"
@@ -80,11 +84,51 @@ public:
     void Integrate(const geometry::RGBDImage &image,
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
+
+    /// \brief Integrate an RGBD frame whose depth channel is raw uint16.
+    ///
+    /// The depth scale is applied per sample inside the volume unit update
+    /// loops and samples at or beyond \p depth_trunc are treated as
+    /// missing, so no intermediate float depth image is created.
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic,
+                   double depth_scale,
+                   double depth_trunc);
+
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+
+    /// \brief Extract a triangle mesh, re-meshing only the volume units
+    /// modified by Integrate() since the previous call.
+    ///
+    /// The per-unit meshes are cached and stitched into the returned mesh,
+    /// so repeated calls during an ongoing reconstruction cost time
+    /// proportional to the newly integrated region instead of the whole
+    /// volume. Unlike ExtractTriangleMesh(), vertices on unit boundaries
+    /// are duplicated between adjacent units.
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshIncremental();
     /// Debug function to extract the voxel data into a point cloud.
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
 
+    /// \brief Render depth and normal maps of the volume seen from the
+    /// given view by sphere tracing the TSDF.
+    ///
+    /// Rays step by the truncation distance through space without
+    /// observed voxels and by the sampled distance estimate otherwise,
+    /// so rendering a model view for frame-to-model tracking does not
+    /// require extracting a point cloud or mesh first. The depth map is
+    /// a single channel float image in meters (z depth, like an input
+    /// depth frame); the normal map is a three channel float image with
+    /// normals in world coordinates. Pixels whose rays hit no surface
+    /// are zero in both maps.
+    std::tuple<std::shared_ptr<geometry::Image>,
+               std::shared_ptr<geometry::Image>>
+    RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min = 0.1,
+            double depth_max = 3.0);
+
 public:
     int volume_unit_resolution_;
     double volume_unit_length_;
@@ -98,6 +142,31 @@ public:
                        utility::hash_eigen<Eigen::Vector3i>>
             volume_units_;
 
+    /// Volume units restored from a checkpoint but not decompressed yet.
+    ///
+    /// io::ReadScalableTSDFVolume() fills this map with the compressed
+    /// per-unit voxel payloads; a unit is inflated into volume_units_ the
+    /// first time OpenVolumeUnit() touches it, and the extraction
+    /// functions inflate the remainder in bulk. Restoring a checkpoint
+    /// therefore only pays decompression for the units that are actually
+    /// accessed afterwards.
+    std::unordered_map<Eigen::Vector3i,
+                       std::vector<char>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            pending_volume_units_;
+
+    /// \brief Maximum number of volume units kept resident in memory,
+    /// 0 keeps every unit resident.
+    ///
+    /// When the budget is exceeded, OpenVolumeUnit() evicts the least
+    /// recently used units: their voxels are lzf compressed into
+    /// pending_volume_units_ (the representation the TSDF checkpoints
+    /// use) and their voxel storage is recycled. Evicted units are
+    /// transparently restored when revisited, so continuous operation
+    /// stays memory bounded without losing old space. The full-volume
+    /// extraction functions still materialize every unit temporarily.
+    int max_resident_volume_units_ = 0;
+
 private:
     Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
@@ -108,9 +177,61 @@ private:
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
+    /// Inflates all pending volume units; the full-volume extraction
+    /// functions need every unit materialized.
+    void InflatePendingVolumeUnits();
+
+    /// Compresses the least recently used volume units into
+    /// pending_volume_units_ until at most max_resident_volume_units_
+    /// remain resident; no-op when the budget is 0 or not exceeded.
+    void EvictVolumeUnitsIfNeeded();
+
+    /// Runs marching cubes over the cubes anchored in \p unit, appending
+    /// the result to \p mesh. \p edgeindex_to_vertexindex deduplicates
+    /// vertices among the cubes sharing it.
+    void ExtractTriangleMeshUnit(
+            const VolumeUnit &unit,
+            std::unordered_map<Eigen::Vector4i,
+                               int,
+                               utility::hash_eigen<Eigen::Vector4i>,
+                               std::equal_to<Eigen::Vector4i>,
+                               Eigen::aligned_allocator<
+                                       std::pair<const Eigen::Vector4i, int>>>
+                    &edgeindex_to_vertexindex,
+            geometry::TriangleMesh &mesh);
+
+    /// Volume units whose voxels changed since the last incremental mesh
+    /// extraction, and the cached per-unit meshes stitched by
+    /// ExtractTriangleMeshIncremental().
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            dirty_volume_units_;
+    std::unordered_map<Eigen::Vector3i,
+                       std::shared_ptr<geometry::TriangleMesh>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            unit_meshes_;
+
+    /// Volume units released by Reset() or evicted by the resident-unit
+    /// budget are kept here and recycled by OpenVolumeUnit() so that
+    /// repeated integrations reuse the voxel storage instead of
+    /// reallocating it.
+    std::vector<std::shared_ptr<UniformTSDFVolume>> volume_unit_pool_;
+
+    /// Monotonic access counter and per-unit last-access ticks backing
+    /// the LRU policy of EvictVolumeUnitsIfNeeded().
+    std::uint64_t access_tick_ = 0;
+    std::unordered_map<Eigen::Vector3i,
+                       std::uint64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            unit_last_access_;
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+    /// Trilinear TSDF sample that, unlike GetTSDFAt(), reports whether
+    /// all eight contributing voxels have been observed, so that ray
+    /// casting can distinguish the surface from unknown space.
+    bool SampleTSDF(const Eigen::Vector3d &p, float &tsdf);
 };
 
 }  // namespace integration
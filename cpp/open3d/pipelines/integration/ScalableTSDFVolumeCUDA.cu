@@ -0,0 +1,966 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/ScalableTSDFVolumeCUDA.h"
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <climits>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/integration/MarchingCubesConst.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+namespace {
+
+// An unused block key; blocks at this coordinate cannot be represented.
+constexpr int kEmptyKey = INT_MIN;
+constexpr int kThreadsPerBlock = 128;
+
+// Marching cubes tables from MarchingCubesConst.h in device constant
+// memory, with the Eigen shift tables flattened to plain ints.
+__constant__ int tri_table_device[256][16];
+__constant__ int shift_device[8][3];
+__constant__ int edge_shift_device[12][4];
+__constant__ int edge_to_vert_device[12][2];
+
+struct HashTable {
+    int3 *keys;     // block_capacity entries, kEmptyKey when unused
+    float *tsdf;    // block_capacity * resolution^3
+    float *weight;  // block_capacity * resolution^3
+    float3 *color;  // block_capacity * resolution^3, nullptr when NoColor
+    int capacity;
+    int resolution;
+};
+
+struct FrameParams {
+    float fx, fy, cx, cy;
+    int width, height;
+    // world-to-camera
+    float extrinsic[12];
+    // camera-to-world
+    float extrinsic_inv[12];
+};
+
+__device__ inline int3 MakeKey(int x, int y, int z) {
+    return make_int3(x, y, z);
+}
+
+__device__ inline bool KeyEquals(const int3 &a, const int3 &b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+__device__ inline int HashOf(const int3 &key, int capacity) {
+    // Spatial hash of Teschner et al. 2003.
+    int h = (key.x * 73856093) ^ (key.y * 19349669) ^ (key.z * 83492791);
+    h %= capacity;
+    return h < 0 ? h + capacity : h;
+}
+
+/// Returns the slot of \p key, or -1 when it is not allocated.
+__device__ int HashLookup(const HashTable table, const int3 &key) {
+    int slot = HashOf(key, table.capacity);
+    for (int probe = 0; probe < table.capacity; probe++) {
+        int3 stored = table.keys[slot];
+        if (stored.x == kEmptyKey) {
+            return -1;
+        }
+        if (KeyEquals(stored, key)) {
+            return slot;
+        }
+        slot = slot + 1 == table.capacity ? 0 : slot + 1;
+    }
+    return -1;
+}
+
+/// Allocates \p key if necessary and returns its slot, or -1 when the
+/// table is full. Thread-safe; concurrent inserts of the same key yield
+/// the same slot.
+__device__ int HashInsert(HashTable table, const int3 &key) {
+    int slot = HashOf(key, table.capacity);
+    for (int probe = 0; probe < table.capacity; probe++) {
+        int prev = atomicCAS(&table.keys[slot].x, kEmptyKey, key.x);
+        if (prev == kEmptyKey) {
+            // This thread owns the slot; publish the remaining
+            // coordinates. Readers treat y == kEmptyKey as "being
+            // written" and spin below.
+            table.keys[slot].z = key.z;
+            __threadfence();
+            table.keys[slot].y = key.y;
+            return slot;
+        }
+        if (prev == key.x) {
+            // Possibly our key; wait until the owner published y/z.
+            int y;
+            do {
+                y = ((volatile int3 *)table.keys)[slot].y;
+            } while (y == kEmptyKey);
+            __threadfence();
+            if (KeyEquals(table.keys[slot], key)) {
+                return slot;
+            }
+        }
+        slot = slot + 1 == table.capacity ? 0 : slot + 1;
+    }
+    return -1;
+}
+
+__device__ inline int VoxelIndexOf(int x, int y, int z, int resolution) {
+    return (x * resolution + y) * resolution + z;
+}
+
+__device__ inline float3 Transform12(const float m[12], const float3 &p) {
+    return make_float3(m[0] * p.x + m[1] * p.y + m[2] * p.z + m[3],
+                       m[4] * p.x + m[5] * p.y + m[6] * p.z + m[7],
+                       m[8] * p.x + m[9] * p.y + m[10] * p.z + m[11]);
+}
+
+/// Reads the TSDF at a world-space voxel coordinate across block borders.
+/// Returns false when the voxel is unallocated or unobserved.
+__device__ bool SampleVoxel(const HashTable table,
+                            int x,
+                            int y,
+                            int z,
+                            float *tsdf,
+                            float *weight,
+                            float3 *color) {
+    const int r = table.resolution;
+    int3 key = MakeKey(x >= 0 ? x / r : (x + 1) / r - 1,
+                       y >= 0 ? y / r : (y + 1) / r - 1,
+                       z >= 0 ? z / r : (z + 1) / r - 1);
+    int slot = HashLookup(table, key);
+    if (slot < 0) {
+        return false;
+    }
+    int vx = x - key.x * r;
+    int vy = y - key.y * r;
+    int vz = z - key.z * r;
+    int ind = slot * r * r * r + VoxelIndexOf(vx, vy, vz, r);
+    *tsdf = table.tsdf[ind];
+    *weight = table.weight[ind];
+    if (color != nullptr && table.color != nullptr) {
+        *color = table.color[ind];
+    }
+    return *weight > 0.0f;
+}
+
+/// Pass 1 of Integrate: allocate every block whose voxels can fall inside
+/// the truncation band of an observed depth sample.
+__global__ void AllocateBlocksKernel(HashTable table,
+                                     const float *depth,
+                                     FrameParams params,
+                                     float sdf_trunc,
+                                     float volume_unit_length,
+                                     int stride,
+                                     int *error_flag) {
+    int u = (blockIdx.x * blockDim.x + threadIdx.x) * stride;
+    int v = (blockIdx.y * blockDim.y + threadIdx.y) * stride;
+    if (u >= params.width || v >= params.height) {
+        return;
+    }
+    float d = depth[v * params.width + u];
+    if (d <= 0.0f) {
+        return;
+    }
+    float3 pt_camera = make_float3((u - params.cx) * d / params.fx,
+                                   (v - params.cy) * d / params.fy, d);
+    float3 pt = Transform12(params.extrinsic_inv, pt_camera);
+    int3 lo = MakeKey((int)floorf((pt.x - sdf_trunc) / volume_unit_length),
+                      (int)floorf((pt.y - sdf_trunc) / volume_unit_length),
+                      (int)floorf((pt.z - sdf_trunc) / volume_unit_length));
+    int3 hi = MakeKey((int)floorf((pt.x + sdf_trunc) / volume_unit_length),
+                      (int)floorf((pt.y + sdf_trunc) / volume_unit_length),
+                      (int)floorf((pt.z + sdf_trunc) / volume_unit_length));
+    for (int x = lo.x; x <= hi.x; x++) {
+        for (int y = lo.y; y <= hi.y; y++) {
+            for (int z = lo.z; z <= hi.z; z++) {
+                if (HashInsert(table, MakeKey(x, y, z)) < 0) {
+                    *error_flag = 1;
+                }
+            }
+        }
+    }
+}
+
+/// Pass 2 of Integrate: collect the allocated blocks visible in the
+/// current frustum.
+__global__ void CollectVisibleBlocksKernel(HashTable table,
+                                           FrameParams params,
+                                           float volume_unit_length,
+                                           float depth_margin,
+                                           int *visible_slots,
+                                           int *visible_count) {
+    int slot = blockIdx.x * blockDim.x + threadIdx.x;
+    if (slot >= table.capacity || table.keys[slot].x == kEmptyKey) {
+        return;
+    }
+    const int3 key = table.keys[slot];
+    float3 center = make_float3((key.x + 0.5f) * volume_unit_length,
+                                (key.y + 0.5f) * volume_unit_length,
+                                (key.z + 0.5f) * volume_unit_length);
+    float3 pt_camera = Transform12(params.extrinsic, center);
+    // Conservative bound: a block is visible when its bounding sphere
+    // intersects the frustum.
+    float radius = 0.87f * volume_unit_length + depth_margin;
+    if (pt_camera.z + radius <= 0.0f) {
+        return;
+    }
+    float z = fmaxf(pt_camera.z, 1e-6f);
+    float u = pt_camera.x * params.fx / z + params.cx;
+    float v = pt_camera.y * params.fy / z + params.cy;
+    float pixel_radius = radius * fmaxf(params.fx, params.fy) / z;
+    if (u + pixel_radius < 0.0f || u - pixel_radius >= params.width ||
+        v + pixel_radius < 0.0f || v - pixel_radius >= params.height) {
+        return;
+    }
+    visible_slots[atomicAdd(visible_count, 1)] = slot;
+}
+
+/// Pass 3 of Integrate: fuse the frame into every visible block; one CUDA
+/// block per voxel block.
+__global__ void IntegrateKernel(HashTable table,
+                                const float *depth,
+                                const uint8_t *color_rgb8,
+                                const float *color_gray32,
+                                FrameParams params,
+                                float voxel_length,
+                                float sdf_trunc,
+                                const int *visible_slots) {
+    int slot = visible_slots[blockIdx.x];
+    const int r = table.resolution;
+    const int voxels_per_block = r * r * r;
+    const int3 key = table.keys[slot];
+    for (int i = threadIdx.x; i < voxels_per_block; i += blockDim.x) {
+        int x = i / (r * r);
+        int y = (i / r) % r;
+        int z = i % r;
+        float3 pt = make_float3(
+                (key.x * r + x + 0.5f) * voxel_length,
+                (key.y * r + y + 0.5f) * voxel_length,
+                (key.z * r + z + 0.5f) * voxel_length);
+        float3 pt_camera = Transform12(params.extrinsic, pt);
+        if (pt_camera.z <= 0.0f) {
+            continue;
+        }
+        float u_f = pt_camera.x * params.fx / pt_camera.z + params.cx + 0.5f;
+        float v_f = pt_camera.y * params.fy / pt_camera.z + params.cy + 0.5f;
+        if (u_f < 0.0001f || u_f >= params.width - 0.0001f || v_f < 0.0001f ||
+            v_f >= params.height - 0.0001f) {
+            continue;
+        }
+        int u = (int)u_f;
+        int v = (int)v_f;
+        float d = depth[v * params.width + u];
+        if (d <= 0.0f) {
+            continue;
+        }
+        // Scale the projective distance to a distance along the ray, as
+        // CreateDepthToCameraDistanceMultiplierFloatImage does on the CPU.
+        float xc = (u - params.cx) / params.fx;
+        float yc = (v - params.cy) / params.fy;
+        float multiplier = sqrtf(xc * xc + yc * yc + 1.0f);
+        float sdf = (d - pt_camera.z) * multiplier;
+        if (sdf <= -sdf_trunc) {
+            continue;
+        }
+        float tsdf = fminf(1.0f, sdf / sdf_trunc);
+        int ind = slot * voxels_per_block + i;
+        float weight = table.weight[ind];
+        float new_weight_inv = 1.0f / (weight + 1.0f);
+        table.tsdf[ind] =
+                (table.tsdf[ind] * weight + tsdf) * new_weight_inv;
+        if (table.color != nullptr) {
+            float3 c = table.color[ind];
+            if (color_rgb8 != nullptr) {
+                const uint8_t *rgb = color_rgb8 + (v * params.width + u) * 3;
+                c = make_float3((c.x * weight + rgb[0]) * new_weight_inv,
+                                (c.y * weight + rgb[1]) * new_weight_inv,
+                                (c.z * weight + rgb[2]) * new_weight_inv);
+            } else if (color_gray32 != nullptr) {
+                float intensity = color_gray32[v * params.width + u];
+                c = make_float3((c.x * weight + intensity) * new_weight_inv,
+                                (c.y * weight + intensity) * new_weight_inv,
+                                (c.z * weight + intensity) * new_weight_inv);
+            }
+            table.color[ind] = c;
+        }
+        table.weight[ind] = weight + 1.0f;
+    }
+}
+
+__global__ void RayCastKernel(HashTable table,
+                              float *depth_out,
+                              FrameParams params,
+                              float voxel_length,
+                              float sdf_trunc,
+                              float depth_max) {
+    int u = blockIdx.x * blockDim.x + threadIdx.x;
+    int v = blockIdx.y * blockDim.y + threadIdx.y;
+    if (u >= params.width || v >= params.height) {
+        return;
+    }
+    float3 dir_camera = make_float3((u - params.cx) / params.fx,
+                                    (v - params.cy) / params.fy, 1.0f);
+    float norm = sqrtf(dir_camera.x * dir_camera.x +
+                       dir_camera.y * dir_camera.y + 1.0f);
+    float3 origin = make_float3(params.extrinsic_inv[3],
+                                params.extrinsic_inv[7],
+                                params.extrinsic_inv[11]);
+    // Rotate only; the ray direction is translation free.
+    float3 dir = make_float3(params.extrinsic_inv[0] * dir_camera.x +
+                                     params.extrinsic_inv[1] * dir_camera.y +
+                                     params.extrinsic_inv[2],
+                             params.extrinsic_inv[4] * dir_camera.x +
+                                     params.extrinsic_inv[5] * dir_camera.y +
+                                     params.extrinsic_inv[6],
+                             params.extrinsic_inv[8] * dir_camera.x +
+                                     params.extrinsic_inv[9] * dir_camera.y +
+                                     params.extrinsic_inv[10]);
+    dir = make_float3(dir.x / norm, dir.y / norm, dir.z / norm);
+    const float t_max = depth_max * norm;
+    float tsdf_prev = 0.0f;
+    float t_prev = 0.0f;
+    bool have_prev = false;
+    float result = 0.0f;
+    float t = voxel_length;
+    while (t < t_max) {
+        float3 p = make_float3(origin.x + t * dir.x, origin.y + t * dir.y,
+                               origin.z + t * dir.z);
+        int x = (int)floorf(p.x / voxel_length - 0.5f);
+        int y = (int)floorf(p.y / voxel_length - 0.5f);
+        int z = (int)floorf(p.z / voxel_length - 0.5f);
+        float tsdf, weight;
+        if (!SampleVoxel(table, x, y, z, &tsdf, &weight, nullptr)) {
+            // Skip empty space a truncation band at a time.
+            have_prev = false;
+            t += sdf_trunc;
+            continue;
+        }
+        if (have_prev && tsdf_prev > 0.0f && tsdf <= 0.0f) {
+            // Linear interpolation of the zero crossing.
+            float t_hit =
+                    t_prev + (t - t_prev) * tsdf_prev / (tsdf_prev - tsdf);
+            result = t_hit / norm;
+            break;
+        }
+        tsdf_prev = tsdf;
+        t_prev = t;
+        have_prev = true;
+        t += fmaxf(tsdf * sdf_trunc, voxel_length);
+    }
+    depth_out[v * params.width + u] = result;
+}
+
+/// Marching cubes, pass 1: triangles per allocated block.
+__global__ void MeshCountKernel(HashTable table, int *block_triangle_count) {
+    int slot = blockIdx.x;
+    const int r = table.resolution;
+    if (table.keys[slot].x == kEmptyKey) {
+        if (threadIdx.x == 0) {
+            block_triangle_count[slot] = 0;
+        }
+        return;
+    }
+    const int3 key = table.keys[slot];
+    __shared__ int count;
+    if (threadIdx.x == 0) {
+        count = 0;
+    }
+    __syncthreads();
+    const int cubes = r * r * r;
+    for (int i = threadIdx.x; i < cubes; i += blockDim.x) {
+        int x = i / (r * r);
+        int y = (i / r) % r;
+        int z = i % r;
+        int cube_index = 0;
+        for (int c = 0; c < 8; c++) {
+            float tsdf, weight;
+            if (!SampleVoxel(table, key.x * r + x + shift_device[c][0],
+                             key.y * r + y + shift_device[c][1],
+                             key.z * r + z + shift_device[c][2], &tsdf,
+                             &weight, nullptr)) {
+                cube_index = 0;
+                break;
+            }
+            if (tsdf < 0.0f) {
+                cube_index |= (1 << c);
+            }
+        }
+        if (cube_index == 0 || cube_index == 255) {
+            continue;
+        }
+        int n = 0;
+        while (tri_table_device[cube_index][n] != -1) {
+            n += 3;
+        }
+        atomicAdd(&count, n / 3);
+    }
+    __syncthreads();
+    if (threadIdx.x == 0) {
+        block_triangle_count[slot] = count;
+    }
+}
+
+/// Marching cubes, pass 2: emit triangles at the precomputed offsets.
+/// Vertices are emitted per triangle without deduplication.
+__global__ void MeshEmitKernel(HashTable table,
+                               const int *block_triangle_offset,
+                               float3 *vertices,
+                               float3 *vertex_colors,
+                               float voxel_length,
+                               int *block_cursor) {
+    int slot = blockIdx.x;
+    const int r = table.resolution;
+    if (table.keys[slot].x == kEmptyKey) {
+        return;
+    }
+    const int3 key = table.keys[slot];
+    const int cubes = r * r * r;
+    for (int i = threadIdx.x; i < cubes; i += blockDim.x) {
+        int x = i / (r * r);
+        int y = (i / r) % r;
+        int z = i % r;
+        int cube_index = 0;
+        float f[8];
+        float3 c[8];
+        for (int v = 0; v < 8; v++) {
+            float weight;
+            float3 color = make_float3(0.0f, 0.0f, 0.0f);
+            if (!SampleVoxel(table, key.x * r + x + shift_device[v][0],
+                             key.y * r + y + shift_device[v][1],
+                             key.z * r + z + shift_device[v][2], &f[v],
+                             &weight, &color)) {
+                cube_index = 0;
+                break;
+            }
+            c[v] = color;
+            if (f[v] < 0.0f) {
+                cube_index |= (1 << v);
+            }
+        }
+        if (cube_index == 0 || cube_index == 255) {
+            continue;
+        }
+        for (int tri = 0; tri_table_device[cube_index][tri] != -1; tri += 3) {
+            int out = block_triangle_offset[slot] +
+                      atomicAdd(&block_cursor[slot], 1);
+            for (int corner = 0; corner < 3; corner++) {
+                // Triangle winding matches the CPU extraction: 0, 2, 1.
+                int e = tri_table_device[cube_index]
+                                        [tri + (corner == 0 ? 0
+                                                            : 3 - corner)];
+                int v0 = edge_to_vert_device[e][0];
+                int v1 = edge_to_vert_device[e][1];
+                float f0 = fabsf(f[v0]);
+                float f1 = fabsf(f[v1]);
+                float3 pt = make_float3(
+                        (key.x * r + x + edge_shift_device[e][0] + 0.5f) *
+                                voxel_length,
+                        (key.y * r + y + edge_shift_device[e][1] + 0.5f) *
+                                voxel_length,
+                        (key.z * r + z + edge_shift_device[e][2] + 0.5f) *
+                                voxel_length);
+                float offset = f0 * voxel_length / (f0 + f1);
+                int axis = edge_shift_device[e][3];
+                if (axis == 0) {
+                    pt.x += offset;
+                } else if (axis == 1) {
+                    pt.y += offset;
+                } else {
+                    pt.z += offset;
+                }
+                vertices[out * 3 + corner] = pt;
+                if (vertex_colors != nullptr) {
+                    float3 c0 = c[v0];
+                    float3 c1 = c[v1];
+                    float inv = 1.0f / (f0 + f1);
+                    vertex_colors[out * 3 + corner] = make_float3(
+                            (f1 * c0.x + f0 * c1.x) * inv,
+                            (f1 * c0.y + f0 * c1.y) * inv,
+                            (f1 * c0.z + f0 * c1.z) * inv);
+                }
+            }
+        }
+    }
+}
+
+/// Surface points, pass 1 and 2 in one kernel: appends one point per
+/// zero crossing along +x/+y/+z, like the CPU ExtractPointCloud.
+__global__ void SurfacePointsKernel(HashTable table,
+                                    float voxel_length,
+                                    float3 *points,
+                                    float3 *colors,
+                                    int *count,
+                                    int point_capacity) {
+    int slot = blockIdx.x;
+    const int r = table.resolution;
+    if (table.keys[slot].x == kEmptyKey) {
+        return;
+    }
+    const int3 key = table.keys[slot];
+    const int voxels = r * r * r;
+    for (int i = threadIdx.x; i < voxels; i += blockDim.x) {
+        int x = key.x * r + i / (r * r);
+        int y = key.y * r + (i / r) % r;
+        int z = key.z * r + i % r;
+        float f0, w0;
+        float3 c0 = make_float3(0.0f, 0.0f, 0.0f);
+        if (!SampleVoxel(table, x, y, z, &f0, &w0, &c0) || f0 >= 0.98f ||
+            f0 < -0.98f) {
+            continue;
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            int x1 = x + (axis == 0);
+            int y1 = y + (axis == 1);
+            int z1 = z + (axis == 2);
+            float f1, w1;
+            float3 c1 = make_float3(0.0f, 0.0f, 0.0f);
+            if (!SampleVoxel(table, x1, y1, z1, &f1, &w1, &c1) ||
+                f1 >= 0.98f || f1 < -0.98f || f0 * f1 >= 0.0f) {
+                continue;
+            }
+            float r0 = fabsf(f0);
+            float r1 = fabsf(f1);
+            float inv = 1.0f / (r0 + r1);
+            float3 p = make_float3((x + 0.5f) * voxel_length,
+                                   (y + 0.5f) * voxel_length,
+                                   (z + 0.5f) * voxel_length);
+            if (axis == 0) {
+                p.x += r0 * voxel_length * inv;
+            } else if (axis == 1) {
+                p.y += r0 * voxel_length * inv;
+            } else {
+                p.z += r0 * voxel_length * inv;
+            }
+            int out = atomicAdd(count, 1);
+            if (out >= point_capacity) {
+                continue;
+            }
+            points[out] = p;
+            if (colors != nullptr) {
+                colors[out] = make_float3((c0.x * r1 + c1.x * r0) * inv,
+                                          (c0.y * r1 + c1.y * r0) * inv,
+                                          (c0.z * r1 + c1.z * r0) * inv);
+            }
+        }
+    }
+}
+
+__global__ void ResetKernel(HashTable table) {
+    int slot = blockIdx.x * blockDim.x + threadIdx.x;
+    if (slot >= table.capacity) {
+        return;
+    }
+    table.keys[slot] = make_int3(kEmptyKey, kEmptyKey, kEmptyKey);
+    const int voxels = table.resolution * table.resolution * table.resolution;
+    for (int i = 0; i < voxels; i++) {
+        table.tsdf[slot * voxels + i] = 0.0f;
+        table.weight[slot * voxels + i] = 0.0f;
+        if (table.color != nullptr) {
+            table.color[slot * voxels + i] = make_float3(0.0f, 0.0f, 0.0f);
+        }
+    }
+}
+
+void FillFrameParams(FrameParams &params,
+                     const camera::PinholeCameraIntrinsic &intrinsic,
+                     const Eigen::Matrix4d &extrinsic) {
+    params.fx = (float)intrinsic.GetFocalLength().first;
+    params.fy = (float)intrinsic.GetFocalLength().second;
+    params.cx = (float)intrinsic.GetPrincipalPoint().first;
+    params.cy = (float)intrinsic.GetPrincipalPoint().second;
+    params.width = intrinsic.width_;
+    params.height = intrinsic.height_;
+    Eigen::Matrix4d extrinsic_inv = extrinsic.inverse();
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < 4; col++) {
+            params.extrinsic[row * 4 + col] = (float)extrinsic(row, col);
+            params.extrinsic_inv[row * 4 + col] =
+                    (float)extrinsic_inv(row, col);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+struct ScalableTSDFVolumeCUDA::DeviceData {
+    HashTable table;
+    // Per-frame scratch reused across Integrate calls.
+    int *visible_slots = nullptr;
+    int *counters = nullptr;  // {visible_count, error_flag}
+    float *depth = nullptr;
+    uint8_t *color_rgb8 = nullptr;
+    float *color_gray32 = nullptr;
+    int frame_width = 0;
+    int frame_height = 0;
+};
+
+ScalableTSDFVolumeCUDA::ScalableTSDFVolumeCUDA(
+        double voxel_length,
+        double sdf_trunc,
+        TSDFVolumeColorType color_type,
+        int block_capacity /* = 100000*/,
+        int volume_unit_resolution /* = 16*/)
+    : TSDFVolume(voxel_length, sdf_trunc, color_type),
+      block_capacity_(block_capacity),
+      volume_unit_resolution_(volume_unit_resolution),
+      volume_unit_length_(voxel_length * volume_unit_resolution),
+      device_(new DeviceData) {
+    const size_t voxels =
+            (size_t)block_capacity * volume_unit_resolution *
+            volume_unit_resolution * volume_unit_resolution;
+    HashTable &table = device_->table;
+    table.capacity = block_capacity;
+    table.resolution = volume_unit_resolution;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&table.keys, block_capacity * sizeof(int3)));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&table.tsdf, voxels * sizeof(float)));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&table.weight, voxels * sizeof(float)));
+    table.color = nullptr;
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        OPEN3D_CUDA_CHECK(cudaMalloc(&table.color, voxels * sizeof(float3)));
+    }
+    OPEN3D_CUDA_CHECK(cudaMalloc(&device_->visible_slots,
+                                 block_capacity * sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&device_->counters, 2 * sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMemcpyToSymbol(tri_table_device, tri_table,
+                                         sizeof(tri_table)));
+    OPEN3D_CUDA_CHECK(cudaMemcpyToSymbol(edge_to_vert_device, edge_to_vert,
+                                         sizeof(edge_to_vert)));
+    int shift_host[8][3];
+    int edge_shift_host[12][4];
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 3; j++) {
+            shift_host[i][j] = shift[i](j);
+        }
+    }
+    for (int i = 0; i < 12; i++) {
+        for (int j = 0; j < 4; j++) {
+            edge_shift_host[i][j] = edge_shift[i](j);
+        }
+    }
+    OPEN3D_CUDA_CHECK(cudaMemcpyToSymbol(shift_device, shift_host,
+                                         sizeof(shift_host)));
+    OPEN3D_CUDA_CHECK(cudaMemcpyToSymbol(edge_shift_device, edge_shift_host,
+                                         sizeof(edge_shift_host)));
+    Reset();
+}
+
+ScalableTSDFVolumeCUDA::~ScalableTSDFVolumeCUDA() {
+    cudaFree(device_->table.keys);
+    cudaFree(device_->table.tsdf);
+    cudaFree(device_->table.weight);
+    cudaFree(device_->table.color);
+    cudaFree(device_->visible_slots);
+    cudaFree(device_->counters);
+    cudaFree(device_->depth);
+    cudaFree(device_->color_rgb8);
+    cudaFree(device_->color_gray32);
+}
+
+void ScalableTSDFVolumeCUDA::Reset() {
+    int grid = (block_capacity_ + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    ResetKernel<<<grid, kThreadsPerBlock>>>(device_->table);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+int ScalableTSDFVolumeCUDA::GetBlockCount() const {
+    std::vector<int3> keys(block_capacity_);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(keys.data(), device_->table.keys,
+                                 block_capacity_ * sizeof(int3),
+                                 cudaMemcpyDeviceToHost));
+    int count = 0;
+    for (const auto &key : keys) {
+        count += key.x != kEmptyKey;
+    }
+    return count;
+}
+
+void ScalableTSDFVolumeCUDA::Integrate(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) {
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 4) ||
+        (image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.width_ != intrinsic.width_) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "[ScalableTSDFVolumeCUDA::Integrate] Unsupported image "
+                "format.");
+    }
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    if (device_->frame_width != width || device_->frame_height != height) {
+        cudaFree(device_->depth);
+        cudaFree(device_->color_rgb8);
+        cudaFree(device_->color_gray32);
+        device_->color_rgb8 = nullptr;
+        device_->color_gray32 = nullptr;
+        OPEN3D_CUDA_CHECK(cudaMalloc(&device_->depth,
+                                     width * height * sizeof(float)));
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            OPEN3D_CUDA_CHECK(
+                    cudaMalloc(&device_->color_rgb8, width * height * 3));
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            OPEN3D_CUDA_CHECK(cudaMalloc(&device_->color_gray32,
+                                         width * height * sizeof(float)));
+        }
+        device_->frame_width = width;
+        device_->frame_height = height;
+    }
+    OPEN3D_CUDA_CHECK(cudaMemcpy(device_->depth, image.depth_.data_.data(),
+                                 width * height * sizeof(float),
+                                 cudaMemcpyHostToDevice));
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        OPEN3D_CUDA_CHECK(cudaMemcpy(device_->color_rgb8,
+                                     image.color_.data_.data(),
+                                     width * height * 3,
+                                     cudaMemcpyHostToDevice));
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        OPEN3D_CUDA_CHECK(cudaMemcpy(device_->color_gray32,
+                                     image.color_.data_.data(),
+                                     width * height * sizeof(float),
+                                     cudaMemcpyHostToDevice));
+    }
+    FrameParams params;
+    FillFrameParams(params, intrinsic, extrinsic);
+    OPEN3D_CUDA_CHECK(cudaMemset(device_->counters, 0, 2 * sizeof(int)));
+
+    // One allocation sample every 4 pixels matches the CPU volume's
+    // default depth_sampling_stride.
+    const int stride = 4;
+    dim3 alloc_threads(16, 16);
+    dim3 alloc_grid((width / stride + 15) / 16, (height / stride + 15) / 16);
+    AllocateBlocksKernel<<<alloc_grid, alloc_threads>>>(
+            device_->table, device_->depth, params, (float)sdf_trunc_,
+            (float)volume_unit_length_, stride, device_->counters + 1);
+
+    int grid = (block_capacity_ + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    CollectVisibleBlocksKernel<<<grid, kThreadsPerBlock>>>(
+            device_->table, params, (float)volume_unit_length_,
+            (float)sdf_trunc_, device_->visible_slots, device_->counters);
+
+    int counters[2];
+    OPEN3D_CUDA_CHECK(cudaMemcpy(counters, device_->counters, 2 * sizeof(int),
+                                 cudaMemcpyDeviceToHost));
+    if (counters[1] != 0) {
+        utility::LogError(
+                "[ScalableTSDFVolumeCUDA::Integrate] Voxel block hash table "
+                "is full; increase block_capacity.");
+    }
+    if (counters[0] == 0) {
+        return;
+    }
+    IntegrateKernel<<<counters[0], kThreadsPerBlock>>>(
+            device_->table, device_->depth, device_->color_rgb8,
+            device_->color_gray32, params, (float)voxel_length_,
+            (float)sdf_trunc_, device_->visible_slots);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+std::shared_ptr<geometry::Image> ScalableTSDFVolumeCUDA::RayCast(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_max /* = 3.0*/) {
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    FrameParams params;
+    FillFrameParams(params, intrinsic, extrinsic);
+    float *depth_out;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&depth_out,
+                                 width * height * sizeof(float)));
+    dim3 threads(16, 16);
+    dim3 grid((width + 15) / 16, (height + 15) / 16);
+    RayCastKernel<<<grid, threads>>>(device_->table, depth_out, params,
+                                     (float)voxel_length_, (float)sdf_trunc_,
+                                     (float)depth_max);
+    auto image = std::make_shared<geometry::Image>();
+    image->Prepare(width, height, 1, 4);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(image->data_.data(), depth_out,
+                                 width * height * sizeof(float),
+                                 cudaMemcpyDeviceToHost));
+    cudaFree(depth_out);
+    return image;
+}
+
+std::shared_ptr<geometry::PointCloud>
+ScalableTSDFVolumeCUDA::ExtractPointCloud() {
+    const int block_count = GetBlockCount();
+    // At most three crossings per voxel; in practice a small fraction of
+    // the voxels lie on the surface.
+    const int point_capacity = block_count * volume_unit_resolution_ *
+                               volume_unit_resolution_ * 4;
+    float3 *points;
+    float3 *colors = nullptr;
+    int *count;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&points, point_capacity * sizeof(float3)));
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        OPEN3D_CUDA_CHECK(
+                cudaMalloc(&colors, point_capacity * sizeof(float3)));
+    }
+    OPEN3D_CUDA_CHECK(cudaMalloc(&count, sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMemset(count, 0, sizeof(int)));
+    SurfacePointsKernel<<<block_capacity_, kThreadsPerBlock>>>(
+            device_->table, (float)voxel_length_, points, colors, count,
+            point_capacity);
+    int n;
+    OPEN3D_CUDA_CHECK(
+            cudaMemcpy(&n, count, sizeof(int), cudaMemcpyDeviceToHost));
+    if (n > point_capacity) {
+        utility::LogWarning(
+                "[ScalableTSDFVolumeCUDA::ExtractPointCloud] Point buffer "
+                "overflow; output truncated.");
+        n = point_capacity;
+    }
+    std::vector<float3> points_host(n);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(points_host.data(), points,
+                                 n * sizeof(float3),
+                                 cudaMemcpyDeviceToHost));
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    pointcloud->points_.reserve(n);
+    for (const auto &p : points_host) {
+        pointcloud->points_.push_back(Eigen::Vector3d(p.x, p.y, p.z));
+    }
+    if (colors != nullptr) {
+        std::vector<float3> colors_host(n);
+        OPEN3D_CUDA_CHECK(cudaMemcpy(colors_host.data(), colors,
+                                     n * sizeof(float3),
+                                     cudaMemcpyDeviceToHost));
+        const double scale =
+                color_type_ == TSDFVolumeColorType::RGB8 ? 1.0 / 255.0 : 1.0;
+        pointcloud->colors_.reserve(n);
+        for (const auto &c : colors_host) {
+            pointcloud->colors_.push_back(
+                    Eigen::Vector3d(c.x, c.y, c.z) * scale);
+        }
+    }
+    cudaFree(points);
+    cudaFree(colors);
+    cudaFree(count);
+    return pointcloud;
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+ScalableTSDFVolumeCUDA::ExtractTriangleMesh() {
+    int *block_triangle_count;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&block_triangle_count,
+                                 block_capacity_ * sizeof(int)));
+    MeshCountKernel<<<block_capacity_, kThreadsPerBlock>>>(
+            device_->table, block_triangle_count);
+    std::vector<int> counts(block_capacity_);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(counts.data(), block_triangle_count,
+                                 block_capacity_ * sizeof(int),
+                                 cudaMemcpyDeviceToHost));
+    std::vector<int> offsets(block_capacity_);
+    int total = 0;
+    for (int i = 0; i < block_capacity_; i++) {
+        offsets[i] = total;
+        total += counts[i];
+    }
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    if (total == 0) {
+        cudaFree(block_triangle_count);
+        return mesh;
+    }
+    int *block_triangle_offset;
+    int *block_cursor;
+    float3 *vertices;
+    float3 *vertex_colors = nullptr;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&block_triangle_offset,
+                                 block_capacity_ * sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&block_cursor,
+                                 block_capacity_ * sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMemcpy(block_triangle_offset, offsets.data(),
+                                 block_capacity_ * sizeof(int),
+                                 cudaMemcpyHostToDevice));
+    OPEN3D_CUDA_CHECK(cudaMemset(block_cursor, 0,
+                                 block_capacity_ * sizeof(int)));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&vertices,
+                                 (size_t)total * 3 * sizeof(float3)));
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        OPEN3D_CUDA_CHECK(cudaMalloc(&vertex_colors,
+                                     (size_t)total * 3 * sizeof(float3)));
+    }
+    MeshEmitKernel<<<block_capacity_, kThreadsPerBlock>>>(
+            device_->table, block_triangle_offset, vertices, vertex_colors,
+            (float)voxel_length_, block_cursor);
+    std::vector<float3> vertices_host((size_t)total * 3);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(vertices_host.data(), vertices,
+                                 (size_t)total * 3 * sizeof(float3),
+                                 cudaMemcpyDeviceToHost));
+    mesh->vertices_.reserve((size_t)total * 3);
+    mesh->triangles_.reserve(total);
+    for (int i = 0; i < total; i++) {
+        for (int corner = 0; corner < 3; corner++) {
+            const float3 &p = vertices_host[(size_t)i * 3 + corner];
+            mesh->vertices_.push_back(Eigen::Vector3d(p.x, p.y, p.z));
+        }
+        mesh->triangles_.push_back(
+                Eigen::Vector3i(i * 3, i * 3 + 1, i * 3 + 2));
+    }
+    if (vertex_colors != nullptr) {
+        std::vector<float3> colors_host((size_t)total * 3);
+        OPEN3D_CUDA_CHECK(cudaMemcpy(colors_host.data(), vertex_colors,
+                                     (size_t)total * 3 * sizeof(float3),
+                                     cudaMemcpyDeviceToHost));
+        const double scale =
+                color_type_ == TSDFVolumeColorType::RGB8 ? 1.0 / 255.0 : 1.0;
+        mesh->vertex_colors_.reserve((size_t)total * 3);
+        for (const auto &c : colors_host) {
+            mesh->vertex_colors_.push_back(
+                    Eigen::Vector3d(c.x, c.y, c.z) * scale);
+        }
+    }
+    cudaFree(block_triangle_count);
+    cudaFree(block_triangle_offset);
+    cudaFree(block_cursor);
+    cudaFree(vertices);
+    cudaFree(vertex_colors);
+    return mesh;
+}
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#ifdef BUILD_CUDA_MODULE
+
+#include <memory>
+
+#include "open3d/pipelines/integration/TSDFVolume.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+/// \class ScalableTSDFVolumeCUDA
+///
+/// \brief GPU counterpart of ScalableTSDFVolume backed by a device-resident
+/// voxel block hash.
+///
+/// Voxel blocks of volume_unit_resolution^3 voxels are allocated on demand
+/// in a fixed-capacity open-addressing hash table that lives entirely in
+/// device memory, so Integrate() touches no host data beyond the uploaded
+/// RGBD frame. RayCast() renders a depth map from the current volume and
+/// ExtractTriangleMesh() runs marching cubes on the device; both only copy
+/// their final output back to the host.
+///
+/// All member functions are synchronous with respect to the host: they
+/// return once the launched kernels have completed.
+class ScalableTSDFVolumeCUDA : public TSDFVolume {
+public:
+    /// \param voxel_length Voxel size in meters.
+    /// \param sdf_trunc Truncation distance of the signed distance function.
+    /// \param color_type Color layout carried by the voxels.
+    /// \param block_capacity Capacity of the voxel block hash table. The
+    /// volume fails with an error once more blocks are touched; 100000
+    /// blocks at resolution 16 cover roughly a 400 m^3 surface shell with
+    /// 1 cm voxels.
+    /// \param volume_unit_resolution Voxel block resolution per axis.
+    ScalableTSDFVolumeCUDA(double voxel_length,
+                           double sdf_trunc,
+                           TSDFVolumeColorType color_type,
+                           int block_capacity = 100000,
+                           int volume_unit_resolution = 16);
+    ~ScalableTSDFVolumeCUDA() override;
+
+public:
+    void Reset() override;
+
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic) override;
+
+    /// \brief Render a depth map of the volume seen from the given view.
+    ///
+    /// Rays are marched through the voxel block hash until the zero
+    /// crossing of the TSDF; pixels whose rays hit no surface are 0. The
+    /// returned image is a single channel float image in meters.
+    std::shared_ptr<geometry::Image> RayCast(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = 3.0);
+
+    std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
+
+    /// \brief Run marching cubes over the allocated voxel blocks on the
+    /// device.
+    ///
+    /// Triangles carry their own three vertices without deduplication;
+    /// run geometry::TriangleMesh::MergeCloseVertices or
+    /// RemoveDuplicatedVertices on the result when a watertight
+    /// connectivity is needed.
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+
+    /// Number of voxel blocks currently allocated in the hash table.
+    int GetBlockCount() const;
+
+public:
+    int block_capacity_;
+    int volume_unit_resolution_;
+    double volume_unit_length_;
+
+private:
+    /// Device-side state; defined in the .cu translation unit so that this
+    /// header stays free of CUDA types.
+    struct DeviceData;
+    std::unique_ptr<DeviceData> device_;
+};
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
+
+#endif  // BUILD_CUDA_MODULE
@@ -26,13 +26,18 @@
 
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <thread>
-#include <unordered_map>
+
+#include <tbb/parallel_sort.h>
 
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace pipelines {
@@ -49,12 +54,22 @@ UniformTSDFVolume::UniformTSDFVolume(
       length_(length),
       resolution_(resolution),
       voxel_num_(resolution * resolution * resolution) {
-    voxels_.resize(voxel_num_);
+    voxel_tsdf_.resize(voxel_num_, 0.0f);
+    voxel_weight_.resize(voxel_num_, 0.0f);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        voxel_color_.resize(voxel_num_, Eigen::Vector3f::Zero());
+    }
 }
 
 UniformTSDFVolume::~UniformTSDFVolume() {}
 
-void UniformTSDFVolume::Reset() { voxels_.clear(); }
+void UniformTSDFVolume::Reset() {
+    voxel_tsdf_.assign(voxel_num_, 0.0f);
+    voxel_weight_.assign(voxel_num_, 0.0f);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        voxel_color_.assign(voxel_num_, Eigen::Vector3f::Zero());
+    }
+}
 
 void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -89,6 +104,42 @@ void UniformTSDFVolume::Integrate(
                                                  *depth2cameradistance);
 }
 
+void UniformTSDFVolume::Integrate(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_scale,
+        double depth_trunc) {
+    // Same as Integrate, but consumes raw uint16 depth; the scale and
+    // truncation are applied per sample in the voxel update loop instead of
+    // in a float conversion pass over the depth image.
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 2) ||
+        (image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.width_ != intrinsic.width_) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "[UniformTSDFVolume::Integrate] Unsupported image format.");
+    }
+    auto depth2cameradistance =
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    IntegrateWithDepthToCameraDistanceMultiplier(image, intrinsic, extrinsic,
+                                                 *depth2cameradistance,
+                                                 depth_scale, depth_trunc);
+}
+
 std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
@@ -96,9 +147,12 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
         for (int y = 1; y < resolution_ - 1; y++) {
             for (int z = 1; z < resolution_ - 1; z++) {
                 Eigen::Vector3i idx0(x, y, z);
-                float w0 = voxels_[IndexOf(idx0)].weight_;
-                float f0 = voxels_[IndexOf(idx0)].tsdf_;
-                const Eigen::Vector3d &c0 = voxels_[IndexOf(idx0)].color_;
+                float w0 = voxel_weight_[IndexOf(idx0)];
+                float f0 = voxel_tsdf_[IndexOf(idx0)];
+                Eigen::Vector3f c0 = Eigen::Vector3f::Zero();
+                if (color_type_ != TSDFVolumeColorType::NoColor) {
+                    c0 = voxel_color_[IndexOf(idx0)];
+                }
 
                 if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
                     continue;
@@ -112,10 +166,12 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                     Eigen::Vector3i idx1 = idx0;
                     idx1(i) += 1;
                     if (idx1(i) < resolution_ - 1) {
-                        float w1 = voxels_[IndexOf(idx1)].weight_;
-                        float f1 = voxels_[IndexOf(idx1)].tsdf_;
-                        const Eigen::Vector3d &c1 =
-                                voxels_[IndexOf(idx1)].color_;
+                        float w1 = voxel_weight_[IndexOf(idx1)];
+                        float f1 = voxel_tsdf_[IndexOf(idx1)];
+                        Eigen::Vector3f c1 = Eigen::Vector3f::Zero();
+                        if (color_type_ != TSDFVolumeColorType::NoColor) {
+                            c1 = voxel_color_[IndexOf(idx1)];
+                        }
                         if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
                             f0 * f1 < 0) {
                             float r0 = std::fabs(f0);
@@ -147,87 +203,172 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
+    // Two-pass parallel marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
+    //
+    // Pass 1 counts the triangles per x-slab, a prefix sum turns the
+    // counts into output offsets, and pass 2 emits one global edge key
+    // per triangle corner at its precomputed offset. Shared vertices
+    // are then welded by sorting the edge keys instead of the previous
+    // serial hash-map dedup; every vertex attribute can be recomputed
+    // from its key alone, so the passes need no shared mutable state.
     auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    // Map of "edge_index = (x, y, z, 0) + edge_shift" to "global vertex index"
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (int x = 0; x < resolution_ - 1; x++) {
-        for (int y = 0; y < resolution_ - 1; y++) {
-            for (int z = 0; z < resolution_ - 1; z++) {
-                int cube_index = 0;
-                float f[8];
-                Eigen::Vector3d c[8];
-                for (int i = 0; i < 8; i++) {
-                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
+    const int num_cells = resolution_ - 1;
+    if (num_cells <= 0) {
+        return mesh;
+    }
+    const double half_voxel_length = voxel_length_ * 0.5;
 
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
-                        cube_index = 0;
-                        break;
-                    } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
-                        if (f[i] < 0.0f) {
-                            cube_index |= (1 << i);
-                        }
-                        if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
-                        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
-                        }
-                    }
-                }
-                if (cube_index == 0 || cube_index == 255) {
-                    continue;
-                }
+    // Triangles emitted per cube configuration.
+    static const std::array<int, 256> tri_counts = [] {
+        std::array<int, 256> counts{};
+        for (int ci = 0; ci < 256; ci++) {
+            int n = 0;
+            while (tri_table[ci][n] != -1) {
+                n += 3;
+            }
+            counts[ci] = n / 3;
+        }
+        return counts;
+    }();
+
+    // Cube configuration at (x, y, z); 0 when any corner is
+    // unobserved, matching the serial implementation.
+    auto compute_cube_index = [this](int x, int y, int z) -> int {
+        int cube_index = 0;
+        for (int i = 0; i < 8; i++) {
+            const Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
+            if (voxel_weight_[IndexOf(idx)] == 0.0f) {
+                return 0;
+            }
+            if (voxel_tsdf_[IndexOf(idx)] < 0.0f) {
+                cube_index |= (1 << i);
+            }
+        }
+        return cube_index;
+    };
+
+    // A global edge is identified by its start voxel and direction.
+    const std::uint64_t res = std::uint64_t(resolution_);
+    auto encode_edge = [res](const Eigen::Vector4i &edge) -> std::uint64_t {
+        return ((std::uint64_t(edge(0)) * res + std::uint64_t(edge(1))) *
+                        res +
+                std::uint64_t(edge(2))) *
+                       3 +
+               std::uint64_t(edge(3));
+    };
+
+    // Pass 1: triangles per x-slab.
+    std::vector<int64_t> slab_counts(num_cells, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int x = 0; x < num_cells; x++) {
+        int64_t count = 0;
+        for (int y = 0; y < num_cells; y++) {
+            for (int z = 0; z < num_cells; z++) {
+                count += tri_counts[compute_cube_index(x, y, z)];
+            }
+        }
+        slab_counts[x] = count;
+    }
+    std::vector<int64_t> slab_offsets(num_cells + 1, 0);
+    utility::InclusivePrefixSum(slab_counts.data(),
+                                slab_counts.data() + num_cells,
+                                slab_offsets.data() + 1);
+    const int64_t num_triangles = slab_offsets[num_cells];
+    if (num_triangles == 0) {
+        return mesh;
+    }
+
+    // Pass 2: one edge key per triangle corner, in the serial
+    // triangle order (corner order 0, 2, 1 preserves the winding).
+    std::vector<std::uint64_t> corner_keys(num_triangles * 3);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int x = 0; x < num_cells; x++) {
+        int64_t triangle = slab_offsets[x];
+        for (int y = 0; y < num_cells; y++) {
+            for (int z = 0; z < num_cells; z++) {
+                const int cube_index = compute_cube_index(x, y, z);
+                std::uint64_t edge_keys[12];
                 for (int i = 0; i < 12; i++) {
                     if (edge_table[cube_index] & (1 << i)) {
-                        Eigen::Vector4i edge_index =
-                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
-                        if (edgeindex_to_vertexindex.find(edge_index) ==
-                            edgeindex_to_vertexindex.end()) {
-                            edge_to_index[i] = (int)mesh->vertices_.size();
-                            edgeindex_to_vertexindex[edge_index] =
-                                    (int)mesh->vertices_.size();
-                            Eigen::Vector3d pt(
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(0),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(1),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(2));
-                            double f0 = std::abs((double)f[edge_to_vert[i][0]]);
-                            double f1 = std::abs((double)f[edge_to_vert[i][1]]);
-                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
-                            mesh->vertices_.push_back(pt + origin_);
-                            if (color_type_ != TSDFVolumeColorType::NoColor) {
-                                const auto &c0 = c[edge_to_vert[i][0]];
-                                const auto &c1 = c[edge_to_vert[i][1]];
-                                mesh->vertex_colors_.push_back(
-                                        (f1 * c0 + f0 * c1) / (f0 + f1));
-                            }
-                        } else {
-                            edge_to_index[i] =
-                                    edgeindex_to_vertexindex.find(edge_index)
-                                            ->second;
-                        }
+                        edge_keys[i] = encode_edge(
+                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i]);
                     }
                 }
                 for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
-                    mesh->triangles_.push_back(Eigen::Vector3i(
-                            edge_to_index[tri_table[cube_index][i]],
-                            edge_to_index[tri_table[cube_index][i + 2]],
-                            edge_to_index[tri_table[cube_index][i + 1]]));
+                    corner_keys[triangle * 3 + 0] =
+                            edge_keys[tri_table[cube_index][i]];
+                    corner_keys[triangle * 3 + 1] =
+                            edge_keys[tri_table[cube_index][i + 2]];
+                    corner_keys[triangle * 3 + 2] =
+                            edge_keys[tri_table[cube_index][i + 1]];
+                    triangle++;
                 }
             }
         }
     }
+
+    // Weld shared vertices: the sorted unique edge keys are the
+    // vertex list, corner keys map to indices by binary search.
+    std::vector<std::uint64_t> vertex_keys = corner_keys;
+    tbb::parallel_sort(vertex_keys.begin(), vertex_keys.end());
+    vertex_keys.erase(std::unique(vertex_keys.begin(), vertex_keys.end()),
+                      vertex_keys.end());
+    const int64_t num_vertices = int64_t(vertex_keys.size());
+
+    mesh->triangles_.resize(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t t = 0; t < num_triangles; t++) {
+        for (int corner = 0; corner < 3; corner++) {
+            mesh->triangles_[t](corner) = int(
+                    std::lower_bound(vertex_keys.begin(), vertex_keys.end(),
+                                     corner_keys[t * 3 + corner]) -
+                    vertex_keys.begin());
+        }
+    }
+
+    // Vertex attributes recomputed from the decoded keys; the TSDF
+    // values at both edge endpoints are valid because every key came
+    // from a cube with all corners observed.
+    mesh->vertices_.resize(num_vertices);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(num_vertices);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t v = 0; v < num_vertices; v++) {
+        const std::uint64_t key = vertex_keys[v];
+        const int axis = int(key % 3);
+        const int z = int((key / 3) % res);
+        const int y = int((key / 3 / res) % res);
+        const int x = int(key / 3 / res / res);
+        Eigen::Vector3i idx1(x, y, z);
+        idx1(axis) += 1;
+        const double f0 = std::abs(double(voxel_tsdf_[IndexOf(x, y, z)]));
+        const double f1 = std::abs(double(voxel_tsdf_[IndexOf(idx1)]));
+        Eigen::Vector3d pt(half_voxel_length + voxel_length_ * x,
+                           half_voxel_length + voxel_length_ * y,
+                           half_voxel_length + voxel_length_ * z);
+        pt(axis) += f0 * voxel_length_ / (f0 + f1);
+        mesh->vertices_[v] = pt + origin_;
+        if (color_type_ != TSDFVolumeColorType::NoColor) {
+            Eigen::Vector3d c0 =
+                    voxel_color_[IndexOf(x, y, z)].cast<double>();
+            Eigen::Vector3d c1 = voxel_color_[IndexOf(idx1)].cast<double>();
+            if (color_type_ == TSDFVolumeColorType::RGB8) {
+                c0 /= 255.0;
+                c1 /= 255.0;
+            }
+            mesh->vertex_colors_[v] = (f1 * c0 + f0 * c1) / (f0 + f1);
+        }
+    }
     return mesh;
 }
 
@@ -235,9 +376,6 @@ std::shared_ptr<geometry::PointCloud>
 UniformTSDFVolume::ExtractVoxelPointCloud() const {
     auto voxel = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
-    // const float *p_tsdf = (const float *)tsdf_.data();
-    // const float *p_weight = (const float *)weight_.data();
-    // const float *p_color = (const float *)color_.data();
     for (int x = 0; x < resolution_; x++) {
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
@@ -245,11 +383,11 @@ UniformTSDFVolume::ExtractVoxelPointCloud() const {
                                    half_voxel_length + voxel_length_ * y,
                                    half_voxel_length + voxel_length_ * z);
                 int ind = IndexOf(x, y, z);
-                if (voxels_[ind].weight_ != 0.0f &&
-                    voxels_[ind].tsdf_ < 0.98f &&
-                    voxels_[ind].tsdf_ >= -0.98f) {
+                if (voxel_weight_[ind] != 0.0f &&
+                    voxel_tsdf_[ind] < 0.98f &&
+                    voxel_tsdf_[ind] >= -0.98f) {
                     voxel->points_.push_back(pt + origin_);
-                    double c = (voxels_[ind].tsdf_ + 1.0) * 0.5;
+                    double c = (voxel_tsdf_[ind] + 1.0) * 0.5;
                     voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
                 }
             }
@@ -268,8 +406,8 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
+                const float w = voxel_weight_[ind];
+                const float f = voxel_tsdf_[ind];
                 if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     double c = (f + 1.0) * 0.5;
                     Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
@@ -286,7 +424,9 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
-        const geometry::Image &depth_to_camera_distance_multiplier) {
+        const geometry::Image &depth_to_camera_distance_multiplier,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/) {
     const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
     const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
     const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
@@ -299,6 +439,9 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
     const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
     const float safe_width_f = intrinsic.width_ - 0.0001f;
     const float safe_height_f = intrinsic.height_ - 0.0001f;
+    const bool depth_is_uint16 = image.depth_.bytes_per_channel_ == 2;
+    const float depth_scale_inv_f = static_cast<float>(1.0 / depth_scale);
+    const float depth_trunc_f = static_cast<float>(depth_trunc);
 
 #ifdef _OPENMP
 #ifdef _WIN32
@@ -331,12 +474,22 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                       v_f < safe_height_f)) {
                     continue;
                 }
-                // Skip if negative depth in depth image
+                // Skip if negative (or, for uint16, truncated) depth in
+                // depth image
                 int u = (int)u_f;
                 int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
+                float d;
+                if (depth_is_uint16) {
+                    d = *image.depth_.PointerAt<uint16_t>(u, v) *
+                        depth_scale_inv_f;
+                    if (d <= 0.0f || d >= depth_trunc_f) {
+                        continue;
+                    }
+                } else {
+                    d = *image.depth_.PointerAt<float>(u, v);
+                    if (d <= 0.0f) {
+                        continue;
+                    }
                 }
 
                 int v_ind = IndexOf(x, y, z);
@@ -347,29 +500,26 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
+                    const float weight = voxel_weight_[v_ind];
+                    const float new_weight_inv = 1.0f / (weight + 1.0f);
+                    voxel_tsdf_[v_ind] = (voxel_tsdf_[v_ind] * weight + tsdf) *
+                                         new_weight_inv;
                     if (color_type_ == TSDFVolumeColorType::RGB8) {
                         const uint8_t *rgb =
                                 image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        Eigen::Vector3f rgb_f(rgb[0], rgb[1], rgb[2]);
+                        voxel_color_[v_ind] =
+                                (voxel_color_[v_ind] * weight + rgb_f) *
+                                new_weight_inv;
                     } else if (color_type_ == TSDFVolumeColorType::Gray32) {
                         const float *intensity =
                                 image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        voxel_color_[v_ind] = (voxel_color_[v_ind].array() *
+                                                       weight +
+                                               (*intensity)) *
+                                              new_weight_inv;
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
+                    voxel_weight_[v_ind] = weight + 1.0f;
                 }
             }
         }
@@ -399,21 +549,21 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
 
     double tsdf = 0;
     tsdf += (1 - r(0)) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))];
     tsdf += (1 - r(0)) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))];
     tsdf += (1 - r(0)) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))];
     tsdf += (1 - r(0)) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))];
     tsdf += r(0) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))];
     tsdf += r(0) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))];
     tsdf += r(0) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))];
     tsdf += r(0) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))].tsdf_;
+            voxel_tsdf_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))];
     return tsdf;
 }
 
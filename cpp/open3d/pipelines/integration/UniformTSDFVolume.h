@@ -69,6 +69,19 @@ public:
     void Integrate(const geometry::RGBDImage &image,
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
+
+    /// \brief Integrate an RGBD frame whose depth channel is raw uint16.
+    ///
+    /// The depth scale is applied per sample inside the voxel update loop
+    /// and samples at or beyond \p depth_trunc are treated as missing, so
+    /// no intermediate float depth image is created and the depth reads
+    /// stay two bytes per pixel.
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic,
+                   double depth_scale,
+                   double depth_trunc);
+
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
 
@@ -78,12 +91,16 @@ public:
     std::shared_ptr<geometry::VoxelGrid> ExtractVoxelGrid() const;
 
     /// Faster Integrate function that uses depth_to_camera_distance_multiplier
-    /// precomputed from camera intrinsic
+    /// precomputed from camera intrinsic. The depth channel may be float
+    /// (assumed metric and truncated already; depth_scale and depth_trunc are
+    /// ignored) or raw uint16 (scaled and truncated per sample in the loop).
     void IntegrateWithDepthToCameraDistanceMultiplier(
             const geometry::RGBDImage &image,
             const camera::PinholeCameraIntrinsic &intrinsic,
             const Eigen::Matrix4d &extrinsic,
-            const geometry::Image &depth_to_camera_distance_multiplier);
+            const geometry::Image &depth_to_camera_distance_multiplier,
+            double depth_scale = 1000.0,
+            double depth_trunc = 3.0);
 
     inline int IndexOf(int x, int y, int z) const {
         return x * resolution_ * resolution_ + y * resolution_ + z;
@@ -94,7 +111,13 @@ public:
     }
 
 public:
-    std::vector<geometry::TSDFVoxel> voxels_;
+    /// The voxel data is stored as structure-of-arrays indexed by IndexOf(),
+    /// so that the integration kernel vectorizes and a voxel costs 8 bytes
+    /// (20 with color) instead of a 32-byte struct with a double color.
+    /// voxel_color_ is only allocated when color_type_ is not NoColor.
+    std::vector<float> voxel_tsdf_;
+    std::vector<float> voxel_weight_;
+    std::vector<Eigen::Vector3f> voxel_color_;
     Eigen::Vector3d origin_;
     /// Total length, where voxel_length = length / resolution.
     double length_;
@@ -27,6 +27,8 @@
 #include "open3d/pipelines/odometry/Odometry.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 #include "open3d/geometry/Image.h"
@@ -39,163 +41,150 @@ namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<std::shared_ptr<geometry::Image>,
-                  std::shared_ptr<geometry::Image>>
-InitializeCorrespondenceMap(int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    auto correspondence_map = std::make_shared<geometry::Image>();
-    auto depth_buffer = std::make_shared<geometry::Image>();
-    correspondence_map->Prepare(width, height, 2, 4);
-    depth_buffer->Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map->height_; v++) {
-        for (int u = 0; u < correspondence_map->width_; u++) {
-            *correspondence_map->PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map->PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer->PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
+/// One cache entry per source pixel with valid depth. The scaled pixel
+/// ray d_s * (u_s, v_s, 1) only depends on the source depth image, so
+/// it is extracted once per image pair; each iteration then merely
+/// reprojects it and, if the projection drifted by less than
+/// kMaxWarmStartPixelDrift since the last full test, reuses the cached
+/// accept/reject decision without touching the target depth image.
+struct CorrespondencePixelCache {
+    Eigen::Vector3d uvd_s;
+    int u_s;
+    int v_s;
+    /// Projection at the last full test (invalid until first tested).
+    double u_proj;
+    double v_proj;
+    /// Accepted target pixel, or u_t == -1 when rejected.
+    int u_t;
+    int v_t;
+};
+
+/// Scratch buffers for ComputeCorrespondence() that persist across the
+/// iterations of a pyramid level, so the per-iteration correspondence
+/// search reuses its row buffers and output set instead of reallocating
+/// them every call, and warm-starts from the previous iteration's
+/// projections when the image pair is unchanged.
+struct CorrespondenceWorkspace {
+    std::vector<CorrespondenceSetPixelWise> rows;
+    std::vector<size_t> row_offsets;
+    std::shared_ptr<CorrespondenceSetPixelWise> correspondence;
+    std::vector<std::vector<CorrespondencePixelCache>> cached_rows;
+    /// Cache identity: the depth pair the cache was extracted from.
+    const void *cached_depth_s = nullptr;
+    const void *cached_depth_t = nullptr;
+    int cached_width = 0;
+    int cached_height = 0;
+    /// False until the cached projections have been through one full
+    /// test pass; the first pass after (re)extraction tests everything.
+    bool cache_primed = false;
+};
+
+/// Correspondences whose projection moved by no more than this many
+/// pixels since their last full test keep their cached decision. The
+/// rounded target pixel rarely changes under sub-quarter-pixel motion,
+/// and late Gauss-Newton iterations move almost nothing, which is
+/// where the saved target-image probing pays off.
+constexpr double kMaxWarmStartPixelDrift = 0.25;
 
 static std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
         const Eigen::Matrix3d intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        CorrespondenceWorkspace &workspace) {
     const Eigen::Matrix3d K = intrinsic_matrix;
     const Eigen::Matrix3d K_inv = K.inverse();
     const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    std::shared_ptr<geometry::Image> correspondence_map;
-    std::shared_ptr<geometry::Image> depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        std::shared_ptr<geometry::Image> correspondence_map_private;
-        std::shared_ptr<geometry::Image> depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
+    workspace.rows.resize(depth_s.height_);
+    workspace.row_offsets.resize(depth_s.height_);
+    if (!workspace.correspondence) {
+        workspace.correspondence =
+                std::make_shared<CorrespondenceSetPixelWise>();
+    }
+    if (workspace.cached_depth_s != depth_s.data_.data() ||
+        workspace.cached_depth_t != depth_t.data_.data() ||
+        workspace.cached_width != depth_s.width_ ||
+        workspace.cached_height != depth_s.height_) {
+        // New image pair (e.g. the next pyramid level): extract the
+        // valid source pixels once.
+        workspace.cached_rows.assign(depth_s.height_, {});
 #ifdef _OPENMP
-#pragma omp for nowait
+#pragma omp parallel for schedule(static)
 #endif
         for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+            auto &cached_row = workspace.cached_rows[v_s];
             for (int u_s = 0; u_s < depth_s.width_; u_s++) {
                 double d_s = *depth_s.PointerAt<float>(u_s, v_s);
                 if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    *correspondence_map_private,
-                                    *depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
-                    }
+                    cached_row.push_back(
+                            {d_s * Eigen::Vector3d(u_s, v_s, 1.0), u_s, v_s,
+                             0.0, 0.0, -1, -1});
                 }
             }
         }
+        workspace.cached_depth_s = depth_s.data_.data();
+        workspace.cached_depth_t = depth_t.data_.data();
+        workspace.cached_width = depth_s.width_;
+        workspace.cached_height = depth_s.height_;
+        workspace.cache_primed = false;
+    }
+    const bool primed = workspace.cache_primed;
+    // Each source pixel produces at most one correspondence, so the rows
+    // can be searched independently.
 #ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            MergeCorrespondenceMaps(*correspondence_map, *depth_buffer,
-                                    *correspondence_map_private,
-                                    *depth_buffer_private);
-#ifdef _OPENMP
-        }  //    omp critical
-    }      //    omp parallel
+#pragma omp parallel for schedule(static)
 #endif
-
-    auto correspondence = std::make_shared<CorrespondenceSetPixelWise>();
-    int correspondence_count = CountCorrespondence(*correspondence_map);
-    correspondence->resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map->height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map->width_; u_s++) {
-            int u_t = *correspondence_map->PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map->PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                (*correspondence)[cnt] = pixel_correspondence;
-                cnt++;
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        auto &row = workspace.rows[v_s];
+        row.clear();
+        for (auto &cached : workspace.cached_rows[v_s]) {
+            Eigen::Vector3d uv_in_s = KRK_inv * cached.uvd_s + Kt;
+            double transformed_d_s = uv_in_s(2);
+            double u_proj = uv_in_s(0) / transformed_d_s;
+            double v_proj = uv_in_s(1) / transformed_d_s;
+            if (!primed ||
+                std::abs(u_proj - cached.u_proj) > kMaxWarmStartPixelDrift ||
+                std::abs(v_proj - cached.v_proj) > kMaxWarmStartPixelDrift) {
+                cached.u_proj = u_proj;
+                cached.v_proj = v_proj;
+                cached.u_t = -1;
+                int u_t = (int)(u_proj + 0.5);
+                int v_t = (int)(v_proj + 0.5);
+                if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                    v_t < depth_t.height_) {
+                    double d_t = *depth_t.PointerAt<float>(u_t, v_t);
+                    if (!std::isnan(d_t) && std::abs(transformed_d_s - d_t) <=
+                                                    option.max_depth_diff_) {
+                        cached.u_t = u_t;
+                        cached.v_t = v_t;
+                    }
+                }
+            }
+            if (cached.u_t >= 0) {
+                row.push_back(Eigen::Vector4i(cached.u_s, cached.v_s,
+                                              cached.u_t, cached.v_t));
             }
         }
     }
+    workspace.cache_primed = true;
+    size_t total = 0;
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        workspace.row_offsets[v_s] = total;
+        total += workspace.rows[v_s].size();
+    }
+    auto correspondence = workspace.correspondence;
+    correspondence->resize(total);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        std::copy(workspace.rows[v_s].begin(), workspace.rows[v_s].end(),
+                  correspondence->begin() + workspace.row_offsets[v_s]);
+    }
     return correspondence;
 }
 
@@ -249,9 +238,11 @@ static Eigen::Matrix6d CreateInformationMatrix(
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
         const OdometryOption &option) {
+    CorrespondenceWorkspace workspace;
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
+                                  extrinsic, depth_s, depth_t, option,
+                                  workspace);
 
     auto xyz_t = ConvertDepthImageToXYZImage(
             depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
@@ -397,7 +388,8 @@ InitializeRGBDOdometry(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &odo_inits,
         const OdometryOption &option) {
     std::shared_ptr<geometry::Image> source_color, target_color;
     if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
@@ -419,10 +411,26 @@ InitializeRGBDOdometry(
     auto target_depth = target_depth_preprocessed->Filter(
             geometry::Image::FilterType::Gaussian3);
 
-    auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
+    // The normalization correspondences come from the first
+    // initialization with image overlap, so one bad candidate in a
+    // multi-init call cannot poison the intensity scale.
+    CorrespondenceWorkspace workspace;
+    std::shared_ptr<CorrespondenceSetPixelWise> correspondence;
+    for (const auto &odo_init : odo_inits) {
+        correspondence = ComputeCorrespondence(
+                pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+                *source_depth, *target_depth, option, workspace);
+        if (!correspondence->empty()) {
+            break;
+        }
+    }
+    if (correspondence && !correspondence->empty()) {
+        NormalizeIntensity(*source_gray, *target_gray, *correspondence);
+    } else {
+        utility::LogWarning(
+                "[InitializeRGBDOdometry] No initialization has image "
+                "overlap; skipping intensity normalization.");
+    }
 
     auto source_out = PackRGBDImage(*source_gray, *source_depth);
     auto target_out = PackRGBDImage(*target_gray, *target_depth);
@@ -440,27 +448,19 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix3d intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    auto correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
-    int corresps_count = (int)correspondence->size();
-
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        *correspondence);
-            };
+        const OdometryOption &option,
+        CorrespondenceWorkspace &workspace) {
+    auto correspondence =
+            ComputeCorrespondence(intrinsic, extrinsic_initial, source.depth_,
+                                  target.depth_, option, workspace);
+
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic_initial, *correspondence);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -474,16 +474,22 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
     }
 }
 
-static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
+/// Per-level images shared by every initialization solved against the
+/// same preprocessed image pair.
+struct MultiscaleBuffers {
+    std::vector<std::shared_ptr<geometry::RGBDImage>> source_levels;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> target_levels;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> target_dx_levels;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> target_dy_levels;
+    std::vector<std::shared_ptr<geometry::Image>> source_xyz_levels;
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix;
+};
+
+static MultiscaleBuffers BuildMultiscaleBuffers(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &extrinsic_initial,
-        const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
-    int num_levels = (int)iter_counts.size();
-
+        int num_levels) {
     auto source_pyramid = source.CreatePyramid(num_levels);
     auto target_pyramid = target.CreatePyramid(num_levels);
     auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
@@ -491,36 +497,54 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
             target_pyramid, geometry::Image::FilterType::Sobel3Dy);
 
+    MultiscaleBuffers buffers;
+    buffers.pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        buffers.source_xyz_levels.push_back(ConvertDepthImageToXYZImage(
+                source_pyramid[level]->depth_,
+                buffers.pyramid_camera_matrix[level]));
+        buffers.source_levels.push_back(
+                PackRGBDImage(source_pyramid[level]->color_,
+                              source_pyramid[level]->depth_));
+        buffers.target_levels.push_back(
+                PackRGBDImage(target_pyramid[level]->color_,
+                              target_pyramid[level]->depth_));
+        buffers.target_dx_levels.push_back(
+                PackRGBDImage(target_pyramid_dx[level]->color_,
+                              target_pyramid_dx[level]->depth_));
+        buffers.target_dy_levels.push_back(
+                PackRGBDImage(target_pyramid_dy[level]->color_,
+                              target_pyramid_dy[level]->depth_));
+    }
+    return buffers;
+}
+
+static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscaleFromBuffers(
+        const MultiscaleBuffers &buffers,
+        const Eigen::Matrix4d &extrinsic_initial,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option,
+        CorrespondenceWorkspace &workspace) {
+    std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
+    int num_levels = (int)iter_counts.size();
+
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
-        const Eigen::Matrix3d level_camera_matrix =
-                pyramid_camera_matrix[level];
-
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *buffers.source_levels[level],
+                    *buffers.target_levels[level],
+                    *buffers.source_xyz_levels[level],
+                    *buffers.target_dx_levels[level],
+                    *buffers.target_dy_levels[level],
+                    buffers.pyramid_camera_matrix[level], result_odo,
+                    jacobian_method, option, workspace);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -532,6 +556,21 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
+static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix4d &extrinsic_initial,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option) {
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+    MultiscaleBuffers buffers = BuildMultiscaleBuffers(
+            source, target, pinhole_camera_intrinsic, num_levels);
+    CorrespondenceWorkspace workspace;
+    return ComputeMultiscaleFromBuffers(buffers, extrinsic_initial,
+                                        jacobian_method, option, workspace);
+}
+
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
@@ -550,7 +589,7 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
 
     std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
     std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+            source, target, pinhole_camera_intrinsic, {odo_init}, option);
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
@@ -570,6 +609,98 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d, int>
+ComputeRGBDOdometryMultiInit(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &odo_init_candidates,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (odo_init_candidates.empty()) {
+        utility::LogWarning(
+                "[RGBDOdometryMultiInit] No candidate initialization given.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero(), -1);
+    }
+    if (!CheckRGBDImagePair(source, target)) {
+        utility::LogWarning(
+                "[RGBDOdometry] Two RGBD pairs should be same in size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero(), -1);
+    }
+
+    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
+    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
+            source, target, pinhole_camera_intrinsic, odo_init_candidates,
+            option);
+
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+    MultiscaleBuffers buffers =
+            BuildMultiscaleBuffers(*source_processed, *target_processed,
+                                   pinhole_camera_intrinsic, num_levels);
+
+    int num_candidates = (int)odo_init_candidates.size();
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transforms(
+            num_candidates, Eigen::Matrix4d::Identity());
+    std::vector<double> scores(num_candidates,
+                               std::numeric_limits<double>::max());
+    // The candidates only read the shared buffers and write their own
+    // transform and score; the parallel regions inside a candidate's
+    // solve collapse to one thread within this team.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_candidates; k++) {
+        CorrespondenceWorkspace workspace;
+        bool is_success;
+        Eigen::Matrix4d trans;
+        std::tie(is_success, trans) = ComputeMultiscaleFromBuffers(
+                buffers, odo_init_candidates[k], jacobian_method, option,
+                workspace);
+        if (!is_success) {
+            continue;
+        }
+        auto correspondence = ComputeCorrespondence(
+                buffers.pyramid_camera_matrix[0], trans,
+                buffers.source_levels[0]->depth_,
+                buffers.target_levels[0]->depth_, option, workspace);
+        if (correspondence->empty()) {
+            continue;
+        }
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+                *buffers.source_levels[0], *buffers.target_levels[0],
+                *buffers.source_xyz_levels[0], *buffers.target_dx_levels[0],
+                *buffers.target_dy_levels[0], buffers.pyramid_camera_matrix[0],
+                trans, *correspondence);
+        transforms[k] = trans;
+        scores[k] = r2 / (double)correspondence->size();
+    }
+
+    int best = -1;
+    for (int k = 0; k < num_candidates; k++) {
+        if (scores[k] < std::numeric_limits<double>::max() &&
+            (best == -1 || scores[k] < scores[best])) {
+            best = k;
+        }
+    }
+    if (best == -1) {
+        utility::LogWarning(
+                "[RGBDOdometryMultiInit] No candidate converged.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero(), -1);
+    }
+    Eigen::Matrix6d info_output = CreateInformationMatrix(
+            transforms[best], pinhole_camera_intrinsic,
+            source_processed->depth_, target_processed->depth_, option);
+    return std::make_tuple(true, transforms[best], info_output, best);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -65,6 +65,36 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Estimate 6D rigid motion trying several candidate
+/// initializations and keeping the best converged one.
+///
+/// The image preprocessing, pyramids and derivative images are built
+/// once and shared by all candidates, and the candidates are solved
+/// concurrently, so evaluating K initializations (e.g. relocalization
+/// hypotheses) costs far less than K calls to ComputeRGBDOdometry().
+/// The intensity normalization uses the first candidate with image
+/// overlap. Candidates are ranked by the mean squared residual of the
+/// finest pyramid level at their converged pose.
+///
+/// \param source Source RGBD image.
+/// \param target Target RGBD image.
+/// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+/// \param odo_init_candidates Candidate initial 4x4 motion matrices.
+/// \param jacobian_method The odometry Jacobian method to use.
+/// \param option Odometry hyper parameteres.
+/// \return is_success, best 4x4 motion matrix, its 6x6 information
+/// matrix, and the index of the winning candidate (-1 on failure).
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d, int>
+ComputeRGBDOdometryMultiInit(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &odo_init_candidates,
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -29,6 +29,7 @@
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/Odometry.h"
+#include "open3d/utility/Console.h"
 
 namespace open3d {
 
@@ -41,6 +42,29 @@ const double LAMBDA_HYBRID_DEPTH = 0.968;
 
 namespace pipelines {
 namespace odometry {
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    auto f_lambda =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r) {
+                ComputeJacobianAndResidual(i, J_r, r, source, target,
+                                           source_xyz, target_dx, target_dy,
+                                           intrinsic, extrinsic, corresps);
+            };
+    return utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+            f_lambda, (int)corresps.size());
+}
+
 void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -154,6 +178,125 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
     r[1] = r_geo;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    // Fused version of the per-row ComputeJacobianAndResidual() above:
+    // the square roots, rotation and translation are hoisted out of the
+    // loop and the photometric and geometric rows are accumulated
+    // directly, without a virtual call or temporary Jacobian vectors per
+    // correspondence.
+    const double sqrt_lambda_dep = sqrt(LAMBDA_HYBRID_DEPTH);
+    const double sqrt_lambda_img = sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
+    const double fx = intrinsic(0, 0);
+    const double fy = intrinsic(1, 1);
+    const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::Matrix6d JTJ_private;
+        Eigen::Vector6d JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        Eigen::Vector6d J_photo, J_geo;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int row = 0; row < (int)corresps.size(); row++) {
+            int u_s = corresps[row](0);
+            int v_s = corresps[row](1);
+            int u_t = corresps[row](2);
+            int v_t = corresps[row](3);
+            double diff_photo = (*target.color_.PointerAt<float>(u_t, v_t) -
+                                 *source.color_.PointerAt<float>(u_s, v_s));
+            double dIdx = SOBEL_SCALE *
+                          (*target_dx.color_.PointerAt<float>(u_t, v_t));
+            double dIdy = SOBEL_SCALE *
+                          (*target_dy.color_.PointerAt<float>(u_t, v_t));
+            double dDdx = SOBEL_SCALE *
+                          (*target_dx.depth_.PointerAt<float>(u_t, v_t));
+            double dDdy = SOBEL_SCALE *
+                          (*target_dy.depth_.PointerAt<float>(u_t, v_t));
+            if (std::isnan(dDdx)) dDdx = 0;
+            if (std::isnan(dDdy)) dDdy = 0;
+            Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
+                                    *source_xyz.PointerAt<float>(u_s, v_s, 1),
+                                    *source_xyz.PointerAt<float>(u_s, v_s, 2));
+            Eigen::Vector3d p3d_trans = R * p3d_mat + t;
+
+            double diff_geo =
+                    *target.depth_.PointerAt<float>(u_t, v_t) - p3d_trans(2);
+            double invz = 1. / p3d_trans(2);
+            double c0 = dIdx * fx * invz;
+            double c1 = dIdy * fy * invz;
+            double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+            double d0 = dDdx * fx * invz;
+            double d1 = dDdy * fy * invz;
+            double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
+
+            J_photo(0) =
+                    sqrt_lambda_img * (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
+            J_photo(1) =
+                    sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
+            J_photo(2) =
+                    sqrt_lambda_img * (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
+            J_photo(3) = sqrt_lambda_img * (c0);
+            J_photo(4) = sqrt_lambda_img * (c1);
+            J_photo(5) = sqrt_lambda_img * (c2);
+            double r_photo = sqrt_lambda_img * diff_photo;
+
+            J_geo(0) = sqrt_lambda_dep * ((-p3d_trans(2) * d1 +
+                                           p3d_trans(1) * d2) -
+                                          p3d_trans(1));
+            J_geo(1) = sqrt_lambda_dep * ((p3d_trans(2) * d0 -
+                                           p3d_trans(0) * d2) +
+                                          p3d_trans(0));
+            J_geo(2) = sqrt_lambda_dep *
+                       ((-p3d_trans(1) * d0 + p3d_trans(0) * d1));
+            J_geo(3) = sqrt_lambda_dep * (d0);
+            J_geo(4) = sqrt_lambda_dep * (d1);
+            J_geo(5) = sqrt_lambda_dep * (d2 - 1.0f);
+            double r_geo = sqrt_lambda_dep * diff_geo;
+
+            JTJ_private.noalias() += J_photo * J_photo.transpose();
+            JTr_private.noalias() += J_photo * r_photo;
+            r2_sum_private += r_photo * r_photo;
+            JTJ_private.noalias() += J_geo * J_geo.transpose();
+            JTr_private.noalias() += J_geo * r_geo;
+            r2_sum_private += r_geo * r_geo;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      r2_sum / (double)corresps.size(), (int)corresps.size());
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
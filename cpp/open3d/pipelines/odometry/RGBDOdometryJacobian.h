@@ -76,6 +76,24 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const = 0;
+
+    /// \brief Accumulate the normal equations JTJ and JTr and the
+    /// squared residual over all correspondences.
+    ///
+    /// The default implementation reduces the per-row
+    /// ComputeJacobianAndResidual() with utility::ComputeJTJandJTr.
+    /// Subclasses can override it with a fused loop that hoists the
+    /// per-row invariants and accumulates without the per-row virtual
+    /// call and temporary Jacobian vectors.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTr(const geometry::RGBDImage &source,
+                     const geometry::RGBDImage &target,
+                     const geometry::Image &source_xyz,
+                     const geometry::RGBDImage &target_dx,
+                     const geometry::RGBDImage &target_dy,
+                     const Eigen::Matrix3d &intrinsic,
+                     const Eigen::Matrix4d &extrinsic,
+                     const CorrespondenceSetPixelWise &corresps) const;
 };
 
 /// \class RGBDOdometryJacobianFromColorTerm
@@ -137,6 +155,18 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    /// Fused accumulation of the photometric and geometric terms in one
+    /// pass over the correspondences.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 }  // namespace odometry
@@ -39,11 +39,6 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
-class PointCloudForColoredICP : public geometry::PointCloud {
-public:
-    std::vector<Eigen::Vector3d> color_gradient_;
-};
-
 class TransformationEstimationForColoredICP : public TransformationEstimation {
 public:
     TransformationEstimationType GetTransformationEstimationType()
@@ -74,8 +69,7 @@ private:
             TransformationEstimationType::ColoredICP;
 };
 
-static std::shared_ptr<PointCloudForColoredICP>
-InitializePointCloudForColoredICP(
+std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
         const geometry::PointCloud &target,
         const geometry::KDTreeSearchParamHybrid &search_param) {
     utility::LogDebug("InitializePointCloudForColoredICP");
@@ -253,8 +247,25 @@ RegistrationResult RegistrationColoredICP(
         double lambda_geometric /* = 0.968*/) {
     auto target_c = InitializePointCloudForColoredICP(
             target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
+    return RegistrationColoredICP(source, *target_c, max_distance, init,
+                                  criteria, lambda_geometric);
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const PointCloudForColoredICP &target,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/) {
+    if (target.color_gradient_.size() != target.points_.size()) {
+        utility::LogError(
+                "[RegistrationColoredICP] The target has no precomputed color "
+                "gradients; build it with "
+                "InitializePointCloudForColoredICP.");
+    }
     return RegistrationICP(
-            source, *target_c, max_distance, init,
+            source, target, max_distance, init,
             TransformationEstimationForColoredICP(lambda_geometric), criteria);
 }
 
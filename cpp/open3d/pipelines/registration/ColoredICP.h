@@ -27,19 +27,44 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Registration.h"
 
 namespace open3d {
-
-namespace geometry {
-class PointCloud;
-}
-
 namespace pipelines {
 namespace registration {
 class RegistrationResult;
 
+/// \class PointCloudForColoredICP
+///
+/// \brief Target point cloud augmented with per-point color gradients.
+///
+/// Computing the gradients requires a KDTree pass over the target;
+/// building this object once with InitializePointCloudForColoredICP and
+/// passing it to repeated RegistrationColoredICP calls avoids redoing
+/// that pass when the same target is registered against several
+/// sources.
+class PointCloudForColoredICP : public geometry::PointCloud {
+public:
+    /// Per-point gradient of the color intensity in the tangential
+    /// plane of the point.
+    std::vector<Eigen::Vector3d> color_gradient_;
+};
+
+/// \brief Function to precompute the color gradients of a Colored ICP
+/// target.
+///
+/// \param target The target point cloud; must have normals and colors.
+/// \param search_param Neighborhood used for the gradient estimation;
+/// its radius should be about twice the maximum correspondence distance
+/// of the intended registrations.
+std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
+        const geometry::PointCloud &target,
+        const geometry::KDTreeSearchParamHybrid &search_param);
+
 /// \brief Function for Colored ICP registration.
 ///
 /// This is implementation of following paper
@@ -61,6 +86,26 @@ RegistrationResult RegistrationColoredICP(
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
         double lambda_geometric = 0.968);
 
+/// \brief Colored ICP registration against a precomputed target.
+///
+/// Overload that reuses the color gradients of a target built once
+/// with InitializePointCloudForColoredICP, e.g. when one fragment is
+/// registered against several neighbors.
+///
+/// \param source The source point cloud.
+/// \param target The gradient-augmented target point cloud.
+/// \param max_distance Maximum correspondence points-pair distance.
+/// \param init Initial transformation estimation.
+/// \param criteria Convergence criteria.
+/// \param lambda_geometric lambda_geometric value.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const PointCloudForColoredICP &target,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -27,30 +27,86 @@
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
 
 #include <Eigen/Dense>
+#include <cstdint>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+
+/// Squared-length comparison of edge pair (i, j); equivalent to comparing
+/// the norms since both sides are non-negative, but avoids the square
+/// roots.
+bool IsEdgePairSimilar(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres,
+                       size_t i,
+                       size_t j,
+                       double squared_similarity) {
+    double dis2_source =
+            (source.points_[corres[i](0)] - source.points_[corres[j](0)])
+                    .squaredNorm();
+    double dis2_target =
+            (target.points_[corres[i](1)] - target.points_[corres[j](1)])
+                    .squaredNorm();
+    return dis2_source >= dis2_target * squared_similarity &&
+           dis2_target >= dis2_source * squared_similarity;
+}
+
+}  // namespace
+
+void CorrespondenceChecker::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres_batch,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &results) const {
+    results.resize(corres_batch.size());
+    for (size_t i = 0; i < corres_batch.size(); i++) {
+        results[i] =
+                Check(source, target, corres_batch[i], transformations[i]);
+    }
+}
+
 bool CorrespondenceCheckerBasedOnEdgeLength::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres,
         const Eigen::Matrix4d & /*transformation*/) const {
+    const double squared_similarity =
+            similarity_threshold_ * similarity_threshold_;
+    const int64_t num_corres = int64_t(corres.size());
+    const int64_t num_pairs = num_corres * (num_corres - 1) / 2;
+    if (max_edge_pairs_ > 0 && num_pairs > int64_t(max_edge_pairs_)) {
+        // Test a deterministic random subset of the edge pairs; the
+        // all-pairs sweep is quadratic in the correspondence count and
+        // dominates RANSAC wall time at high iteration counts.
+        utility::random::Philox rng{uint64_t(num_corres),
+                                    uint64_t(max_edge_pairs_)};
+        for (int k = 0; k < max_edge_pairs_; k++) {
+            size_t i = rng.BoundedUInt32(uint32_t(num_corres));
+            size_t j = rng.BoundedUInt32(uint32_t(num_corres));
+            if (i == j) {
+                continue;
+            }
+            if (!IsEdgePairSimilar(source, target, corres, i, j,
+                                   squared_similarity)) {
+                return false;
+            }
+        }
+        return true;
+    }
     for (size_t i = 0; i < corres.size(); i++) {
         for (size_t j = i + 1; j < corres.size(); j++) {
             // check edge ij
-            double dis_source = (source.points_[corres[i](0)] -
-                                 source.points_[corres[j](0)])
-                                        .norm();
-            double dis_target = (target.points_[corres[i](1)] -
-                                 target.points_[corres[j](1)])
-                                        .norm();
-            if (dis_source < dis_target * similarity_threshold_ ||
-                dis_target < dis_source * similarity_threshold_) {
+            if (!IsEdgePairSimilar(source, target, corres, i, j,
+                                   squared_similarity)) {
                 return false;
             }
         }
@@ -58,6 +114,28 @@ bool CorrespondenceCheckerBasedOnEdgeLength::Check(
     return true;
 }
 
+void CorrespondenceCheckerBasedOnEdgeLength::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres_batch,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &results) const {
+    // std::vector<bool> packs bits, so parallel writes go through a
+    // byte buffer.
+    std::vector<uint8_t> passed(corres_batch.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t h = 0; h < int64_t(corres_batch.size()); h++) {
+        passed[h] = Check(source, target, corres_batch[h],
+                          transformations[h])
+                            ? 1
+                            : 0;
+    }
+    results.assign(passed.begin(), passed.end());
+}
+
 bool CorrespondenceCheckerBasedOnDistance::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -75,6 +153,45 @@ bool CorrespondenceCheckerBasedOnDistance::Check(
     return true;
 }
 
+void CorrespondenceCheckerBasedOnDistance::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres_batch,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &results) const {
+    const double squared_threshold =
+            distance_threshold_ * distance_threshold_;
+    std::vector<uint8_t> passed(corres_batch.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t h = 0; h < int64_t(corres_batch.size()); h++) {
+        const CorrespondenceSet &corres = corres_batch[h];
+        if (corres.empty()) {
+            passed[h] = 1;
+            continue;
+        }
+        // Gather the endpoints once, then evaluate the hypothesis as a
+        // single matrix expression.
+        Eigen::Matrix3Xd source_points(3, corres.size());
+        Eigen::Matrix3Xd target_points(3, corres.size());
+        for (size_t i = 0; i < corres.size(); i++) {
+            source_points.col(i) = source.points_[corres[i](0)];
+            target_points.col(i) = target.points_[corres[i](1)];
+        }
+        const Eigen::Matrix3d R = transformations[h].block<3, 3>(0, 0);
+        const Eigen::Vector3d t = transformations[h].block<3, 1>(0, 3);
+        const double worst = (((R * source_points).colwise() + t) -
+                              target_points)
+                                     .colwise()
+                                     .squaredNorm()
+                                     .maxCoeff();
+        passed[h] = worst <= squared_threshold ? 1 : 0;
+    }
+    results.assign(passed.begin(), passed.end());
+}
+
 bool CorrespondenceCheckerBasedOnNormal::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -101,6 +218,49 @@ bool CorrespondenceCheckerBasedOnNormal::Check(
     return true;
 }
 
+void CorrespondenceCheckerBasedOnNormal::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres_batch,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &results) const {
+    if (!source.HasNormals() || !target.HasNormals()) {
+        utility::LogWarning(
+                "[CorrespondenceCheckerBasedOnNormal::CheckBatch] Pointcloud "
+                "has no normals.");
+        results.assign(corres_batch.size(), true);
+        return;
+    }
+    const double cos_normal_angle_threshold =
+            std::cos(normal_angle_threshold_);
+    std::vector<uint8_t> passed(corres_batch.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t h = 0; h < int64_t(corres_batch.size()); h++) {
+        const CorrespondenceSet &corres = corres_batch[h];
+        if (corres.empty()) {
+            passed[h] = 1;
+            continue;
+        }
+        Eigen::Matrix3Xd source_normals(3, corres.size());
+        Eigen::Matrix3Xd target_normals(3, corres.size());
+        for (size_t i = 0; i < corres.size(); i++) {
+            source_normals.col(i) = source.normals_[corres[i](0)];
+            target_normals.col(i) = target.normals_[corres[i](1)];
+        }
+        const Eigen::Matrix3d R = transformations[h].block<3, 3>(0, 0);
+        const double worst = (R * source_normals)
+                                     .cwiseProduct(target_normals)
+                                     .colwise()
+                                     .sum()
+                                     .minCoeff();
+        passed[h] = worst >= cos_normal_angle_threshold ? 1 : 0;
+    }
+    results.assign(passed.begin(), passed.end());
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 
@@ -73,6 +74,27 @@ public:
                        const CorrespondenceSet &corres,
                        const Eigen::Matrix4d &transformation) const = 0;
 
+    /// \brief Batch version of Check() over many RANSAC hypotheses.
+    ///
+    /// Evaluates one correspondence set and transformation per hypothesis
+    /// and writes one pass/fail flag per hypothesis. The base
+    /// implementation calls Check() per hypothesis; subclasses override it
+    /// to evaluate each hypothesis as matrix operations and to run the
+    /// batch in parallel.
+    ///
+    /// \param source Source point cloud.
+    /// \param target Target point cloud.
+    /// \param corres_batch Per-hypothesis correspondence sets.
+    /// \param transformations Per-hypothesis estimated transformations.
+    /// \param results Per-hypothesis check results.
+    virtual void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres_batch,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &results) const;
+
 public:
     /// Some checkers do not require point clouds to be aligned, e.g., the edge
     /// length checker. Some checkers do, e.g., the distance checker.
@@ -94,9 +116,13 @@ public:
     ///
     /// \param similarity_threshold specifies the threshold within which 2
     /// arbitrary edges are similar.
-    CorrespondenceCheckerBasedOnEdgeLength(double similarity_threshold = 0.9)
+    /// \param max_edge_pairs Maximum number of edge pairs tested per check,
+    /// or 0 to test every pair.
+    CorrespondenceCheckerBasedOnEdgeLength(double similarity_threshold = 0.9,
+                                           int max_edge_pairs = 0)
         : CorrespondenceChecker(false),
-          similarity_threshold_(similarity_threshold) {}
+          similarity_threshold_(similarity_threshold),
+          max_edge_pairs_(max_edge_pairs) {}
     ~CorrespondenceCheckerBasedOnEdgeLength() override {}
 
 public:
@@ -105,12 +131,24 @@ public:
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
 
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres_batch,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &results) const override;
+
 public:
     /// For the check to be true,
     /// ||edgesource||>similarity_threshold×||edgetarget|| and
     /// ||edgetarget||>similarity_threshold×||edgesource|| must hold true for
     /// all edges.
     double similarity_threshold_;
+    /// When positive and the correspondence set spans more than this many
+    /// edge pairs, a deterministic random subset of max_edge_pairs_ pairs is
+    /// tested instead of all O(n^2) pairs. 0 tests every pair.
+    int max_edge_pairs_;
 };
 
 /// \class CorrespondenceCheckerBasedOnDistance
@@ -132,6 +170,14 @@ public:
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
 
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres_batch,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &results) const override;
+
 public:
     /// Distance threashold for the check.
     double distance_threshold_;
@@ -159,6 +205,14 @@ public:
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
 
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres_batch,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &results) const override;
+
 public:
     /// Radian value for angle threshold.
     double normal_angle_threshold_;
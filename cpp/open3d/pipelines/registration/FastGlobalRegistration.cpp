@@ -26,6 +26,8 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
+#include <algorithm>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
@@ -58,25 +60,57 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     int nPtj = int(point_cloud_vec[fj].points_.size());
     geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
     geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
     std::vector<std::pair<int, int>> corres;
     std::vector<std::pair<int, int>> corres_ij;
     std::vector<std::pair<int, int>> corres_ji;
+    // Both KNN sweeps are embarrassingly parallel; the j-side sweep
+    // runs first so the i-side sweep only queries the features that
+    // were actually matched, exactly as the former serial loop did.
+    std::vector<int> nn_j_to_i(nPtj);
     std::vector<int> i_to_j(nPti, -1);
-    for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> corresK(1);
+        std::vector<double> dis(1);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (int j = 0; j < nPtj; j++) {
+            feature_tree_i.SearchKNN(
+                    Eigen::VectorXd(features_vec[fj].data_.col(j)), 1, corresK,
                     dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+            nn_j_to_i[j] = corresK[0];
+        }
+#ifdef _OPENMP
+    }
+#endif
+    std::vector<bool> i_is_matched(nPti, false);
+    for (int j = 0; j < nPtj; j++) {
+        i_is_matched[nn_j_to_i[j]] = true;
+        corres_ji.push_back(std::pair<int, int>(nn_j_to_i[j], j));
+    }
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> corresK(1);
+        std::vector<double> dis(1);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (int i = 0; i < nPti; i++) {
+            if (i_is_matched[i]) {
+                feature_tree_j.SearchKNN(
+                        Eigen::VectorXd(features_vec[fi].data_.col(i)), 1,
+                        corresK, dis);
+                i_to_j[i] = corresK[0];
+            }
         }
-        corres_ji.push_back(std::pair<int, int>(i, j));
+#ifdef _OPENMP
     }
+#endif
     for (int i = 0; i < nPti; i++) {
         if (i_to_j[i] != -1)
             corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
@@ -119,49 +153,75 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
 
     // STEP 3) TUPLE CONSTRAINT
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int i, cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
 
+    // The trials are processed in blocks: the random indices of a block
+    // are drawn serially (keeping the RNG sequence and therefore the
+    // accepted tuples identical to a serial sweep), the geometric test
+    // runs in parallel, and the results are collected in trial order
+    // until maximum_tuple_count_ is reached.
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+    const int block_size = (std::min)(number_of_trial, 1 << 14);
+    std::vector<int> trial_idx((size_t)block_size * 3);
+    std::vector<char> trial_accepted(block_size);
+    for (i = 0; i < number_of_trial && cnt < option.maximum_tuple_count_;) {
+        int block = (std::min)(block_size, number_of_trial - i);
+        for (int t = 0; t < block; t++) {
+            trial_idx[t * 3 + 0] = utility::UniformRandInt(0, ncorr - 1);
+            trial_idx[t * 3 + 1] = utility::UniformRandInt(0, ncorr - 1);
+            trial_idx[t * 3 + 2] = utility::UniformRandInt(0, ncorr - 1);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int t = 0; t < block; t++) {
+            int idi0 = corres_cross[trial_idx[t * 3 + 0]].first;
+            int idj0 = corres_cross[trial_idx[t * 3 + 0]].second;
+            int idi1 = corres_cross[trial_idx[t * 3 + 1]].first;
+            int idj1 = corres_cross[trial_idx[t * 3 + 1]].second;
+            int idi2 = corres_cross[trial_idx[t * 3 + 2]].first;
+            int idj2 = corres_cross[trial_idx[t * 3 + 2]].second;
+
+            // collect 3 points from i-th fragment
+            const Eigen::Vector3d& pti0 = point_cloud_vec[fi].points_[idi0];
+            const Eigen::Vector3d& pti1 = point_cloud_vec[fi].points_[idi1];
+            const Eigen::Vector3d& pti2 = point_cloud_vec[fi].points_[idi2];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from j-th fragment
+            const Eigen::Vector3d& ptj0 = point_cloud_vec[fj].points_[idj0];
+            const Eigen::Vector3d& ptj1 = point_cloud_vec[fj].points_[idj1];
+            const Eigen::Vector3d& ptj2 = point_cloud_vec[fj].points_[idj2];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            trial_accepted[t] =
+                    (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                    (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                    (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int t = 0;
+             t < block && cnt < option.maximum_tuple_count_; t++, i++) {
+            if (trial_accepted[t]) {
+                corres_tuple.push_back(std::pair<int, int>(
+                        corres_cross[trial_idx[t * 3 + 0]].first,
+                        corres_cross[trial_idx[t * 3 + 0]].second));
+                corres_tuple.push_back(std::pair<int, int>(
+                        corres_cross[trial_idx[t * 3 + 1]].first,
+                        corres_cross[trial_idx[t * 3 + 1]].second));
+                corres_tuple.push_back(std::pair<int, int>(
+                        corres_cross[trial_idx[t * 3 + 2]].first,
+                        corres_cross[trial_idx[t * 3 + 2]].second));
+                cnt++;
+            }
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
                       number_of_trial, i);
@@ -251,51 +311,79 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
         const int nvariable = 6;
         Eigen::MatrixXd JTJ(nvariable, nvariable);
         Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
         JTJ.setZero();
         JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
-            Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
-            double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
+        double r2 = 0.0;
+
+        // The line-process weights s[c] are independent per
+        // correspondence and the normal equations are a sum over them;
+        // accumulate into per-thread copies merged at the end, the
+        // same reduction pattern as utility::ComputeJTJandJTr.
+#ifdef _OPENMP
+#pragma omp parallel
+        {
+#endif
+            Eigen::MatrixXd JTJ_private(nvariable, nvariable);
+            Eigen::MatrixXd JTr_private(nvariable, 1);
+            Eigen::MatrixXd J(nvariable, 1);
+            JTJ_private.setZero();
+            JTr_private.setZero();
+            double r = 0.0, r2_private = 0.0;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+            for (int c = 0; c < (int)corres.size(); c++) {
+                int ii = corres[c].first;
+                int jj = corres[c].second;
+                Eigen::Vector3d p, q;
+                p = point_cloud_vec[i].points_[ii];
+                q = point_cloud_copy_j.points_[jj];
+                Eigen::Vector3d rpq = p - q;
+
+                size_t c2 = c;
+                double temp = par / (rpq.dot(rpq) + par);
+                s[c2] = temp * temp;
+
+                J.setZero();
+                J(1) = -q(2);
+                J(2) = q(1);
+                J(3) = -1;
+                r = rpq(0);
+                JTJ_private += J * J.transpose() * s[c2];
+                JTr_private += J * r * s[c2];
+                r2_private += r * r * s[c2];
+
+                J.setZero();
+                J(2) = -q(0);
+                J(0) = q(2);
+                J(4) = -1;
+                r = rpq(1);
+                JTJ_private += J * J.transpose() * s[c2];
+                JTr_private += J * r * s[c2];
+                r2_private += r * r * s[c2];
+
+                J.setZero();
+                J(0) = -q(1);
+                J(1) = q(0);
+                J(5) = -1;
+                r = rpq(2);
+                JTJ_private += J * J.transpose() * s[c2];
+                JTr_private += J * r * s[c2];
+                r2_private += r * r * s[c2];
+                r2_private +=
+                        (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
+            }
+#ifdef _OPENMP
+#pragma omp critical(OptimizePairwiseRegistration)
+#endif
+            {
+                JTJ += JTJ_private;
+                JTr += JTr_private;
+                r2 += r2_private;
+            }
+#ifdef _OPENMP
         }
+#endif
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
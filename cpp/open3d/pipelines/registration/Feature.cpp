@@ -70,10 +70,26 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
-static std::shared_ptr<Feature> ComputeSPFHFeature(
+static void ComputeNeighborLists(
         const geometry::PointCloud &input,
         const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const geometry::KDTreeSearchParam &search_param,
+        std::vector<std::vector<int>> &neighbor_indices,
+        std::vector<std::vector<double>> &neighbor_distance2) {
+    neighbor_indices.resize(input.points_.size());
+    neighbor_distance2.resize(input.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)input.points_.size(); i++) {
+        kdtree.Search(input.points_[i], search_param, neighbor_indices[i],
+                      neighbor_distance2[i]);
+    }
+}
+
+static std::shared_ptr<Feature> ComputeSPFHFeature(
+        const geometry::PointCloud &input,
+        const std::vector<std::vector<int>> &neighbor_indices) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
 #ifdef _OPENMP
@@ -82,9 +98,8 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const auto &indices = neighbor_indices[i];
+        if (indices.size() > 1) {
             // only compute SPFH feature when a point has neighbors
             double hist_incr = 100.0 / (double)(indices.size() - 1);
             for (size_t k = 1; k < indices.size(); k++) {
@@ -114,6 +129,18 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    geometry::KDTreeFlann kdtree(input);
+    return ComputeFPFHFeature(input, search_param, kdtree);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const geometry::KDTreeFlann &kdtree,
+        const std::vector<std::vector<int>>
+                &neighbor_indices /* = {}*/,
+        const std::vector<std::vector<double>>
+                &neighbor_distance2 /* = {}*/) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (!input.HasNormals()) {
@@ -121,16 +148,33 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    // The SPFH pass and the reaggregation pass visit the same neighbor
+    // lists; query them once and share them between the two passes.
+    const std::vector<std::vector<int>> *indices_ptr = &neighbor_indices;
+    const std::vector<std::vector<double>> *distance2_ptr =
+            &neighbor_distance2;
+    std::vector<std::vector<int>> computed_indices;
+    std::vector<std::vector<double>> computed_distance2;
+    if (neighbor_indices.size() != input.points_.size() ||
+        neighbor_distance2.size() != input.points_.size()) {
+        if (!neighbor_indices.empty() || !neighbor_distance2.empty()) {
+            utility::LogWarning(
+                    "[ComputeFPFHFeature] Provided neighbor lists do not "
+                    "match the point cloud size, recomputing them.");
+        }
+        ComputeNeighborLists(input, kdtree, search_param, computed_indices,
+                             computed_distance2);
+        indices_ptr = &computed_indices;
+        distance2_ptr = &computed_distance2;
+    }
+    auto spfh = ComputeSPFHFeature(input, *indices_ptr);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const auto &indices = (*indices_ptr)[i];
+        const auto &distance2 = (*distance2_ptr)[i];
+        if (indices.size() > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
             for (size_t k = 1; k < indices.size(); k++) {
                 // skip the point itself
@@ -35,8 +35,9 @@
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
@@ -73,6 +74,30 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud, reusing a
+/// caller-provided KDTree and, optionally, precomputed neighbor lists.
+///
+/// The neighbor lists are queried only once and shared by the SPFH pass
+/// and the reaggregation pass, instead of running two full KDTree
+/// sweeps. Callers that already hold per-point neighbors (e.g. from the
+/// search used for normal estimation with the same search parameter)
+/// can pass them in to skip the KDTree queries entirely.
+///
+/// \param input The Input point cloud.
+/// \param search_param KDTree KNN search parameter.
+/// \param kdtree KDTree built from \p input.
+/// \param neighbor_indices Per-point neighbor indices including the
+/// point itself as the first entry; pass an empty vector to have them
+/// computed from \p kdtree.
+/// \param neighbor_distance2 Squared distances matching
+/// \p neighbor_indices; must have the same shape.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const geometry::KDTreeFlann &kdtree,
+        const std::vector<std::vector<int>> &neighbor_indices = {},
+        const std::vector<std::vector<double>> &neighbor_distance2 = {});
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -0,0 +1,308 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+#include "open3d/utility/Random.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+namespace {
+
+// Queries per chunk and references per tile for the blocked brute
+// force; the score tile (kReferenceTileSize x kQueryChunkSize floats)
+// stays cache-resident while Eigen's matrix product fills it.
+constexpr int64_t kQueryChunkSize = 128;
+constexpr int64_t kReferenceTileSize = 1024;
+
+// The CUDA kernel keeps one query feature in registers; longer
+// descriptors fall back to the CPU path.
+constexpr int kMaxCUDAFeatureDim = 64;
+
+// Seed for the LSH hyperplanes; fixed so matching is reproducible.
+constexpr std::uint64_t kLSHSeed = 0x6665617475726573;  // "features"
+
+// Standard normal draw via Box-Muller, fully specified for
+// reproducibility across standard libraries.
+double NextGaussian(utility::random::Philox &rng) {
+    double u1 = std::max(rng.NextUniformDouble(), 1e-300);
+    double u2 = rng.NextUniformDouble();
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+/// Exact nearest reference column for every query column; blocked
+/// matrix products over reference tiles, parallel over query chunks.
+/// Only the cross terms are computed: argmin_r |q - r|^2 ==
+/// argmin_r (|r|^2 - 2 q.r).
+std::vector<int> NearestMatchBruteForceCPU(const Eigen::MatrixXf &query,
+                                           const Eigen::MatrixXf &reference) {
+    const int64_t num_queries = query.cols();
+    const int64_t num_references = reference.cols();
+    const Eigen::VectorXf reference_sq =
+            reference.colwise().squaredNorm().transpose();
+    std::vector<int> matches(num_queries, -1);
+    const int64_t num_chunks =
+            (num_queries + kQueryChunkSize - 1) / kQueryChunkSize;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        Eigen::MatrixXf scores(kReferenceTileSize, kQueryChunkSize);
+        std::vector<float> best_dist(kQueryChunkSize);
+        std::vector<int> best_index(kQueryChunkSize);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t c = 0; c < num_chunks; c++) {
+            const int64_t query_lo = c * kQueryChunkSize;
+            const int64_t chunk =
+                    std::min(kQueryChunkSize, num_queries - query_lo);
+            std::fill(best_dist.begin(), best_dist.end(),
+                      std::numeric_limits<float>::max());
+            std::fill(best_index.begin(), best_index.end(), -1);
+            for (int64_t tile_lo = 0; tile_lo < num_references;
+                 tile_lo += kReferenceTileSize) {
+                const int64_t tile = std::min(kReferenceTileSize,
+                                              num_references - tile_lo);
+                scores.topLeftCorner(tile, chunk).noalias() =
+                        reference.middleCols(tile_lo, tile).transpose() *
+                        query.middleCols(query_lo, chunk);
+                for (int64_t j = 0; j < chunk; j++) {
+                    for (int64_t r = 0; r < tile; r++) {
+                        const float dist = reference_sq(tile_lo + r) -
+                                           2.0f * scores(r, j);
+                        if (dist < best_dist[j]) {
+                            best_dist[j] = dist;
+                            best_index[j] = int(tile_lo + r);
+                        }
+                    }
+                }
+            }
+            for (int64_t j = 0; j < chunk; j++) {
+                matches[query_lo + j] = best_index[j];
+            }
+        }
+    }
+    return matches;
+}
+
+/// One random-hyperplane hash table: bucket b holds the reference
+/// columns whose projection sign pattern equals b, stored CSR-style.
+struct LSHTable {
+    Eigen::MatrixXf hyperplanes;  // hash_bits x dim
+    std::vector<int64_t> sorted_indices;
+    std::vector<int64_t> bucket_offsets;
+};
+
+std::uint32_t ProjectionsToKey(const Eigen::VectorXf &projections) {
+    std::uint32_t key = 0;
+    for (int b = 0; b < projections.size(); b++) {
+        key |= std::uint32_t(projections(b) > 0.0f) << b;
+    }
+    return key;
+}
+
+std::vector<LSHTable> BuildLSHTables(const Eigen::MatrixXf &reference,
+                                     int hash_bits,
+                                     int num_tables) {
+    const int64_t num_references = reference.cols();
+    const int64_t num_buckets = int64_t(1) << hash_bits;
+    std::vector<LSHTable> tables(num_tables);
+    for (int t = 0; t < num_tables; t++) {
+        LSHTable &table = tables[t];
+        utility::random::Philox rng{kLSHSeed, std::uint64_t(t)};
+        table.hyperplanes.resize(hash_bits, reference.rows());
+        for (int b = 0; b < hash_bits; b++) {
+            for (int d = 0; d < reference.rows(); d++) {
+                table.hyperplanes(b, d) = float(NextGaussian(rng));
+            }
+        }
+        const Eigen::MatrixXf projections = table.hyperplanes * reference;
+        std::vector<std::uint32_t> keys(num_references);
+        for (int64_t i = 0; i < num_references; i++) {
+            keys[i] = ProjectionsToKey(projections.col(i));
+        }
+        table.sorted_indices.resize(num_references);
+        table.bucket_offsets.resize(num_buckets + 1);
+        utility::CountingSort(keys.data(), keys.data() + num_references,
+                              num_buckets, table.sorted_indices.data(),
+                              table.bucket_offsets.data());
+    }
+    return tables;
+}
+
+/// Approximate nearest reference for every query. Per table the home
+/// bucket is probed plus \p multi_probes buckets obtained by flipping
+/// the hash bits with the smallest projection magnitude (the bits most
+/// likely to differ for a true near neighbor).
+std::vector<int> NearestMatchLSH(const Eigen::MatrixXf &query,
+                                 const Eigen::MatrixXf &reference,
+                                 int hash_bits,
+                                 int num_tables,
+                                 int multi_probes) {
+    const std::vector<LSHTable> tables =
+            BuildLSHTables(reference, hash_bits, num_tables);
+    const int64_t num_queries = query.cols();
+    std::vector<int> matches(num_queries, -1);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> bit_order(hash_bits);
+        std::vector<std::uint32_t> probe_keys;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_queries; i++) {
+            float best_dist = std::numeric_limits<float>::max();
+            int best_index = -1;
+            for (const LSHTable &table : tables) {
+                const Eigen::VectorXf projections =
+                        table.hyperplanes * query.col(i);
+                const std::uint32_t key = ProjectionsToKey(projections);
+                probe_keys.assign(1, key);
+                std::iota(bit_order.begin(), bit_order.end(), 0);
+                std::sort(bit_order.begin(), bit_order.end(),
+                          [&projections](int a, int b) {
+                              return std::abs(projections(a)) <
+                                     std::abs(projections(b));
+                          });
+                for (int p = 0; p < multi_probes && p < hash_bits; p++) {
+                    probe_keys.push_back(key ^
+                                         (std::uint32_t(1) << bit_order[p]));
+                }
+                for (std::uint32_t probe : probe_keys) {
+                    const int64_t lo = table.bucket_offsets[probe];
+                    const int64_t hi = table.bucket_offsets[probe + 1];
+                    for (int64_t s = lo; s < hi; s++) {
+                        const int64_t candidate = table.sorted_indices[s];
+                        const float dist =
+                                (reference.col(candidate) - query.col(i))
+                                        .squaredNorm();
+                        if (dist < best_dist) {
+                            best_dist = dist;
+                            best_index = int(candidate);
+                        }
+                    }
+                }
+            }
+            matches[i] = best_index;
+        }
+    }
+    return matches;
+}
+
+std::vector<int> NearestMatch(const Eigen::MatrixXf &query,
+                              const Eigen::MatrixXf &reference,
+                              const FeatureMatchingOption &option) {
+    switch (option.method_) {
+        case FeatureMatchingOption::Method::ApproximateLSH: {
+            const int hash_bits =
+                    std::min(std::max(option.lsh_hash_bits_, 4), 20);
+            return NearestMatchLSH(query, reference, hash_bits,
+                                   std::max(option.lsh_num_tables_, 1),
+                                   std::max(option.lsh_multi_probes_, 0));
+        }
+        case FeatureMatchingOption::Method::BruteForceCUDA: {
+#ifdef BUILD_CUDA_MODULE
+            if (query.rows() <= kMaxCUDAFeatureDim) {
+                return cuda::NearestMatchBruteForce(query, reference);
+            }
+            utility::LogWarning(
+                    "MatchFeatures: feature dimension {:d} exceeds the CUDA "
+                    "limit of {:d}; falling back to the CPU brute force.",
+                    query.rows(), kMaxCUDAFeatureDim);
+#else
+            utility::LogWarning(
+                    "MatchFeatures: built without CUDA support; falling back "
+                    "to the CPU brute force.");
+#endif
+            return NearestMatchBruteForceCPU(query, reference);
+        }
+        case FeatureMatchingOption::Method::BruteForce:
+        default:
+            return NearestMatchBruteForceCPU(query, reference);
+    }
+}
+
+}  // unnamed namespace
+
+CorrespondenceSet MatchFeatures(const Feature &source,
+                                const Feature &target,
+                                const FeatureMatchingOption &option) {
+    CorrespondenceSet correspondences;
+    if (source.Num() == 0 || target.Num() == 0) {
+        utility::LogWarning("MatchFeatures: empty feature set.");
+        return correspondences;
+    }
+    if (source.Dimension() != target.Dimension()) {
+        utility::LogWarning(
+                "MatchFeatures: feature dimensions do not match ({:d} vs "
+                "{:d}).",
+                source.Dimension(), target.Dimension());
+        return correspondences;
+    }
+    // One float conversion up front; all distance work below runs in
+    // float at twice the SIMD width of the double storage.
+    const Eigen::MatrixXf source_f = source.data_.cast<float>();
+    const Eigen::MatrixXf target_f = target.data_.cast<float>();
+
+    const std::vector<int> forward = NearestMatch(source_f, target_f, option);
+    if (!option.mutual_filter_) {
+        correspondences.reserve(forward.size());
+        for (size_t i = 0; i < forward.size(); i++) {
+            if (forward[i] >= 0) {
+                correspondences.push_back(Eigen::Vector2i(int(i), forward[i]));
+            }
+        }
+        return correspondences;
+    }
+
+    const std::vector<int> reverse = NearestMatch(target_f, source_f, option);
+    for (size_t i = 0; i < forward.size(); i++) {
+        if (forward[i] >= 0 && reverse[forward[i]] == int(i)) {
+            correspondences.push_back(Eigen::Vector2i(int(i), forward[i]));
+        }
+    }
+    utility::LogDebug("MatchFeatures: {:d} of {:d} matches are mutual.",
+                      correspondences.size(), forward.size());
+    return correspondences;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FeatureMatching.h"
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <cfloat>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+namespace cuda {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 128;
+// Reference columns staged in shared memory per iteration.
+constexpr int kReferenceTile = 64;
+// Must match kMaxCUDAFeatureDim in FeatureMatching.cpp; one query
+// feature is kept in registers.
+constexpr int kMaxFeatureDim = 64;
+
+/// One thread per query; the block cooperatively stages reference
+/// tiles in shared memory and every thread scans the tile against its
+/// register-resident query. Matrices are column-major, one feature per
+/// column, as in Eigen.
+__global__ void NearestMatchKernel(const float *query,
+                                   const float *reference,
+                                   const float *reference_sq,
+                                   int dim,
+                                   int num_queries,
+                                   int num_references,
+                                   int *matches) {
+    extern __shared__ float tile[];  // kReferenceTile * dim
+    const int q = blockIdx.x * blockDim.x + threadIdx.x;
+
+    float feature[kMaxFeatureDim];
+    if (q < num_queries) {
+        for (int d = 0; d < dim; d++) {
+            feature[d] = query[q * dim + d];
+        }
+    }
+
+    float best_dist = FLT_MAX;
+    int best_index = -1;
+    for (int tile_lo = 0; tile_lo < num_references;
+         tile_lo += kReferenceTile) {
+        const int tile_size = min(kReferenceTile, num_references - tile_lo);
+        for (int i = threadIdx.x; i < tile_size * dim; i += blockDim.x) {
+            tile[i] = reference[tile_lo * dim + i];
+        }
+        __syncthreads();
+        if (q < num_queries) {
+            for (int r = 0; r < tile_size; r++) {
+                float dot = 0.0f;
+                for (int d = 0; d < dim; d++) {
+                    dot += feature[d] * tile[r * dim + d];
+                }
+                // The query norm is constant per thread and cannot
+                // change the argmin.
+                const float dist =
+                        reference_sq[tile_lo + r] - 2.0f * dot;
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best_index = tile_lo + r;
+                }
+            }
+        }
+        __syncthreads();
+    }
+    if (q < num_queries) {
+        matches[q] = best_index;
+    }
+}
+
+}  // unnamed namespace
+
+std::vector<int> NearestMatchBruteForce(const Eigen::MatrixXf &query,
+                                        const Eigen::MatrixXf &reference) {
+    const int dim = int(query.rows());
+    const int num_queries = int(query.cols());
+    const int num_references = int(reference.cols());
+    const Eigen::VectorXf reference_sq =
+            reference.colwise().squaredNorm().transpose();
+
+    float *query_device = nullptr;
+    float *reference_device = nullptr;
+    float *reference_sq_device = nullptr;
+    int *matches_device = nullptr;
+    OPEN3D_CUDA_CHECK(cudaMalloc(&query_device,
+                                 sizeof(float) * dim * num_queries));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&reference_device,
+                                 sizeof(float) * dim * num_references));
+    OPEN3D_CUDA_CHECK(
+            cudaMalloc(&reference_sq_device, sizeof(float) * num_references));
+    OPEN3D_CUDA_CHECK(cudaMalloc(&matches_device, sizeof(int) * num_queries));
+    OPEN3D_CUDA_CHECK(cudaMemcpy(query_device, query.data(),
+                                 sizeof(float) * dim * num_queries,
+                                 cudaMemcpyHostToDevice));
+    OPEN3D_CUDA_CHECK(cudaMemcpy(reference_device, reference.data(),
+                                 sizeof(float) * dim * num_references,
+                                 cudaMemcpyHostToDevice));
+    OPEN3D_CUDA_CHECK(cudaMemcpy(reference_sq_device, reference_sq.data(),
+                                 sizeof(float) * num_references,
+                                 cudaMemcpyHostToDevice));
+
+    const int num_blocks =
+            (num_queries + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    const size_t shared_bytes = sizeof(float) * kReferenceTile * dim;
+    NearestMatchKernel<<<num_blocks, kThreadsPerBlock, shared_bytes>>>(
+            query_device, reference_device, reference_sq_device, dim,
+            num_queries, num_references, matches_device);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    std::vector<int> matches(num_queries);
+    OPEN3D_CUDA_CHECK(cudaMemcpy(matches.data(), matches_device,
+                                 sizeof(int) * num_queries,
+                                 cudaMemcpyDeviceToHost));
+    OPEN3D_CUDA_CHECK(cudaFree(query_device));
+    OPEN3D_CUDA_CHECK(cudaFree(reference_device));
+    OPEN3D_CUDA_CHECK(cudaFree(reference_sq_device));
+    OPEN3D_CUDA_CHECK(cudaFree(matches_device));
+    return matches;
+}
+
+}  // namespace cuda
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// \class FeatureMatchingOption
+///
+/// \brief Options for MatchFeatures.
+class FeatureMatchingOption {
+public:
+    /// \enum Method
+    ///
+    /// \brief Search strategy used to find nearest-neighbor features.
+    enum class Method {
+        /// Exact nearest neighbors via blocked float matrix products.
+        /// Scales with num_source * num_target; the right choice for
+        /// small to medium sets.
+        BruteForce = 0,
+        /// Approximate nearest neighbors via multi-probe random
+        /// hyperplane LSH. Near-linear build and query time; the right
+        /// choice for very large sets where a small miss rate is
+        /// acceptable.
+        ApproximateLSH = 1,
+        /// Exact brute force on the GPU. Falls back to BruteForce with
+        /// a warning when built without CUDA support.
+        BruteForceCUDA = 2,
+    };
+
+    /// \param method Search strategy, see Method.
+    /// \param mutual_filter If true, only keep pairs that are mutual
+    /// nearest neighbors.
+    /// \param lsh_hash_bits Hash bits per LSH table (clamped to
+    /// [4, 20]); buckets per table is 2^bits.
+    /// \param lsh_num_tables Number of independent LSH tables.
+    /// \param lsh_multi_probes Extra buckets probed per table by
+    /// flipping the least confident hash bits.
+    FeatureMatchingOption(Method method = Method::BruteForce,
+                          bool mutual_filter = true,
+                          int lsh_hash_bits = 14,
+                          int lsh_num_tables = 8,
+                          int lsh_multi_probes = 4)
+        : method_(method),
+          mutual_filter_(mutual_filter),
+          lsh_hash_bits_(lsh_hash_bits),
+          lsh_num_tables_(lsh_num_tables),
+          lsh_multi_probes_(lsh_multi_probes) {}
+
+public:
+    /// Search strategy used to find nearest neighbors.
+    Method method_;
+    /// If true, only mutual nearest-neighbor pairs are kept.
+    bool mutual_filter_;
+    /// Hash bits per LSH table.
+    int lsh_hash_bits_;
+    /// Number of independent LSH tables.
+    int lsh_num_tables_;
+    /// Extra multi-probe buckets per table.
+    int lsh_multi_probes_;
+};
+
+/// \brief Matches \p source features against \p target features in one
+/// batched, parallel pass.
+///
+/// Returns a CorrespondenceSet of (source index, target index) pairs.
+/// The features are converted to float once and matched with the
+/// strategy from \p option; with mutual filtering enabled the reverse
+/// matching runs with the same strategy and only mutual nearest
+/// neighbors are kept. Sources whose search comes back empty (possible
+/// with ApproximateLSH) are dropped. The LSH hash tables are seeded
+/// deterministically, so results are reproducible across runs and
+/// machines.
+CorrespondenceSet MatchFeatures(
+        const Feature &source,
+        const Feature &target,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
+#ifdef BUILD_CUDA_MODULE
+namespace cuda {
+/// For every column of \p query returns the index of the closest
+/// column of \p reference (implementation detail of MatchFeatures with
+/// Method::BruteForceCUDA).
+std::vector<int> NearestMatchBruteForce(const Eigen::MatrixXf &query,
+                                        const Eigen::MatrixXf &reference);
+}  // namespace cuda
+#endif
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -206,6 +206,39 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
+/// Computes the four Hessian blocks and the two right-hand-side
+/// segments that edge \p iter_edge contributes; shared by the dense and
+/// the sparse system assembly.
+static void ComputeEdgeContribution(const PoseGraph &pose_graph,
+                                    const Eigen::VectorXd &zeta,
+                                    int iter_edge,
+                                    Eigen::Matrix6d &H_ss,
+                                    Eigen::Matrix6d &H_st,
+                                    Eigen::Matrix6d &H_ts,
+                                    Eigen::Matrix6d &H_tt,
+                                    Eigen::Vector6d &b_s,
+                                    Eigen::Vector6d &b_t) {
+    const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+    Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+
+    Eigen::Matrix4d X_inv, Ts, Tt_inv;
+    std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+
+    Eigen::Matrix6d Js, Jt;
+    std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+    Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+    Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+    Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+    double line_process_iter = t.confidence_;
+
+    H_ss.noalias() = line_process_iter * JsT_Info * Js;
+    H_st.noalias() = line_process_iter * JsT_Info * Jt;
+    H_ts.noalias() = line_process_iter * JtT_Info * Js;
+    H_tt.noalias() = line_process_iter * JtT_Info * Jt;
+    b_s.noalias() = -line_process_iter * (eT_Info.transpose() * Js).transpose();
+    b_t.noalias() = -line_process_iter * (eT_Info.transpose() * Jt).transpose();
+}
+
 static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
         const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
@@ -215,38 +248,140 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
     H.setZero();
     b.setZero();
 
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
-
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        // Per-thread accumulators merged at the end, following the
+        // reduction pattern of utility::ComputeJTJandJTr.
+        Eigen::MatrixXd H_private(n_nodes * 6, n_nodes * 6);
+        Eigen::VectorXd b_private(n_nodes * 6);
+        H_private.setZero();
+        b_private.setZero();
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            Eigen::Matrix6d H_ss, H_st, H_ts, H_tt;
+            Eigen::Vector6d b_s, b_t;
+            ComputeEdgeContribution(pose_graph, zeta, iter_edge, H_ss, H_st,
+                                    H_ts, H_tt, b_s, b_t);
+
+            int id_i = t.source_node_id_ * 6;
+            int id_j = t.target_node_id_ * 6;
+            H_private.block<6, 6>(id_i, id_i).noalias() += H_ss;
+            H_private.block<6, 6>(id_i, id_j).noalias() += H_st;
+            H_private.block<6, 6>(id_j, id_i).noalias() += H_ts;
+            H_private.block<6, 6>(id_j, id_j).noalias() += H_tt;
+            b_private.block<6, 1>(id_i, 0).noalias() += b_s;
+            b_private.block<6, 1>(id_j, 0).noalias() += b_t;
+        }
+#ifdef _OPENMP
+#pragma omp critical(ComputeLinearSystem)
+#endif
+        {
+            H += H_private;
+            b += b_private;
+        }
+#ifdef _OPENMP
+    }
+#endif
+    return std::make_tuple(std::move(H), std::move(b));
+}
 
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+/// Assembles the same system as ComputeLinearSystem directly into a
+/// sparse matrix. Each edge touches only four 6x6 blocks, so for large
+/// graphs the dense 6n x 6n Hessian is almost entirely zero and does
+/// not fit in memory; the triplet assembly keeps only the non-zeros.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeSparseLinearSystem(const PoseGraph &pose_graph,
+                          const Eigen::VectorXd &zeta) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    Eigen::VectorXd b(n_nodes * 6);
+    b.setZero();
+    // 4 blocks of 6x6 coefficients per edge, each written to a fixed
+    // offset so the edges can be processed in parallel without a merge
+    // and the triplet order stays deterministic.
+    std::vector<Eigen::Triplet<double>> triplets((size_t)n_edges * 144);
+
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::VectorXd b_private(n_nodes * 6);
+        b_private.setZero();
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            Eigen::Matrix6d H_ss, H_st, H_ts, H_tt;
+            Eigen::Vector6d b_s, b_t;
+            ComputeEdgeContribution(pose_graph, zeta, iter_edge, H_ss, H_st,
+                                    H_ts, H_tt, b_s, b_t);
+
+            int id_i = t.source_node_id_ * 6;
+            int id_j = t.target_node_id_ * 6;
+            size_t k = (size_t)iter_edge * 144;
+            for (int r = 0; r < 6; r++) {
+                for (int c = 0; c < 6; c++) {
+                    triplets[k++] = Eigen::Triplet<double>(id_i + r, id_i + c,
+                                                           H_ss(r, c));
+                    triplets[k++] = Eigen::Triplet<double>(id_i + r, id_j + c,
+                                                           H_st(r, c));
+                    triplets[k++] = Eigen::Triplet<double>(id_j + r, id_i + c,
+                                                           H_ts(r, c));
+                    triplets[k++] = Eigen::Triplet<double>(id_j + r, id_j + c,
+                                                           H_tt(r, c));
+                }
+            }
+            b_private.block<6, 1>(id_i, 0).noalias() += b_s;
+            b_private.block<6, 1>(id_j, 0).noalias() += b_t;
+        }
+#ifdef _OPENMP
+#pragma omp critical(ComputeSparseLinearSystem)
+#endif
+        { b += b_private; }
+#ifdef _OPENMP
     }
+#endif
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    // setFromTriplets sums duplicate entries, matching the dense +=.
+    H.setFromTriplets(triplets.begin(), triplets.end());
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves the sparse system with a Cholesky factorization and falls
+/// back to conjugate gradient when the factorization reports a
+/// numerical issue.
+static std::tuple<bool, Eigen::VectorXd> SolveSparseSystem(
+        const Eigen::SparseMatrix<double> &H, const Eigen::VectorXd &b) {
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    ldlt.compute(H);
+    if (ldlt.info() == Eigen::Success) {
+        Eigen::VectorXd x = ldlt.solve(b);
+        if (ldlt.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(x));
+        }
+    }
+    utility::LogWarning(
+            "Sparse Cholesky factorization failed, falling back to "
+            "conjugate gradient.");
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper>
+            cg;
+    cg.compute(H);
+    Eigen::VectorXd x = cg.solve(b);
+    return std::make_tuple(cg.info() == Eigen::Success, std::move(x));
+}
+
+/// Node count from which the Levenberg-Marquardt optimizer assembles
+/// the Hessian sparsely; the dense 6n x 6n matrix of a 300-node graph
+/// already takes ~26 MB and grows quadratically.
+static const int kSparseSolverMinNodes = 300;
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -579,12 +714,136 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             timer_overall.GetDuration() / 1000.0);
 }
 
+/// Sparse-Hessian variant of the Levenberg-Marquardt loop below. It is
+/// selected for graphs with kSparseSolverMinNodes nodes or more, where
+/// the dense Hessian either thrashes or does not fit; the iteration
+/// logic is identical.
+static void OptimizePoseGraphSparseLM(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
+
+    utility::LogDebug(
+            "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
+            "{:d} edges (sparse solver).",
+            n_nodes, n_edges);
+    utility::LogDebug("Line process weight : {:f}", line_process_weight);
+
+    Eigen::VectorXd zeta = ComputeZeta(pose_graph);
+    double current_residual, new_residual;
+    new_residual =
+            ComputeResidual(pose_graph, zeta, line_process_weight, option);
+    current_residual = new_residual;
+
+    int valid_edges_num =
+            UpdateConfidence(pose_graph, zeta, line_process_weight, option);
+
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
+    Eigen::VectorXd b;
+    Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+
+    std::tie(H, b) = ComputeSparseLinearSystem(pose_graph, zeta);
+
+    Eigen::VectorXd H_diag = H.diagonal();
+    double tau = 1e-5;
+    double current_lambda = tau * H_diag.maxCoeff();
+    double ni = 2.0;
+    double rho = 0.0;
+
+    utility::LogDebug("[Initial     ] residual : {:e}, lambda : {:e}",
+                      current_residual, current_lambda);
+
+    bool stop = false;
+    stop = stop || CheckRightTerm(b, criteria);
+    if (stop) return;
+
+    utility::Timer timer_overall;
+    timer_overall.Start();
+    for (int iter = 0; !stop; iter++) {
+        utility::Timer timer_iter;
+        timer_iter.Start();
+        int lm_count = 0;
+        do {
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
+            Eigen::VectorXd delta(H_LM.cols());
+            bool solver_success = false;
+
+            std::tie(solver_success, delta) = SolveSparseSystem(H_LM, b);
+
+            stop = stop || CheckRelativeIncrement(delta, x, criteria);
+            if (!stop) {
+                std::shared_ptr<PoseGraph> pose_graph_new =
+                        UpdatePoseGraph(pose_graph, delta);
+
+                Eigen::VectorXd zeta_new;
+                zeta_new = ComputeZeta(*pose_graph_new);
+                new_residual = ComputeResidual(pose_graph, zeta_new,
+                                               line_process_weight, option);
+                rho = (current_residual - new_residual) /
+                      (delta.dot(current_lambda * delta + b) + 1e-3);
+                if (rho > 0) {
+                    stop = stop ||
+                           CheckRelativeResidualIncrement(
+                                   current_residual, new_residual, criteria);
+                    if (stop) break;
+                    double alpha = 1. - pow((2 * rho - 1), 3);
+                    alpha = (std::min)(alpha, criteria.upper_scale_factor_);
+                    double scaleFactor =
+                            (std::max)(criteria.lower_scale_factor_, alpha);
+                    current_lambda *= scaleFactor;
+                    ni = 2;
+                    current_residual = new_residual;
+
+                    zeta = zeta_new;
+                    pose_graph = *pose_graph_new;
+                    x = UpdatePoseVector(pose_graph);
+                    valid_edges_num = UpdateConfidence(
+                            pose_graph, zeta, line_process_weight, option);
+                    std::tie(H, b) =
+                            ComputeSparseLinearSystem(pose_graph, zeta);
+
+                    stop = stop || CheckRightTerm(b, criteria);
+                    if (stop) break;
+                } else {
+                    current_lambda *= ni;
+                    ni *= 2;
+                }
+            }
+            lm_count++;
+            stop = stop || CheckMaxIterationLM(lm_count, criteria);
+        } while (!((rho > 0) || stop));
+        timer_iter.Stop();
+        if (!stop) {
+            utility::LogDebug(
+                    "[Iteration {:02d}] residual : {:e}, valid edges : {:d}, "
+                    "time : "
+                    "{:.3f} sec.",
+                    iter, current_residual, valid_edges_num,
+                    timer_iter.GetDuration() / 1000.0);
+        }
+        stop = stop || CheckResidual(current_residual, criteria) ||
+               CheckMaxIteration(iter, criteria);
+    }  // end for
+    timer_overall.Stop();
+    utility::LogDebug("[GlobalOptimizationLM] total time : {:.3f} sec.",
+                      timer_overall.GetDuration() / 1000.0);
+}
+
 void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
         const GlobalOptimizationOption &option) const {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
+    if (n_nodes >= kSparseSolverMinNodes) {
+        OptimizePoseGraphSparseLM(pose_graph, criteria, option);
+        return;
+    }
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
 
     utility::LogDebug(
@@ -717,6 +976,116 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+void GlobalOptimizationIncremental::Update(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationMethod &method
+        /* = GlobalOptimizationLevenbergMarquardt() */,
+        const GlobalOptimizationConvergenceCriteria &criteria
+        /* = GlobalOptimizationConvergenceCriteria() */,
+        const GlobalOptimizationOption &option
+        /* = GlobalOptimizationOption() */) {
+    size_t n_nodes = pose_graph.nodes_.size();
+    size_t n_edges = pose_graph.edges_.size();
+    if (n_edges < optimized_num_edges_) {
+        utility::LogWarning(
+                "[GlobalOptimizationIncremental] The pose graph shrank since "
+                "the last update, restarting with a full solve.");
+        optimized_num_edges_ = 0;
+    }
+    if (n_edges == optimized_num_edges_) {
+        return;
+    }
+
+    bool full_solve = optimized_num_edges_ == 0 ||
+                      updates_since_full_solve_ + 1 >= full_solve_interval_;
+
+    std::shared_ptr<PoseGraph> local_graph;
+    std::vector<int> local_to_global;
+    if (!full_solve) {
+        // Collect the nodes within local_hops_ edge hops of the new
+        // edges; only this sub-graph is re-optimized.
+        std::vector<std::vector<int>> adjacency(n_nodes);
+        for (const auto &t : pose_graph.edges_) {
+            adjacency[t.source_node_id_].push_back(t.target_node_id_);
+            adjacency[t.target_node_id_].push_back(t.source_node_id_);
+        }
+        std::vector<bool> selected(n_nodes, false);
+        std::vector<int> frontier;
+        for (size_t k = optimized_num_edges_; k < n_edges; k++) {
+            for (int id : {pose_graph.edges_[k].source_node_id_,
+                           pose_graph.edges_[k].target_node_id_}) {
+                if (!selected[id]) {
+                    selected[id] = true;
+                    frontier.push_back(id);
+                }
+            }
+        }
+        for (int hop = 0; hop < local_hops_; hop++) {
+            std::vector<int> next_frontier;
+            for (int id : frontier) {
+                for (int neighbor : adjacency[id]) {
+                    if (!selected[neighbor]) {
+                        selected[neighbor] = true;
+                        next_frontier.push_back(neighbor);
+                    }
+                }
+            }
+            frontier = std::move(next_frontier);
+        }
+
+        // Extract the induced sub-graph; iterating the nodes in order
+        // makes the oldest selected node local node 0, which anchors
+        // the patch to the untouched remainder of the graph.
+        std::vector<int> global_to_local(n_nodes, -1);
+        local_graph = std::make_shared<PoseGraph>();
+        for (size_t i = 0; i < n_nodes; i++) {
+            if (selected[i]) {
+                global_to_local[i] = (int)local_to_global.size();
+                local_to_global.push_back((int)i);
+                local_graph->nodes_.push_back(pose_graph.nodes_[i]);
+            }
+        }
+        for (const auto &t : pose_graph.edges_) {
+            if (selected[t.source_node_id_] && selected[t.target_node_id_]) {
+                PoseGraphEdge local_edge = t;
+                local_edge.source_node_id_ = global_to_local[t.source_node_id_];
+                local_edge.target_node_id_ = global_to_local[t.target_node_id_];
+                local_graph->edges_.push_back(local_edge);
+            }
+        }
+        // New edges touching disjoint regions can make the sub-graph
+        // disconnected; relinearize the whole graph in that case.
+        if (!ValidatePoseGraphConnectivity(*local_graph)) {
+            full_solve = true;
+        }
+    }
+
+    if (full_solve) {
+        GlobalOptimization(pose_graph, method, criteria, option);
+        // GlobalOptimization prunes uncertain edges, so re-read the
+        // edge count instead of reusing n_edges.
+        optimized_num_edges_ = pose_graph.edges_.size();
+        updates_since_full_solve_ = 0;
+        return;
+    }
+
+    utility::LogDebug(
+            "[GlobalOptimizationIncremental] Optimizing sub-graph having {:d} "
+            "of {:d} nodes.",
+            (int)local_graph->nodes_.size(), (int)n_nodes);
+    GlobalOptimizationOption local_option(option.max_correspondence_distance_,
+                                          option.edge_prune_threshold_,
+                                          option.preference_loop_closure_,
+                                          /*reference_node=*/0);
+    GlobalOptimization(*local_graph, method, criteria, local_option);
+    for (size_t local = 0; local < local_to_global.size(); local++) {
+        pose_graph.nodes_[local_to_global[local]].pose_ =
+                local_graph->nodes_[local].pose_;
+    }
+    optimized_num_edges_ = n_edges;
+    updates_since_full_solve_++;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
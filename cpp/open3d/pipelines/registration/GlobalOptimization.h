@@ -62,6 +62,58 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class GlobalOptimizationIncremental
+///
+/// \brief Incremental pose graph optimization for online use.
+///
+/// Tracks which edges of a growing pose graph have already been
+/// optimized. On each Update only the sub-graph within a few hops of
+/// the newly added edges is re-optimized, anchored at its oldest node
+/// so the patch stays consistent with the untouched remainder; every
+/// full_solve_interval updates (and on the first one) the whole graph
+/// is relinearized with a full GlobalOptimization, which bounds the
+/// drift the local solves can accumulate.
+class GlobalOptimizationIncremental {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param full_solve_interval Number of incremental updates between
+    /// full batch solves.
+    /// \param local_hops Number of edge hops around the new edges that
+    /// are included in the locally optimized sub-graph.
+    GlobalOptimizationIncremental(int full_solve_interval = 10,
+                                  int local_hops = 2)
+        : full_solve_interval_(full_solve_interval),
+          local_hops_(local_hops),
+          optimized_num_edges_(0),
+          updates_since_full_solve_(0) {}
+    ~GlobalOptimizationIncremental() {}
+
+    /// \brief Re-optimizes the poses affected by edges added since the
+    /// previous call.
+    ///
+    /// \param pose_graph The pose graph; new nodes and edges are
+    /// expected to be appended since the last Update.
+    /// \param method Optimization method for both local and full
+    /// solves.
+    /// \param criteria Convergence criteria.
+    /// \param option Optimization option; its reference node is used
+    /// for the full solves.
+    void Update(PoseGraph &pose_graph,
+                const GlobalOptimizationMethod &method =
+                        GlobalOptimizationLevenbergMarquardt(),
+                const GlobalOptimizationConvergenceCriteria &criteria =
+                        GlobalOptimizationConvergenceCriteria(),
+                const GlobalOptimizationOption &option =
+                        GlobalOptimizationOption());
+
+private:
+    int full_solve_interval_;
+    int local_hops_;
+    size_t optimized_num_edges_;
+    int updates_since_full_solve_;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
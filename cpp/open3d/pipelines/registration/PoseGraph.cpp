@@ -127,6 +127,66 @@ PoseGraph::PoseGraph() {}
 
 PoseGraph::~PoseGraph() {}
 
+void PoseGraph::AddNodes(const std::vector<Eigen::Matrix4d_u> &poses) {
+    nodes_.reserve(nodes_.size() + poses.size());
+    for (const auto &pose : poses) {
+        nodes_.push_back(PoseGraphNode(pose));
+    }
+}
+
+void PoseGraph::AddEdges(const std::vector<PoseGraphEdge> &edges) {
+    edges_.reserve(edges_.size() + edges.size());
+    edges_.insert(edges_.end(), edges.begin(), edges.end());
+}
+
+std::vector<Eigen::Matrix4d_u> PoseGraph::GetNodePoses() const {
+    std::vector<Eigen::Matrix4d_u> poses;
+    poses.reserve(nodes_.size());
+    for (const auto &node : nodes_) {
+        poses.push_back(node.pose_);
+    }
+    return poses;
+}
+
+void PoseGraph::SetNodePoses(const std::vector<Eigen::Matrix4d_u> &poses) {
+    if (poses.size() != nodes_.size()) {
+        utility::LogError(
+                "SetNodePoses: got {:d} poses for {:d} nodes.", poses.size(),
+                nodes_.size());
+    }
+    for (size_t i = 0; i < poses.size(); i++) {
+        nodes_[i].pose_ = poses[i];
+    }
+}
+
+std::vector<Eigen::Vector2i> PoseGraph::GetEdgeNodeIndices() const {
+    std::vector<Eigen::Vector2i> indices;
+    indices.reserve(edges_.size());
+    for (const auto &edge : edges_) {
+        indices.push_back(
+                Eigen::Vector2i(edge.source_node_id_, edge.target_node_id_));
+    }
+    return indices;
+}
+
+std::vector<Eigen::Matrix4d_u> PoseGraph::GetEdgeTransformations() const {
+    std::vector<Eigen::Matrix4d_u> transformations;
+    transformations.reserve(edges_.size());
+    for (const auto &edge : edges_) {
+        transformations.push_back(edge.transformation_);
+    }
+    return transformations;
+}
+
+std::vector<Eigen::Matrix6d_u> PoseGraph::GetEdgeInformationMatrices() const {
+    std::vector<Eigen::Matrix6d_u> informations;
+    informations.reserve(edges_.size());
+    for (const auto &edge : edges_) {
+        informations.push_back(edge.information_);
+    }
+    return informations;
+}
+
 bool PoseGraph::ConvertToJsonValue(Json::Value &value) const {
     value["class_name"] = "PoseGraph";
     value["version_major"] = 1;
@@ -122,6 +122,41 @@ public:
     bool ConvertToJsonValue(Json::Value &value) const override;
     bool ConvertFromJsonValue(const Json::Value &value) override;
 
+    /// \brief Appends one node per pose, growing nodes_ with a single
+    /// reservation.
+    ///
+    /// Use this instead of per-node push_back when building a graph of
+    /// known size; repeated push_back reallocates the Eigen-heavy node
+    /// structs logarithmically often.
+    void AddNodes(const std::vector<Eigen::Matrix4d_u> &poses);
+
+    /// \brief Appends \p edges to edges_ with a single reservation.
+    void AddEdges(const std::vector<PoseGraphEdge> &edges);
+
+    /// \brief Returns the node poses gathered into one contiguous
+    /// array.
+    ///
+    /// The flat layout lets optimization code stream all poses without
+    /// striding over the node structs. Write results back with
+    /// SetNodePoses().
+    std::vector<Eigen::Matrix4d_u> GetNodePoses() const;
+
+    /// \brief Overwrites the node poses from a flat array, the inverse
+    /// of GetNodePoses(). \p poses must have one entry per node.
+    void SetNodePoses(const std::vector<Eigen::Matrix4d_u> &poses);
+
+    /// \brief Returns (source_node_id, target_node_id) of every edge
+    /// as one contiguous array.
+    std::vector<Eigen::Vector2i> GetEdgeNodeIndices() const;
+
+    /// \brief Returns the edge transformations gathered into one
+    /// contiguous array.
+    std::vector<Eigen::Matrix4d_u> GetEdgeTransformations() const;
+
+    /// \brief Returns the edge information matrices gathered into one
+    /// contiguous array.
+    std::vector<Eigen::Matrix6d_u> GetEdgeInformationMatrices() const;
+
 public:
     /// List of PoseGraphNode.
     std::vector<PoseGraphNode> nodes_;
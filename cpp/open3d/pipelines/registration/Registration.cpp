@@ -26,76 +26,119 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <mutex>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Profiler.h"
+#include "open3d/utility/Random.h"
+#include "open3d/utility/ThreadPool.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+
+/// Buffers for the correspondence search that are reused across
+/// repeated calls (one ICP iteration each), so the iterations after the
+/// first run without growing any allocation.
+struct CorrespondenceWorkspace {
+    /// Matched target index per source point, -1 when unmatched.
+    std::vector<int> corres_target;
+    /// Squared distance of the match per source point.
+    std::vector<double> corres_dist2;
+};
+
+}  // unnamed namespace
+
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
+        const Eigen::Matrix4d &transformation,
+        CorrespondenceWorkspace &workspace) {
     RegistrationResult result(transformation);
     if (max_correspondence_distance <= 0.0) {
         return result;
     }
 
+    const int num_points = (int)source.points_.size();
+    workspace.corres_target.resize(num_points);
+    workspace.corres_dist2.resize(num_points);
+
     double error2 = 0.0;
+    int64_t corres_number = 0;
 
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
+    std::mutex reduction_mutex;
+    utility::ThreadPool::GetInstance().ParallelForRange(
+            0, num_points, [&](int64_t lo, int64_t hi) {
+                // Per-chunk KNN buffers, reused for every query of the
+                // chunk instead of being allocated per point.
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                double error2_private = 0.0;
+                int64_t corres_number_private = 0;
+                for (int64_t i = lo; i < hi; i++) {
+                    const auto &point = source.points_[i];
+                    if (target_kdtree.SearchHybrid(
+                                point, max_correspondence_distance, 1, indices,
+                                dists) > 0) {
+                        workspace.corres_target[i] = indices[0];
+                        workspace.corres_dist2[i] = dists[0];
+                        error2_private += dists[0];
+                        corres_number_private++;
+                    } else {
+                        workspace.corres_target[i] = -1;
+                    }
+                }
+                std::lock_guard<std::mutex> lock(reduction_mutex);
+                error2 += error2_private;
+                corres_number += corres_number_private;
+            });
+
+    // Compacting the per-point matches in source order makes the
+    // correspondence set deterministic; the order no longer depends on
+    // which thread finished first.
+    result.correspondence_set_.resize(corres_number);
+    int64_t k = 0;
+    for (int i = 0; i < num_points; i++) {
+        if (workspace.corres_target[i] >= 0) {
+            result.correspondence_set_[k++] =
+                    Eigen::Vector2i(i, workspace.corres_target[i]);
         }
-#ifdef _OPENMP
     }
-#endif
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
         result.inlier_rmse_ = 0.0;
     } else {
-        size_t corres_number = result.correspondence_set_.size();
         result.fitness_ = (double)corres_number / (double)source.points_.size();
         result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
     }
     return result;
 }
 
+static RegistrationResult GetRegistrationResultAndCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    CorrespondenceWorkspace workspace;
+    return GetRegistrationResultAndCorrespondences(
+            source, target, target_kdtree, max_correspondence_distance,
+            transformation, workspace);
+}
+
 static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -125,6 +168,50 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+struct RegistrationTarget::Impl {
+    geometry::PointCloud target_;
+    geometry::KDTreeFlann kdtree_;
+    geometry::KDTreeFlann kdtree_feature_;
+    bool has_feature_tree_ = false;
+};
+
+RegistrationTarget::RegistrationTarget(const geometry::PointCloud &target)
+    : impl_(new Impl()) {
+    impl_->target_ = target;
+    impl_->kdtree_.SetGeometry(impl_->target_);
+}
+
+RegistrationTarget::RegistrationTarget(const geometry::PointCloud &target,
+                                       const Feature &target_feature)
+    : impl_(new Impl()) {
+    impl_->target_ = target;
+    impl_->kdtree_.SetGeometry(impl_->target_);
+    impl_->kdtree_feature_.SetFeature(target_feature);
+    impl_->has_feature_tree_ = true;
+}
+
+RegistrationTarget::~RegistrationTarget() {}
+
+const geometry::PointCloud &RegistrationTarget::GetPointCloud() const {
+    return impl_->target_;
+}
+
+const geometry::KDTreeFlann &RegistrationTarget::GetPointKDTree() const {
+    return impl_->kdtree_;
+}
+
+bool RegistrationTarget::HasFeatureKDTree() const {
+    return impl_->has_feature_tree_;
+}
+
+const geometry::KDTreeFlann &RegistrationTarget::GetFeatureKDTree() const {
+    if (!impl_->has_feature_tree_) {
+        utility::LogError(
+                "The RegistrationTarget was prepared without a feature.");
+    }
+    return impl_->kdtree_feature_;
+}
+
 RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -141,18 +228,25 @@ RegistrationResult EvaluateRegistration(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
 
-RegistrationResult RegistrationICP(
+RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+        const RegistrationTarget &target,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        const ICPConvergenceCriteria
-                &criteria /* = ICPConvergenceCriteria()*/) {
-    if (max_correspondence_distance <= 0.0) {
-        utility::LogError("Invalid max_correspondence_distance.");
+        const Eigen::Matrix4d
+                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+    geometry::PointCloud pcd = source;
+    if (!transformation.isIdentity()) {
+        pcd.Transform(transformation);
     }
+    return GetRegistrationResultAndCorrespondences(
+            pcd, target.GetPointCloud(), target.GetPointKDTree(),
+            max_correspondence_distance, transformation);
+}
+
+static void CheckICPEstimationCompatibility(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const TransformationEstimation &estimation) {
     if ((estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::PointToPlane ||
          estimation.GetTransformationEstimationType() ==
@@ -163,17 +257,38 @@ RegistrationResult RegistrationICP(
                 "TransformationEstimationColoredICP "
                 "require pre-computed normal vectors.");
     }
+}
 
+/// The iteration loop shared by RegistrationICP and the levels of
+/// RegistrationMultiScaleICP; the caller provides the KD-tree so
+/// repeated passes against the same target build it only once.
+static RegistrationResult RunICPIterations(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria,
+        const RegistrationResult *warm_start = nullptr) {
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
     }
+    // One workspace for all iterations; after the first search the
+    // iterations reuse its buffers instead of reallocating them.
+    CorrespondenceWorkspace workspace;
     RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+    if (warm_start != nullptr && !warm_start->correspondence_set_.empty()) {
+        // The caller already searched the correspondences at init
+        // (e.g. in EvaluateRegistration); skip the first search.
+        result = *warm_start;
+    } else {
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, target_kdtree, max_correspondence_distance,
+                transformation, workspace);
+    }
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
@@ -183,8 +298,8 @@ RegistrationResult RegistrationICP(
         pcd.Transform(update);
         RegistrationResult backup = result;
         result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
+                pcd, target, target_kdtree, max_correspondence_distance,
+                transformation, workspace);
         if (std::abs(backup.fitness_ - result.fitness_) <
                     criteria.relative_fitness_ &&
             std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
@@ -195,6 +310,137 @@ RegistrationResult RegistrationICP(
     return result;
 }
 
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/,
+        int num_threads /* = 0*/) {
+    utility::ProfilerZone zone("RegistrationICP");
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    CheckICPEstimationCompatibility(source, target, estimation);
+
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RunICPIterations(source, target, kdtree,
+                            max_correspondence_distance, init, estimation,
+                            criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/,
+        int num_threads /* = 0*/) {
+    utility::ProfilerZone zone("RegistrationICP");
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    CheckICPEstimationCompatibility(source, target.GetPointCloud(),
+                                    estimation);
+
+    return RunICPIterations(source, target.GetPointCloud(),
+                            target.GetPointKDTree(),
+                            max_correspondence_distance, init, estimation,
+                            criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const RegistrationResult &init_result,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/,
+        int num_threads /* = 0*/) {
+    utility::ProfilerZone zone("RegistrationICP");
+    utility::ScopedNumThreads scoped_num_threads(num_threads);
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    CheckICPEstimationCompatibility(source, target, estimation);
+
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RunICPIterations(source, target, kdtree,
+                            max_correspondence_distance,
+                            init_result.transformation_, estimation, criteria,
+                            &init_result);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const std::vector<ICPConvergenceCriteria> &criterias /* = {}*/) {
+    if (voxel_sizes.empty()) {
+        utility::LogError("Invalid voxel_sizes: no levels given.");
+    }
+    if (max_correspondence_distances.size() != voxel_sizes.size()) {
+        utility::LogError(
+                "voxel_sizes and max_correspondence_distances must have the "
+                "same length.");
+    }
+    if (!criterias.empty() && criterias.size() != voxel_sizes.size()) {
+        utility::LogError(
+                "criterias must be empty or match voxel_sizes in length.");
+    }
+    for (size_t l = 0; l < voxel_sizes.size(); l++) {
+        if (max_correspondence_distances[l] <= 0.0) {
+            utility::LogError("Invalid max_correspondence_distance.");
+        }
+    }
+    CheckICPEstimationCompatibility(source, target, estimation);
+
+    Eigen::Matrix4d transformation = init;
+    RegistrationResult result(transformation);
+    for (size_t l = 0; l < voxel_sizes.size(); l++) {
+        // Each level is built once; the previous level's result warm
+        // starts the next one.
+        std::shared_ptr<geometry::PointCloud> source_down;
+        std::shared_ptr<geometry::PointCloud> target_down;
+        const geometry::PointCloud *source_level = &source;
+        const geometry::PointCloud *target_level = &target;
+        if (voxel_sizes[l] > 0.0) {
+            source_down = source.VoxelDownSampleParallel(voxel_sizes[l]);
+            target_down = target.VoxelDownSampleParallel(voxel_sizes[l]);
+            source_level = source_down.get();
+            target_level = target_down.get();
+        }
+        geometry::KDTreeFlann kdtree;
+        kdtree.SetGeometry(*target_level);
+        result = RunICPIterations(
+                *source_level, *target_level, kdtree,
+                max_correspondence_distances[l], transformation, estimation,
+                criterias.empty() ? ICPConvergenceCriteria() : criterias[l]);
+        transformation = result.transformation_;
+        utility::LogDebug(
+                "Multi-scale ICP level #{:d} (voxel {:.4f}): Fitness {:.4f}, "
+                "RMSE {:.4f}",
+                int(l), voxel_sizes[l], result.fitness_, result.inlier_rmse_);
+    }
+    return result;
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -212,13 +458,16 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     Eigen::Matrix4d transformation;
     CorrespondenceSet ransac_corres(ransac_n);
     RegistrationResult result;
+    utility::random::Philox &rng = utility::random::GetThreadLocalEngine();
+    std::vector<int> sample(ransac_n);
 
     for (int itr = 0;
          itr < criteria.max_iteration_ && itr < criteria.max_validation_;
          itr++) {
+        utility::random::SampleWithoutReplacement(
+                rng, int64_t(corres.size()), ransac_n, sample.data());
         for (int j = 0; j < ransac_n; j++) {
-            ransac_corres[j] = corres[utility::UniformRandInt(
-                    0, static_cast<int>(corres.size()) - 1)];
+            ransac_corres[j] = corres[sample[j]];
         }
         transformation =
                 estimation.ComputeTransformation(source, target, ransac_corres);
@@ -238,19 +487,21 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     return result;
 }
 
-RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+/// The RANSAC loop of RegistrationRANSACBasedOnFeatureMatching, with
+/// the target KD-trees provided by the caller so drivers registering
+/// many pairs against the same target build them only once.
+static RegistrationResult RunRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const Feature &source_feature,
-        const Feature &target_feature,
+        const geometry::KDTreeFlann &kdtree,
+        const geometry::KDTreeFlann &kdtree_feature,
         double max_correspondence_distance,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        int ransac_n /* = 4*/,
+        const TransformationEstimation &estimation,
+        int ransac_n,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
-                &checkers /* = {}*/,
-        const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+                &checkers,
+        const RANSACConvergenceCriteria &criteria) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -260,15 +511,33 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     bool finished_validation = false;
     int num_similar_features = 1;
     std::vector<std::vector<int>> similar_features(source.points_.size());
+    // Best fitness of any fully validated hypothesis so far, shared
+    // between the threads. It is read without a lock in the prescreen
+    // below; a stale value only lets one extra hypothesis through, so
+    // the race is benign (same pattern as finished_validation).
+    double best_fitness = 0.0;
+    // The prescreen validates a hypothesis on a decimated subset of the
+    // source before paying for the full sweep. The subset fitness is
+    // noisy, so a hypothesis survives when it reaches a fraction of the
+    // best full fitness instead of beating it outright.
+    const int prescreen_stride =
+            std::max(1, static_cast<int>(source.points_.size()) / 1000);
+    const double prescreen_slack = 0.75;
 
 #ifdef _OPENMP
 #pragma omp parallel
     {
 #endif
         CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
         RegistrationResult result_private;
+        utility::random::Philox &rng = utility::random::GetThreadLocalEngine();
+        // Per-thread scratch reused by every hypothesis this thread
+        // validates: the transformed cloud, the correspondence
+        // workspace and the prescreen KNN buffers.
+        geometry::PointCloud pcd;
+        CorrespondenceWorkspace workspace;
+        std::vector<int> prescreen_indices(1);
+        std::vector<double> prescreen_dists(1);
 
 #ifdef _OPENMP
 #pragma omp for nowait
@@ -278,8 +547,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 std::vector<double> dists(num_similar_features);
                 Eigen::Matrix4d transformation;
                 for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id = utility::UniformRandInt(
-                            0, static_cast<int>(source.points_.size()) - 1);
+                    int source_sample_id = int(rng.BoundedUInt32(
+                            uint32_t(source.points_.size())));
                     if (similar_features[source_sample_id].empty()) {
                         std::vector<int> indices(num_similar_features);
                         kdtree_feature.SearchKNN(
@@ -296,9 +565,10 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                         ransac_corres[j](1) =
                                 similar_features[source_sample_id][0];
                     else {
-                        ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
+                        ransac_corres[j](1) =
+                                similar_features[source_sample_id]
+                                                [rng.BoundedUInt32(uint32_t(
+                                                        num_similar_features))];
                     }
                 }
                 bool check = true;
@@ -323,11 +593,41 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                     }
                 }
                 if (!check) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
+                const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+                const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+                if (best_fitness > 0.0) {
+                    // Decimated prescreen: count matches on every
+                    // prescreen_stride-th source point and skip the
+                    // full sweep when the estimate cannot approach the
+                    // best hypothesis so far.
+                    int sampled = 0;
+                    int matched = 0;
+                    for (size_t i = 0; i < source.points_.size();
+                         i += prescreen_stride) {
+                        Eigen::Vector3d query = R * source.points_[i] + t;
+                        sampled++;
+                        if (kdtree.SearchHybrid(query,
+                                                max_correspondence_distance, 1,
+                                                prescreen_indices,
+                                                prescreen_dists) > 0) {
+                            matched++;
+                        }
+                    }
+                    if ((double)matched <
+                        prescreen_slack * best_fitness * (double)sampled) {
+                        continue;
+                    }
+                }
+                // Transform into the reused buffer; only the points are
+                // needed for the evaluation, so the full cloud copy of
+                // normals and colors is avoided.
+                pcd.points_.resize(source.points_.size());
+                for (size_t i = 0; i < source.points_.size(); i++) {
+                    pcd.points_[i] = R * source.points_[i] + t;
+                }
                 auto this_result = GetRegistrationResultAndCorrespondences(
                         pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
+                        transformation, workspace);
                 if (this_result.fitness_ > result_private.fitness_ ||
                     (this_result.fitness_ == result_private.fitness_ &&
                      this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
@@ -340,6 +640,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                     total_validation = total_validation + 1;
                     if (total_validation >= criteria.max_validation_)
                         finished_validation = true;
+                    if (this_result.fitness_ > best_fitness) {
+                        best_fitness = this_result.fitness_;
+                    }
                 }
             }  // end of if statement
         }      // end of for-loop
@@ -362,21 +665,113 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     return result;
 }
 
-Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const Feature &target_feature,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
-    geometry::PointCloud pcd = source;
-    if (!transformation.isIdentity()) {
-        pcd.Transform(transformation);
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 4*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
     }
-    RegistrationResult result;
-    geometry::KDTreeFlann target_kdtree(target);
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, target_kdtree, max_correspondence_distance,
-            transformation);
+    geometry::KDTreeFlann kdtree(target);
+    geometry::KDTreeFlann kdtree_feature(target_feature);
+    return RunRANSACBasedOnFeatureMatching(
+            source, target, source_feature, kdtree, kdtree_feature,
+            max_correspondence_distance, estimation, ransac_n, checkers,
+            criteria);
+}
+
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        const Feature &source_feature,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 4*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+    if (!target.HasFeatureKDTree()) {
+        utility::LogError(
+                "The RegistrationTarget was prepared without a feature.");
+    }
+    return RunRANSACBasedOnFeatureMatching(
+            source, target.GetPointCloud(), source_feature,
+            target.GetPointKDTree(), target.GetFeatureKDTree(),
+            max_correspondence_distance, estimation, ransac_n, checkers,
+            criteria);
+}
 
+std::vector<RegistrationResult> RegistrationMultiPair(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<Feature> &features,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 4*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/) {
+    if (features.size() != fragments.size()) {
+        utility::LogError(
+                "fragments and features must have the same length.");
+    }
+    int n_fragments = (int)fragments.size();
+    for (const auto &pair : pairs) {
+        if (pair.first < 0 || pair.first >= n_fragments || pair.second < 0 ||
+            pair.second >= n_fragments) {
+            utility::LogError("A pair references an invalid fragment index.");
+        }
+    }
+
+    // The per-fragment KD-trees are the shared part of the O(N^2) pair
+    // registrations; build them once, in parallel.
+    std::vector<geometry::KDTreeFlann> point_trees(fragments.size());
+    std::vector<geometry::KDTreeFlann> feature_trees(fragments.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < n_fragments; i++) {
+        point_trees[i].SetGeometry(fragments[i]);
+        feature_trees[i].SetFeature(features[i]);
+    }
+
+    // Each pair is independent; the RANSAC loops inside run serially
+    // when scheduled from this outer parallel region, so the pairs
+    // spread across the threads instead.
+    std::vector<RegistrationResult> results(pairs.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int p = 0; p < (int)pairs.size(); p++) {
+        int s = pairs[p].first;
+        int t = pairs[p].second;
+        results[p] = RunRANSACBasedOnFeatureMatching(
+                fragments[s], fragments[t], features[s], point_trees[t],
+                feature_trees[t], max_correspondence_distance, estimation,
+                ransac_n, checkers, criteria);
+    }
+    return results;
+}
+
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences) {
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
@@ -390,8 +785,8 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
+        for (int c = 0; c < int(correspondences.size()); c++) {
+            int t = correspondences[c](1);
             double x = target.points_[t](0);
             double y = target.points_[t](1);
             double z = target.points_[t](2);
@@ -421,6 +816,24 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     return GTG;
 }
 
+Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    geometry::PointCloud pcd = source;
+    if (!transformation.isIdentity()) {
+        pcd.Transform(transformation);
+    }
+    RegistrationResult result;
+    geometry::KDTreeFlann target_kdtree(target);
+    result = GetRegistrationResultAndCorrespondences(
+            pcd, target, target_kdtree, max_correspondence_distance,
+            transformation);
+    return GetInformationMatrixFromCorrespondences(target,
+                                                   result.correspondence_set_);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
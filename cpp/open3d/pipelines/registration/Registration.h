@@ -27,7 +27,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
@@ -38,7 +40,8 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
-}
+class KDTreeFlann;
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
@@ -132,6 +135,48 @@ public:
     double fitness_;
 };
 
+/// \class RegistrationTarget
+///
+/// \brief A target point cloud prepared for repeated registration
+/// calls.
+///
+/// Builds the point KD-tree (and, when a feature is given, the feature
+/// KD-tree) once at construction, so callers that register many
+/// sources against the same target pay for index construction once
+/// instead of once per call. The point cloud (with its normals) is
+/// copied, which keeps the object self-contained. Accepted by the
+/// EvaluateRegistration, RegistrationICP and
+/// RegistrationRANSACBasedOnFeatureMatching overloads below.
+class RegistrationTarget {
+public:
+    /// \brief Prepares \p target for EvaluateRegistration and
+    /// RegistrationICP.
+    explicit RegistrationTarget(const geometry::PointCloud &target);
+    /// \brief Prepares \p target and \p target_feature, additionally
+    /// enabling RegistrationRANSACBasedOnFeatureMatching.
+    RegistrationTarget(const geometry::PointCloud &target,
+                       const Feature &target_feature);
+    ~RegistrationTarget();
+    RegistrationTarget(const RegistrationTarget &) = delete;
+    RegistrationTarget &operator=(const RegistrationTarget &) = delete;
+
+    /// Returns the copied target point cloud.
+    const geometry::PointCloud &GetPointCloud() const;
+    /// Returns the KD-tree over the target points.
+    const geometry::KDTreeFlann &GetPointKDTree() const;
+    /// Returns true if a feature KD-tree was built.
+    bool HasFeatureKDTree() const;
+    /// Returns the KD-tree over the target features; only valid when
+    /// HasFeatureKDTree() is true.
+    const geometry::KDTreeFlann &GetFeatureKDTree() const;
+
+private:
+    // The KD-trees only live in the implementation file, keeping the
+    // heavy KDTreeFlann header out of this one.
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -146,6 +191,21 @@ RegistrationResult EvaluateRegistration(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
 
+/// \brief Overload of EvaluateRegistration against a prepared target,
+/// reusing its KD-tree instead of building one per call.
+///
+/// \param source The source point cloud.
+/// \param target The prepared target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
+
 /// \brief Functions for ICP registration.
 ///
 /// \param source The source point cloud.
@@ -156,6 +216,8 @@ RegistrationResult EvaluateRegistration(
 ///  [0., 0., 0., 1.]])
 /// \param estimation Estimation method.
 /// \param criteria Convergence criteria.
+/// \param num_threads If positive, caps the number of threads used by this
+/// call; 0 uses the global setting (utility::SetNumThreads).
 RegistrationResult RegistrationICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -163,7 +225,89 @@ RegistrationResult RegistrationICP(
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint(false),
-        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        int num_threads = 0);
+
+/// \brief Overload of RegistrationICP against a prepared target,
+/// reusing its KD-tree instead of building one per call.
+///
+/// \param source The source point cloud.
+/// \param target The prepared target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \param num_threads If positive, caps the number of threads used by this
+/// call; 0 uses the global setting (utility::SetNumThreads).
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        int num_threads = 0);
+
+/// \brief ICP warm-started from a previous evaluation.
+///
+/// Overload that reuses the correspondence set of \p init_result (e.g.
+/// the output of EvaluateRegistration on the same clouds) instead of
+/// running the first correspondence search again; the iterations start
+/// from init_result.transformation_. The correspondences must have
+/// been computed at that transformation with the same
+/// max_correspondence_distance, otherwise the first update is based on
+/// stale matches.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init_result Result of a previous evaluation at the initial
+/// transformation; an empty correspondence set falls back to a fresh
+/// search.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \param num_threads If positive, caps the number of threads used by this
+/// call; 0 uses the global setting (utility::SetNumThreads).
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const RegistrationResult &init_result,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        int num_threads = 0);
+
+/// \brief Coarse-to-fine ICP over a voxel downsampling pyramid.
+///
+/// Runs one ICP pass per level, warm-starting every level with the
+/// transformation of the previous one. The downsampled clouds and the
+/// per-level KD-trees are built once internally, which replaces the
+/// repeated external downsample/tree builds of a hand-rolled pyramid.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size per level, in the order the levels run
+/// (typically decreasing); a value <= 0 uses the full resolution cloud.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance per level; must match voxel_sizes in length.
+/// \param init Initial transformation estimation of the first level.
+/// \param estimation Estimation method.
+/// \param criterias Convergence criteria per level; empty uses the
+/// default criteria on every level, otherwise the length must match
+/// voxel_sizes.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const std::vector<ICPConvergenceCriteria> &criterias = {});
 
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
@@ -210,6 +354,60 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const RANSACConvergenceCriteria &criteria =
                 RANSACConvergenceCriteria());
 
+/// \brief Overload of RegistrationRANSACBasedOnFeatureMatching against
+/// a prepared target, reusing its point and feature KD-trees instead
+/// of building both per call. The target must have been prepared with
+/// its feature.
+///
+/// \param source The source point cloud.
+/// \param target The prepared target, constructed with a feature.
+/// \param source_feature Source point cloud feature.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. \param ransac_n Fit ransac with `ransac_n` correspondences. \param
+/// checkers Correspondence checker. \param criteria Convergence criteria.
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        const Feature &source_feature,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        int ransac_n = 4,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers = {},
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
+/// \brief Registers many fragment pairs with shared per-fragment data.
+///
+/// Builds the point and feature KD-trees of every fragment once and
+/// schedules the pair registrations across the available threads, so
+/// the O(N^2) candidate pairs of a fragment-based reconstruction reuse
+/// the per-fragment work instead of rebuilding it for every pair.
+///
+/// \param fragments The fragment point clouds.
+/// \param features Per-fragment features, aligned with \p fragments.
+/// \param pairs The (source index, target index) pairs to register.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param checkers Correspondence checker.
+/// \param criteria Convergence criteria, applied per pair.
+/// \return One RegistrationResult per entry of \p pairs, in order.
+std::vector<RegistrationResult> RegistrationMultiPair(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<Feature> &features,
+        const std::vector<std::pair<int, int>> &pairs,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        int ransac_n = 4,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers = {},
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param max_correspondence_distance Maximum correspondence points-pair
@@ -221,6 +419,23 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation);
 
+/// \brief Same as GetInformationMatrixFromPointClouds, but reuses a
+/// precomputed correspondence set instead of re-running the
+/// correspondence search.
+///
+/// When the information matrix is needed right after a registration,
+/// pass RegistrationResult::correspondence_set_ here; that turns the
+/// O(N log N) search of GetInformationMatrixFromPointClouds into a
+/// parallel reduction over the correspondences, which matters when
+/// information matrices are computed for many fragment pairs.
+///
+/// \param target The target point cloud.
+/// \param correspondences Correspondences as (source index, target
+/// index) pairs; only the target side is used.
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
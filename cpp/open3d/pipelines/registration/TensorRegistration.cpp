@@ -0,0 +1,272 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/TensorRegistration.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+#include <Eigen/SVD>
+#include <cmath>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+namespace {
+
+/// Reduces a tensor of any shape to one double on the host; the
+/// reduction itself runs on the tensor's device.
+double SumAllToDouble(const core::Tensor &t) {
+    core::SizeVector dims(t.GetShape().size());
+    for (size_t d = 0; d < dims.size(); d++) {
+        dims[d] = int64_t(d);
+    }
+    return t.Sum(dims).To(core::Dtype::Float64).Item<double>();
+}
+
+double ScalarToDouble(const core::Tensor &t) {
+    return t.To(core::Dtype::Float64).Item<double>();
+}
+
+/// Applies a rigid transformation to {n, 3} points, written as
+/// column-wise multiply-adds so it stays on the device.
+core::Tensor TransformPoints(const core::Tensor &points,
+                             const Eigen::Matrix4d &transformation) {
+    core::Tensor x = points.Slice(1, 0, 1);
+    core::Tensor y = points.Slice(1, 1, 2);
+    core::Tensor z = points.Slice(1, 2, 3);
+    core::Tensor result = core::Tensor::Empty(
+            points.GetShape(), points.GetDtype(), points.GetDevice());
+    for (int r = 0; r < 3; r++) {
+        core::Tensor row = x.Mul(transformation(r, 0))
+                                   .Add(y.Mul(transformation(r, 1)))
+                                   .Add(z.Mul(transformation(r, 2)))
+                                   .Add(transformation(r, 3));
+        result.Slice(1, r, r + 1).SetItem(row);
+    }
+    return result;
+}
+
+/// Brute force nearest neighbor of every query in target, chunked so
+/// that the {chunk, m} distance matrix stays within a fixed budget.
+void BruteForceNearestNeighbor(const core::Tensor &query,
+                               const core::Tensor &target,
+                               core::Tensor &indices,
+                               core::Tensor &dist2) {
+    const int64_t n = query.GetShape()[0];
+    const int64_t m = target.GetShape()[0];
+    indices = core::Tensor::Empty({n}, core::Dtype::Int64, query.GetDevice());
+    dist2 = core::Tensor::Empty({n}, query.GetDtype(), query.GetDevice());
+    // ~128M distance matrix elements per chunk.
+    const int64_t chunk = std::max(int64_t(1), (int64_t(1) << 27) / m);
+    core::Tensor target_row = target.View({1, m, 3});
+    for (int64_t begin = 0; begin < n; begin += chunk) {
+        const int64_t end = std::min(begin + chunk, n);
+        core::Tensor q = query.Slice(0, begin, end).View({end - begin, 1, 3});
+        core::Tensor diff = q.Sub(target_row);
+        core::Tensor d2 = diff.Mul(diff).Sum({2});
+        indices.Slice(0, begin, end).SetItem(d2.ArgMin({1}));
+        dist2.Slice(0, begin, end).SetItem(d2.Min({1}));
+    }
+}
+
+/// Kabsch solve for the point-to-point update; the 3x3 covariance and
+/// the centroids come to the host, the SVD is on 3x3 only.
+Eigen::Matrix4d SolvePointToPoint(const core::Tensor &source_sel,
+                                  const core::Tensor &target_sel) {
+    const double k = double(source_sel.GetShape()[0]);
+    core::Tensor source_mean = source_sel.Sum({0}, true).Div(k);
+    core::Tensor target_mean = target_sel.Sum({0}, true).Div(k);
+    core::Tensor source_c = source_sel.Sub(source_mean);
+    core::Tensor target_c = target_sel.Sub(target_mean);
+    Eigen::Matrix3d H;
+    Eigen::Vector3d mean_s, mean_t;
+    for (int i = 0; i < 3; i++) {
+        mean_s(i) = ScalarToDouble(source_mean[0][i]);
+        mean_t(i) = ScalarToDouble(target_mean[0][i]);
+        for (int j = 0; j < 3; j++) {
+            H(i, j) = SumAllToDouble(
+                    source_c.Slice(1, i, i + 1).Mul(target_c.Slice(1, j,
+                                                                   j + 1)));
+        }
+    }
+    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+            H, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    Eigen::Matrix3d D = Eigen::Matrix3d::Identity();
+    D(2, 2) = (svd.matrixV() * svd.matrixU().transpose()).determinant();
+    Eigen::Matrix3d R = svd.matrixV() * D * svd.matrixU().transpose();
+    Eigen::Matrix4d update = Eigen::Matrix4d::Identity();
+    update.block<3, 3>(0, 0) = R;
+    update.block<3, 1>(0, 3) = mean_t - R * mean_s;
+    return update;
+}
+
+/// Point-to-plane normal equations; the 6x6 system is accumulated on
+/// the device column pair by column pair and solved on the host.
+Eigen::Matrix4d SolvePointToPlane(const core::Tensor &source_sel,
+                                  const core::Tensor &target_sel,
+                                  const core::Tensor &normal_sel) {
+    core::Tensor sx = source_sel.Slice(1, 0, 1);
+    core::Tensor sy = source_sel.Slice(1, 1, 2);
+    core::Tensor sz = source_sel.Slice(1, 2, 3);
+    core::Tensor nx = normal_sel.Slice(1, 0, 1);
+    core::Tensor ny = normal_sel.Slice(1, 1, 2);
+    core::Tensor nz = normal_sel.Slice(1, 2, 3);
+    core::Tensor r =
+            source_sel.Sub(target_sel).Mul(normal_sel).Sum({1}, true);
+    core::Tensor cols[6] = {sy.Mul(nz).Sub(sz.Mul(ny)),
+                            sz.Mul(nx).Sub(sx.Mul(nz)),
+                            sx.Mul(ny).Sub(sy.Mul(nx)),
+                            nx,
+                            ny,
+                            nz};
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    for (int i = 0; i < 6; i++) {
+        for (int j = i; j < 6; j++) {
+            JTJ(i, j) = SumAllToDouble(cols[i].Mul(cols[j]));
+            JTJ(j, i) = JTJ(i, j);
+        }
+        JTr(i) = SumAllToDouble(cols[i].Mul(r));
+    }
+    Eigen::Vector6d xi = JTJ.ldlt().solve(-JTr);
+    return utility::TransformVector6dToMatrix4d(xi);
+}
+
+}  // unnamed namespace
+
+RegistrationResult RegistrationICPTensor(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        TransformationEstimationType estimation_type
+        /* = TransformationEstimationType::PointToPoint*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if (estimation_type != TransformationEstimationType::PointToPoint &&
+        estimation_type != TransformationEstimationType::PointToPlane) {
+        utility::LogError(
+                "RegistrationICPTensor supports PointToPoint and "
+                "PointToPlane estimation only.");
+    }
+    if (source_points.GetShape().size() != 2 ||
+        source_points.GetShape()[1] != 3 ||
+        target_points.GetShape().size() != 2 ||
+        target_points.GetShape()[1] != 3) {
+        utility::LogError("Source and target points must have shape {n, 3}.");
+    }
+    if (source_points.GetDtype() != core::Dtype::Float32 &&
+        source_points.GetDtype() != core::Dtype::Float64) {
+        utility::LogError("Points must be Float32 or Float64.");
+    }
+    if (target_points.GetDtype() != source_points.GetDtype() ||
+        target_points.GetDevice() != source_points.GetDevice()) {
+        utility::LogError(
+                "Source and target must share one dtype and device.");
+    }
+    const bool use_normals =
+            estimation_type == TransformationEstimationType::PointToPlane;
+    if (use_normals &&
+        (target_normals.GetShape() != target_points.GetShape() ||
+         target_normals.GetDtype() != target_points.GetDtype() ||
+         target_normals.GetDevice() != target_points.GetDevice())) {
+        utility::LogError(
+                "PointToPlane requires target normals of the same shape, "
+                "dtype and device as the target points.");
+    }
+
+    const int64_t num_points = source_points.GetShape()[0];
+    const double max_dist2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    Eigen::Matrix4d transformation = init;
+    RegistrationResult result(transformation);
+    double prev_fitness = 0.0;
+    double prev_rmse = 0.0;
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        core::Tensor transformed = TransformPoints(source_points,
+                                                   transformation);
+        core::Tensor nn_indices, nn_dist2;
+        BruteForceNearestNeighbor(transformed, target_points, nn_indices,
+                                  nn_dist2);
+        core::Tensor mask = nn_dist2.Le(core::Tensor::Full(
+                {}, max_dist2, nn_dist2.GetDtype(), nn_dist2.GetDevice()));
+        core::Tensor valid = mask.NonZeroNumpy()[0];
+        const int64_t num_corres = valid.GetShape()[0];
+        if (num_corres == 0) {
+            utility::LogWarning(
+                    "RegistrationICPTensor: no correspondences within "
+                    "max_correspondence_distance.");
+            result.transformation_ = transformation;
+            result.fitness_ = 0.0;
+            result.inlier_rmse_ = 0.0;
+            return result;
+        }
+        result.fitness_ = double(num_corres) / double(num_points);
+        result.inlier_rmse_ = std::sqrt(
+                SumAllToDouble(nn_dist2.IndexGet({valid})) /
+                double(num_corres));
+        result.transformation_ = transformation;
+        utility::LogDebug(
+                "ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                result.fitness_, result.inlier_rmse_);
+        if (i > 0 && std::abs(prev_fitness - result.fitness_) <
+                             criteria.relative_fitness_ &&
+            std::abs(prev_rmse - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+        prev_fitness = result.fitness_;
+        prev_rmse = result.inlier_rmse_;
+
+        core::Tensor source_sel = transformed.IndexGet({valid});
+        core::Tensor target_indices = nn_indices.IndexGet({valid});
+        core::Tensor target_sel = target_points.IndexGet({target_indices});
+        Eigen::Matrix4d update;
+        if (use_normals) {
+            core::Tensor normal_sel =
+                    target_normals.IndexGet({target_indices});
+            update = SolvePointToPlane(source_sel, target_sel, normal_sel);
+        } else {
+            update = SolvePointToPoint(source_sel, target_sel);
+        }
+        transformation = update * transformation;
+        result.transformation_ = transformation;
+    }
+    return result;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// \brief ICP on core::Tensor point clouds, resident on their device.
+///
+/// Every per-point operation (transforming the source, the brute force
+/// correspondence search, building the normal equations) is composed
+/// from core::Tensor kernels and therefore runs on the device that
+/// holds the tensors — for clouds on Device("CUDA:0") nothing but a
+/// handful of scalars and small matrices crosses PCIe per iteration.
+/// The correspondence search compares every source point against every
+/// target point in memory-bounded chunks, so pair it with downsampled
+/// clouds; it has no spatial index.
+///
+/// \param source_points Source points, {n, 3}, Float32 or Float64.
+/// \param target_points Target points, {m, 3}, same dtype and device as
+/// the source.
+/// \param target_normals Target normals, {m, 3}, required by
+/// PointToPlane; pass an empty tensor for PointToPoint.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation_type PointToPoint or PointToPlane.
+/// \param criteria Convergence criteria.
+/// \return The result with transformation, fitness and inlier RMSE; the
+/// correspondence set is left empty to avoid copying it off the device.
+RegistrationResult RegistrationICPTensor(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        TransformationEstimationType estimation_type =
+                TransformationEstimationType::PointToPoint,
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
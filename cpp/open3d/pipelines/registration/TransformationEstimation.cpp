@@ -29,12 +29,85 @@
 #include <Eigen/Geometry>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
 #include "open3d/utility/Eigen.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+
+/// Single precision evaluation of the point-to-plane normal equations.
+/// Residuals and Jacobians are computed in float, which Eigen vectorizes
+/// with the target's float SIMD width; each block of correspondences is
+/// summed in float and flushed into double accumulators, so rounding
+/// error stays bounded by the block size instead of growing with the
+/// correspondence count.
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+ComputePointToPlaneJTJandJTrFloat(const geometry::PointCloud &source,
+                                  const geometry::PointCloud &target,
+                                  const CorrespondenceSet &corres) {
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r2_sum = 0.0;
+    const int num_corres = (int)corres.size();
+    const int kBlockSize = 256;
+    const int num_blocks = (num_corres + kBlockSize - 1) / kBlockSize;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double r2_sum_private = 0.0;
+        Eigen::Matrix<float, 6, 6> JTJ_block;
+        Eigen::Matrix<float, 6, 1> JTr_block;
+        Eigen::Matrix<float, 6, 1> J_r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            JTJ_block.setZero();
+            JTr_block.setZero();
+            float r2_block = 0.0f;
+            const int i_end = std::min(num_corres, (b + 1) * kBlockSize);
+            for (int i = b * kBlockSize; i < i_end; i++) {
+                const Eigen::Vector3f vs =
+                        source.points_[corres[i][0]].cast<float>();
+                const Eigen::Vector3f vt =
+                        target.points_[corres[i][1]].cast<float>();
+                const Eigen::Vector3f nt =
+                        target.normals_[corres[i][1]].cast<float>();
+                const float r = (vs - vt).dot(nt);
+                J_r.block<3, 1>(0, 0) = vs.cross(nt);
+                J_r.block<3, 1>(3, 0) = nt;
+                JTJ_block.noalias() += J_r * J_r.transpose();
+                JTr_block.noalias() += J_r * r;
+                r2_block += r * r;
+            }
+            JTJ_private += JTJ_block.cast<double>();
+            JTr_private += JTr_block.cast<double>();
+            r2_sum_private += (double)r2_block;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      r2_sum / (double)num_corres, num_corres);
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+}  // namespace
+
 double TransformationEstimationPointToPoint::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -82,6 +155,20 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || !target.HasNormals())
         return Eigen::Matrix4d::Identity();
 
+    if (use_float_computation_) {
+        Eigen::Matrix6d JTJ_f;
+        Eigen::Vector6d JTr_f;
+        double r2_f;
+        std::tie(JTJ_f, JTr_f, r2_f) =
+                ComputePointToPlaneJTJandJTrFloat(source, target, corres);
+        bool solved;
+        Eigen::Matrix4d extrinsic_f;
+        std::tie(solved, extrinsic_f) =
+                utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ_f,
+                                                                     JTr_f);
+        return solved ? extrinsic_f : Eigen::Matrix4d::Identity();
+    }
+
     auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
                                              double &r) {
         const Eigen::Vector3d &vs = source.points_[corres[i][0]];
@@ -130,7 +130,11 @@ private:
 class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
     /// \brief Default Constructor.
-    TransformationEstimationPointToPlane() {}
+    ///
+    /// \param use_float_computation If true, residuals and Jacobians are
+    /// evaluated in single precision.
+    TransformationEstimationPointToPlane(bool use_float_computation = false)
+        : use_float_computation_(use_float_computation) {}
     ~TransformationEstimationPointToPlane() override {}
 
 public:
@@ -146,6 +150,14 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Evaluate per-correspondence residuals and Jacobians in single
+    /// precision, accumulating partial sums in double for stability. Float
+    /// math roughly doubles throughput on targets without fast double
+    /// SIMD; the resulting transformation typically differs from the
+    /// double path at the level of the float rounding error.
+    bool use_float_computation_ = false;
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
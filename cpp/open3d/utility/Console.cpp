@@ -27,7 +27,9 @@
 #include "open3d/utility/Console.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <climits>
 #include <cmath>
 #include <cstdarg>
@@ -35,8 +37,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -50,6 +55,153 @@ namespace open3d {
 
 namespace utility {
 
+namespace {
+
+/// Bounded multi-producer single-consumer ring buffer of formatted log
+/// messages (Vyukov-style: per-slot sequence numbers, no locks on the
+/// producer path). One background thread drains it to print_fcn_.
+class AsyncLogQueue {
+public:
+    static AsyncLogQueue& GetInstance() {
+        static AsyncLogQueue instance;
+        return instance;
+    }
+
+    ~AsyncLogQueue() { Stop(); }
+
+    void Start() {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (running_) {
+            return;
+        }
+        running_ = true;
+        consumer_ = std::thread([this] { ConsumerLoop(); });
+    }
+
+    void Stop() {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        consumer_.join();
+    }
+
+    /// Enqueues \p msg; returns false when the buffer is full so the
+    /// caller can write synchronously instead.
+    bool TryPush(const std::string& msg) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & (kCapacity - 1)];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.msg = msg;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Blocks until every message enqueued before the call is written.
+    void Flush() const {
+        while (dequeue_pos_.load(std::memory_order_acquire) <
+               enqueue_pos_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+private:
+    // Power of two; 4096 messages of in-flight logging before
+    // producers fall back to synchronous writes.
+    static constexpr size_t kCapacity = 4096;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::string msg;
+    };
+
+    AsyncLogQueue() : slots_(new Slot[kCapacity]) {
+        for (size_t i = 0; i < kCapacity; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPop(std::string& msg) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (kCapacity - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (intptr_t(seq) - intptr_t(pos + 1) < 0) {
+            return false;
+        }
+        msg = std::move(slot.msg);
+        slot.sequence.store(pos + kCapacity, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    void ConsumerLoop() {
+        std::string msg;
+        while (running_ || dequeue_pos_.load(std::memory_order_acquire) <
+                                   enqueue_pos_.load(
+                                           std::memory_order_acquire)) {
+            if (TryPop(msg)) {
+                Logger::i().print_fcn_(msg);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> enqueue_pos_{0};
+    std::atomic<size_t> dequeue_pos_{0};
+
+    std::mutex control_mutex_;
+    std::atomic<bool> running_{false};
+    std::thread consumer_;
+};
+
+std::atomic<bool> s_async_output_enabled{false};
+
+}  // unnamed namespace
+
+void Logger::SetAsyncOutputEnabled(bool enabled) {
+    if (enabled == s_async_output_enabled) {
+        return;
+    }
+    if (enabled) {
+        AsyncLogQueue::GetInstance().Start();
+        s_async_output_enabled = true;
+    } else {
+        s_async_output_enabled = false;
+        AsyncLogQueue::GetInstance().Flush();
+        AsyncLogQueue::GetInstance().Stop();
+    }
+}
+
+bool Logger::IsAsyncOutputEnabled() const { return s_async_output_enabled; }
+
+void Logger::FlushAsyncOutput() const {
+    if (s_async_output_enabled) {
+        AsyncLogQueue::GetInstance().Flush();
+    }
+}
+
+void Logger::Output(const std::string& msg) const {
+    if (s_async_output_enabled && AsyncLogQueue::GetInstance().TryPush(msg)) {
+        return;
+    }
+    print_fcn_(msg);
+}
+
 void Logger::ChangeConsoleColor(TextColor text_color,
                                 int highlight_text) const {
 #ifdef _WIN32
@@ -42,6 +42,15 @@
 
 #define DEFAULT_IO_BUFFER_SIZE 1024
 
+/// Messages above this verbosity level are stripped at compile time:
+/// their formatting code is never emitted and the call compiles to
+/// nothing. 0 = Error, 1 = Warning, 2 = Info, 3 = Debug (keep all, the
+/// default). Build with e.g. -DOPEN3D_VERBOSITY_COMPILE_LEVEL=2 to
+/// remove every LogDebug call site from release binaries.
+#ifndef OPEN3D_VERBOSITY_COMPILE_LEVEL
+#define OPEN3D_VERBOSITY_COMPILE_LEVEL 3
+#endif
+
 namespace open3d {
 namespace utility {
 
@@ -99,7 +108,7 @@ public:
             std::string err_msg = fmt::vformat(format, args);
             err_msg = fmt::format("[Open3D WARNING] {}", err_msg);
             err_msg = ColorString(err_msg, TextColor::Yellow, 1);
-            print_fcn_(err_msg);
+            Output(err_msg);
         }
     }
 
@@ -107,7 +116,7 @@ public:
         if (verbosity_level_ >= VerbosityLevel::Info) {
             std::string err_msg = fmt::vformat(format, args);
             err_msg = fmt::format("[Open3D INFO] {}", err_msg);
-            print_fcn_(err_msg);
+            Output(err_msg);
         }
     }
 
@@ -115,10 +124,23 @@ public:
         if (verbosity_level_ >= VerbosityLevel::Debug) {
             std::string err_msg = fmt::vformat(format, args);
             err_msg = fmt::format("[Open3D DEBUG] {}", err_msg);
-            print_fcn_(err_msg);
+            Output(err_msg);
         }
     }
 
+    /// When enabled, messages are pushed to a lock-free ring buffer and
+    /// written by one background thread, so heavily logging producer
+    /// threads no longer serialize on the console. When the buffer is
+    /// full the producer writes synchronously, applying backpressure
+    /// instead of dropping messages. LogError always throws
+    /// synchronously.
+    void SetAsyncOutputEnabled(bool enabled);
+    bool IsAsyncOutputEnabled() const;
+
+    /// Blocks until every queued message has been written. Called
+    /// automatically when async output is disabled or at shutdown.
+    void FlushAsyncOutput() const;
+
     template <typename... Args>
     void Error[[noreturn]](const char *format, const Args &... args) const {
         VError(format, fmt::make_format_args(args...));
@@ -126,20 +148,39 @@ public:
 
     template <typename... Args>
     void Warning(const char *format, const Args &... args) const {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 1
         VWarning(format, fmt::make_format_args(args...));
+#else
+        (void)format;
+        (void)sizeof...(Args);
+#endif
     }
 
     template <typename... Args>
     void Info(const char *format, const Args &... args) const {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 2
         VInfo(format, fmt::make_format_args(args...));
+#else
+        (void)format;
+        (void)sizeof...(Args);
+#endif
     }
 
     template <typename... Args>
     void Debug(const char *format, const Args &... args) const {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 3
         VDebug(format, fmt::make_format_args(args...));
+#else
+        (void)format;
+        (void)sizeof...(Args);
+#endif
     }
 
 protected:
+    /// Routes a formatted message to the async queue or, when async
+    /// output is off, directly to print_fcn_.
+    void Output(const std::string &msg) const;
+
     /// Internal function to change text color for the console
     /// Note there is no safety check for parameters.
     /// \param text_color from 0 to 7, they are black, red, green, yellow,
@@ -181,17 +222,32 @@ inline void LogError[[noreturn]](const char *format, const Args &... args) {
 
 template <typename... Args>
 inline void LogWarning(const char *format, const Args &... args) {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 1
     Logger::i().VWarning(format, fmt::make_format_args(args...));
+#else
+    (void)format;
+    (void)sizeof...(Args);
+#endif
 }
 
 template <typename... Args>
 inline void LogInfo(const char *format, const Args &... args) {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 2
     Logger::i().VInfo(format, fmt::make_format_args(args...));
+#else
+    (void)format;
+    (void)sizeof...(Args);
+#endif
 }
 
 template <typename... Args>
 inline void LogDebug(const char *format, const Args &... args) {
+#if OPEN3D_VERBOSITY_COMPILE_LEVEL >= 3
     Logger::i().VDebug(format, fmt::make_format_args(args...));
+#else
+    (void)format;
+    (void)sizeof...(Args);
+#endif
 }
 
 class VerbosityContextManager {
@@ -266,17 +266,133 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
 }
 
-// clang-format off
-template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+namespace {
+
+// Flat accumulator layout of the specialized 6x6 path: the 21 unique
+// lower-triangular JTJ entries, then the 6 JTr entries, then r^2.
+constexpr int kNumJTJEntries6 = 21;
+constexpr int kNumAccumEntries6 = kNumJTJEntries6 + 6 + 1;
+
+// Rank-1 update of the flat accumulator. The fixed trip counts and
+// contiguous stores let the compiler unroll and vectorize this; the
+// accumulator is small enough to stay in cache (or registers) across
+// the whole reduction loop.
+inline void AccumulateJTJandJTr6(const double *J_r, double r, double *accum) {
+    int k = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j <= i; j++) {
+            accum[k++] += J_r[i] * J_r[j];
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        accum[kNumJTJEntries6 + i] += J_r[i] * r;
+    }
+    accum[kNumAccumEntries6 - 1] += r * r;
+}
+
+// Expands the flat accumulator back into the symmetric matrix form.
+inline std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+UnflattenJTJandJTr6(const double *accum) {
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int k = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j <= i; j++) {
+            JTJ(i, j) = accum[k];
+            JTJ(j, i) = accum[k];
+            k++;
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        JTr(i) = accum[kNumJTJEntries6 + i];
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr),
+                           accum[kNumAccumEntries6 - 1]);
+}
+
+}  // unnamed namespace
+
+template <>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
         std::function<void(int, Eigen::Vector6d &, double &)> f,
-        int iteration_num, bool verbose);
+        int iteration_num,
+        bool verbose /*=true*/) {
+    double accum[kNumAccumEntries6] = {0.0};
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        double accum_private[kNumAccumEntries6] = {0.0};
+        Eigen::Vector6d J_r;
+        double r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r);
+            AccumulateJTJandJTr6(J_r.data(), r, accum_private);
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            for (int k = 0; k < kNumAccumEntries6; k++) {
+                accum[k] += accum_private[k];
+            }
+#ifdef _OPENMP
+        }
+    }
+#endif
+    double r2_sum = accum[kNumAccumEntries6 - 1];
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return UnflattenJTJandJTr6(accum);
+}
 
-template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+template <>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
         std::function<void(int,
                            std::vector<Eigen::Vector6d, Vector6d_allocator> &,
                            std::vector<double> &)> f,
-        int iteration_num, bool verbose);
-// clang-format on
+        int iteration_num,
+        bool verbose /*=true*/) {
+    double accum[kNumAccumEntries6] = {0.0};
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        double accum_private[kNumAccumEntries6] = {0.0};
+        std::vector<double> r;
+        std::vector<Eigen::Vector6d, Vector6d_allocator> J_r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r);
+            for (int j = 0; j < (int)r.size(); j++) {
+                AccumulateJTJandJTr6(J_r[j].data(), r[j], accum_private);
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            for (int k = 0; k < kNumAccumEntries6; k++) {
+                accum[k] += accum_private[k];
+            }
+#ifdef _OPENMP
+        }
+    }
+#endif
+    double r2_sum = accum[kNumAccumEntries6 - 1];
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return UnflattenJTJandJTr6(accum);
+}
 
 Eigen::Matrix3d RotationMatrixX(double radians) {
     Eigen::Matrix3d rot;
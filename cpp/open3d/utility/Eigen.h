@@ -117,6 +117,28 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Specializations for the ubiquitous 6x6 system (point-to-plane ICP,
+/// colored ICP, RGBD odometry). JTJ is symmetric, so only its 21 unique
+/// lower-triangular entries are accumulated, flattened together with the
+/// 6 JTr entries and r^2 into one contiguous block of 28 doubles that
+/// the compiler vectorizes and keeps hot through the inner loop; the
+/// full matrix is only assembled once at the end.
+template <>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int, Eigen::Vector6d &, double &)> f,
+        int iteration_num,
+        bool verbose);
+
+template <>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int,
+                           std::vector<Eigen::Vector6d,
+                                       Eigen::aligned_allocator<
+                                               Eigen::Vector6d>> &,
+                           std::vector<double> &)> f,
+        int iteration_num,
+        bool verbose);
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
@@ -42,6 +42,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -505,6 +506,192 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MemoryMappedFile::~MemoryMappedFile() { Close(); }
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile &&other)
+    : data_(other.data_),
+      size_(other.size_),
+      is_open_(other.is_open_),
+      error_code_(other.error_code_),
+      fd_(other.fd_),
+      file_handle_(other.file_handle_),
+      mapping_handle_(other.mapping_handle_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.is_open_ = false;
+    other.fd_ = -1;
+    other.file_handle_ = nullptr;
+    other.mapping_handle_ = nullptr;
+}
+
+MemoryMappedFile &MemoryMappedFile::operator=(MemoryMappedFile &&other) {
+    if (this != &other) {
+        Close();
+        data_ = other.data_;
+        size_ = other.size_;
+        is_open_ = other.is_open_;
+        error_code_ = other.error_code_;
+        fd_ = other.fd_;
+        file_handle_ = other.file_handle_;
+        mapping_handle_ = other.mapping_handle_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.is_open_ = false;
+        other.fd_ = -1;
+        other.file_handle_ = nullptr;
+        other.mapping_handle_ = nullptr;
+    }
+    return *this;
+}
+
+bool MemoryMappedFile::Open(const std::string &filename, Mode mode) {
+    Close();
+#ifndef _WIN32
+    fd_ = open(filename.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd_, &file_stat) < 0) {
+        error_code_ = errno;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    size_ = size_t(file_stat.st_size);
+    if (size_ > 0) {
+        int prot = (mode == Mode::CopyOnWrite) ? PROT_READ | PROT_WRITE
+                                               : PROT_READ;
+        int flags = (mode == Mode::CopyOnWrite) ? MAP_PRIVATE : MAP_SHARED;
+        data_ = mmap(nullptr, size_, prot, flags, fd_, 0);
+        if (data_ == MAP_FAILED) {
+            error_code_ = errno;
+            data_ = nullptr;
+            size_ = 0;
+            close(fd_);
+            fd_ = -1;
+            return false;
+        }
+    }
+    is_open_ = true;
+    return true;
+#else
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = EACCES;
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    size_ = size_t(file_size.QuadPart);
+    file_handle_ = file;
+    if (size_ > 0) {
+        DWORD protect =
+                (mode == Mode::CopyOnWrite) ? PAGE_WRITECOPY : PAGE_READONLY;
+        HANDLE mapping = CreateFileMappingW(file, NULL, protect, 0, 0, NULL);
+        if (mapping == NULL) {
+            error_code_ = EIO;
+            CloseHandle(file);
+            file_handle_ = nullptr;
+            size_ = 0;
+            return false;
+        }
+        DWORD access = (mode == Mode::CopyOnWrite) ? FILE_MAP_COPY
+                                                   : FILE_MAP_READ;
+        data_ = MapViewOfFile(mapping, access, 0, 0, 0);
+        if (data_ == NULL) {
+            error_code_ = EIO;
+            CloseHandle(mapping);
+            CloseHandle(file);
+            file_handle_ = nullptr;
+            size_ = 0;
+            return false;
+        }
+        mapping_handle_ = mapping;
+    }
+    is_open_ = true;
+    return true;
+#endif
+}
+
+void MemoryMappedFile::Close() {
+    if (!is_open_) {
+        return;
+    }
+#ifndef _WIN32
+    if (data_) {
+        if (munmap(data_, size_)) {
+            error_code_ = errno;
+            utility::LogError("munmap failed: {}", GetError());
+        }
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+#else
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle((HANDLE)mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle((HANDLE)file_handle_);
+        file_handle_ = nullptr;
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+}
+
+void MemoryMappedFile::Advise(AccessPattern pattern) const {
+#ifndef _WIN32
+    if (!data_) {
+        return;
+    }
+    int advice = MADV_NORMAL;
+    switch (pattern) {
+        case AccessPattern::Normal:
+            advice = MADV_NORMAL;
+            break;
+        case AccessPattern::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessPattern::Random:
+            advice = MADV_RANDOM;
+            break;
+        case AccessPattern::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+    }
+    madvise(data_, size_, advice);
+#else
+    // Windows has no madvise equivalent for views; hints are ignored.
+    (void)pattern;
+#endif
+}
+
+std::string MemoryMappedFile::GetError() {
+    return GetIOErrorString(error_code_);
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
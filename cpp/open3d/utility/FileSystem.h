@@ -117,6 +117,68 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII wrapper for a memory-mapped file (mmap on POSIX, file mappings on
+/// Windows). Mapping avoids the read syscall and buffer copy of FILE* based
+/// readers and lets the OS page data in lazily, which is the backbone of the
+/// zero-copy binary readers. Opening never throws; it returns false and
+/// records errno so callers can fall back to buffered reads.
+class MemoryMappedFile {
+public:
+    enum class Mode {
+        /// Pages are mapped read-only; writing through GetData() faults.
+        ReadOnly,
+        /// Copy-on-write: the mapping is writable but modified pages stay
+        /// private to this process and are never written back to the file.
+        CopyOnWrite,
+    };
+
+    /// Access pattern hints forwarded to madvise (no-op on Windows).
+    enum class AccessPattern {
+        /// No special treatment (the default after Open).
+        Normal,
+        /// Expect sequential reads: more aggressive readahead.
+        Sequential,
+        /// Expect random reads: readahead is wasted effort.
+        Random,
+        /// Expect the whole file to be needed soon: prefetch it.
+        WillNeed,
+    };
+
+    MemoryMappedFile() {}
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+    MemoryMappedFile(MemoryMappedFile &&other);
+    MemoryMappedFile &operator=(MemoryMappedFile &&other);
+
+    /// Maps \p filename into memory. Returns false (with the reason
+    /// available from GetError()) if the file cannot be opened or mapped;
+    /// an empty file maps successfully with GetSize() == 0 and
+    /// GetData() == nullptr.
+    bool Open(const std::string &filename, Mode mode = Mode::ReadOnly);
+    void Close();
+    bool IsOpen() const { return is_open_; }
+    /// Pointer to the first mapped byte; writable only in CopyOnWrite
+    /// mode. Valid until Close() or destruction.
+    void *GetData() const { return data_; }
+    size_t GetSize() const { return size_; }
+    /// Advises the kernel about the expected access pattern.
+    void Advise(AccessPattern pattern) const;
+    /// Returns the last encountered error for this mapping.
+    std::string GetError();
+
+private:
+    void *data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+    int error_code_ = 0;
+    // POSIX file descriptor / Windows file and mapping HANDLEs; only the
+    // fields of the current platform are used.
+    int fd_ = -1;
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Initialization.h"
+
+#include <mutex>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+// The records live behind a function-local static so that reporting
+// from other static initialization sites is safe regardless of link
+// order
+struct RecordStore {
+    std::mutex mutex;
+    std::vector<InitializationProfiler::Record> records;
+
+    static RecordStore &GetInstance() {
+        static RecordStore instance;
+        return instance;
+    }
+};
+
+}  // unnamed namespace
+
+void InitializationProfiler::Report(const std::string &subsystem,
+                                    double duration_ms) {
+    RecordStore &store = RecordStore::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(store.mutex);
+        store.records.push_back({subsystem, duration_ms});
+    }
+    LogDebug("[Initialization] {} took {:.2f} ms", subsystem, duration_ms);
+}
+
+std::vector<InitializationProfiler::Record>
+InitializationProfiler::GetRecords() {
+    RecordStore &store = RecordStore::GetInstance();
+    std::lock_guard<std::mutex> lock(store.mutex);
+    return store.records;
+}
+
+std::string GetInitializationReport() {
+    auto records = InitializationProfiler::GetRecords();
+    if (records.empty()) {
+        return "Initialization report: no subsystems initialized.\n";
+    }
+    size_t name_width = 0;
+    for (const auto &record : records) {
+        name_width = std::max(name_width, record.subsystem.size());
+    }
+    std::string report = "Initialization report:\n";
+    double total_ms = 0.0;
+    for (const auto &record : records) {
+        report += fmt::format("  {:<{}} {:>10.2f} ms\n", record.subsystem,
+                              name_width, record.duration_ms);
+        total_ms += record.duration_ms;
+    }
+    report += fmt::format("  {:<{}} {:>10.2f} ms\n", "total", name_width,
+                          total_ms);
+    return report;
+}
+
+ScopedInitializationTimer::ScopedInitializationTimer(
+        const std::string &subsystem)
+    : subsystem_(subsystem),
+      start_time_in_ms_(Timer::GetSystemTimeInMilliseconds()) {}
+
+ScopedInitializationTimer::~ScopedInitializationTimer() {
+    InitializationProfiler::Report(
+            subsystem_,
+            Timer::GetSystemTimeInMilliseconds() - start_time_in_ms_);
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Audit surface for lazy subsystem initialization.
+///
+/// Open3D initializes its expensive singletons (the filament rendering
+/// engine, GLFW, device memory managers) lazily on first use, so tools
+/// that only touch io and geometry never pay for them. Each of those
+/// initialization sites reports its one-off cost here, and
+/// GetInitializationReport() lists what the current process actually
+/// paid for, in initialization order:
+/// ```
+/// Initialization report:
+///   visualization::GLFW                 18.21 ms
+///   rendering::FilamentEngine          312.74 ms
+///   rendering::FilamentResourceManager  84.02 ms
+///   total                              414.97 ms
+/// ```
+/// A cold-start-sensitive batch worker should see an empty report; any
+/// listed subsystem is a candidate for removal from its dependency
+/// graph. Recording is always on and costs one mutex-guarded push per
+/// subsystem per process.
+class InitializationProfiler {
+public:
+    /// Cost of one subsystem's initialization.
+    struct Record {
+        std::string subsystem;
+        double duration_ms;
+    };
+
+    /// Called by the initialization sites; \p duration_ms is the time
+    /// spent initializing \p subsystem.
+    static void Report(const std::string &subsystem, double duration_ms);
+
+    /// Returns the subsystems initialized so far, in initialization
+    /// order.
+    static std::vector<Record> GetRecords();
+};
+
+/// Returns the per-subsystem initialization costs formatted as a table,
+/// see InitializationProfiler.
+std::string GetInitializationReport();
+
+/// \brief RAII helper timing one initialization site.
+///
+/// Reports the lifetime of the object to InitializationProfiler:
+/// ```cpp
+/// EngineInstance::EngineInstance() {
+///     utility::ScopedInitializationTimer timer("rendering::FilamentEngine");
+///     engine_ = filament::Engine::create(backend_);
+/// }
+/// ```
+class ScopedInitializationTimer {
+public:
+    explicit ScopedInitializationTimer(const std::string &subsystem);
+    ~ScopedInitializationTimer();
+
+    ScopedInitializationTimer(const ScopedInitializationTimer &) = delete;
+    ScopedInitializationTimer &operator=(const ScopedInitializationTimer &) =
+            delete;
+
+private:
+    std::string subsystem_;
+    double start_time_in_ms_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <tbb/parallel_for.h>
+#if TBB_INTERFACE_VERSION >= 9100
+#include <tbb/global_control.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ThreadPool.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+std::mutex thread_settings_mutex;
+
+#if TBB_INTERFACE_VERSION >= 9100
+// Keeps the TBB thread cap alive until the next SetNumThreads call.
+std::unique_ptr<tbb::global_control> tbb_thread_limit;
+#endif
+
+#ifdef __linux__
+/// Pins the calling thread to [first_core, first_core + num_cores), or
+/// to all configured cores when num_cores < 1.
+void PinCurrentThread(int first_core, int num_cores) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (num_cores < 1) {
+        const int total = int(std::thread::hardware_concurrency());
+        for (int core = 0; core < total; core++) {
+            CPU_SET(core, &cpu_set);
+        }
+    } else {
+        for (int core = first_core; core < first_core + num_cores; core++) {
+            CPU_SET(core, &cpu_set);
+        }
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) !=
+        0) {
+        LogWarning("SetThreadAffinity: failed to pin thread to cores [{:d}, "
+                   "{:d}).",
+                   first_core, first_core + std::max(num_cores, 0));
+    }
+}
+#endif
+
+}  // unnamed namespace
+
+void SetNumThreads(int num_threads) {
+    num_threads = std::max(1, num_threads);
+    std::lock_guard<std::mutex> lock(thread_settings_mutex);
+    // Covers the OpenMP regions as well.
+    ThreadPool::GetInstance().SetMaxThreads(num_threads);
+#if TBB_INTERFACE_VERSION >= 9100
+    tbb_thread_limit.reset(new tbb::global_control(
+            tbb::global_control::max_allowed_parallelism, num_threads));
+#endif
+}
+
+int GetNumThreads() { return ThreadPool::GetInstance().GetMaxThreads(); }
+
+void SetThreadAffinity(int first_core, int num_cores) {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(thread_settings_mutex);
+    PinCurrentThread(first_core, num_cores);
+#ifdef _OPENMP
+    // Pin the whole OpenMP team; the team is created on first use and
+    // persists, so pinning here covers subsequent parallel regions.
+#pragma omp parallel
+    { PinCurrentThread(first_core, num_cores); }
+#endif
+#else
+    (void)first_core;
+    (void)num_cores;
+    utility::LogWarning(
+            "SetThreadAffinity is only implemented on Linux; the call has "
+            "no effect.");
+#endif
+}
+
+ScopedNumThreads::ScopedNumThreads(int num_threads) {
+#ifdef _OPENMP
+    if (num_threads > 0) {
+        saved_num_threads_ = omp_get_max_threads();
+        omp_set_num_threads(num_threads);
+    }
+#else
+    (void)num_threads;
+#endif
+}
+
+ScopedNumThreads::~ScopedNumThreads() {
+#ifdef _OPENMP
+    if (saved_num_threads_ > 0) {
+        omp_set_num_threads(saved_num_threads_);
+    }
+#endif
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace utility {
+
+/// \brief Caps the number of threads Open3D may use.
+///
+/// Applies to the OpenMP regions, the TBB-based utilities
+/// (ParallelScan.h) and the shared ThreadPool alike, so one call bounds
+/// the total concurrency of the library, e.g. to partition a machine
+/// between several concurrent pipelines. \p num_threads < 1 is clamped
+/// to 1. The default is the full hardware concurrency.
+void SetNumThreads(int num_threads);
+
+/// Returns the current thread cap set by SetNumThreads, or the hardware
+/// concurrency if it was never called.
+int GetNumThreads();
+
+/// \brief Pins Open3D's threads to the cores
+/// [\p first_core, \p first_core + \p num_cores).
+///
+/// Together with SetNumThreads this partitions a machine
+/// deterministically between concurrent jobs, e.g. job A on cores 0-31
+/// and job B on cores 32-63. Pinning is applied to the calling thread
+/// and to the OpenMP team; \p num_cores < 1 restores the full affinity
+/// mask. Only implemented on Linux; elsewhere a warning is logged and
+/// the call has no effect.
+void SetThreadAffinity(int first_core, int num_cores);
+
+/// \brief Scoped per-call override of the OpenMP thread count.
+///
+/// Heavy entry points take an optional num_threads argument and route
+/// it through this guard: a positive count overrides the OpenMP thread
+/// count for the lifetime of the object and the previous value is
+/// restored on destruction; zero or a negative count leaves the global
+/// setting untouched. The OpenMP thread count is a per-thread setting,
+/// so concurrent calls with different overrides do not interfere.
+class ScopedNumThreads {
+public:
+    explicit ScopedNumThreads(int num_threads);
+    ~ScopedNumThreads();
+
+    ScopedNumThreads(const ScopedNumThreads &) = delete;
+    ScopedNumThreads &operator=(const ScopedNumThreads &) = delete;
+
+private:
+    int saved_num_threads_ = 0;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -26,6 +26,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
 #include <tbb/parallel_for.h>
 #include "tbb/parallel_scan.h"
 #if TBB_INTERFACE_VERSION >= 10000
@@ -60,6 +65,107 @@ public:
     void reverse_join(ScanSumBody& a) { sum = a.sum + sum; }
     void assign(ScanSumBody& b) { sum = b.sum; }
 };
+
+template <class Tin, class Tout>
+class ExclusiveScanSumBody {
+    Tout sum;
+    const Tin* in;
+    Tout* const out;
+
+public:
+    ExclusiveScanSumBody(Tout* out_, const Tin* in_)
+        : sum(0), in(in_), out(out_) {}
+
+    template <class Tag>
+    void operator()(const tbb::blocked_range<size_t>& r, Tag) {
+        Tout temp = sum;
+        for (size_t i = r.begin(); i < r.end(); ++i) {
+            // Read before writing so that out may alias in.
+            Tin value = in[i];
+            if (Tag::is_final_scan()) out[i] = temp;
+            temp = temp + value;
+        }
+        sum = temp;
+    }
+    ExclusiveScanSumBody(ExclusiveScanSumBody& b, tbb::split)
+        : sum(0), in(b.in), out(b.out) {}
+    void reverse_join(ExclusiveScanSumBody& a) { sum = a.sum + sum; }
+    void assign(ExclusiveScanSumBody& b) { sum = b.sum; }
+};
+
+// Segmented scan monoid: a range's state is its sum plus whether the
+// range contains a segment start, in which case the carry of the ranges
+// to its left does not propagate through it.
+template <class Tin, class Tout>
+class SegmentedScanSumBody {
+    Tout sum;
+    bool has_segment_start;
+    const Tin* in;
+    const uint8_t* flags;
+    Tout* const out;
+
+public:
+    SegmentedScanSumBody(Tout* out_, const Tin* in_, const uint8_t* flags_)
+        : sum(0), has_segment_start(false), in(in_), flags(flags_),
+          out(out_) {}
+
+    template <class Tag>
+    void operator()(const tbb::blocked_range<size_t>& r, Tag) {
+        Tout temp = sum;
+        bool seen = has_segment_start;
+        for (size_t i = r.begin(); i < r.end(); ++i) {
+            if (flags[i]) {
+                temp = in[i];
+                seen = true;
+            } else {
+                temp = temp + in[i];
+            }
+            if (Tag::is_final_scan()) out[i] = temp;
+        }
+        sum = temp;
+        has_segment_start = seen;
+    }
+    SegmentedScanSumBody(SegmentedScanSumBody& b, tbb::split)
+        : sum(0),
+          has_segment_start(false),
+          in(b.in),
+          flags(b.flags),
+          out(b.out) {}
+    void reverse_join(SegmentedScanSumBody& a) {
+        if (!has_segment_start) {
+            sum = a.sum + sum;
+        }
+        has_segment_start = has_segment_start || a.has_segment_start;
+    }
+    void assign(SegmentedScanSumBody& b) {
+        sum = b.sum;
+        has_segment_start = b.has_segment_start;
+    }
+};
+
+/// Per-chunk histograms over fixed chunks of [0, n); chunk counts go to
+/// local_counts[chunk * num_buckets + key]. Shared by Histogram and
+/// CountingSort.
+template <class Tkey>
+void ChunkedHistogram(const Tkey* first,
+                      int64_t n,
+                      int64_t num_buckets,
+                      int64_t num_chunks,
+                      int64_t chunk_size,
+                      std::vector<int64_t>& local_counts) {
+    local_counts.assign(num_chunks * num_buckets, 0);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_chunks),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t c = r.begin(); c < r.end(); ++c) {
+                    int64_t* counts = local_counts.data() + c * num_buckets;
+                    int64_t end = std::min((c + 1) * chunk_size, n);
+                    for (int64_t i = c * chunk_size; i < end; ++i) {
+                        ++counts[first[i]];
+                    }
+                }
+            });
+}
 }  // namespace
 
 template <class Tin, class Tout>
@@ -74,5 +180,113 @@ void InclusivePrefixSum(const Tin* first, const Tin* last, Tout* out) {
 #endif
 }
 
+/// Exclusive prefix sum: out[i] is the sum of in[0..i), out[0] == 0.
+/// This is the CSR row-pointer transform of a row-size array. \p out
+/// may alias the input.
+template <class Tin, class Tout>
+void ExclusivePrefixSum(const Tin* first, const Tin* last, Tout* out) {
+    ExclusiveScanSumBody<Tin, Tout> body(out, first);
+    size_t n = std::distance(first, last);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(0, n), body);
+}
+
+/// Segmented inclusive prefix sum: like InclusivePrefixSum, but the
+/// running sum restarts at every element whose \p flags entry is
+/// non-zero (a segment start). Elements before the first flag form an
+/// implicit leading segment. \p out may alias the input.
+template <class Tin, class Tout>
+void SegmentedInclusivePrefixSum(const Tin* first,
+                                 const Tin* last,
+                                 const uint8_t* flags,
+                                 Tout* out) {
+    SegmentedScanSumBody<Tin, Tout> body(out, first, flags);
+    size_t n = std::distance(first, last);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(0, n), body);
+}
+
+/// Counts key occurrences in parallel: counts[b] is the number of keys
+/// equal to b. Every key must be in [0, num_buckets). The merge step is
+/// serial over buckets, so this is meant for bucket counts that are
+/// small against the number of keys (voxel grids, label histograms).
+template <class Tkey>
+void Histogram(const Tkey* first,
+               const Tkey* last,
+               int64_t num_buckets,
+               int64_t* counts) {
+    int64_t n = std::distance(first, last);
+    std::fill(counts, counts + num_buckets, 0);
+    if (n == 0) {
+        return;
+    }
+    int64_t num_chunks = std::min<int64_t>(n, 128);
+    int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<int64_t> local_counts;
+    ChunkedHistogram(first, n, num_buckets, num_chunks, chunk_size,
+                     local_counts);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_buckets),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t b = r.begin(); b < r.end(); ++b) {
+                              int64_t sum = 0;
+                              for (int64_t c = 0; c < num_chunks; ++c) {
+                                  sum += local_counts[c * num_buckets + b];
+                              }
+                              counts[b] = sum;
+                          }
+                      });
+}
+
+/// Stable parallel counting sort of integer keys in [0, num_buckets).
+///
+/// Writes the sorted order into \p sorted_indices (element i of bucket
+/// b keeps its relative input order) and the CSR-style offsets into
+/// \p bucket_offsets (num_buckets + 1 entries; bucket b occupies
+/// [bucket_offsets[b], bucket_offsets[b + 1])). One call therefore
+/// builds both the permutation and the row pointers of a CSR
+/// structure. Histogram and scatter passes are parallel over chunks;
+/// the offset computation is serial over buckets x chunks.
+template <class Tkey>
+void CountingSort(const Tkey* first,
+                  const Tkey* last,
+                  int64_t num_buckets,
+                  int64_t* sorted_indices,
+                  int64_t* bucket_offsets) {
+    int64_t n = std::distance(first, last);
+    if (n == 0) {
+        std::fill(bucket_offsets, bucket_offsets + num_buckets + 1, 0);
+        return;
+    }
+    int64_t num_chunks = std::min<int64_t>(n, 128);
+    int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<int64_t> local_counts;
+    ChunkedHistogram(first, n, num_buckets, num_chunks, chunk_size,
+                     local_counts);
+
+    // Turn the per-chunk counts into per-chunk write cursors,
+    // bucket-major so bucket b of chunk c starts after bucket b of all
+    // earlier chunks, which keeps the sort stable.
+    int64_t running = 0;
+    for (int64_t b = 0; b < num_buckets; ++b) {
+        bucket_offsets[b] = running;
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            int64_t count = local_counts[c * num_buckets + b];
+            local_counts[c * num_buckets + b] = running;
+            running += count;
+        }
+    }
+    bucket_offsets[num_buckets] = running;
+
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_chunks),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t c = r.begin(); c < r.end(); ++c) {
+                    int64_t* cursors = local_counts.data() + c * num_buckets;
+                    int64_t end = std::min((c + 1) * chunk_size, n);
+                    for (int64_t i = c * chunk_size; i < end; ++i) {
+                        sorted_indices[cursors[first[i]]++] = i;
+                    }
+                }
+            });
+}
+
 }  // namespace utility
 }  // namespace open3d
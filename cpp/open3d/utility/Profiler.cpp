@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+// Zone names of the zones currently open on this thread; joined with
+// '/' to form the hierarchical path of a closing zone.
+thread_local std::vector<const char*> t_zone_stack;
+
+// Per-zone sample cap: count/total/min/max stay exact beyond it, only
+// the p99 is then estimated from the retained samples.
+constexpr size_t kMaxSamplesPerZone = 1 << 16;
+// Cap on raw trace events kept for WriteTraceFile.
+constexpr size_t kMaxTraceEvents = 1 << 20;
+
+std::string JsonEscape(const std::string& s) {
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+}  // unnamed namespace
+
+class Profiler::Impl {
+public:
+    struct ZoneAccum {
+        int64_t count = 0;
+        double total_ms = 0.0;
+        double min_ms = 0.0;
+        double max_ms = 0.0;
+        std::vector<double> samples;
+    };
+
+    struct TraceEvent {
+        std::string path;
+        uint64_t tid;
+        double start_ms;
+        double dur_ms;
+    };
+
+    std::atomic<bool> enabled{false};
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, ZoneAccum> zones;
+    std::vector<TraceEvent> events;
+    bool events_overflowed = false;
+};
+
+Profiler& Profiler::GetInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler() : impl_(new Impl()) {}
+
+void Profiler::SetEnabled(bool enabled) { impl_->enabled = enabled; }
+
+bool Profiler::IsEnabled() const { return impl_->enabled; }
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->zones.clear();
+    impl_->events.clear();
+    impl_->events_overflowed = false;
+}
+
+void Profiler::RecordZone(const std::string& path,
+                          double start_ms,
+                          double end_ms) {
+    double dur_ms = end_ms - start_ms;
+    uint64_t tid = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto& accum = impl_->zones[path];
+    if (accum.count == 0 || dur_ms < accum.min_ms) {
+        accum.min_ms = dur_ms;
+    }
+    if (accum.count == 0 || dur_ms > accum.max_ms) {
+        accum.max_ms = dur_ms;
+    }
+    accum.count++;
+    accum.total_ms += dur_ms;
+    if (accum.samples.size() < kMaxSamplesPerZone) {
+        accum.samples.push_back(dur_ms);
+    }
+    if (impl_->events.size() < kMaxTraceEvents) {
+        impl_->events.push_back({path, tid, start_ms, dur_ms});
+    } else if (!impl_->events_overflowed) {
+        impl_->events_overflowed = true;
+        utility::LogWarning(
+                "Profiler trace buffer is full ({} events); further zones "
+                "are aggregated but not exported to traces.",
+                kMaxTraceEvents);
+    }
+}
+
+std::vector<Profiler::ZoneStats> Profiler::GetStats() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    std::vector<ZoneStats> stats;
+    stats.reserve(impl_->zones.size());
+    for (auto& it : impl_->zones) {
+        const Impl::ZoneAccum& accum = it.second;
+        ZoneStats zone;
+        zone.path = it.first;
+        zone.count = accum.count;
+        zone.total_ms = accum.total_ms;
+        zone.min_ms = accum.min_ms;
+        zone.mean_ms = accum.total_ms / double(accum.count);
+        zone.max_ms = accum.max_ms;
+        std::vector<double> samples = accum.samples;
+        size_t p99_rank = size_t(double(samples.size() - 1) * 0.99);
+        std::nth_element(samples.begin(), samples.begin() + p99_rank,
+                         samples.end());
+        zone.p99_ms = samples[p99_rank];
+        stats.push_back(zone);
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const ZoneStats& a, const ZoneStats& b) {
+                  return a.total_ms > b.total_ms;
+              });
+    return stats;
+}
+
+std::string Profiler::ToString() const {
+    std::string table = fmt::format(
+            "{:<40}{:>10}{:>12}{:>10}{:>10}{:>10}{:>10}\n", "zone", "count",
+            "total[ms]", "min[ms]", "mean[ms]", "p99[ms]", "max[ms]");
+    for (const ZoneStats& zone : GetStats()) {
+        table += fmt::format(
+                "{:<40}{:>10}{:>12.3f}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}\n",
+                zone.path, zone.count, zone.total_ms, zone.min_ms,
+                zone.mean_ms, zone.p99_ms, zone.max_ms);
+    }
+    return table;
+}
+
+bool Profiler::WriteTraceFile(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        utility::LogWarning("Cannot write trace file {}.", filename);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const Impl::TraceEvent& event : impl_->events) {
+        if (!first) {
+            file << ",\n";
+        }
+        first = false;
+        // Complete ("X") events; timestamps are in microseconds.
+        file << fmt::format(
+                "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},"
+                "\"ts\":{:.1f},\"dur\":{:.1f}}}",
+                JsonEscape(event.path), event.tid % 0xffffff,
+                event.start_ms * 1000.0, event.dur_ms * 1000.0);
+    }
+    file << "\n]}\n";
+    return file.good();
+}
+
+ProfilerZone::ProfilerZone(const char* name)
+    : start_ms_(0.0), recording_(Profiler::GetInstance().IsEnabled()) {
+    if (recording_) {
+        t_zone_stack.push_back(name);
+        start_ms_ = Timer::GetSystemTimeInMilliseconds();
+    }
+}
+
+ProfilerZone::~ProfilerZone() {
+    if (recording_) {
+        double end_ms = Timer::GetSystemTimeInMilliseconds();
+        std::string path = t_zone_stack[0];
+        for (size_t i = 1; i < t_zone_stack.size(); i++) {
+            path += '/';
+            path += t_zone_stack[i];
+        }
+        t_zone_stack.pop_back();
+        Profiler::GetInstance().RecordZone(path, start_ms_, end_ms);
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Aggregating runtime profiler with named RAII zones.
+///
+/// Unlike ScopeTimer, which prints one log line per scope, the profiler
+/// aggregates: every ProfilerZone records its duration under its zone
+/// path (nested zones produce "Parent/Child" paths), and GetStats
+/// returns call counts, min, mean, max and p99 per path across all
+/// threads. WriteTraceFile exports the raw zone events as a
+/// chrome://tracing JSON file with one row per thread.
+///
+/// Profiling is off by default and zones then cost a single flag check,
+/// so instrumentation can stay in production hot paths. Enable it
+/// around the region of interest:
+/// ```cpp
+/// utility::Profiler::GetInstance().SetEnabled(true);
+/// RunPipeline();
+/// utility::LogInfo("{}", utility::Profiler::GetInstance().ToString());
+/// utility::Profiler::GetInstance().WriteTraceFile("trace.json");
+/// ```
+class Profiler {
+public:
+    /// Aggregated timings of one zone path.
+    struct ZoneStats {
+        std::string path;
+        int64_t count = 0;
+        double total_ms = 0.0;
+        double min_ms = 0.0;
+        double mean_ms = 0.0;
+        double max_ms = 0.0;
+        double p99_ms = 0.0;
+    };
+
+    /// Returns the process-wide profiler.
+    static Profiler &GetInstance();
+
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    /// Starts / stops collecting. Zones opened while disabled are not
+    /// recorded.
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const;
+
+    /// Discards all recorded zones.
+    void Reset();
+
+    /// Returns the aggregated statistics of every recorded zone path,
+    /// sorted by descending total time.
+    std::vector<ZoneStats> GetStats() const;
+
+    /// Returns GetStats formatted as a table.
+    std::string ToString() const;
+
+    /// Writes all recorded zone events in the chrome://tracing JSON
+    /// format ("Trace Event Format"); open the file with
+    /// chrome://tracing or https://ui.perfetto.dev. Returns false when
+    /// the file cannot be written.
+    bool WriteTraceFile(const std::string &filename) const;
+
+private:
+    Profiler();
+    friend class ProfilerZone;
+
+    /// Called by ProfilerZone; timestamps in milliseconds since an
+    /// arbitrary epoch.
+    void RecordZone(const std::string &path, double start_ms, double end_ms);
+
+    class Impl;
+    Impl *impl_;
+};
+
+/// \brief RAII marker recording one Profiler zone.
+///
+/// The zone spans the lifetime of the object. Zones nest: a zone opened
+/// while another is active on the same thread is recorded under the
+/// outer zone's path. \p name must outlive the zone; string literals
+/// are the expected use.
+/// ```cpp
+/// void Integrate(...) {
+///     utility::ProfilerZone zone("TSDFIntegrate");
+///     ...
+/// }
+/// ```
+class ProfilerZone {
+public:
+    explicit ProfilerZone(const char *name);
+    ~ProfilerZone();
+
+    ProfilerZone(const ProfilerZone &) = delete;
+    ProfilerZone &operator=(const ProfilerZone &) = delete;
+
+private:
+    double start_ms_;
+    bool recording_;
+};
+
+}  // namespace utility
+}  // namespace open3d
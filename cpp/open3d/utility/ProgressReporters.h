@@ -26,7 +26,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+
 #include "open3d/utility/Console.h"  //for ConsoleProgressBar
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace utility {
@@ -70,6 +76,112 @@ private:
     int64_t last_count_ = -1;
 };
 
+/// Progress reporter cheap enough to be updated once per element in a
+/// tight reader loop. Update(count) is a single integer compare against
+/// a precomputed threshold until the threshold is crossed; the wrapped
+/// callback then fires at most once per report_interval_ms, and the
+/// threshold is re-derived from the measured throughput so the
+/// steady-state cost stays at that one compare. When the total is known
+/// the callback additionally fires at least once per percent of
+/// progress, so percent-driven consumers (console bars, call-counting
+/// tests) behave as with CountingProgressReporter even when the whole
+/// load finishes within one report interval. Same SetTotal / Update /
+/// Finish interface as CountingProgressReporter. Update may be called
+/// concurrently from parallel chunk loops (counts must be
+/// monotonically increasing across reports).
+class SampledProgressReporter {
+public:
+    explicit SampledProgressReporter(std::function<bool(double)> f,
+                                     double report_interval_ms = 100.0)
+        : update_progress_(f), report_interval_ms_(report_interval_ms) {}
+
+    void SetTotal(int64_t total) {
+        total_ = total;
+        start_ms_ = Timer::GetSystemTimeInMilliseconds();
+        last_report_ms_ = start_ms_;
+        last_report_count_ = 0;
+        next_report_count_ = 0;
+    }
+
+    /// Returns false once the callback has requested cancellation.
+    bool Update(int64_t count) {
+        if (count < next_report_count_.load(std::memory_order_relaxed)) {
+            return !cancelled_.load(std::memory_order_relaxed);
+        }
+        return Report(count);
+    }
+
+    void Finish() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        eta_seconds_ = 0.0;
+        CallUpdate(100.0);
+    }
+
+    /// Estimated remaining seconds extrapolated from the measured
+    /// throughput; negative until the first report has been made.
+    double GetETASeconds() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return eta_seconds_;
+    }
+
+private:
+    bool Report(int64_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (count < next_report_count_.load(std::memory_order_relaxed)) {
+            // Another thread has already reported past this count.
+            return !cancelled_.load(std::memory_order_relaxed);
+        }
+        double now = Timer::GetSystemTimeInMilliseconds();
+        double elapsed_ms = std::max(now - start_ms_, 1.0);
+        // Aim the next threshold one report interval ahead at the
+        // measured rate, but never skip more than one percent.
+        int64_t stride = int64_t(count / elapsed_ms * report_interval_ms_);
+        if (total_ > 0) {
+            stride = std::min(stride, std::max<int64_t>(total_ / 100, 1));
+        }
+        next_report_count_.store(count + std::max<int64_t>(stride, 1),
+                                 std::memory_order_relaxed);
+        // Count-based floor: with a known total, a whole percent of
+        // progress always reports even inside the report interval.
+        int64_t percent_stride = total_ > 0
+                                         ? std::max<int64_t>(total_ / 100, 1)
+                                         : std::numeric_limits<int64_t>::max();
+        if (now - last_report_ms_ < report_interval_ms_ &&
+            count - last_report_count_ < percent_stride && count < total_) {
+            return !cancelled_.load(std::memory_order_relaxed);
+        }
+        last_report_count_ = count;
+        last_report_ms_ = now;
+        double percent = 0.0;
+        if (total_ > 0) {
+            percent = std::min(count * 100.0 / total_, 100.0);
+            if (count > 0) {
+                eta_seconds_ = elapsed_ms * (total_ - count) / count / 1000.0;
+            }
+        }
+        return CallUpdate(percent);
+    }
+
+    // Callers must hold mutex_.
+    bool CallUpdate(double percent) {
+        if (update_progress_ && !update_progress_(percent)) {
+            cancelled_.store(true, std::memory_order_relaxed);
+        }
+        return !cancelled_.load(std::memory_order_relaxed);
+    }
+
+    std::function<bool(double)> update_progress_;
+    double report_interval_ms_;
+    int64_t total_ = -1;
+    double start_ms_ = 0.0;
+    double last_report_ms_ = 0.0;
+    int64_t last_report_count_ = 0;
+    double eta_seconds_ = -1.0;
+    std::atomic<int64_t> next_report_count_{0};
+    std::atomic<bool> cancelled_{false};
+    mutable std::mutex mutex_;
+};
+
 using utility::ConsoleProgressBar;
 /// update_progress(double percent) functor for ConsoleProgressBar
 struct ConsoleProgressUpdater {
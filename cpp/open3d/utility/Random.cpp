@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Random.h"
+
+#include <atomic>
+#include <mutex>
+#include <random>
+
+namespace open3d {
+namespace utility {
+namespace random {
+
+namespace {
+
+std::mutex s_seed_mutex;
+uint64_t s_seed = 0;
+bool s_seeded = false;
+// Bumped by Seed() so threads rebuild their engine; the stream counter
+// restarts with it, giving the same stream assignment on replay.
+std::atomic<uint64_t> s_generation{0};
+std::atomic<uint64_t> s_next_stream{0};
+
+uint64_t GetGlobalSeed() {
+    std::lock_guard<std::mutex> lock(s_seed_mutex);
+    if (!s_seeded) {
+        std::random_device rd;
+        s_seed = (uint64_t(rd()) << 32) | rd();
+        s_seeded = true;
+    }
+    return s_seed;
+}
+
+}  // unnamed namespace
+
+void Seed(uint64_t seed) {
+    {
+        std::lock_guard<std::mutex> lock(s_seed_mutex);
+        s_seed = seed;
+        s_seeded = true;
+    }
+    s_next_stream = 0;
+    s_generation++;
+}
+
+Philox &GetThreadLocalEngine() {
+    thread_local Philox engine(0, 0);
+    thread_local uint64_t generation = uint64_t(-1);
+    uint64_t current_generation = s_generation.load();
+    if (generation != current_generation) {
+        engine = Philox(GetGlobalSeed(), s_next_stream++);
+        generation = current_generation;
+    }
+    return engine;
+}
+
+}  // namespace random
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace open3d {
+namespace utility {
+namespace random {
+
+/// \brief Counter-based Philox4x32-10 pseudo-random generator.
+///
+/// Unlike std::mt19937 there is no large state to warm up: the state is
+/// a (seed, stream, counter) triple, so any number of statistically
+/// independent streams can be created from one seed by picking distinct
+/// stream ids (e.g. one per thread or per RANSAC iteration block),
+/// which makes parallel sampling reproducible regardless of how the
+/// iterations are scheduled. Satisfies UniformRandomBitGenerator and
+/// can be plugged into the <random> distributions.
+class Philox {
+public:
+    using result_type = uint32_t;
+
+    /// \param seed Seed shared by every stream of a run.
+    /// \param stream Stream id; different ids give independent
+    /// sequences for the same seed.
+    Philox(uint64_t seed, uint64_t stream = 0)
+        : key_lo_(uint32_t(seed)),
+          key_hi_(uint32_t(seed >> 32)),
+          counter_lo_(0),
+          counter_hi_(stream),
+          buffer_index_(4) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<uint32_t>::max();
+    }
+
+    result_type operator()() {
+        if (buffer_index_ == 4) {
+            Generate();
+            buffer_index_ = 0;
+        }
+        return buffer_[buffer_index_++];
+    }
+
+    uint64_t NextUInt64() {
+        uint64_t lo = (*this)();
+        uint64_t hi = (*this)();
+        return (hi << 32) | lo;
+    }
+
+    /// Uniform integer in [0, bound) without modulo bias
+    /// (Lemire's multiply-shift rejection method). \p bound must be > 0.
+    uint32_t BoundedUInt32(uint32_t bound) {
+        uint64_t product = uint64_t((*this)()) * uint64_t(bound);
+        uint32_t fraction = uint32_t(product);
+        if (fraction < bound) {
+            uint32_t threshold = -bound % bound;
+            while (fraction < threshold) {
+                product = uint64_t((*this)()) * uint64_t(bound);
+                fraction = uint32_t(product);
+            }
+        }
+        return uint32_t(product >> 32);
+    }
+
+    /// Uniform double in [0, 1) with 53 random mantissa bits.
+    double NextUniformDouble() {
+        return double(NextUInt64() >> 11) *
+               (1.0 / double(uint64_t(1) << 53));
+    }
+
+private:
+    // One Philox4x32 round: two 32x32->64 multiplies whose halves are
+    // xor-mixed across the counter words.
+    static void Round(uint32_t ctr[4], uint32_t key_lo, uint32_t key_hi) {
+        uint64_t product0 = uint64_t(0xD2511F53u) * ctr[0];
+        uint64_t product1 = uint64_t(0xCD9E8D57u) * ctr[2];
+        uint32_t out0 = uint32_t(product1 >> 32) ^ ctr[1] ^ key_lo;
+        uint32_t out2 = uint32_t(product0 >> 32) ^ ctr[3] ^ key_hi;
+        ctr[1] = uint32_t(product1);
+        ctr[3] = uint32_t(product0);
+        ctr[0] = out0;
+        ctr[2] = out2;
+    }
+
+    void Generate() {
+        buffer_[0] = uint32_t(counter_lo_);
+        buffer_[1] = uint32_t(counter_lo_ >> 32);
+        buffer_[2] = uint32_t(counter_hi_);
+        buffer_[3] = uint32_t(counter_hi_ >> 32);
+        uint32_t key_lo = key_lo_;
+        uint32_t key_hi = key_hi_;
+        for (int round = 0; round < 10; round++) {
+            Round(buffer_, key_lo, key_hi);
+            key_lo += 0x9E3779B9u;
+            key_hi += 0xBB67AE85u;
+        }
+        counter_lo_++;
+    }
+
+    uint32_t key_lo_;
+    uint32_t key_hi_;
+    uint64_t counter_lo_;
+    uint64_t counter_hi_;
+    uint32_t buffer_[4];
+    int buffer_index_;
+};
+
+/// \brief Seeds the process-wide generator service.
+///
+/// Resets the per-thread engines: after Seed(s), the n-th thread to
+/// draw (in order of first use) gets stream n of seed s, so a
+/// single-threaded run replays exactly and parallel runs draw from
+/// disjoint streams. Without an explicit call the service is seeded
+/// from std::random_device at first use.
+void Seed(uint64_t seed);
+
+/// Returns the calling thread's engine (see Seed for the stream
+/// assignment). The reference stays valid for the thread's lifetime.
+Philox &GetThreadLocalEngine();
+
+/// Uniform integer in [0, bound) from the calling thread's engine.
+inline uint32_t RandUint32(uint32_t bound) {
+    return GetThreadLocalEngine().BoundedUInt32(bound);
+}
+
+/// \brief Samples \p k distinct integers from [0, n) into \p out.
+///
+/// Draw-and-linear-scan rejection, O(k^2) per call with no allocation;
+/// meant for the small k of minimal RANSAC models (k << n, and n must
+/// fit in 32 bits).
+template <typename T>
+void SampleWithoutReplacement(Philox &rng, int64_t n, int64_t k, T *out) {
+    for (int64_t i = 0; i < k; i++) {
+        T candidate;
+        bool duplicate;
+        do {
+            candidate = T(rng.BoundedUInt32(uint32_t(n)));
+            duplicate = false;
+            for (int64_t j = 0; j < i; j++) {
+                if (out[j] == candidate) {
+                    duplicate = true;
+                    break;
+                }
+            }
+        } while (duplicate);
+        out[i] = candidate;
+    }
+}
+
+}  // namespace random
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,236 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace {
+// Set while a thread executes chunks of a pool job; nested parallel
+// calls from such a thread run serially instead of deadlocking on the
+// single shared job slot.
+thread_local bool t_inside_pool = false;
+
+// Chunks per thread. More chunks give finer stealing granularity for
+// uneven iterations at slightly more counter traffic.
+constexpr int64_t kChunksPerThread = 8;
+}  // unnamed namespace
+
+class ThreadPool::Impl {
+public:
+    Impl() {
+#ifdef _OPENMP
+        max_threads_ = omp_get_max_threads();
+#else
+        max_threads_ = std::max(1u, std::thread::hardware_concurrency());
+#endif
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+        cv_work_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void SetMaxThreads(int max_threads) {
+        std::lock_guard<std::mutex> lock(run_mutex_);
+        max_threads_ = std::max(1, max_threads);
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads_);
+#endif
+    }
+
+    int GetMaxThreads() const { return max_threads_; }
+
+    void ParallelForRange(int64_t begin,
+                          int64_t end,
+                          const std::function<void(int64_t, int64_t)>& f,
+                          int max_threads) {
+        int64_t n = end - begin;
+        if (n <= 0) {
+            return;
+        }
+        int thread_cap = max_threads > 0
+                                 ? std::min(max_threads, max_threads_)
+                                 : max_threads_;
+        if (t_inside_pool || thread_cap == 1 || n == 1) {
+            f(begin, end);
+            return;
+        }
+
+        // One job at a time; concurrent callers queue up here.
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        int num_threads = int(std::min(int64_t(thread_cap), n));
+        EnsureWorkers(num_threads - 1);
+
+        chunk_size_ = std::max(int64_t(1),
+                               n / (int64_t(num_threads) * kChunksPerThread));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &f;
+            next_ = begin;
+            end_ = end;
+            // All workers wake and report done, but only num_threads - 1
+            // of them (plus the caller) claim chunks, so lowering the
+            // cap idles the surplus without joining threads.
+            participants_ = 0;
+            participant_limit_ = num_threads - 1;
+            busy_workers_ = int(workers_.size());
+            generation_++;
+        }
+        cv_work_.notify_all();
+
+        RunChunks(f);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_done_.wait(lock, [this] { return busy_workers_ == 0; });
+        task_ = nullptr;
+    }
+
+private:
+    /// Grows the worker set up to \p num_workers threads. Workers are
+    /// created lazily and kept for the lifetime of the pool; shrinking
+    /// the cap only idles them.
+    void EnsureWorkers(int num_workers) {
+        // A worker must start from the generation current at its spawn:
+        // starting from 0 would make a worker created after earlier jobs
+        // see a stale generation, wake without a job and decrement
+        // busy_workers_ it was never counted in. Spawning happens before
+        // the submitter bumps generation_, so the worker still catches
+        // the job it was created for.
+        uint64_t spawn_generation;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            spawn_generation = generation_;
+        }
+        while (int(workers_.size()) < num_workers) {
+            workers_.emplace_back(
+                    [this, spawn_generation] { WorkerLoop(spawn_generation); });
+        }
+    }
+
+    void WorkerLoop(uint64_t last_generation) {
+        t_inside_pool = true;
+        while (true) {
+            const std::function<void(int64_t, int64_t)>* task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_work_.wait(lock, [this, last_generation] {
+                    return shutdown_ || generation_ != last_generation;
+                });
+                if (shutdown_) {
+                    return;
+                }
+                last_generation = generation_;
+                task = task_;
+            }
+            if (task != nullptr &&
+                participants_.fetch_add(1) < participant_limit_) {
+                RunChunks(*task);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                busy_workers_--;
+            }
+            cv_done_.notify_one();
+        }
+    }
+
+    /// Pulls chunks off the shared counter until the job is exhausted.
+    /// Both the workers and the submitting thread end up here, so a
+    /// fast caller steals chunks a slow worker would otherwise process.
+    void RunChunks(const std::function<void(int64_t, int64_t)>& f) {
+        bool was_inside = t_inside_pool;
+        t_inside_pool = true;
+        int64_t lo;
+        while ((lo = next_.fetch_add(chunk_size_)) < end_) {
+            f(lo, std::min(lo + chunk_size_, end_));
+        }
+        t_inside_pool = was_inside;
+    }
+
+    // Serializes job submission.
+    std::mutex run_mutex_;
+
+    // Guards the job slot and worker bookkeeping below.
+    std::mutex mutex_;
+    std::condition_variable cv_work_;
+    std::condition_variable cv_done_;
+    const std::function<void(int64_t, int64_t)>* task_ = nullptr;
+    std::atomic<int64_t> next_{0};
+    std::atomic<int> participants_{0};
+    int participant_limit_ = 0;
+    int64_t end_ = 0;
+    int64_t chunk_size_ = 1;
+    uint64_t generation_ = 0;
+    int busy_workers_ = 0;
+    bool shutdown_ = false;
+
+    std::vector<std::thread> workers_;
+    int max_threads_ = 1;
+};
+
+ThreadPool& ThreadPool::GetInstance() {
+    static ThreadPool instance;
+    return instance;
+}
+
+ThreadPool::ThreadPool() : impl_(new Impl()) {}
+
+ThreadPool::~ThreadPool() { delete impl_; }
+
+void ThreadPool::SetMaxThreads(int max_threads) {
+    impl_->SetMaxThreads(max_threads);
+}
+
+int ThreadPool::GetMaxThreads() const { return impl_->GetMaxThreads(); }
+
+void ThreadPool::ParallelForRange(
+        int64_t begin,
+        int64_t end,
+        const std::function<void(int64_t, int64_t)>& f,
+        int max_threads) {
+    impl_->ParallelForRange(begin, end, f, max_threads);
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace open3d {
+namespace utility {
+
+/// \brief A shared pool of worker threads with a global concurrency
+/// cap.
+///
+/// OpenMP regions spin their own team per translation unit and TBB
+/// brings another scheduler, so embedding Open3D next to other
+/// threaded libraries oversubscribes the machine. ThreadPool keeps one
+/// process-wide set of persistent workers; loops submitted through
+/// ParallelFor pull chunks from a shared counter, so threads that
+/// finish early steal the remaining work of slower ones and uneven
+/// iterations balance automatically.
+///
+/// SetMaxThreads caps the pool and, when built with OpenMP, the
+/// remaining OpenMP regions as well, giving the embedding application
+/// one knob for Open3D's total concurrency.
+///
+/// Example:
+/// ```cpp
+/// utility::ThreadPool::GetInstance().ParallelFor(
+///         0, n, [&](int64_t i) { out[i] = Process(in[i]); });
+/// ```
+class ThreadPool {
+public:
+    /// Returns the process-wide pool.
+    static ThreadPool& GetInstance();
+
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Caps the number of threads used by the pool (including the
+    /// calling thread) and by OpenMP regions. \p max_threads < 1 is
+    /// clamped to 1.
+    void SetMaxThreads(int max_threads);
+
+    /// Number of threads a parallel call may use.
+    int GetMaxThreads() const;
+
+    /// Calls f(i) for every i in [begin, end) in parallel. The calling
+    /// thread participates and the call returns after the last
+    /// iteration finished. Nested calls from inside the pool run
+    /// serially.
+    template <typename func_t>
+    void ParallelFor(int64_t begin, int64_t end, const func_t& f) {
+        ParallelForRange(begin, end, [&f](int64_t lo, int64_t hi) {
+            for (int64_t i = lo; i < hi; i++) {
+                f(i);
+            }
+        });
+    }
+
+    /// Calls f(lo, hi) for disjoint sub-ranges covering [begin, end).
+    /// Use this instead of ParallelFor when per-thread state (scratch
+    /// buffers, partial sums) should be set up once per chunk rather
+    /// than per element. A positive \p max_threads caps this one call
+    /// below the pool-wide limit; 0 uses the limit.
+    void ParallelForRange(int64_t begin,
+                          int64_t end,
+                          const std::function<void(int64_t, int64_t)>& f,
+                          int max_threads = 0);
+
+    /// Returns identity combined with f(i) over [begin, end) using
+    /// \p reduction, e.g. a parallel sum:
+    /// ```cpp
+    /// double s = pool.ParallelReduce<double>(
+    ///         0, n, 0.0, [&](int64_t i) { return v[i]; },
+    ///         [](double a, double b) { return a + b; });
+    /// ```
+    /// \p reduction must be associative; the combination order is
+    /// unspecified.
+    template <typename scalar_t, typename func_t, typename reduce_t>
+    scalar_t ParallelReduce(int64_t begin,
+                            int64_t end,
+                            scalar_t identity,
+                            const func_t& f,
+                            const reduce_t& reduction) {
+        scalar_t result = identity;
+        std::mutex reduction_mutex;
+        ParallelForRange(begin, end, [&](int64_t lo, int64_t hi) {
+            scalar_t partial = identity;
+            for (int64_t i = lo; i < hi; i++) {
+                partial = reduction(partial, f(i));
+            }
+            std::lock_guard<std::mutex> lock(reduction_mutex);
+            result = reduction(result, partial);
+        });
+        return result;
+    }
+
+private:
+    ThreadPool();
+
+    class Impl;
+    Impl* impl_;
+};
+
+}  // namespace utility
+}  // namespace open3d
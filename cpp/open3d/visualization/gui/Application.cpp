@@ -36,6 +36,7 @@
 
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Initialization.h"
 #include "open3d/visualization/gui/Button.h"
 #include "open3d/visualization/gui/Events.h"
 #include "open3d/visualization/gui/Label.h"
@@ -124,6 +125,7 @@ struct Application::Impl {
             return;
         }
 
+        utility::ScopedInitializationTimer timer("gui::GLFW");
 #if __APPLE__
         glfwInitHint(GLFW_COCOA_MENUBAR, GLFW_FALSE);  // no auto-create menubar
 #endif
@@ -369,21 +371,24 @@ Application::RunStatus Application::ProcessQueuedEvents() {
         impl_->last_time_ = now;
     }
 
-    // Run any posted functions
+    // Run any posted functions. Take the queue first so that a posted
+    // function can call PostToMainThread() itself; anything posted while
+    // running gets picked up on the next tick.
+    std::vector<Impl::Posted> posted;
     {
         std::lock_guard<std::mutex> lock(impl_->posted_lock_);
-        for (auto &p : impl_->posted_) {
-            void *old = nullptr;
-            if (p.window) {
-                old = p.window->MakeDrawContextCurrent();
-            }
-            p.f();
-            if (p.window) {
-                p.window->RestoreDrawContext(old);
-                p.window->PostRedraw();
-            }
+        posted.swap(impl_->posted_);
+    }
+    for (auto &p : posted) {
+        void *old = nullptr;
+        if (p.window) {
+            old = p.window->MakeDrawContextCurrent();
+        }
+        p.f();
+        if (p.window) {
+            p.window->RestoreDrawContext(old);
+            p.window->PostRedraw();
         }
-        impl_->posted_.clear();
     }
 
     // Clear any tasks that have finished
@@ -29,6 +29,9 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
+
+#include "open3d/visualization/rendering/Camera.h"
 
 namespace open3d {
 namespace visualization {
@@ -56,6 +59,19 @@ public:
     // BufferReadyCallback does not need to free Buffer::bytes.
     // It should also not cache the pointer.
     virtual void RequestFrame(Scene* scene, BufferReadyCallback cb) = 0;
+
+    // Called once per camera pose, in submission order. Like
+    // BufferReadyCallback it must not free or cache Buffer::bytes.
+    using BatchBufferReadyCallback =
+            std::function<void(std::size_t pose_index, const Buffer&)>;
+    // Renders the scene once for every camera pose, reusing the view, the
+    // swap chain and a ring of readback buffers across frames and keeping
+    // several frames in flight, so batch rendering many views (e.g.
+    // thumbnails) is not limited by per-frame setup. Blocks until every
+    // frame has been delivered to the callback.
+    virtual void RenderBatch(Scene* scene,
+                             const std::vector<Camera::Transform>& camera_poses,
+                             BatchBufferReadyCallback cb) = 0;
 };
 
 }  // namespace rendering
@@ -73,6 +73,15 @@ public:
             const geometry::Geometry3D& geometry,
             const MaterialInstanceHandle& material_id,
             const std::string& name) = 0;
+    // Adds one entity per transform while all instances share a single set
+    // of vertex and index buffers built from the geometry, so the geometry
+    // data is uploaded to the GPU only once. Use this for scenes which place
+    // the same asset many times. The returned handles behave like handles
+    // from AddGeometry.
+    virtual std::vector<GeometryHandle> AddGeometryInstances(
+            const geometry::Geometry3D& geometry,
+            const MaterialInstanceHandle& material_id,
+            const std::vector<Transform>& instance_transforms) = 0;
     virtual void AssignMaterial(const GeometryHandle& geometry_id,
                                 const MaterialInstanceHandle& material_id) = 0;
     virtual MaterialInstanceHandle GetMaterial(
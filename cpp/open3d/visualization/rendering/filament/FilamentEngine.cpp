@@ -28,6 +28,7 @@
 
 #include <cstddef>  // <filament/Engine> recursive includes needs this, std::size_t especially
 
+#include "open3d/utility/Initialization.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 
 namespace open3d {
@@ -62,7 +63,12 @@ EngineInstance& EngineInstance::Get() {
 }
 
 EngineInstance::EngineInstance() {
-    engine_ = filament::Engine::create(backend_);
+    {
+        utility::ScopedInitializationTimer timer("rendering::FilamentEngine");
+        engine_ = filament::Engine::create(backend_);
+    }
+    utility::ScopedInitializationTimer timer(
+            "rendering::FilamentResourceManager");
     resource_manager_ = new FilamentResourceManager(*engine_);
 }
 
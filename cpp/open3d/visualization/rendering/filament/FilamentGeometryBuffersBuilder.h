@@ -34,6 +34,7 @@
 #include <filament/RenderableManager.h>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace open3d {
 
@@ -62,6 +63,12 @@ public:
     virtual Buffers ConstructBuffers() = 0;
     virtual filament::Box ComputeAABB() = 0;
 
+    // Cumulative index counts of the coarse-to-fine LOD levels encoded in
+    // the index buffer built by ConstructBuffers. Rendering the first
+    // counts[l] indices draws the geometry at level l; empty when the
+    // geometry carries no LOD levels.
+    virtual std::vector<size_t> GetLodIndexCounts() const { return {}; }
+
 protected:
     static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
 };
@@ -89,9 +96,11 @@ public:
 
     Buffers ConstructBuffers() override;
     filament::Box ComputeAABB() override;
+    std::vector<size_t> GetLodIndexCounts() const override;
 
 private:
     const geometry::PointCloud& geometry_;
+    std::vector<size_t> lod_index_counts_;
 };
 
 class LineSetBuffersBuilder : public GeometryBuffersBuilder {
@@ -105,6 +114,11 @@ public:
     filament::Box ComputeAABB() override;
 
 private:
+    // Fast path for line sets without per-line colors (or with a single
+    // uniform color): indexes the point array directly instead of
+    // deduplicating endpoint copies.
+    Buffers ConstructIndexedBuffers(const Eigen::Vector3d& color);
+
     const geometry::LineSet& geometry_;
 };
 
@@ -146,6 +146,125 @@ void FilamentRenderToBuffer::ReadPixelsCallback(void*, size_t, void* user) {
     delete params;
 }
 
+namespace {
+// Number of readback buffers in the batch rendering ring; up to this many
+// frames are in flight between the GPU and the delivery callbacks
+const std::size_t kBatchRingSize = 3;
+
+struct BatchState {
+    FilamentRenderToBuffer::BatchBufferReadyCallback callback;
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::size_t buffer_size = 0;
+    std::vector<std::uint8_t*> buffers;
+    // One flag per ring slot, true while its readback is in flight
+    std::vector<char> in_flight;
+};
+
+struct BatchSlotParams {
+    BatchState* state;
+    std::size_t slot;
+    std::size_t pose_index;
+};
+}  // namespace
+
+void FilamentRenderToBuffer::BatchReadPixelsCallback(void*,
+                                                     size_t,
+                                                     void* user) {
+    auto params = static_cast<BatchSlotParams*>(user);
+    BatchState& state = *params->state;
+
+    state.callback(params->pose_index,
+                   {state.width, state.height, state.buffers[params->slot],
+                    state.buffer_size});
+
+    state.in_flight[params->slot] = false;
+    delete params;
+}
+
+void FilamentRenderToBuffer::RenderBatch(
+        Scene* scene,
+        const std::vector<Camera::Transform>& camera_poses,
+        BatchBufferReadyCallback callback) {
+    if (!scene || !view_ || !swapchain_) {
+        utility::LogDebug(
+                "No scene or view was provided for batch rendering into "
+                "buffer");
+        return;
+    }
+
+    if (pending_) {
+        utility::LogWarning(
+                "Render to buffer can process only one request at time");
+        return;
+    }
+
+    pending_ = true;
+
+    using namespace filament;
+    using namespace backend;
+
+    BatchState state;
+    state.callback = callback;
+    state.width = width_;
+    state.height = height_;
+    state.buffer_size = buffer_size_;
+    state.buffers.resize(kBatchRingSize);
+    for (auto& buffer : state.buffers) {
+        buffer = static_cast<std::uint8_t*>(malloc(buffer_size_));
+    }
+    state.in_flight.assign(kBatchRingSize, false);
+
+    // Rendering an empty frame delivers finished readback callbacks, like
+    // the pump loop in Render()
+    auto pump = [this]() {
+        if (renderer_->beginFrame(swapchain_)) {
+            renderer_->endFrame();
+        }
+    };
+
+    auto vp = view_->GetNativeView()->getViewport();
+    for (std::size_t i = 0; i < camera_poses.size(); ++i) {
+        const std::size_t slot = i % kBatchRingSize;
+        // Wait until the readback that last used this ring slot finished
+        // before overwriting its buffer; up to kBatchRingSize frames stay
+        // in flight.
+        while (state.in_flight[slot]) {
+            pump();
+        }
+
+        view_->GetCamera()->SetModelMatrix(camera_poses[i]);
+
+        // beginFrame() may refuse a frame for backpressure; the attempt
+        // still delivers finished callbacks, so just try again
+        while (!renderer_->beginFrame(swapchain_)) {
+        }
+        renderer_->render(view_->GetNativeView());
+
+        auto* params = new BatchSlotParams{&state, slot, i};
+        PixelBufferDescriptor pd(state.buffers[slot], buffer_size_,
+                                 PixelDataFormat::RGB, PixelDataType::UBYTE,
+                                 BatchReadPixelsCallback, params);
+        renderer_->readPixels(vp.left, vp.bottom, vp.width, vp.height,
+                              std::move(pd));
+        renderer_->endFrame();
+        state.in_flight[slot] = true;
+    }
+
+    // Drain the remaining readbacks before the ring buffers go away
+    for (std::size_t slot = 0; slot < kBatchRingSize; ++slot) {
+        while (state.in_flight[slot]) {
+            pump();
+        }
+    }
+
+    for (auto& buffer : state.buffers) {
+        free(buffer);
+    }
+
+    pending_ = false;
+}
+
 void FilamentRenderToBuffer::Render() {
     bool shotDone = false;
     frame_done_ = false;
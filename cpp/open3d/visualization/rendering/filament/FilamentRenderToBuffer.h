@@ -60,6 +60,10 @@ public:
 
     void RequestFrame(Scene* scene, BufferReadyCallback cb) override;
 
+    void RenderBatch(Scene* scene,
+                     const std::vector<Camera::Transform>& camera_poses,
+                     BatchBufferReadyCallback cb) override;
+
 private:
     friend class FilamentRenderer;
 
@@ -79,6 +83,7 @@ private:
     bool pending_ = false;
 
     static void ReadPixelsCallback(void* buffer, size_t size, void* user);
+    static void BatchReadPixelsCallback(void* buffer, size_t size, void* user);
     void Render();
 };
 
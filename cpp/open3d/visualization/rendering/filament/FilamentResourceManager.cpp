@@ -39,6 +39,8 @@
 #include <image/KtxBundle.h>
 #include <image/KtxUtility.h>
 
+#include <algorithm>
+
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
@@ -253,12 +255,23 @@ MaterialHandle FilamentResourceManager::CreateMaterial(
     MaterialHandle handle;
 
     if (!request.path_.empty()) {
+        // Materials built from the same package are identical, so windows
+        // opened later in the process reuse the already compiled material
+        // instead of re-reading and re-parsing the file
+        auto cached = material_cache_.find(request.path_);
+        if (cached != material_cache_.end()) {
+            return cached->second;
+        }
+
         std::vector<char> material_data;
         std::string error_str;
 
         if (utility::filesystem::FReadToBuffer(request.path_, material_data,
                                                &error_str)) {
             handle = CreateMaterial(material_data.data(), material_data.size());
+            if (handle) {
+                material_cache_[request.path_] = handle;
+            }
         } else {
             request.error_callback_(request, errno, error_str);
         }
@@ -335,6 +348,17 @@ TextureHandle FilamentResourceManager::CreateTexture(const char* path) {
     std::shared_ptr<geometry::Image> img;
 
     if (path) {
+        // KTX containers carry compressed (e.g. BC/ETC) payloads and a
+        // prebuilt mip chain, which are uploaded to the GPU as is
+        if (utility::filesystem::GetFileExtensionInLowerCase(path) == "ktx") {
+            TextureHandle handle;
+            auto* texture = LoadTextureFromKtx(path);
+            if (texture) {
+                handle = RegisterResource<TextureHandle>(engine_, texture,
+                                                         textures_);
+            }
+            return handle;
+        }
         img = io::CreateImageFromFile(path);
     } else {
         utility::LogWarning("Empty path for texture loading provided");
@@ -541,6 +565,7 @@ std::weak_ptr<filament::IndexBuffer> FilamentResourceManager::GetIndexBuffer(
 }
 
 void FilamentResourceManager::DestroyAll() {
+    material_cache_.clear();
     material_instances_.clear();
     materials_.clear();
     textures_.clear();
@@ -561,6 +586,14 @@ void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
     switch (id.type) {
         case EntityType::Material:
             DestroyResource(id, materials_);
+            for (auto it = material_cache_.begin();
+                 it != material_cache_.end();) {
+                if (it->second == id) {
+                    it = material_cache_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
             break;
         case EntityType::MaterialInstance:
             DestroyResource(id, material_instances_);
@@ -609,19 +642,45 @@ filament::Texture* FilamentResourceManager::LoadTextureFromImage(
             image->data_.data(), image->data_.size(),
             texture_settings.image_format, texture_settings.image_type,
             FreeRetainedImage, (void*)retained_img_id);
+    // Allocate the full mip chain so that minified samples read the small
+    // levels instead of thrashing the full-resolution image
+    std::uint8_t levels = 1;
+    auto dimension = std::max(texture_settings.texel_width,
+                              texture_settings.texel_height);
+    while (dimension >>= 1) {
+        ++levels;
+    }
     auto texture = Texture::Builder()
                            .width(texture_settings.texel_width)
                            .height(texture_settings.texel_height)
-                           .levels((uint8_t)1)
+                           .levels(levels)
                            .format(texture_settings.format)
                            .sampler(Texture::Sampler::SAMPLER_2D)
                            .build(engine_);
 
     texture->setImage(engine_, 0, std::move(pb));
+    if (levels > 1) {
+        texture->generateMipmaps(engine_);
+    }
 
     return texture;
 }
 
+filament::Texture* FilamentResourceManager::LoadTextureFromKtx(
+        const char* path) {
+    std::vector<char> ktx_data;
+    std::string error_str;
+    if (!utility::filesystem::FReadToBuffer(path, ktx_data, &error_str)) {
+        utility::LogWarning("Failed to read texture {}: {}", path, error_str);
+        return nullptr;
+    }
+
+    // will be destroyed later by image::ktx::createTexture
+    auto* ktx = new image::KtxBundle(
+            reinterpret_cast<std::uint8_t*>(ktx_data.data()), ktx_data.size());
+    return image::ktx::createTexture(&engine_, ktx, false);
+}
+
 filament::Texture* FilamentResourceManager::LoadFilledTexture(
         const Eigen::Vector3f& color, size_t dimension) {
     auto image = std::make_shared<geometry::Image>();
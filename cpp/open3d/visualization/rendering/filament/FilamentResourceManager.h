@@ -81,6 +81,9 @@ public:
     MaterialInstanceHandle CreateFromDescriptor(
             const geometry::TriangleMesh::Material& material_attributes);
 
+    // Loads KTX containers (compressed payloads with prebuilt mip chains)
+    // directly; other formats go through geometry::Image and get a mip
+    // chain generated on upload.
     TextureHandle CreateTexture(const char* path);
     TextureHandle CreateTexture(const std::shared_ptr<geometry::Image>& image);
     // Slow, will make copy of image data and free it after.
@@ -124,6 +127,9 @@ private:
 
     ResourcesContainer<filament::MaterialInstance> material_instances_;
     ResourcesContainer<filament::Material> materials_;
+    // Materials built from .filamat files, keyed by path, so repeated
+    // visualizer windows in one process reuse the compiled material
+    std::unordered_map<std::string, MaterialHandle> material_cache_;
     ResourcesContainer<filament::Texture> textures_;
     ResourcesContainer<filament::IndirectLight> ibls_;
     ResourcesContainer<filament::Skybox> skyboxes_;
@@ -139,6 +145,7 @@ private:
 
     filament::Texture* LoadTextureFromImage(
             const std::shared_ptr<geometry::Image>& image);
+    filament::Texture* LoadTextureFromKtx(const char* path);
     filament::Texture* LoadFilledTexture(const Eigen::Vector3f& color,
                                          size_t dimension);
 
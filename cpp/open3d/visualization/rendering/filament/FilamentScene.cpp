@@ -110,10 +110,12 @@ FilamentScene::~FilamentScene() {
     for (const auto& pair : entities_) {
         const auto& allocated_entity = pair.second;
 
-        if (allocated_entity.info.ib) {
+        if (allocated_entity.info.ib &&
+            ReleaseSharedBuffer(allocated_entity.info.ib)) {
             resource_mgr_.Destroy(allocated_entity.info.ib);
         }
-        if (allocated_entity.info.vb) {
+        if (allocated_entity.info.vb &&
+            ReleaseSharedBuffer(allocated_entity.info.vb)) {
             resource_mgr_.Destroy(allocated_entity.info.vb);
         }
 
@@ -272,6 +274,8 @@ GeometryHandle FilamentScene::AddGeometry(
     auto buffers = geometry_buffer_builder->ConstructBuffers();
     entity_entry.info.vb = std::get<0>(buffers);
     entity_entry.info.ib = std::get<1>(buffers);
+    entity_entry.lod_index_counts =
+            geometry_buffer_builder->GetLodIndexCounts();
 
     Box aabb = geometry_buffer_builder->ComputeAABB();
 
@@ -308,6 +312,88 @@ GeometryHandle FilamentScene::AddGeometry(
     return handle;
 }
 
+std::vector<GeometryHandle> FilamentScene::AddGeometryInstances(
+        const geometry::Geometry3D& geometry,
+        const MaterialInstanceHandle& material_id,
+        const std::vector<Transform>& instance_transforms) {
+    using namespace filament;
+
+    std::vector<GeometryHandle> handles;
+    if (instance_transforms.empty()) {
+        return handles;
+    }
+
+    auto geometry_buffer_builder = GeometryBuffersBuilder::GetBuilder(geometry);
+    if (!geometry_buffer_builder) {
+        utility::LogWarning("Geometry type {} is not supported yet!",
+                            static_cast<size_t>(geometry.GetGeometryType()));
+        return handles;
+    }
+
+    // All instances share one set of vertex and index buffers; only the
+    // renderable entities and their transforms are per instance.
+    auto buffers = geometry_buffer_builder->ConstructBuffers();
+    VertexBufferHandle vb = std::get<0>(buffers);
+    IndexBufferHandle ib = std::get<1>(buffers);
+
+    Box aabb = geometry_buffer_builder->ComputeAABB();
+
+    auto vbuf = resource_mgr_.GetVertexBuffer(vb).lock();
+    auto ibuf = resource_mgr_.GetIndexBuffer(ib).lock();
+
+    auto wmat_instance = resource_mgr_.GetMaterialInstance(material_id);
+
+    handles.reserve(instance_transforms.size());
+    for (const auto& transform : instance_transforms) {
+        SceneEntity entity_entry;
+        entity_entry.info.type = EntityType::Geometry;
+        entity_entry.info.vb = vb;
+        entity_entry.info.ib = ib;
+        entity_entry.name = geometry.GetName();
+        entity_entry.lod_index_counts =
+                geometry_buffer_builder->GetLodIndexCounts();
+
+        entity_entry.info.self = utils::EntityManager::get().create();
+        RenderableManager::Builder builder(1);
+        builder.boundingBox(aabb)
+                .layerMask(FilamentView::kAllLayersMask,
+                           FilamentView::kMainLayer)
+                .castShadows(true)
+                .receiveShadows(true)
+                .geometry(0, geometry_buffer_builder->GetPrimitiveType(),
+                          vbuf.get(), ibuf.get());
+
+        if (!wmat_instance.expired()) {
+            builder.material(0, wmat_instance.lock().get());
+            entity_entry.material = material_id;
+        }
+
+        auto result = builder.build(engine_, entity_entry.info.self);
+        if (result != RenderableManager::Builder::Success) {
+            engine_.destroy(entity_entry.info.self);
+            continue;
+        }
+
+        scene_->addEntity(entity_entry.info.self);
+
+        auto handle = GeometryHandle::Next();
+        entities_[handle] = entity_entry;
+        ++shared_buffer_use_count_[vb];
+        ++shared_buffer_use_count_[ib];
+
+        SetEntityTransform(handle, transform);
+        handles.push_back(handle);
+    }
+
+    // no instance was built, so the shared buffers have no users
+    if (handles.empty()) {
+        resource_mgr_.Destroy(ib);
+        resource_mgr_.Destroy(vb);
+    }
+
+    return handles;
+}
+
 std::vector<GeometryHandle> FilamentScene::FindGeometryByName(
         const std::string& name) {
     std::vector<GeometryHandle> found;
@@ -671,12 +757,33 @@ void FilamentScene::RemoveEntity(REHandle_abstract id) {
         auto& data = found->second;
         scene_->remove(data.info.self);
 
+        // Buffers shared with other instances are only destroyed with the
+        // last user; clearing the handle makes ReleaseResources skip them.
+        if (data.info.vb && !ReleaseSharedBuffer(data.info.vb)) {
+            data.info.vb = VertexBufferHandle();
+        }
+        if (data.info.ib && !ReleaseSharedBuffer(data.info.ib)) {
+            data.info.ib = IndexBufferHandle();
+        }
+
         data.ReleaseResources(engine_, resource_mgr_);
 
         entities_.erase(found);
     }
 }
 
+bool FilamentScene::ReleaseSharedBuffer(const REHandle_abstract& buffer) {
+    auto found = shared_buffer_use_count_.find(buffer);
+    if (found == shared_buffer_use_count_.end()) {
+        return true;
+    }
+    if (--found->second > 0) {
+        return false;
+    }
+    shared_buffer_use_count_.erase(found);
+    return true;
+}
+
 void FilamentScene::SceneEntity::Details::ReleaseResources(
         filament::Engine& engine, FilamentResourceManager& manager) {
     if (vb) {
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/visualization/rendering/Scene.h"
 
@@ -77,6 +78,10 @@ public:
     GeometryHandle AddGeometry(const geometry::Geometry3D& geometry,
                                const MaterialInstanceHandle& material_id,
                                const std::string& name) override;
+    std::vector<GeometryHandle> AddGeometryInstances(
+            const geometry::Geometry3D& geometry,
+            const MaterialInstanceHandle& material_id,
+            const std::vector<Transform>& instance_transforms) override;
     std::vector<GeometryHandle> FindGeometryByName(
             const std::string& name) override;
     void AssignMaterial(const GeometryHandle& geometry_id,
@@ -140,11 +145,16 @@ private:
         // We can disable entities removing them from scene, but not
         // deallocating
         bool enabled = true;
+        // True while frustum culling keeps the entity out of the scene
+        bool culled = false;
         MaterialInstanceHandle material;
         TextureHandle texture;  // if none, default is used
         // Used for relocating transform to center of mass
         utils::Entity parent;
         std::string name;
+        // Cumulative LOD index counts from the buffers builder; empty when
+        // the geometry carries no LOD levels
+        std::vector<size_t> lod_index_counts;
 
         bool IsValid() const { return info.IsValid(); }
         void ReleaseResources(filament::Engine& engine,
@@ -159,6 +169,9 @@ private:
     utils::EntityInstance<filament::TransformManager>
     GetEntityTransformInstance(const REHandle_abstract& id);
     void RemoveEntity(REHandle_abstract id);
+    // Decrements the use count of a buffer shared between instanced
+    // entities. Returns true when the caller must destroy the buffer.
+    bool ReleaseSharedBuffer(const REHandle_abstract& buffer);
 
     filament::Scene* scene_ = nullptr;
 
@@ -167,6 +180,8 @@ private:
 
     std::unordered_map<REHandle_abstract, ViewContainer> views_;
     std::unordered_map<REHandle_abstract, SceneEntity> entities_;
+    // Use counts for vertex/index buffers shared by instanced entities
+    std::unordered_map<REHandle_abstract, int> shared_buffer_use_count_;
     std::weak_ptr<filament::IndirectLight> indirect_light_;
     std::weak_ptr<filament::Skybox> skybox_;
 };
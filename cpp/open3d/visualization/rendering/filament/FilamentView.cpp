@@ -32,6 +32,10 @@
 #include <filament/Scene.h>
 #include <filament/View.h>
 #include <filament/Viewport.h>
+#include <math/mat4.h>
+
+#include <algorithm>
+#include <array>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/visualization/rendering/filament/FilamentCamera.h"
@@ -52,6 +56,41 @@ const filament::LinearColorA kDepthClearColor = {0.f, 0.f, 0.f, 0.f};
 const filament::LinearColorA kNormalsClearColor = {0.5f, 0.5f, 0.5f, 1.f};
 #endif
 
+// A LOD level is fine enough when its point spacing projects to at most
+// this many pixels on screen
+const float kLodScreenSpaceError = 2.f;
+
+// Extracts the six frustum planes from a projection * view matrix
+// (Gribb & Hartmann); the plane normals point inside the frustum
+std::array<Eigen::Vector4d, 6> ExtractFrustumPlanes(
+        const filament::math::mat4& m) {
+    auto row = [&m](int i) {
+        return Eigen::Vector4d(m[0][i], m[1][i], m[2][i], m[3][i]);
+    };
+    const Eigen::Vector4d r0 = row(0);
+    const Eigen::Vector4d r1 = row(1);
+    const Eigen::Vector4d r2 = row(2);
+    const Eigen::Vector4d r3 = row(3);
+    return {{r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2}};
+}
+
+// Conservative test of a world space AABB against the frustum planes
+bool IntersectsFrustum(const std::array<Eigen::Vector4d, 6>& planes,
+                       const geometry::AxisAlignedBoundingBox& box) {
+    for (const auto& plane : planes) {
+        // The box vertex furthest along the plane normal; the whole box
+        // lies outside when even this vertex is behind the plane
+        const Eigen::Vector3d positive(
+                plane(0) >= 0. ? box.max_bound_(0) : box.min_bound_(0),
+                plane(1) >= 0. ? box.max_bound_(1) : box.min_bound_(1),
+                plane(2) >= 0. ? box.max_bound_(2) : box.min_bound_(2));
+        if (plane.head<3>().dot(positive) + plane(3) < 0.) {
+            return false;
+        }
+    }
+    return true;
+}
+
 filament::View::TargetBufferFlags FlagsFromTargetBuffers(
         const View::TargetBuffers& buffers) {
     using namespace std;
@@ -264,9 +303,38 @@ void FilamentView::PreRender() {
     }
 
     if (scene_) {
-        for (const auto& pair : scene_->entities_) {
-            const auto& entity = pair.second;
+        const auto* native_camera = camera_->GetNativeCamera();
+        const auto frustum_planes = ExtractFrustumPlanes(
+                native_camera->getProjectionMatrix() *
+                filament::math::mat4(
+                        inverse(native_camera->getModelMatrix())));
+
+        for (auto& pair : scene_->entities_) {
+            auto& entity = pair.second;
             if (entity.info.type == EntityType::Geometry) {
+                // Frustum culling: remove entities whose world bounding
+                // box falls outside the view frustum from the scene and
+                // re-add them when they come back into view, so hidden
+                // geometry stops consuming vertex throughput
+                if (entity.enabled) {
+                    const bool visible = IntersectsFrustum(
+                            frustum_planes,
+                            scene_->GetEntityBoundingBox(pair.first));
+                    if (visible == entity.culled) {
+                        entity.culled = !visible;
+                        if (visible) {
+                            scene_->GetNativeScene()->addEntity(
+                                    entity.info.self);
+                        } else {
+                            scene_->GetNativeScene()->remove(
+                                    entity.info.self);
+                        }
+                    }
+                    if (!visible) {
+                        continue;
+                    }
+                }
+
                 std::shared_ptr<filament::MaterialInstance> mat_inst;
                 if (selected_material) {
                     mat_inst = selected_material;
@@ -293,6 +361,45 @@ void FilamentView::PreRender() {
                 filament::RenderableManager::Instance inst =
                         renderable_mgr.getInstance(entity.info.self);
                 renderable_mgr.setMaterialInstanceAt(inst, 0, mat_inst.get());
+
+                // Geometries with LOD levels have their index buffer
+                // ordered coarse-to-fine; pick the shortest prefix whose
+                // point spacing projects below the screen space error
+                // threshold at the current camera distance
+                if (!entity.lod_index_counts.empty()) {
+                    const auto bbox =
+                            scene_->GetEntityBoundingBox(pair.first);
+                    const Eigen::Vector3f center =
+                            bbox.GetCenter().cast<float>();
+                    const float extent = float(bbox.GetMaxExtent());
+                    const float dist = std::max(
+                            (center - camera_->GetPosition()).norm() -
+                                    0.5f * extent,
+                            float(camera_->GetNear()));
+                    // Projection matrix element [1][1] is cot(fov_y / 2)
+                    const auto proj = camera_->GetNativeCamera()
+                                              ->getProjectionMatrix();
+                    const float pixels_per_unit =
+                            float(proj[1][1]) * 0.5f *
+                            float(view_->getViewport().height) / dist;
+
+                    size_t count = entity.lod_index_counts.back();
+                    // Level l has one point per cell of size extent / 2^l
+                    float spacing = extent;
+                    for (size_t l = 0; l < entity.lod_index_counts.size();
+                         ++l, spacing *= 0.5f) {
+                        if (spacing * pixels_per_unit <=
+                            kLodScreenSpaceError) {
+                            count = entity.lod_index_counts[l];
+                            break;
+                        }
+                    }
+                    renderable_mgr.setGeometryAt(
+                            inst, 0,
+                            filament::RenderableManager::PrimitiveType::
+                                    POINTS,
+                            0, count);
+                }
             }
         }
     }
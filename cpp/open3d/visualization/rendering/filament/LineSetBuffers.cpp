@@ -77,6 +77,25 @@ RenderableManager::PrimitiveType LineSetBuffersBuilder::GetPrimitiveType()
 }
 
 LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructBuffers() {
+    // Line sets without per-line colors, or with one uniform color, can
+    // reference the point array directly: one vertex per point and two
+    // indices per line, with no endpoint duplication or map lookups. This
+    // is the common case for correspondence debugging line sets.
+    if (!geometry_.HasColors()) {
+        return ConstructIndexedBuffers(Eigen::Vector3d(1.0, 1.0, 1.0));
+    }
+    bool uniform_color = true;
+    const Eigen::Vector3d& first_color = geometry_.colors_[0];
+    for (const auto& color : geometry_.colors_) {
+        if (color != first_color) {
+            uniform_color = false;
+            break;
+        }
+    }
+    if (uniform_color) {
+        return ConstructIndexedBuffers(first_color);
+    }
+
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
@@ -207,6 +226,80 @@ LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle);
 }
 
+LineSetBuffersBuilder::Buffers LineSetBuffersBuilder::ConstructIndexedBuffers(
+        const Eigen::Vector3d& color) {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    const size_t vertices_count = geometry_.points_.size();
+    const size_t vertices_bytes_count = vertices_count * sizeof(ColoredVertex);
+    auto* vertices = static_cast<ColoredVertex*>(malloc(vertices_bytes_count));
+
+    for (size_t i = 0; i < vertices_count; ++i) {
+        auto& element = vertices[i];
+        element.SetVertexPosition(geometry_.points_[i]);
+        element.SetVertexColor(color);
+    }
+
+    const size_t lines_count = geometry_.lines_.size();
+    const size_t indices_bytes_count = lines_count * 2 * sizeof(IndexType);
+    auto* indices = static_cast<IndexType*>(malloc(indices_bytes_count));
+
+    for (size_t i = 0; i < lines_count; ++i) {
+        const auto& line = geometry_.lines_[i];
+        indices[2 * i] = IndexType(line(0));
+        indices[2 * i + 1] = IndexType(line(1));
+    }
+
+    VertexBuffer* vbuf = VertexBuffer::Builder()
+                                 .bufferCount(1)
+                                 .vertexCount(vertices_count)
+                                 .attribute(VertexAttribute::POSITION, 0,
+                                            VertexBuffer::AttributeType::FLOAT3,
+                                            ColoredVertex::GetPositionOffset(),
+                                            sizeof(ColoredVertex))
+                                 .normalized(VertexAttribute::COLOR)
+                                 .attribute(VertexAttribute::COLOR, 0,
+                                            VertexBuffer::AttributeType::FLOAT4,
+                                            ColoredVertex::GetColorOffset(),
+                                            sizeof(ColoredVertex))
+                                 .build(engine);
+
+    VertexBufferHandle vb_handle;
+    if (vbuf) {
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+    } else {
+        free(vertices);
+        free(indices);
+        return {};
+    }
+
+    // Moving `vertices` to VertexBuffer, which will clean them up later
+    // with DeallocateBuffer
+    VertexBuffer::BufferDescriptor vb_descriptor(vertices,
+                                                 vertices_bytes_count);
+    vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+
+    const size_t indices_count = lines_count * 2;
+    auto ib_handle =
+            resource_mgr.CreateIndexBuffer(indices_count, sizeof(IndexType));
+    if (!ib_handle) {
+        free(indices);
+        return {};
+    }
+
+    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
+
+    // Moving `indices` to IndexBuffer, which will clean them up later
+    // with DeallocateBuffer
+    IndexBuffer::BufferDescriptor ib_descriptor(indices, indices_bytes_count);
+    ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
+    ibuf->setBuffer(engine, std::move(ib_descriptor));
+
+    return std::make_tuple(vb_handle, ib_handle);
+}
+
 Box LineSetBuffersBuilder::ComputeAABB() {
     const auto geometry_aabb = geometry_.GetAxisAlignedBoundingBox();
 
@@ -29,6 +29,9 @@
 #include <geometry/SurfaceOrientation.h>
 #include <Eigen/Core>
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
@@ -70,6 +73,69 @@ struct ColoredVertex {
         color.z = float_color(2);
     }
 };
+
+// Point clouds below this size render fast enough without LOD levels
+const size_t kMinLodPoints = 1000000;
+// The finest LOD grid has 2^kMaxLodLevel cells per axis
+const int kMaxLodLevel = 20;
+
+// Builds a coarse-to-fine ordering of the point indices. Level l keeps one
+// point per cell of a cubic grid with 2^l cells along the longest extent,
+// like an octree cut at depth l, so any level prefix of the ordering is a
+// spatially uniform subsample of the cloud. Returns the cumulative index
+// count per level.
+std::vector<size_t> BuildLodOrder(const geometry::PointCloud& geometry,
+                                  GeometryBuffersBuilder::IndexType* indices) {
+    const size_t n = geometry.points_.size();
+    const auto aabb = geometry.GetAxisAlignedBoundingBox();
+    const Eigen::Vector3d min_bound = aabb.min_bound_;
+    const double extent = std::max(aabb.GetMaxExtent(), 1e-12);
+
+    std::vector<size_t> counts;
+    std::vector<bool> selected(n, false);
+    size_t num_ordered = 0;
+    for (int level = 0; level <= kMaxLodLevel && num_ordered < n; ++level) {
+        const std::uint64_t resolution = std::uint64_t(1) << level;
+        const double inv_cell_size = double(resolution) / extent;
+        auto cell_key = [&](size_t i) {
+            const Eigen::Vector3d p = geometry.points_[i] - min_bound;
+            // Points on the upper AABB faces land exactly on resolution,
+            // clamp them into the last cell. 3x21 bits fit into the key.
+            const auto clamped = [&](double v) {
+                return std::min(std::uint64_t(std::max(v, 0.) * inv_cell_size),
+                                resolution - 1);
+            };
+            return (clamped(p(0)) << 42) | (clamped(p(1)) << 21) |
+                   clamped(p(2));
+        };
+
+        std::unordered_set<std::uint64_t> occupied;
+        // Points selected at coarser levels occupy their cell here as well
+        for (size_t i = 0; i < num_ordered; ++i) {
+            occupied.insert(cell_key(indices[i]));
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (!selected[i] && occupied.insert(cell_key(i)).second) {
+                indices[num_ordered++] =
+                        GeometryBuffersBuilder::IndexType(i);
+                selected[i] = true;
+            }
+        }
+        counts.push_back(num_ordered);
+    }
+
+    // Points denser than the finest grid go into one last level
+    if (num_ordered < n) {
+        for (size_t i = 0; i < n; ++i) {
+            if (!selected[i]) {
+                indices[num_ordered++] =
+                        GeometryBuffersBuilder::IndexType(i);
+            }
+        }
+        counts.push_back(n);
+    }
+    return counts;
+}
 }  // namespace
 
 PointCloudBuffersBuilder::PointCloudBuffersBuilder(
@@ -176,8 +242,15 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
 
     const size_t indices_byte_count = n_vertices * sizeof(IndexType);
     auto* uint_indices = static_cast<IndexType*>(malloc(indices_byte_count));
-    for (std::uint32_t i = 0; i < n_vertices; ++i) {
-        uint_indices[i] = i;
+    if (n_vertices >= kMinLodPoints) {
+        // Order the indices coarse-to-fine so the renderer can draw a
+        // prefix of the index buffer as a lower level of detail
+        lod_index_counts_ = BuildLodOrder(geometry_, uint_indices);
+    } else {
+        lod_index_counts_.clear();
+        for (std::uint32_t i = 0; i < n_vertices; ++i) {
+            uint_indices[i] = i;
+        }
     }
 
     auto ib_handle =
@@ -199,6 +272,10 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle);
 }
 
+std::vector<size_t> PointCloudBuffersBuilder::GetLodIndexCounts() const {
+    return lod_index_counts_;
+}
+
 filament::Box PointCloudBuffersBuilder::ComputeAABB() {
     const auto geometry_aabb = geometry_.GetAxisAlignedBoundingBox();
 
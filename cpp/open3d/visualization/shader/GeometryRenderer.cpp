@@ -72,10 +72,18 @@ bool PointCloudRenderer::AddGeometry(
 }
 
 bool PointCloudRenderer::UpdateGeometry() {
-    simple_point_shader_.InvalidateGeometry();
-    phong_point_shader_.InvalidateGeometry();
-    normal_point_shader_.InvalidateGeometry();
-    simpleblack_normal_shader_.InvalidateGeometry();
+    // UpdateGeometry() keeps the buffer objects alive, so shaders which
+    // support it (e.g. SimpleShader) stream the new points with
+    // glBufferSubData instead of deleting and reallocating the buffers.
+    // The geometry's attribute change mask narrows the refresh further: a
+    // color-only edit re-uploads just the color buffer.
+    const int changed_attributes =
+            ((const geometry::Geometry3D &)(*geometry_ptr_))
+                    .ConsumeRenderAttributesChanged();
+    simple_point_shader_.UpdateGeometry(changed_attributes);
+    phong_point_shader_.UpdateGeometry(changed_attributes);
+    normal_point_shader_.UpdateGeometry(changed_attributes);
+    simpleblack_normal_shader_.UpdateGeometry(changed_attributes);
     return true;
 }
 
@@ -27,6 +27,7 @@
 #include "open3d/visualization/shader/ShaderWrapper.h"
 
 #include "open3d/geometry/Geometry.h"
+#include "open3d/geometry/Geometry3D.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -40,6 +41,16 @@ bool ShaderWrapper::Render(const geometry::Geometry &geometry,
     if (!compiled_) {
         Compile();
     }
+    if (bound_ && geometry_update_requested_) {
+        // Try refreshing the buffers in place; fall back to a full rebind
+        // when the shader cannot update or the data does not fit anymore.
+        if (!UpdateBoundGeometry(geometry, option, view,
+                                 geometry_update_mask_)) {
+            UnbindGeometry();
+        }
+        geometry_update_requested_ = false;
+        geometry_update_mask_ = 0;
+    }
     if (!bound_) {
         BindGeometry(geometry, option, view);
     }
@@ -54,6 +65,18 @@ void ShaderWrapper::InvalidateGeometry() {
     if (bound_) {
         UnbindGeometry();
     }
+    geometry_update_requested_ = false;
+}
+
+void ShaderWrapper::UpdateGeometry(int changed_attributes /* = 0*/) {
+    geometry_update_requested_ = true;
+    geometry_update_mask_ |=
+            changed_attributes != 0
+                    ? changed_attributes
+                    : geometry::Geometry3D::RenderAttributePoints |
+                              geometry::Geometry3D::RenderAttributeNormals |
+                              geometry::Geometry3D::RenderAttributeColors |
+                              geometry::Geometry3D::RenderAttributeTopology;
 }
 
 void ShaderWrapper::PrintShaderWarning(const std::string &message) const {
@@ -59,6 +59,17 @@ public:
     /// geometry resource)
     void InvalidateGeometry();
 
+    /// Function to mark the bound geometry as outdated without releasing
+    /// the buffer objects. The next render refreshes the buffer contents
+    /// in place via UpdateBoundGeometry() and only falls back to a full
+    /// rebind when the shader does not support in-place updates or the
+    /// data no longer fits the buffers.
+    ///
+    /// \param changed_attributes Bitmask of
+    /// geometry::Geometry3D::RenderAttributes narrowing the refresh to the
+    /// flagged vertex buffers; 0 refreshes everything.
+    void UpdateGeometry(int changed_attributes = 0);
+
     const std::string &GetShaderName() const { return shader_name_; }
 
     void PrintShaderWarning(const std::string &message) const;
@@ -82,6 +93,19 @@ protected:
                                 const ViewControl &view) = 0;
     virtual void UnbindGeometry() = 0;
 
+    /// Function to refresh the already bound buffer objects in place with
+    /// the current geometry data. \p changed_attributes carries the
+    /// accumulated geometry::Geometry3D::RenderAttributes mask, letting
+    /// implementations skip buffers whose attributes did not change.
+    /// Returning false makes the caller fall back to a full rebind. The
+    /// default implementation supports no in-place updates.
+    virtual bool UpdateBoundGeometry(const geometry::Geometry &geometry,
+                                     const RenderOption &option,
+                                     const ViewControl &view,
+                                     int changed_attributes) {
+        return false;
+    }
+
 protected:
     bool ValidateShader(GLuint shader_index);
     bool ValidateProgram(GLuint program_index);
@@ -99,6 +123,10 @@ protected:
     GLsizei draw_arrays_size_ = 0;
     bool compiled_ = false;
     bool bound_ = false;
+    bool geometry_update_requested_ = false;
+    // Accumulated RenderAttributes mask for the pending update; valid
+    // while geometry_update_requested_ is set.
+    int geometry_update_mask_ = 0;
 
     void SetShaderName(const std::string &shader_name) {
         shader_name_ = shader_name;
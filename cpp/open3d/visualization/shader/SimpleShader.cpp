@@ -87,10 +87,11 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const ViewControl &view) {
     // If there is already geometry, we first unbind it.
     // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
+    // rebind the geometry. Note that this approach is slow. If the geometry
+    // is changing per frame, notify the shader with UpdateGeometry() instead
+    // of InvalidateGeometry(); then UpdateBoundGeometry() refreshes the
+    // buffer contents in place and the buffers are only recreated when the
+    // vertex count outgrows them.
     UnbindGeometry();
 
     // Prepare data to be passed to GPU
@@ -110,10 +111,51 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
                  colors.data(), GL_STATIC_DRAW);
+    vertex_buffer_capacity_ = GLsizei(points.size());
     bound_ = true;
     return true;
 }
 
+bool SimpleShader::UpdateBoundGeometry(const geometry::Geometry &geometry,
+                                       const RenderOption &option,
+                                       const ViewControl &view,
+                                       int changed_attributes) {
+    std::vector<Eigen::Vector3f> points;
+    std::vector<Eigen::Vector3f> colors;
+    if (!PrepareBinding(geometry, option, view, points, colors)) {
+        PrintShaderWarning("Updating failed when preparing data.");
+        return false;
+    }
+    if (GLsizei(points.size()) > vertex_buffer_capacity_) {
+        // The new data does not fit; the caller performs a full rebind.
+        return false;
+    }
+
+    // Overwrite the buffer contents without reallocating the buffers,
+    // skipping buffers whose attributes did not change. Positions depend
+    // on the points and the topology; the expanded colors additionally
+    // depend on the points, because some color options map coordinates to
+    // colors.
+    const int position_attributes =
+            geometry::Geometry3D::RenderAttributePoints |
+            geometry::Geometry3D::RenderAttributeTopology;
+    const int color_attributes =
+            position_attributes | geometry::Geometry3D::RenderAttributeColors;
+    if (changed_attributes & position_attributes) {
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+        glBufferSubData(GL_ARRAY_BUFFER, 0,
+                        points.size() * sizeof(Eigen::Vector3f),
+                        points.data());
+    }
+    if (changed_attributes & color_attributes) {
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+        glBufferSubData(GL_ARRAY_BUFFER, 0,
+                        colors.size() * sizeof(Eigen::Vector3f),
+                        colors.data());
+    }
+    return true;
+}
+
 bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
                                   const RenderOption &option,
                                   const ViewControl &view) {
@@ -139,6 +181,7 @@ void SimpleShader::UnbindGeometry() {
     if (bound_) {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_color_buffer_);
+        vertex_buffer_capacity_ = 0;
         bound_ = false;
     }
 }
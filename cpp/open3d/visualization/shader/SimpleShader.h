@@ -53,6 +53,10 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view) final;
     void UnbindGeometry() final;
+    bool UpdateBoundGeometry(const geometry::Geometry &geometry,
+                             const RenderOption &option,
+                             const ViewControl &view,
+                             int changed_attributes) final;
 
 protected:
     virtual bool PrepareRendering(const geometry::Geometry &geometry,
@@ -70,6 +74,9 @@ protected:
     GLuint vertex_color_;
     GLuint vertex_color_buffer_;
     GLuint MVP_;
+    // Number of vertices the buffer objects were allocated for; in-place
+    // updates are possible as long as the new data fits this capacity.
+    GLsizei vertex_buffer_capacity_ = 0;
 };
 
 class SimpleShaderForPointCloud : public SimpleShader {
@@ -0,0 +1,341 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/utility/SoftwareRasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+#include "open3d/visualization/visualizer/RenderOption.h"
+#include "open3d/visualization/visualizer/ViewControl.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+const int TILE_SIZE = 64;
+const float NEAR_CLIP_EPSILON = 1e-6f;
+
+// Vertex after projection: x, y in pixels (bottom-left origin, matching the
+// OpenGL convention), z in window coordinates [0, 1]
+struct ScreenVertex {
+    float x, y, z;
+    float inv_w;
+    Eigen::Vector3f color;
+};
+
+// Vertex in clip coordinates, before the near clip and perspective divide
+struct ClipVertex {
+    Eigen::Vector4f position;
+    Eigen::Vector3f color;
+};
+
+// Triangles are stored as three consecutive vertices, points as one
+struct RasterScene {
+    std::vector<ScreenVertex> triangles;
+    std::vector<ScreenVertex> points;
+};
+
+ScreenVertex ToScreen(const ClipVertex &v, int width, int height) {
+    ScreenVertex s;
+    float inv_w = 1.f / v.position(3);
+    s.x = (v.position(0) * inv_w * 0.5f + 0.5f) * float(width);
+    s.y = (v.position(1) * inv_w * 0.5f + 0.5f) * float(height);
+    s.z = v.position(2) * inv_w * 0.5f + 0.5f;
+    s.inv_w = inv_w;
+    s.color = v.color;
+    return s;
+}
+
+// Clips the triangle against the near plane (z >= -w) and appends the
+// surviving part, re-triangulated as a fan, to scene.triangles
+void ClipAndAppendTriangle(const ClipVertex clipped[3],
+                           int width,
+                           int height,
+                           RasterScene &scene) {
+    ClipVertex poly[4];
+    int n = 0;
+    for (int i = 0; i < 3; i++) {
+        const ClipVertex &a = clipped[i];
+        const ClipVertex &b = clipped[(i + 1) % 3];
+        float da = a.position(2) + a.position(3);
+        float db = b.position(2) + b.position(3);
+        bool a_in = da >= NEAR_CLIP_EPSILON;
+        bool b_in = db >= NEAR_CLIP_EPSILON;
+        if (a_in) {
+            poly[n++] = a;
+        }
+        if (a_in != b_in) {
+            float t = da / (da - db);
+            ClipVertex v;
+            v.position = a.position + t * (b.position - a.position);
+            v.color = a.color + t * (b.color - a.color);
+            poly[n++] = v;
+        }
+    }
+    for (int i = 2; i < n; i++) {
+        scene.triangles.push_back(ToScreen(poly[0], width, height));
+        scene.triangles.push_back(ToScreen(poly[i - 1], width, height));
+        scene.triangles.push_back(ToScreen(poly[i], width, height));
+    }
+}
+
+void AppendGeometry(const geometry::Geometry &geometry,
+                    const Eigen::Matrix4f &mvp,
+                    const RenderOption &option,
+                    int width,
+                    int height,
+                    RasterScene &scene) {
+    auto transform = [&mvp](const Eigen::Vector3d &point) {
+        return Eigen::Vector4f(mvp * point.cast<float>().homogeneous());
+    };
+    switch (geometry.GetGeometryType()) {
+        case geometry::Geometry::GeometryType::PointCloud: {
+            const auto &cloud = (const geometry::PointCloud &)geometry;
+            for (size_t i = 0; i < cloud.points_.size(); i++) {
+                ClipVertex v;
+                v.position = transform(cloud.points_[i]);
+                if (v.position(2) + v.position(3) < NEAR_CLIP_EPSILON) {
+                    continue;
+                }
+                v.color = cloud.HasColors()
+                                  ? cloud.colors_[i].cast<float>().eval()
+                                  : Eigen::Vector3f(0.5f, 0.5f, 0.5f);
+                scene.points.push_back(ToScreen(v, width, height));
+            }
+            break;
+        }
+        case geometry::Geometry::GeometryType::TriangleMesh: {
+            const auto &mesh = (const geometry::TriangleMesh &)geometry;
+            for (const auto &triangle : mesh.triangles_) {
+                ClipVertex clipped[3];
+                for (int k = 0; k < 3; k++) {
+                    int vi = triangle(k);
+                    clipped[k].position = transform(mesh.vertices_[vi]);
+                    clipped[k].color =
+                            mesh.HasVertexColors()
+                                    ? mesh.vertex_colors_[vi]
+                                              .cast<float>()
+                                              .eval()
+                                    : option.default_mesh_color_.cast<float>()
+                                              .eval();
+                }
+                ClipAndAppendTriangle(clipped, width, height, scene);
+            }
+            break;
+        }
+        default:
+            utility::LogDebug(
+                    "[RasterizeFrame] Geometry type {} is not supported by "
+                    "the software rasterizer and is skipped.",
+                    (int)geometry.GetGeometryType());
+            break;
+    }
+}
+
+void RasterizeTiles(const RasterScene &scene,
+                    int width,
+                    int height,
+                    bool cull_back_face,
+                    float point_size,
+                    float *depth_buffer,
+                    float *color_buffer) {
+    int tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+    int tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+    int tile_count = tiles_x * tiles_y;
+
+    // Bin the primitives to the tiles their screen bounding boxes overlap
+    std::vector<std::vector<int>> triangle_bins(tile_count);
+    std::vector<std::vector<int>> point_bins(tile_count);
+    auto bin = [&](std::vector<std::vector<int>> &bins, int index, float min_x,
+                   float max_x, float min_y, float max_y) {
+        int tx0 = std::max(int(min_x) / TILE_SIZE, 0);
+        int tx1 = std::min(int(max_x) / TILE_SIZE, tiles_x - 1);
+        int ty0 = std::max(int(min_y) / TILE_SIZE, 0);
+        int ty1 = std::min(int(max_y) / TILE_SIZE, tiles_y - 1);
+        for (int ty = ty0; ty <= ty1; ty++) {
+            for (int tx = tx0; tx <= tx1; tx++) {
+                bins[ty * tiles_x + tx].push_back(index);
+            }
+        }
+    };
+    for (int t = 0; t < int(scene.triangles.size()) / 3; t++) {
+        const ScreenVertex *v = &scene.triangles[3 * t];
+        bin(triangle_bins, t, std::min({v[0].x, v[1].x, v[2].x}),
+            std::max({v[0].x, v[1].x, v[2].x}),
+            std::min({v[0].y, v[1].y, v[2].y}),
+            std::max({v[0].y, v[1].y, v[2].y}));
+    }
+    float radius = std::max(0.5f * point_size, 0.5f);
+    for (int p = 0; p < int(scene.points.size()); p++) {
+        const ScreenVertex &v = scene.points[p];
+        bin(point_bins, p, v.x - radius, v.x + radius, v.y - radius,
+            v.y + radius);
+    }
+
+    auto edge = [](const ScreenVertex &a, const ScreenVertex &b, float px,
+                   float py) {
+        return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+    };
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < tile_count; tile++) {
+        int x0 = (tile % tiles_x) * TILE_SIZE;
+        int y0 = (tile / tiles_x) * TILE_SIZE;
+        int x1 = std::min(x0 + TILE_SIZE, width);
+        int y1 = std::min(y0 + TILE_SIZE, height);
+
+        for (int t : triangle_bins[tile]) {
+            const ScreenVertex &v0 = scene.triangles[3 * t];
+            const ScreenVertex &v1 = scene.triangles[3 * t + 1];
+            const ScreenVertex &v2 = scene.triangles[3 * t + 2];
+            float area = edge(v0, v1, v2.x, v2.y);
+            if (area == 0.f || (cull_back_face && area < 0.f)) {
+                continue;
+            }
+            float inv_area = 1.f / area;
+            int px0 = std::max(x0,
+                               int(std::floor(std::min({v0.x, v1.x, v2.x}))));
+            int px1 = std::min(x1,
+                               int(std::ceil(std::max({v0.x, v1.x, v2.x}))));
+            int py0 = std::max(y0,
+                               int(std::floor(std::min({v0.y, v1.y, v2.y}))));
+            int py1 = std::min(y1,
+                               int(std::ceil(std::max({v0.y, v1.y, v2.y}))));
+            for (int y = py0; y < py1; y++) {
+                for (int x = px0; x < px1; x++) {
+                    float px = float(x) + 0.5f;
+                    float py = float(y) + 0.5f;
+                    float b0 = edge(v1, v2, px, py) * inv_area;
+                    float b1 = edge(v2, v0, px, py) * inv_area;
+                    float b2 = edge(v0, v1, px, py) * inv_area;
+                    if (b0 < 0.f || b1 < 0.f || b2 < 0.f) {
+                        continue;
+                    }
+                    float z = b0 * v0.z + b1 * v1.z + b2 * v2.z;
+                    int idx = y * width + x;
+                    if (z < 0.f || z > 1.f || z >= depth_buffer[idx]) {
+                        continue;
+                    }
+                    depth_buffer[idx] = z;
+                    if (color_buffer) {
+                        // Perspective-correct interpolation of the colors
+                        float inv_w = b0 * v0.inv_w + b1 * v1.inv_w +
+                                      b2 * v2.inv_w;
+                        Eigen::Vector3f color = (b0 * v0.inv_w * v0.color +
+                                                 b1 * v1.inv_w * v1.color +
+                                                 b2 * v2.inv_w * v2.color) /
+                                                inv_w;
+                        color_buffer[3 * idx] = color(0);
+                        color_buffer[3 * idx + 1] = color(1);
+                        color_buffer[3 * idx + 2] = color(2);
+                    }
+                }
+            }
+        }
+
+        for (int p : point_bins[tile]) {
+            const ScreenVertex &v = scene.points[p];
+            if (v.z < 0.f || v.z > 1.f) {
+                continue;
+            }
+            int px0 = std::max(x0, int(std::floor(v.x - radius)));
+            int px1 = std::min(x1, int(std::ceil(v.x + radius)));
+            int py0 = std::max(y0, int(std::floor(v.y - radius)));
+            int py1 = std::min(y1, int(std::ceil(v.y + radius)));
+            for (int y = py0; y < py1; y++) {
+                for (int x = px0; x < px1; x++) {
+                    int idx = y * width + x;
+                    if (v.z >= depth_buffer[idx]) {
+                        continue;
+                    }
+                    depth_buffer[idx] = v.z;
+                    if (color_buffer) {
+                        color_buffer[3 * idx] = v.color(0);
+                        color_buffer[3 * idx + 1] = v.color(1);
+                        color_buffer[3 * idx + 2] = v.color(2);
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void RasterizeFrame(
+        const std::unordered_set<std::shared_ptr<const geometry::Geometry>>
+                &geometries,
+        const ViewControl &view,
+        const RenderOption &option,
+        float *depth_buffer,
+        float *color_buffer) {
+    int width = view.GetWindowWidth();
+    int height = view.GetWindowHeight();
+    if (width <= 0 || height <= 0) {
+        utility::LogWarning(
+                "[RasterizeFrame] Window height and width are not set.");
+        return;
+    }
+
+    Eigen::Matrix4f mvp = view.GetMVPMatrix();
+    RasterScene scene;
+    for (const auto &geometry_ptr : geometries) {
+        AppendGeometry(*geometry_ptr, mvp, option, width, height, scene);
+    }
+
+    // The depth test always needs a depth buffer, even for color-only
+    // captures
+    std::vector<float> depth(width * height, 1.f);
+    if (color_buffer) {
+        Eigen::Vector3f background =
+                option.background_color_.cast<float>();
+        for (int i = 0; i < width * height; i++) {
+            color_buffer[3 * i] = background(0);
+            color_buffer[3 * i + 1] = background(1);
+            color_buffer[3 * i + 2] = background(2);
+        }
+    }
+
+    RasterizeTiles(scene, width, height, !option.mesh_show_back_face_,
+                   float(option.point_size_), depth.data(), color_buffer);
+
+    if (depth_buffer) {
+        std::memcpy(depth_buffer, depth.data(),
+                    depth.size() * sizeof(float));
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
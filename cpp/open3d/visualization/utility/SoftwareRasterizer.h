@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <unordered_set>
+
+namespace open3d {
+
+namespace geometry {
+class Geometry;
+}
+
+namespace visualization {
+class RenderOption;
+class ViewControl;
+
+/// \brief Rasterizes the scene on the CPU for frame buffer captures.
+///
+/// Renders triangle meshes and point clouds without touching the GPU, so
+/// depth maps for visibility tests can be computed on machines without one.
+/// Triangles and point splats are binned to screen tiles which are then
+/// rasterized in parallel. Colors are flat per-vertex colors; lighting and
+/// the colormap render options are not applied.
+///
+/// \param geometries Geometries to render, in the view given by \p view.
+/// \param depth_buffer If non-null, receives window-space depth in [0, 1]
+/// with 1.0 for background pixels, one float per pixel and the bottom row
+/// first (the glReadPixels() layout). Must hold width * height floats.
+/// \param color_buffer If non-null, receives RGB in the same layout, three
+/// floats per pixel. Must hold 3 * width * height floats.
+void RasterizeFrame(
+        const std::unordered_set<std::shared_ptr<const geometry::Geometry>>
+                &geometries,
+        const ViewControl &view,
+        const RenderOption &option,
+        float *depth_buffer,
+        float *color_buffer);
+
+}  // namespace visualization
+}  // namespace open3d
@@ -630,6 +630,295 @@ struct GuiVisualizer::Impl {
     int app_menu_custom_items_index_ = -1;
     std::shared_ptr<gui::Menu> app_menu_;
 
+    // One geometry of a SetGeometry() call after the CPU-only preparation
+    // (uniform color analysis, decimation) which may run on a worker thread
+    struct PreparedGeometry {
+        std::shared_ptr<const geometry::Geometry> geometry;
+        // Decimated copy for fast drawing of very large point clouds
+        std::shared_ptr<geometry::PointCloud> decimated;
+        bool uniform_color = false;
+        // Index within the SetGeometry() argument, for loaded_materials_
+        size_t index = 0;
+    };
+
+    // State of one SetGeometry() call while its geometries are prepared on
+    // a worker thread and added to the scene one per run loop tick
+    struct GeometryLoad {
+        std::vector<std::shared_ptr<const geometry::Geometry>> geometries;
+        std::vector<PreparedGeometry> prepared;
+        std::size_t next = 0;
+        gui::SceneWidget::ModelDescription desc;
+        geometry::AxisAlignedBoundingBox bounds;
+        std::size_t num_unlit = 0;
+        std::size_t num_point_clouds = 0;
+        std::size_t num_point_cloud_points = 0;
+        // Loads are superseded when this no longer matches
+        // load_generation_
+        unsigned int generation = 0;
+    };
+    std::shared_ptr<GeometryLoad> pending_load_;
+    unsigned int load_generation_ = 0;
+
+    // Runs the CPU-only part of adding geometries: counting, uniform color
+    // analysis and point cloud decimation. Touches no UI or engine state,
+    // so it is safe to call from a worker thread.
+    static void PrepareGeometries(GeometryLoad &load) {
+        const std::size_t MIN_POINT_CLOUD_POINTS_FOR_DECIMATION = 6000000;
+
+        for (auto &g : load.geometries) {
+            if (g->GetGeometryType() ==
+                geometry::Geometry::GeometryType::PointCloud) {
+                load.num_point_clouds++;
+                auto cloud =
+                        std::static_pointer_cast<const geometry::PointCloud>(
+                                g);
+                load.num_point_cloud_points += cloud->points_.size();
+            }
+        }
+
+        load.prepared.reserve(load.geometries.size());
+        for (size_t i = 0; i < load.geometries.size(); ++i) {
+            PreparedGeometry prep;
+            prep.geometry = load.geometries[i];
+            prep.index = i;
+            switch (prep.geometry->GetGeometryType()) {
+                case geometry::Geometry::GeometryType::PointCloud: {
+                    auto pcd = std::static_pointer_cast<
+                            const geometry::PointCloud>(prep.geometry);
+                    prep.uniform_color = PointCloudHasUniformColor(*pcd);
+                    if (load.num_point_cloud_points >
+                        MIN_POINT_CLOUD_POINTS_FOR_DECIMATION) {
+                        int sample_rate =
+                                load.num_point_cloud_points /
+                                (MIN_POINT_CLOUD_POINTS_FOR_DECIMATION / 2);
+                        prep.decimated = pcd->UniformDownSample(sample_rate);
+                    }
+                } break;
+                case geometry::Geometry::GeometryType::TriangleMesh: {
+                    auto mesh = std::static_pointer_cast<
+                            const geometry::TriangleMesh>(prep.geometry);
+                    prep.uniform_color = MeshHasUniformColor(*mesh);
+                } break;
+                default:
+                    break;
+            }
+            load.prepared.push_back(prep);
+        }
+        load.geometries.clear();
+    }
+
+    // Adds one prepared geometry to the scene. Creates engine resources,
+    // so this must run on the UI thread.
+    void AddPreparedGeometry(rendering::Renderer &renderer,
+                             GeometryLoad &load,
+                             const PreparedGeometry &prep) {
+        auto *scene3d = scene_->GetScene();
+        const auto &g = prep.geometry;
+        Materials materials = settings_.current_materials;
+
+        rendering::MaterialInstanceHandle selected_material;
+
+        // If a point cloud or mesh has no vertex colors or a single uniform
+        // color (usually white), then we want to display it normally, that
+        // is, lit. But if the cloud/mesh has differing vertex colors, then
+        // we assume that the vertex colors have the lighting value baked in
+        // (for example, fountain.ply at http://qianyi.info/scenedata.html)
+        switch (g->GetGeometryType()) {
+            case geometry::Geometry::GeometryType::PointCloud: {
+                auto pcd =
+                        std::static_pointer_cast<const geometry::PointCloud>(
+                                g);
+
+                if (pcd->HasColors() && !prep.uniform_color) {
+                    selected_material = materials.unlit.handle;
+                    load.num_unlit += 1;
+                } else {
+                    selected_material = materials.lit.handle;
+                }
+            } break;
+            case geometry::Geometry::GeometryType::LineSet: {
+                selected_material = materials.unlit.handle;
+                load.num_unlit += 1;
+            } break;
+            case geometry::Geometry::GeometryType::TriangleMesh: {
+                auto mesh =
+                        std::static_pointer_cast<const geometry::TriangleMesh>(
+                                g);
+
+                bool albedo_only = true;
+                if (mesh->HasMaterials()) {
+                    auto mesh_material = mesh->materials_.begin()->second;
+                    LitMaterial material;
+                    TextureMaps maps;
+                    material.base_color.x() = mesh_material.baseColor.r();
+                    material.base_color.y() = mesh_material.baseColor.g();
+                    material.base_color.z() = mesh_material.baseColor.b();
+                    material.roughness = mesh_material.baseRoughness;
+                    material.reflectance = mesh_material.baseReflectance;
+                    material.clear_coat = mesh_material.baseClearCoat;
+                    material.clear_coat_roughness =
+                            mesh_material.baseClearCoatRoughness;
+                    material.anisotropy = mesh_material.baseAnisotropy;
+
+                    auto is_map_valid =
+                            [](std::shared_ptr<geometry::Image> map) -> bool {
+                        return map && map->HasData();
+                    };
+
+                    if (is_map_valid(mesh_material.albedo)) {
+                        maps.albedo_map =
+                                renderer.AddTexture(mesh_material.albedo);
+                    }
+                    if (is_map_valid(mesh_material.normalMap)) {
+                        maps.normal_map =
+                                renderer.AddTexture(mesh_material.normalMap);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.ambientOcclusion)) {
+                        maps.ambient_occlusion_map = renderer.AddTexture(
+                                mesh_material.ambientOcclusion);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.roughness)) {
+                        maps.roughness_map =
+                                renderer.AddTexture(mesh_material.roughness);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.metallic)) {
+                        material.metallic = 1.f;
+                        maps.metallic_map =
+                                renderer.AddTexture(mesh_material.metallic);
+                        albedo_only = false;
+                    } else {
+                        material.metallic = 0.f;
+                    }
+                    if (is_map_valid(mesh_material.reflectance)) {
+                        maps.reflectance_map = renderer.AddTexture(
+                                mesh_material.reflectance);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.clearCoat)) {
+                        maps.clear_coat_map =
+                                renderer.AddTexture(mesh_material.clearCoat);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.clearCoatRoughness)) {
+                        maps.clear_coat_roughness_map = renderer.AddTexture(
+                                mesh_material.clearCoatRoughness);
+                        albedo_only = false;
+                    }
+                    if (is_map_valid(mesh_material.anisotropy)) {
+                        maps.anisotropy_map =
+                                renderer.AddTexture(mesh_material.anisotropy);
+                        albedo_only = false;
+                    }
+                    SetMaterialsToCurrentSettings(renderer, material, maps);
+                    settings_.loaded_materials_[prep.index] = material;
+                }
+
+                if ((mesh->HasVertexColors() && !prep.uniform_color) ||
+                    (mesh->HasMaterials() && albedo_only)) {
+                    selected_material = materials.unlit.handle;
+                    load.num_unlit += 1;
+                } else {
+                    selected_material = materials.lit.handle;
+                }
+            } break;
+            default:
+                utility::LogWarning("Geometry type {} not supported!",
+                                    (int)g->GetGeometryType());
+                break;
+        }
+
+        auto g3 = std::static_pointer_cast<const geometry::Geometry3D>(g);
+        auto handle = scene3d->AddGeometry(*g3, selected_material);
+        load.bounds += scene3d->GetEntityBoundingBox(handle);
+        geometry_handles_.push_back(handle);
+
+        if (g->GetGeometryType() ==
+            geometry::Geometry::GeometryType::PointCloud) {
+            load.desc.point_clouds.push_back(handle);
+            if (prep.decimated) {
+                handle = scene3d->AddGeometry(*prep.decimated,
+                                              selected_material);
+                load.desc.fast_point_clouds.push_back(handle);
+                geometry_handles_.push_back(handle);
+            }
+        } else {
+            load.desc.meshes.push_back(handle);
+        }
+    }
+
+    // Finishes a SetGeometry() call once every geometry has been added:
+    // picks the material type, adds the axes and swaps the new model
+    // description and camera in. Must run on the UI thread.
+    void FinishGeometryLoad(rendering::Renderer &renderer,
+                            GeometryLoad &load) {
+        auto *scene3d = scene_->GetScene();
+
+        if (!load.prepared.empty()) {
+            auto view_mode = scene_->GetView()->GetMode();
+            if (view_mode == rendering::View::Mode::Normals) {
+                SetMaterialType(Settings::NORMAL_MAP);
+            } else if (view_mode == rendering::View::Mode::Depth) {
+                SetMaterialType(Settings::DEPTH);
+            } else {
+                if (load.num_unlit == load.prepared.size()) {
+                    SetMaterialType(Settings::UNLIT);
+                } else {
+                    SetMaterialType(Settings::LIT);
+                }
+            }
+
+            if (load.num_point_clouds == load.prepared.size() &&
+                !settings_.user_has_changed_lighting) {
+                SetLightingProfile(renderer, POINT_CLOUD_PROFILE_NAME);
+            }
+            settings_.wgt_point_size->SetEnabled(load.num_point_clouds > 0);
+        }
+
+        if (!settings_.loaded_materials_.empty()) {
+            if (settings_.loaded_materials_.size() == 1) {
+                auto color =
+                        settings_.loaded_materials_.begin()->second.base_color;
+                settings_.wgt_material_color->SetValue(color.x(), color.y(),
+                                                       color.z());
+            }
+            int resetIdx = settings_.wgt_prefab_material->AddItem(
+                    MATERIAL_FROM_FILE_NAME.c_str());
+            settings_.wgt_prefab_material->SetSelectedIndex(resetIdx);
+            settings_.wgt_prefab_material->ChangeItem(
+                    (DEFAULT_MATERIAL_NAME + " [default]").c_str(),
+                    DEFAULT_MATERIAL_NAME.c_str());
+        } else {
+            settings_.wgt_prefab_material->ChangeItem(
+                    DEFAULT_MATERIAL_NAME.c_str(),
+                    (DEFAULT_MATERIAL_NAME + " [default]").c_str());
+        }
+
+        // Add axes. Axes length should be the longer of the bounds extent
+        // or 25% of the distance from the origin. The latter is necessary
+        // so that the axis is big enough to be visible even if the object
+        // is far from the origin. See caterpillar.ply from Tanks & Temples.
+        auto axis_length = load.bounds.GetMaxExtent();
+        if (axis_length < 0.001) {  // avoid div by zero errors in
+                                    // CreateAxes()
+            axis_length = 1.0;
+        }
+        axis_length = std::max(axis_length,
+                               0.25 * load.bounds.GetCenter().norm());
+        auto axes = CreateAxes(axis_length);
+        settings_.axes = scene3d->AddGeometry(*axes);
+        scene3d->SetGeometryShadows(settings_.axes, false, false);
+        scene3d->SetEntityEnabled(settings_.axes,
+                                  settings_.wgt_show_axes->IsChecked());
+        load.desc.axes = settings_.axes;
+        scene_->SetModel(load.desc);
+
+        scene_->SetupCamera(60.0, load.bounds,
+                            load.bounds.GetCenter().cast<float>());
+    }
+
     void SetMaterialsToDefault(rendering::Renderer &renderer) {
         settings_.loaded_materials_.clear();
         if (settings_.wgt_prefab_material) {
@@ -1573,10 +1862,6 @@ void GuiVisualizer::AddItemsToAppMenu(
 void GuiVisualizer::SetGeometry(
         const std::vector<std::shared_ptr<const geometry::Geometry>>
                 &geometries) {
-    const std::size_t MIN_POINT_CLOUD_POINTS_FOR_DECIMATION = 6000000;
-
-    gui::SceneWidget::ModelDescription desc;
-
     auto *scene3d = impl_->scene_->GetScene();
     if (impl_->settings_.axes) {
         scene3d->RemoveGeometry(impl_->settings_.axes);
@@ -1588,220 +1873,72 @@ void GuiVisualizer::SetGeometry(
 
     impl_->SetMaterialsToDefault(GetRenderer());
 
-    std::size_t num_point_clouds = 0;
-    std::size_t num_point_cloud_points = 0;
+    auto load = std::make_shared<Impl::GeometryLoad>();
+    load->geometries = geometries;
+    load->generation = ++impl_->load_generation_;
+    impl_->pending_load_ = load;
+
+    // Preparing and uploading everything in one go freezes the window for
+    // seconds on large inputs. Above this vertex count the CPU-only
+    // preparation runs on a worker thread and the geometries enter the
+    // scene one per run loop tick, so the UI keeps drawing frames during
+    // the load. Small inputs keep the synchronous path and the model is
+    // complete when this function returns.
+    const std::size_t ASYNC_LOAD_VERTEX_COUNT = 2000000;
+    std::size_t total_vertices = 0;
     for (auto &g : geometries) {
         if (g->GetGeometryType() ==
             geometry::Geometry::GeometryType::PointCloud) {
-            num_point_clouds++;
-            auto cloud =
-                    std::static_pointer_cast<const geometry::PointCloud>(g);
-            num_point_cloud_points += cloud->points_.size();
+            total_vertices +=
+                    std::static_pointer_cast<const geometry::PointCloud>(g)
+                            ->points_.size();
+        } else if (g->GetGeometryType() ==
+                   geometry::Geometry::GeometryType::TriangleMesh) {
+            total_vertices +=
+                    std::static_pointer_cast<const geometry::TriangleMesh>(g)
+                            ->vertices_.size();
         }
     }
 
-    geometry::AxisAlignedBoundingBox bounds;
-    std::size_t num_unlit = 0;
-    for (size_t i = 0; i < geometries.size(); ++i) {
-        std::shared_ptr<const geometry::Geometry> g = geometries[i];
-        Impl::Materials materials = impl_->settings_.current_materials;
-
-        rendering::MaterialInstanceHandle selected_material;
-
-        // If a point cloud or mesh has no vertex colors or a single uniform
-        // color (usually white), then we want to display it normally, that is,
-        // lit. But if the cloud/mesh has differing vertex colors, then we
-        // assume that the vertex colors have the lighting value baked in
-        // (for example, fountain.ply at http://qianyi.info/scenedata.html)
-        switch (g->GetGeometryType()) {
-            case geometry::Geometry::GeometryType::PointCloud: {
-                auto pcd =
-                        std::static_pointer_cast<const geometry::PointCloud>(g);
-
-                if (pcd->HasColors() && !PointCloudHasUniformColor(*pcd)) {
-                    selected_material = materials.unlit.handle;
-                    num_unlit += 1;
-                } else {
-                    selected_material = materials.lit.handle;
-                }
-            } break;
-            case geometry::Geometry::GeometryType::LineSet: {
-                selected_material = materials.unlit.handle;
-                num_unlit += 1;
-            } break;
-            case geometry::Geometry::GeometryType::TriangleMesh: {
-                auto mesh =
-                        std::static_pointer_cast<const geometry::TriangleMesh>(
-                                g);
-
-                bool albedo_only = true;
-                if (mesh->HasMaterials()) {
-                    auto mesh_material = mesh->materials_.begin()->second;
-                    Impl::LitMaterial material;
-                    Impl::TextureMaps maps;
-                    material.base_color.x() = mesh_material.baseColor.r();
-                    material.base_color.y() = mesh_material.baseColor.g();
-                    material.base_color.z() = mesh_material.baseColor.b();
-                    material.roughness = mesh_material.baseRoughness;
-                    material.reflectance = mesh_material.baseReflectance;
-                    material.clear_coat = mesh_material.baseClearCoat;
-                    material.clear_coat_roughness =
-                            mesh_material.baseClearCoatRoughness;
-                    material.anisotropy = mesh_material.baseAnisotropy;
-
-                    auto is_map_valid =
-                            [](std::shared_ptr<geometry::Image> map) -> bool {
-                        return map && map->HasData();
-                    };
-
-                    if (is_map_valid(mesh_material.albedo)) {
-                        maps.albedo_map =
-                                GetRenderer().AddTexture(mesh_material.albedo);
-                    }
-                    if (is_map_valid(mesh_material.normalMap)) {
-                        maps.normal_map = GetRenderer().AddTexture(
-                                mesh_material.normalMap);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.ambientOcclusion)) {
-                        maps.ambient_occlusion_map = GetRenderer().AddTexture(
-                                mesh_material.ambientOcclusion);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.roughness)) {
-                        maps.roughness_map = GetRenderer().AddTexture(
-                                mesh_material.roughness);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.metallic)) {
-                        material.metallic = 1.f;
-                        maps.metallic_map = GetRenderer().AddTexture(
-                                mesh_material.metallic);
-                        albedo_only = false;
-                    } else {
-                        material.metallic = 0.f;
-                    }
-                    if (is_map_valid(mesh_material.reflectance)) {
-                        maps.reflectance_map = GetRenderer().AddTexture(
-                                mesh_material.reflectance);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.clearCoat)) {
-                        maps.clear_coat_map = GetRenderer().AddTexture(
-                                mesh_material.clearCoat);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.clearCoatRoughness)) {
-                        maps.clear_coat_roughness_map =
-                                GetRenderer().AddTexture(
-                                        mesh_material.clearCoatRoughness);
-                        albedo_only = false;
-                    }
-                    if (is_map_valid(mesh_material.anisotropy)) {
-                        maps.anisotropy_map = GetRenderer().AddTexture(
-                                mesh_material.anisotropy);
-                        albedo_only = false;
-                    }
-                    impl_->SetMaterialsToCurrentSettings(GetRenderer(),
-                                                         material, maps);
-                    impl_->settings_.loaded_materials_[i] = material;
-                }
-
-                if ((mesh->HasVertexColors() && !MeshHasUniformColor(*mesh)) ||
-                    (mesh->HasMaterials() && albedo_only)) {
-                    selected_material = materials.unlit.handle;
-                    num_unlit += 1;
-                } else {
-                    selected_material = materials.lit.handle;
-                }
-            } break;
-            default:
-                utility::LogWarning("Geometry type {} not supported!",
-                                    (int)g->GetGeometryType());
-                break;
-        }
-
-        auto g3 = std::static_pointer_cast<const geometry::Geometry3D>(g);
-        auto handle = scene3d->AddGeometry(*g3, selected_material);
-        bounds += scene3d->GetEntityBoundingBox(handle);
-        impl_->geometry_handles_.push_back(handle);
-
-        if (g->GetGeometryType() ==
-            geometry::Geometry::GeometryType::PointCloud) {
-            desc.point_clouds.push_back(handle);
-            auto pcd = std::static_pointer_cast<const geometry::PointCloud>(g);
-            if (num_point_cloud_points >
-                MIN_POINT_CLOUD_POINTS_FOR_DECIMATION) {
-                int sample_rate = num_point_cloud_points /
-                                  (MIN_POINT_CLOUD_POINTS_FOR_DECIMATION / 2);
-                auto small = pcd->UniformDownSample(sample_rate);
-                handle = scene3d->AddGeometry(*small, selected_material);
-                desc.fast_point_clouds.push_back(handle);
-                impl_->geometry_handles_.push_back(handle);
-            }
-        } else {
-            desc.meshes.push_back(handle);
+    if (total_vertices < ASYNC_LOAD_VERTEX_COUNT) {
+        Impl::PrepareGeometries(*load);
+        for (auto &prep : load->prepared) {
+            impl_->AddPreparedGeometry(GetRenderer(), *load, prep);
         }
+        impl_->FinishGeometryLoad(GetRenderer(), *load);
+        impl_->pending_load_.reset();
+        return;
     }
 
-    if (!geometries.empty()) {
-        auto view_mode = impl_->scene_->GetView()->GetMode();
-        if (view_mode == rendering::View::Mode::Normals) {
-            impl_->SetMaterialType(Impl::Settings::NORMAL_MAP);
-        } else if (view_mode == rendering::View::Mode::Depth) {
-            impl_->SetMaterialType(Impl::Settings::DEPTH);
-        } else {
-            if (num_unlit == geometries.size()) {
-                impl_->SetMaterialType(Impl::Settings::UNLIT);
-            } else {
-                impl_->SetMaterialType(Impl::Settings::LIT);
-            }
-        }
+    gui::Application::GetInstance().RunInThread([this, load]() {
+        Impl::PrepareGeometries(*load);
+        gui::Application::GetInstance().PostToMainThread(
+                this, [this]() { AddNextPreparedGeometry(); });
+    });
+}
 
-        if (num_point_clouds == geometries.size() &&
-            !impl_->settings_.user_has_changed_lighting) {
-            impl_->SetLightingProfile(GetRenderer(), POINT_CLOUD_PROFILE_NAME);
-        }
-        impl_->settings_.wgt_point_size->SetEnabled(num_point_clouds > 0);
+void GuiVisualizer::AddNextPreparedGeometry() {
+    auto load = impl_->pending_load_;
+    if (!load || load->generation != impl_->load_generation_) {
+        return;  // superseded by a newer SetGeometry() call
     }
 
-    if (!impl_->settings_.loaded_materials_.empty()) {
-        if (impl_->settings_.loaded_materials_.size() == 1) {
-            auto color = impl_->settings_.loaded_materials_.begin()
-                                 ->second.base_color;
-            impl_->settings_.wgt_material_color->SetValue(color.x(), color.y(),
-                                                          color.z());
-        }
-        int resetIdx = impl_->settings_.wgt_prefab_material->AddItem(
-                MATERIAL_FROM_FILE_NAME.c_str());
-        impl_->settings_.wgt_prefab_material->SetSelectedIndex(resetIdx);
-        impl_->settings_.wgt_prefab_material->ChangeItem(
-                (DEFAULT_MATERIAL_NAME + " [default]").c_str(),
-                DEFAULT_MATERIAL_NAME.c_str());
-    } else {
-        impl_->settings_.wgt_prefab_material->ChangeItem(
-                DEFAULT_MATERIAL_NAME.c_str(),
-                (DEFAULT_MATERIAL_NAME + " [default]").c_str());
+    if (load->next < load->prepared.size()) {
+        impl_->AddPreparedGeometry(GetRenderer(), *load,
+                                   load->prepared[load->next]);
+        load->next += 1;
     }
 
-    // Add axes. Axes length should be the longer of the bounds extent
-    // or 25% of the distance from the origin. The latter is necessary
-    // so that the axis is big enough to be visible even if the object
-    // is far from the origin. See caterpillar.ply from Tanks & Temples.
-    auto axis_length = bounds.GetMaxExtent();
-    if (axis_length < 0.001) {  // avoid div by zero errors in CreateAxes()
-        axis_length = 1.0;
+    if (load->next < load->prepared.size()) {
+        // One geometry per posted function; the run loop draws a frame
+        // between ticks, which keeps the window responsive while the
+        // remaining geometries upload
+        gui::Application::GetInstance().PostToMainThread(
+                this, [this]() { AddNextPreparedGeometry(); });
+    } else {
+        impl_->FinishGeometryLoad(GetRenderer(), *load);
+        impl_->pending_load_.reset();
     }
-    axis_length = std::max(axis_length, 0.25 * bounds.GetCenter().norm());
-    auto axes = CreateAxes(axis_length);
-    impl_->settings_.axes = scene3d->AddGeometry(*axes);
-    scene3d->SetGeometryShadows(impl_->settings_.axes, false, false);
-    scene3d->SetEntityEnabled(impl_->settings_.axes,
-                              impl_->settings_.wgt_show_axes->IsChecked());
-    desc.axes = impl_->settings_.axes;
-    impl_->scene_->SetModel(desc);
-
-    impl_->scene_->SetupCamera(60.0, bounds, bounds.GetCenter().cast<float>());
 }
 
 void GuiVisualizer::Layout(const gui::Theme &theme) {
@@ -85,6 +85,9 @@ private:
     std::unique_ptr<Impl> impl_;
 
     void Init();
+    /// Adds one geometry of a pending asynchronous SetGeometry() call and
+    /// re-posts itself until the load is complete. Runs on the UI thread.
+    void AddNextPreparedGeometry();
 };
 
 }  // namespace visualization
@@ -27,6 +27,7 @@
 #include "open3d/visualization/visualizer/Visualizer.h"
 
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Initialization.h"
 
 namespace open3d {
 
@@ -52,8 +53,14 @@ public:
     }
 
     static int InitGLFW() {
-        GLFWEnvironmentSingleton::GetInstance();
-        return glfwInit();
+        // glfwInit after the first call is a cheap no-op; only the
+        // first one is worth reporting to the initialization audit
+        static int result = []() {
+            utility::ScopedInitializationTimer timer("visualization::GLFW");
+            GLFWEnvironmentSingleton::GetInstance();
+            return glfwInit();
+        }();
+        return result;
     }
 
     static void GLFWErrorCallback(int error, const char *description) {
@@ -204,6 +211,9 @@ bool Visualizer::CreateVisualizerWindow(
 }
 
 void Visualizer::DestroyVisualizerWindow() {
+    // Flush in-flight captures and release the capture buffers while the
+    // context still exists.
+    SetAsyncScreenCapture(false);
     is_initialized_ = false;
     glDeleteVertexArrays(1, &vao_id_);
     glfwDestroyWindow(window_);
@@ -303,6 +313,25 @@ bool Visualizer::AddGeometry(
         return false;
     }
     glfwMakeContextCurrent(window_);
+    auto cached_itr = cached_geometry_renderer_ptrs_.find(geometry_ptr);
+    if (cached_itr != cached_geometry_renderer_ptrs_.end()) {
+        // The geometry was shown before and its renderer survived in the
+        // cache; rebind the existing shader buffers instead of rebuilding
+        // them.
+        geometry_renderer_ptrs_.insert(cached_itr->second);
+        geometry_ptrs_.insert(geometry_ptr);
+        cached_geometry_renderer_ptrs_.erase(cached_itr);
+        if (reset_bounding_box) {
+            view_control_ptr_->FitInGeometry(*geometry_ptr);
+            ResetViewPoint();
+        }
+        utility::LogDebug(
+                "Add geometry from renderer cache and update bounding box to "
+                "{}",
+                view_control_ptr_->GetBoundingBox().GetPrintInfo().c_str());
+        UpdateRender();
+        return true;
+    }
     std::shared_ptr<glsl::GeometryRenderer> renderer_ptr;
     if (geometry_ptr->GetGeometryType() ==
         geometry::Geometry::GeometryType::Unspecified) {
@@ -397,6 +426,10 @@ bool Visualizer::RemoveGeometry(
             geometry_renderer_delete = geometry_renderer_ptr;
     }
     if (geometry_renderer_delete == NULL) return false;
+    if (geometry_renderer_cache_enabled_) {
+        cached_geometry_renderer_ptrs_[geometry_ptr] =
+                geometry_renderer_delete;
+    }
     geometry_renderer_ptrs_.erase(geometry_renderer_delete);
     geometry_ptrs_.erase(geometry_ptr);
     if (reset_bounding_box) {
@@ -413,11 +446,29 @@ bool Visualizer::ClearGeometries() {
         return false;
     }
     glfwMakeContextCurrent(window_);
+    if (geometry_renderer_cache_enabled_) {
+        for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+            cached_geometry_renderer_ptrs_[renderer_ptr->GetGeometry()] =
+                    renderer_ptr;
+        }
+    }
     geometry_renderer_ptrs_.clear();
     geometry_ptrs_.clear();
     return UpdateGeometry();
 }
 
+void Visualizer::SetGeometryRendererCacheEnabled(bool enabled) {
+    geometry_renderer_cache_enabled_ = enabled;
+    if (!enabled && !cached_geometry_renderer_ptrs_.empty()) {
+        // Releasing the cached renderers frees their GL buffers, which
+        // needs the context of this window.
+        if (is_initialized_) {
+            glfwMakeContextCurrent(window_);
+        }
+        cached_geometry_renderer_ptrs_.clear();
+    }
+}
+
 bool Visualizer::UpdateGeometry(
         std::shared_ptr<const geometry::Geometry> geometry_ptr) {
     glfwMakeContextCurrent(window_);
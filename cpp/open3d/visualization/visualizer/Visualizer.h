@@ -34,10 +34,15 @@
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include "open3d/geometry/Geometry.h"
 #include "open3d/visualization/shader/GeometryRenderer.h"
@@ -166,12 +171,27 @@ public:
     /// all geometry objects.
     virtual bool ClearGeometries();
 
+    /// \brief Function to enable or disable the geometry renderer cache.
+    ///
+    /// With the cache enabled, RemoveGeometry() and ClearGeometries() keep
+    /// the renderers of the removed geometries (and their shader buffers)
+    /// alive, and AddGeometry() of a geometry object that is in the cache
+    /// rebinds the existing buffers instead of rebuilding them, which makes
+    /// flipping between precomputed geometries cheap. The cache is keyed by
+    /// geometry identity and assumes cached geometry is unchanged; call
+    /// UpdateGeometry() after re-adding a geometry that was modified while
+    /// it was cached. Disabling the cache releases all cached renderers.
+    virtual void SetGeometryRendererCacheEnabled(bool enabled);
+
     /// \brief Function to update geometry.
     ///
     /// This function must be called when geometry has been changed. Otherwise
     /// the behavior of Visualizer is undefined.
     /// If called without an argument, updates all geometries, otherwise only
     /// updates the geometry specified.
+    /// For point clouds the vertex buffers are refreshed in place, so
+    /// streaming updated points at high frequency does not reallocate GPU
+    /// buffers as long as the point count does not grow.
     virtual bool UpdateGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr = nullptr);
     virtual bool HasGeometry() const;
@@ -187,6 +207,15 @@ public:
     ViewControl &GetViewControl() { return *view_control_ptr_; }
     /// Function to retrieve the associated RenderOption.
     RenderOption &GetRenderOption() { return *render_option_ptr_; }
+    /// \brief Function to select the CPU rasterizer for buffer captures.
+    ///
+    /// When enabled, CaptureScreenFloatBuffer() and CaptureDepthFloatBuffer()
+    /// rasterize the scene on the CPU instead of reading back the OpenGL
+    /// frame buffer, so depth maps for visibility tests can be computed on
+    /// machines without a GPU.
+    void SetCaptureWithSoftwareRasterizer(bool enable) {
+        capture_with_software_rasterizer_ = enable;
+    }
     /// \brief Function to capture screen and store RGB in a float buffer.
     ///
     /// \param do_render Set to `true` to do render.
@@ -198,6 +227,19 @@ public:
     /// \param do_render Set to `true` to do render.
     void CaptureScreenImage(const std::string &filename = "",
                             bool do_render = true);
+    /// \brief Function to toggle asynchronous screen capture.
+    ///
+    /// When enabled, CaptureScreenImage() reads the frame through a ring of
+    /// pixel buffer objects, so glReadPixels returns without stalling the
+    /// pipeline, and PNG encoding runs on background worker threads. Each
+    /// call saves the frame read back by the previous call, i.e. capture
+    /// output trails rendering by one frame. Disabling the mode (or
+    /// destroying the window) flushes the in-flight frame and waits for
+    /// all pending encodes.
+    void SetAsyncScreenCapture(bool enabled);
+    /// Saves the in-flight frame of the asynchronous capture mode and
+    /// blocks until every queued frame has been encoded and written.
+    void FlushAsyncScreenCapture();
     /// Function to capture depth in a float buffer.
     ///
     /// \param do_render Set to `true` to do render.
@@ -282,6 +324,26 @@ protected:
 
     // rendering properties
     std::unique_ptr<RenderOption> render_option_ptr_;
+    bool capture_with_software_rasterizer_ = false;
+
+    // asynchronous screen capture (see SetAsyncScreenCapture)
+    bool async_screen_capture_enabled_ = false;
+    GLuint capture_pbos_[2] = {0, 0};
+    int capture_pbo_width_ = 0;
+    int capture_pbo_height_ = 0;
+    // Index of the PBO with an in-flight readback, or -1.
+    int capture_pbo_pending_ = -1;
+    std::string capture_pbo_pending_filename_;
+    std::deque<std::pair<std::string, std::shared_ptr<geometry::Image>>>
+            capture_encode_queue_;
+    std::vector<std::thread> capture_encode_workers_;
+    std::mutex capture_encode_mutex_;
+    std::condition_variable capture_encode_condition_;
+    int capture_encode_active_ = 0;
+    bool capture_encode_shutdown_ = false;
+
+    // Maps the in-flight PBO and hands its frame to the encode workers.
+    void ReadbackPendingScreenCapture();
 
     // geometry to be rendered
     std::unordered_set<std::shared_ptr<const geometry::Geometry>>
@@ -291,6 +353,13 @@ protected:
     std::unordered_set<std::shared_ptr<glsl::GeometryRenderer>>
             geometry_renderer_ptrs_;
 
+    // renderers of removed geometries, kept alive for rebinding when the
+    // renderer cache is enabled (see SetGeometryRendererCacheEnabled)
+    bool geometry_renderer_cache_enabled_ = false;
+    std::unordered_map<std::shared_ptr<const geometry::Geometry>,
+                       std::shared_ptr<glsl::GeometryRenderer>>
+            cached_geometry_renderer_ptrs_;
+
     // utilities owned by the Visualizer
     std::vector<std::shared_ptr<const geometry::Geometry>> utility_ptrs_;
 
@@ -30,6 +30,7 @@
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/visualization/utility/GLHelper.h"
+#include "open3d/visualization/utility/SoftwareRasterizer.h"
 #include "open3d/visualization/visualizer/ViewParameters.h"
 #include "open3d/visualization/visualizer/ViewTrajectory.h"
 #include "open3d/visualization/visualizer/Visualizer.h"
@@ -147,14 +148,20 @@ std::shared_ptr<geometry::Image> Visualizer::CaptureScreenFloatBuffer(
     geometry::Image screen_image;
     screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
                          view_control_ptr_->GetWindowHeight(), 3, 4);
-    if (do_render) {
-        Render();
-        is_redraw_required_ = false;
+    if (capture_with_software_rasterizer_) {
+        view_control_ptr_->SetViewMatrices();
+        RasterizeFrame(geometry_ptrs_, *view_control_ptr_, *render_option_ptr_,
+                       nullptr, (float *)screen_image.data_.data());
+    } else {
+        if (do_render) {
+            Render();
+            is_redraw_required_ = false;
+        }
+        glFinish();
+        glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
+                     view_control_ptr_->GetWindowHeight(), GL_RGB, GL_FLOAT,
+                     screen_image.data_.data());
     }
-    glFinish();
-    glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
-                 view_control_ptr_->GetWindowHeight(), GL_RGB, GL_FLOAT,
-                 screen_image.data_.data());
 
     // glReadPixels get the screen in a vertically flipped manner
     // Thus we should flip it back.
@@ -171,6 +178,127 @@ std::shared_ptr<geometry::Image> Visualizer::CaptureScreenFloatBuffer(
     return image_ptr;
 }
 
+void Visualizer::SetAsyncScreenCapture(bool enabled) {
+    if (enabled == async_screen_capture_enabled_) {
+        return;
+    }
+    if (enabled) {
+        capture_encode_shutdown_ = false;
+        const unsigned int num_workers = std::min(
+                4u, std::max(1u, std::thread::hardware_concurrency() / 2));
+        for (unsigned int k = 0; k < num_workers; k++) {
+            capture_encode_workers_.emplace_back([this]() {
+                while (true) {
+                    std::pair<std::string, std::shared_ptr<geometry::Image>>
+                            job;
+                    {
+                        std::unique_lock<std::mutex> lock(
+                                capture_encode_mutex_);
+                        capture_encode_condition_.wait(lock, [this]() {
+                            return !capture_encode_queue_.empty() ||
+                                   capture_encode_shutdown_;
+                        });
+                        if (capture_encode_queue_.empty()) {
+                            break;
+                        }
+                        job = std::move(capture_encode_queue_.front());
+                        capture_encode_queue_.pop_front();
+                        capture_encode_active_++;
+                    }
+                    capture_encode_condition_.notify_all();
+                    // glReadPixels returns the screen vertically flipped;
+                    // flip it back before encoding.
+                    const geometry::Image &screen_image = *job.second;
+                    geometry::Image png_image;
+                    png_image.Prepare(screen_image.width_,
+                                      screen_image.height_, 3, 1);
+                    int bytes_per_line = screen_image.BytesPerLine();
+                    for (int i = 0; i < screen_image.height_; i++) {
+                        memcpy(png_image.data_.data() + bytes_per_line * i,
+                               screen_image.data_.data() +
+                                       bytes_per_line *
+                                               (screen_image.height_ - i - 1),
+                               bytes_per_line);
+                    }
+                    io::WriteImage(job.first, png_image);
+                    {
+                        std::lock_guard<std::mutex> lock(
+                                capture_encode_mutex_);
+                        capture_encode_active_--;
+                    }
+                    capture_encode_condition_.notify_all();
+                }
+            });
+        }
+        async_screen_capture_enabled_ = true;
+    } else {
+        FlushAsyncScreenCapture();
+        {
+            std::lock_guard<std::mutex> lock(capture_encode_mutex_);
+            capture_encode_shutdown_ = true;
+        }
+        capture_encode_condition_.notify_all();
+        for (auto &worker : capture_encode_workers_) {
+            worker.join();
+        }
+        capture_encode_workers_.clear();
+        if (capture_pbos_[0] != 0) {
+            glfwMakeContextCurrent(window_);
+            glDeleteBuffers(2, capture_pbos_);
+            capture_pbos_[0] = capture_pbos_[1] = 0;
+            capture_pbo_width_ = capture_pbo_height_ = 0;
+        }
+        async_screen_capture_enabled_ = false;
+    }
+}
+
+void Visualizer::FlushAsyncScreenCapture() {
+    if (!async_screen_capture_enabled_) {
+        return;
+    }
+    if (capture_pbo_pending_ >= 0) {
+        glfwMakeContextCurrent(window_);
+        ReadbackPendingScreenCapture();
+    }
+    std::unique_lock<std::mutex> lock(capture_encode_mutex_);
+    capture_encode_condition_.wait(lock, [this]() {
+        return capture_encode_queue_.empty() && capture_encode_active_ == 0;
+    });
+}
+
+void Visualizer::ReadbackPendingScreenCapture() {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, capture_pbos_[capture_pbo_pending_]);
+    auto screen_image = std::make_shared<geometry::Image>();
+    screen_image->Prepare(capture_pbo_width_, capture_pbo_height_, 3, 1);
+    // Mapping waits for the readback issued in the previous capture call;
+    // by then the DMA has typically finished, so this does not stall.
+    const void *mapped = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    if (mapped != nullptr) {
+        memcpy(screen_image->data_.data(), mapped,
+               screen_image->data_.size());
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        {
+            std::unique_lock<std::mutex> lock(capture_encode_mutex_);
+            // Bound the queue so capture cannot outrun the encoders by
+            // more than a few frames of memory.
+            capture_encode_condition_.wait(lock, [this]() {
+                return capture_encode_queue_.size() <
+                       2 * capture_encode_workers_.size();
+            });
+            capture_encode_queue_.emplace_back(
+                    capture_pbo_pending_filename_, std::move(screen_image));
+        }
+        capture_encode_condition_.notify_all();
+    } else {
+        utility::LogWarning(
+                "[Visualizer] Failed to map capture buffer; frame {} "
+                "dropped.",
+                capture_pbo_pending_filename_.c_str());
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    capture_pbo_pending_ = -1;
+}
+
 void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
                                     bool do_render /* = true*/) {
     std::string png_filename = filename;
@@ -180,6 +308,53 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
         png_filename = "ScreenCapture_" + timestamp + ".png";
         camera_filename = "ScreenCamera_" + timestamp + ".json";
     }
+    if (async_screen_capture_enabled_) {
+        if (do_render) {
+            Render();
+            is_redraw_required_ = false;
+        }
+        const int width = view_control_ptr_->GetWindowWidth();
+        const int height = view_control_ptr_->GetWindowHeight();
+        if (capture_pbos_[0] == 0 || width != capture_pbo_width_ ||
+            height != capture_pbo_height_) {
+            // Save the in-flight frame at its old size before resizing
+            // the ring.
+            if (capture_pbo_pending_ >= 0) {
+                ReadbackPendingScreenCapture();
+            }
+            if (capture_pbos_[0] == 0) {
+                glGenBuffers(2, capture_pbos_);
+            }
+            for (int k = 0; k < 2; k++) {
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, capture_pbos_[k]);
+                glBufferData(GL_PIXEL_PACK_BUFFER, width * height * 3,
+                             nullptr, GL_STREAM_READ);
+            }
+            capture_pbo_width_ = width;
+            capture_pbo_height_ = height;
+        }
+        // Kick off the asynchronous readback of this frame, then hand the
+        // frame read back by the previous call to the encode workers.
+        const int write_index = capture_pbo_pending_ == 0 ? 1 : 0;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, capture_pbos_[write_index]);
+        glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+        if (capture_pbo_pending_ >= 0) {
+            ReadbackPendingScreenCapture();
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        capture_pbo_pending_ = write_index;
+        capture_pbo_pending_filename_ = png_filename;
+        utility::LogDebug("[Visualizer] Async screen capture to {}",
+                          png_filename.c_str());
+        if (!camera_filename.empty()) {
+            utility::LogDebug("[Visualizer] Screen camera capture to {}",
+                              camera_filename.c_str());
+            camera::PinholeCameraParameters parameter;
+            view_control_ptr_->ConvertToPinholeCameraParameters(parameter);
+            io::WriteIJsonConvertible(camera_filename, parameter);
+        }
+        return;
+    }
     geometry::Image screen_image;
     screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
                          view_control_ptr_->GetWindowHeight(), 3, 1);
@@ -222,11 +397,18 @@ std::shared_ptr<geometry::Image> Visualizer::CaptureDepthFloatBuffer(
     geometry::Image depth_image;
     depth_image.Prepare(view_control_ptr_->GetWindowWidth(),
                         view_control_ptr_->GetWindowHeight(), 1, 4);
-    if (do_render) {
-        Render();
-        is_redraw_required_ = false;
-    }
-    glFinish();
+    if (capture_with_software_rasterizer_) {
+        view_control_ptr_->SetViewMatrices();
+        // The flip and depth conversion below are shared with the OpenGL
+        // path, so the rasterizer fills the buffer in glReadPixels() layout
+        RasterizeFrame(geometry_ptrs_, *view_control_ptr_, *render_option_ptr_,
+                       (float *)depth_image.data_.data(), nullptr);
+    } else {
+        if (do_render) {
+            Render();
+            is_redraw_required_ = false;
+        }
+        glFinish();
 
 #if __APPLE__
     // On OSX with Retina display and glfw3, there is a bug with glReadPixels().
@@ -238,20 +420,21 @@ std::shared_ptr<geometry::Image> Visualizer::CaptureDepthFloatBuffer(
     // The reason of this bug is unknown. The current workaround is to read
     // depth buffer column by column. This is 15~30 times slower than one block
     // reading glReadPixels().
-    std::vector<float> float_buffer(depth_image.height_);
-    float *p = (float *)depth_image.data_.data();
-    for (int j = 0; j < depth_image.width_; j++) {
-        glReadPixels(j, 0, 1, depth_image.height_, GL_DEPTH_COMPONENT, GL_FLOAT,
-                     float_buffer.data());
-        for (int i = 0; i < depth_image.height_; i++) {
-            p[i * depth_image.width_ + j] = float_buffer[i];
+        std::vector<float> float_buffer(depth_image.height_);
+        float *p = (float *)depth_image.data_.data();
+        for (int j = 0; j < depth_image.width_; j++) {
+            glReadPixels(j, 0, 1, depth_image.height_, GL_DEPTH_COMPONENT,
+                         GL_FLOAT, float_buffer.data());
+            for (int i = 0; i < depth_image.height_; i++) {
+                p[i * depth_image.width_ + j] = float_buffer[i];
+            }
         }
-    }
 #else   //__APPLE__
-    // By default, glReadPixels read a block of depth buffer.
-    glReadPixels(0, 0, depth_image.width_, depth_image.height_,
-                 GL_DEPTH_COMPONENT, GL_FLOAT, depth_image.data_.data());
+        // By default, glReadPixels read a block of depth buffer.
+        glReadPixels(0, 0, depth_image.width_, depth_image.height_,
+                     GL_DEPTH_COMPONENT, GL_FLOAT, depth_image.data_.data());
 #endif  //__APPLE__
+    }
 
     // glReadPixels get the screen in a vertically flipped manner
     // We should flip it back, and convert it to the correct depth value
@@ -148,6 +148,9 @@ bool VisualizerWithVertexSelection::AddGeometry(
     ui_points_geometry_ptr_ = std::make_shared<geometry::PointCloud>();
     ui_points_renderer_ptr_ = std::make_shared<glsl::PointCloudRenderer>();
     ui_points_renderer_ptr_->AddGeometry(ui_points_geometry_ptr_);
+    ui_points_picking_renderer_ptr_ =
+            std::make_shared<glsl::PointCloudPickingRenderer>();
+    ui_points_picking_renderer_ptr_->AddGeometry(ui_points_geometry_ptr_);
     ui_selected_points_geometry_ptr_ = std::make_shared<geometry::PointCloud>();
     ui_selected_points_renderer_ptr_ =
             std::make_shared<glsl::PointCloudRenderer>();
@@ -233,6 +236,7 @@ bool VisualizerWithVertexSelection::UpdateGeometry(
 
     ui_points_geometry_ptr_->PaintUniformColor(CHOOSE_POINTS_COLOR);
     ui_points_renderer_ptr_->UpdateGeometry();
+    ui_points_picking_renderer_ptr_->UpdateGeometry();
 
     geometry_renderer_ptr_->UpdateGeometry();
 
@@ -348,8 +352,7 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
                                                            double h) {
     points_in_rect_.clear();
 
-    auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
-    if (!renderer_ptr->AddGeometry(ui_points_geometry_ptr_)) {
+    if (!ui_points_picking_renderer_ptr_) {
         return {};
     }
     const auto &view = GetViewControl();
@@ -359,9 +362,19 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
         return {};
     }
 
+    // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
+    int width = int(std::ceil(w));
+    int height = int(std::ceil(h));
+    int lowerLeftX = int(winX + 0.5);
+    int lowerLeftY = int(view.GetWindowHeight() - winY - height + 0.5);
+
     view_control_ptr_->SetViewMatrices();
     glDisable(GL_MULTISAMPLE);  // we need pixelation for correct pick colors
     glDisable(GL_BLEND);
+    // Only the selection rectangle is read back, so limit rasterization and
+    // the clears to it
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(lowerLeftX, lowerLeftY, width, height);
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
     glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
     glClearDepth(1.0f);
@@ -379,20 +392,17 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
     // Now render the points
-    renderer_ptr->Render(pick_point_opts_, GetViewControl());
+    ui_points_picking_renderer_ptr_->Render(pick_point_opts_,
+                                            GetViewControl());
 
     glFinish();
 
-    // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
-    int width = int(std::ceil(w));
-    int height = int(std::ceil(h));
-    int lowerLeftX = int(winX + 0.5);
-    int lowerLeftY = int(view.GetWindowHeight() - winY - height + 0.5);
     std::vector<uint8_t> rgba(4 * width * height, 0);
 
     glReadPixels(lowerLeftX, lowerLeftY, width, height, GL_RGBA,
                  GL_UNSIGNED_BYTE, rgba.data());
     // Recover rendering state
+    glDisable(GL_SCISSOR_TEST);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glEnable(GL_MULTISAMPLE);
 
@@ -122,6 +122,10 @@ protected:
 
     std::shared_ptr<geometry::PointCloud> ui_points_geometry_ptr_;
     std::shared_ptr<glsl::GeometryRenderer> ui_points_renderer_ptr_;
+    /// Renders the pick-index colors for PickPoints(). Kept between picks so
+    /// that the point buffers are uploaded once per geometry update instead
+    /// of on every selection.
+    std::shared_ptr<glsl::GeometryRenderer> ui_points_picking_renderer_ptr_;
 
     std::unordered_map<int, Eigen::Vector3d> selected_points_;
     std::unordered_map<int, Eigen::Vector3d> selected_points_before_drag_;
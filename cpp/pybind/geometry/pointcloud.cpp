@@ -34,6 +34,7 @@
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
+#include "pybind/pybind_utils.h"
 
 namespace open3d {
 
@@ -207,6 +208,36 @@ void pybind_pointcloud(py::module &m) {
                         "image"_a, "intrinsic"_a,
                         "extrinsic"_a = Eigen::Matrix4d::Identity(),
                         "project_valid_depth_only"_a = true)
+            .def("points_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::PointCloud &>().points_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_points, 3)`` float64 numpy "
+                 "view of ``points``. The view shares memory with the "
+                 "point cloud and keeps it alive; operations that resize "
+                 "the point cloud invalidate outstanding views.")
+            .def("normals_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::PointCloud &>().normals_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_points, 3)`` float64 numpy "
+                 "view of ``normals``. The view shares memory with the "
+                 "point cloud and keeps it alive; operations that resize "
+                 "the point cloud invalidate outstanding views.")
+            .def("colors_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::PointCloud &>().colors_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_points, 3)`` float64 numpy "
+                 "view of ``colors``. The view shares memory with the "
+                 "point cloud and keeps it alive; operations that resize "
+                 "the point cloud invalidate outstanding views.")
             .def_readwrite("points", &geometry::PointCloud::points_,
                            "``float64`` array of shape ``(num_points, 3)``, "
                            "use ``numpy.asarray()`` to access data: Points "
@@ -31,6 +31,7 @@
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
+#include "pybind/pybind_utils.h"
 
 namespace open3d {
 
@@ -434,6 +435,59 @@ void pybind_trianglemesh(py::module &m) {
                         "length_split"_a = 70, "width_split"_a = 15,
                         "twists"_a = 1, "raidus"_a = 1, "flatness"_a = 1,
                         "width"_a = 1, "scale"_a = 1)
+            .def("vertices_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::TriangleMesh &>().vertices_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_vertices, 3)`` float64 numpy "
+                 "view of ``vertices``. The view shares memory with the "
+                 "mesh and keeps it alive; operations that resize the "
+                 "mesh invalidate outstanding views.")
+            .def("vertex_normals_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::TriangleMesh &>()
+                                     .vertex_normals_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_vertices, 3)`` float64 numpy "
+                 "view of ``vertex_normals``. The view shares memory with "
+                 "the mesh and keeps it alive; operations that resize the "
+                 "mesh invalidate outstanding views.")
+            .def("vertex_colors_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::TriangleMesh &>()
+                                     .vertex_colors_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_vertices, 3)`` float64 numpy "
+                 "view of ``vertex_colors``. The view shares memory with "
+                 "the mesh and keeps it alive; operations that resize the "
+                 "mesh invalidate outstanding views.")
+            .def("triangles_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::TriangleMesh &>().triangles_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_triangles, 3)`` int32 numpy "
+                 "view of ``triangles``. The view shares memory with the "
+                 "mesh and keeps it alive; operations that resize the "
+                 "mesh invalidate outstanding views.")
+            .def("triangle_normals_view",
+                 [](py::object self) {
+                     return pybind_utils::MakeEigenVectorArrayView(
+                             self.cast<geometry::TriangleMesh &>()
+                                     .triangle_normals_,
+                             self);
+                 },
+                 "Returns a zero-copy ``(num_triangles, 3)`` float64 numpy "
+                 "view of ``triangle_normals``. The view shares memory "
+                 "with the mesh and keeps it alive; operations that resize "
+                 "the mesh invalidate outstanding views.")
             .def_readwrite("vertices", &geometry::TriangleMesh::vertices_,
                            "``float64`` array of shape ``(num_vertices, 3)``, "
                            "use ``numpy.asarray()`` to access data: Vertex "
@@ -577,7 +577,15 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &pipelines::registration::RegistrationICP,
+    m.def("registration_icp",
+          // Disambiguates from the overload warm-started with a
+          // previous RegistrationResult.
+          static_cast<pipelines::registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const pipelines::registration::TransformationEstimation &,
+                  const pipelines::registration::ICPConvergenceCriteria &)>(
+                  &pipelines::registration::RegistrationICP),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -589,7 +597,13 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_colored_icp",
-          &pipelines::registration::RegistrationColoredICP,
+          // Disambiguates from the overload taking a precomputed
+          // PointCloudForColoredICP target.
+          static_cast<pipelines::registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const pipelines::registration::ICPConvergenceCriteria &,
+                  double)>(&pipelines::registration::RegistrationColoredICP),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
@@ -40,6 +41,24 @@ core::Dtype ArrayFormatToDtype(const std::string& format);
 
 std::string DtypeToArrayFormat(const core::Dtype& dtype);
 
+/// Returns a writable (n, k) numpy view over a std::vector of fixed-size
+/// Eigen vectors without copying the data. The returned array holds a
+/// reference to \p owner, so the geometry that contains the vector stays
+/// alive while the view is in use. The view aliases the vector's current
+/// buffer: operations that may reallocate it (resizing, appending,
+/// clearing) invalidate outstanding views, like iterators.
+template <typename EigenVector, typename Allocator>
+py::array MakeEigenVectorArrayView(std::vector<EigenVector, Allocator>& v,
+                                   py::handle owner) {
+    using Scalar = typename EigenVector::Scalar;
+    return py::array(py::dtype::of<Scalar>(),
+                     {py::ssize_t(v.size()),
+                      py::ssize_t(EigenVector::RowsAtCompileTime)},
+                     {py::ssize_t(sizeof(EigenVector)),
+                      py::ssize_t(sizeof(Scalar))},
+                     v.data(), owner);
+}
+
 }  // namespace pybind_utils
 
 }  // namespace open3d
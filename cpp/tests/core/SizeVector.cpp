@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/SizeVector.h"
+
+#include <utility>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(SizeVector, SwapInline) {
+    // Both sides fit the embedded arena; the elements change hands,
+    // the storage does not.
+    core::SizeVector a{1, 2};
+    core::SizeVector b{3, 4, 5};
+    a.swap(b);
+    EXPECT_EQ(a, core::SizeVector({3, 4, 5}));
+    EXPECT_EQ(b, core::SizeVector({1, 2}));
+}
+
+TEST(SizeVector, SwapAcrossInlineHeapBoundary) {
+    // One side exceeds SizeVectorArena::kSmallDims and lives on the
+    // heap; swapping across the boundary must copy the elements, not
+    // hand one vector a pointer into the other's embedded buffer.
+    core::SizeVector inline_sv{1, 2};
+    core::SizeVector heap_sv{3, 4, 5, 6, 7, 8, 9};
+    inline_sv.swap(heap_sv);
+    EXPECT_EQ(inline_sv, core::SizeVector({3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(heap_sv, core::SizeVector({1, 2}));
+
+    // Both vectors still own their storage: growing one must not
+    // touch the other.
+    heap_sv.push_back(10);
+    inline_sv.push_back(100);
+    EXPECT_EQ(heap_sv, core::SizeVector({1, 2, 10}));
+    EXPECT_EQ(inline_sv, core::SizeVector({3, 4, 5, 6, 7, 8, 9, 100}));
+}
+
+TEST(SizeVector, StdSwap) {
+    // std::swap goes through the move constructor and assignments,
+    // which copy elements into the receiver's own arena.
+    core::SizeVector a{1, 2, 3};
+    core::SizeVector b{4, 5, 6, 7, 8, 9};
+    std::swap(a, b);
+    EXPECT_EQ(a, core::SizeVector({4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(b, core::SizeVector({1, 2, 3}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,8 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -2441,6 +2443,216 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+TEST_P(TensorPermuteDevices, MaskedSum) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3},
+                     core::Dtype::Float32, device);
+    core::Tensor mask(std::vector<bool>({true, false, true, false, true,
+                                         false}),
+                      {2, 3}, core::Dtype::Bool, device);
+    core::Tensor dst = src.MaskedSum(mask);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({}));
+    EXPECT_EQ(dst.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({6}));
+
+    // Same fused path, integer dtype.
+    src = core::Tensor(std::vector<int64_t>({0, 1, 2, 3, 4, 5}), {2, 3},
+                       core::Dtype::Int64, device);
+    dst = src.MaskedSum(mask);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({6}));
+
+    // Empty selection sums to 0.
+    mask = core::Tensor(std::vector<bool>(2 * 3, false), {2, 3},
+                        core::Dtype::Bool, device);
+    dst = src.MaskedSum(mask);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({0}));
+
+    // Must match the unfused IndexGet + Sum result.
+    src = core::Tensor(std::vector<float>({2, -3, 5, 7, -11, 13}), {2, 3},
+                       core::Dtype::Float32, device);
+    mask = core::Tensor(std::vector<bool>({false, true, true, false, true,
+                                           true}),
+                        {2, 3}, core::Dtype::Bool, device);
+    EXPECT_EQ(src.MaskedSum(mask).ToFlatVector<float>(),
+              src.IndexGet({mask}).Sum({0}).ToFlatVector<float>());
+
+    // Mask must be Bool and of the same shape.
+    EXPECT_THROW(src.MaskedSum(core::Tensor::Ones({2, 3}, core::Dtype::Int64,
+                                                  device)),
+                 std::runtime_error);
+    EXPECT_THROW(src.MaskedSum(core::Tensor(std::vector<bool>(6, true), {6},
+                                            core::Dtype::Bool, device)),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, MaskedMean) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3},
+                     core::Dtype::Float32, device);
+    core::Tensor mask(std::vector<bool>({false, true, false, true, false,
+                                         true}),
+                      {2, 3}, core::Dtype::Bool, device);
+    core::Tensor dst = src.MaskedMean(mask);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({3}));
+
+    // Only Float32 and Float64 support Mean.
+    core::Tensor int_src =
+            core::Tensor::Ones({2, 3}, core::Dtype::Int64, device);
+    EXPECT_THROW(int_src.MaskedMean(mask), std::runtime_error);
+
+    // An empty selection yields NaN, like Mean() on a 0-sized tensor.
+    mask = core::Tensor(std::vector<bool>(2 * 3, false), {2, 3},
+                        core::Dtype::Bool, device);
+    dst = src.MaskedMean(mask);
+    EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
+}
+
+TEST_P(TensorPermuteDevices, MaskedMinMax) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({4, -1, 2, 9, 0, 5}), {2, 3},
+                     core::Dtype::Float32, device);
+    core::Tensor mask(std::vector<bool>({true, true, false, false, true,
+                                         true}),
+                      {2, 3}, core::Dtype::Bool, device);
+    core::Tensor min, max;
+    std::tie(min, max) = src.MaskedMinMax(mask);
+    EXPECT_EQ(min.GetShape(), core::SizeVector({}));
+    EXPECT_EQ(max.GetShape(), core::SizeVector({}));
+    EXPECT_EQ(min.ToFlatVector<float>(), std::vector<float>({-1}));
+    EXPECT_EQ(max.ToFlatVector<float>(), std::vector<float>({5}));
+
+    // A single selected element is both the min and the max.
+    mask = core::Tensor(std::vector<bool>({false, false, true, false, false,
+                                           false}),
+                        {2, 3}, core::Dtype::Bool, device);
+    std::tie(min, max) = src.MaskedMinMax(mask);
+    EXPECT_EQ(min.ToFlatVector<float>(), std::vector<float>({2}));
+    EXPECT_EQ(max.ToFlatVector<float>(), std::vector<float>({2}));
+
+    // An empty selection is an error, like Min()/Max() on a 0-sized
+    // tensor.
+    mask = core::Tensor(std::vector<bool>(2 * 3, false), {2, 3},
+                        core::Dtype::Bool, device);
+    EXPECT_THROW(src.MaskedMinMax(mask), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({3, 1, 2, 0, 2, 1}), {6},
+                     core::Dtype::Float32, device);
+    core::Tensor vals, idxs;
+    std::tie(vals, idxs) = src.Sort();
+    EXPECT_EQ(vals.GetShape(), core::SizeVector({6}));
+    EXPECT_EQ(idxs.GetDtype(), core::Dtype::Int64);
+    EXPECT_EQ(vals.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 1, 2, 2, 3}));
+    // The sort is stable: equal values keep their original order.
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 1, 5, 2, 4, 0}));
+
+    std::tie(vals, idxs) = src.Sort(/*descending=*/true);
+    EXPECT_EQ(vals.ToFlatVector<float>(),
+              std::vector<float>({3, 2, 2, 1, 1, 0}));
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 4, 1, 5, 3}));
+
+    // A 2-D tensor is sorted row by row along the last dimension.
+    src = core::Tensor(std::vector<float>({3, 1, 2, 0, 2, 1}), {2, 3},
+                       core::Dtype::Float32, device);
+    std::tie(vals, idxs) = src.Sort();
+    EXPECT_EQ(vals.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(vals.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 0, 1, 2}));
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 0, 0, 2, 1}));
+
+    // Scalar tensors and Bool tensors are rejected.
+    EXPECT_THROW(core::Tensor::Ones({}, core::Dtype::Float32, device).Sort(),
+                 std::runtime_error);
+    EXPECT_THROW(core::Tensor::Ones({6}, core::Dtype::Bool, device).Sort(),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, SortLargeArray) {
+    core::Device device = GetParam();
+    // Large enough to take the parallel split-and-merge path; compare
+    // against std::stable_sort as the serial reference.
+    const int64_t n = 100000;
+    std::vector<int32_t> src_vals(n);
+    for (int64_t i = 0; i < n; i++) {
+        src_vals[i] = int32_t((i * 40503) % 65536);
+    }
+    core::Tensor src(src_vals, {n}, core::Dtype::Int32, device);
+    core::Tensor vals, idxs;
+    std::tie(vals, idxs) = src.Sort();
+
+    std::vector<int64_t> ref_idxs(n);
+    std::iota(ref_idxs.begin(), ref_idxs.end(), 0);
+    std::stable_sort(ref_idxs.begin(), ref_idxs.end(),
+                     [&src_vals](int64_t lhs, int64_t rhs) {
+                         return src_vals[lhs] < src_vals[rhs];
+                     });
+    std::vector<int32_t> ref_vals(n);
+    for (int64_t i = 0; i < n; i++) {
+        ref_vals[i] = src_vals[ref_idxs[i]];
+    }
+    EXPECT_EQ(vals.ToFlatVector<int32_t>(), ref_vals);
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(), ref_idxs);
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({3, 1, 2, 1, 3, 0, 2}), {7},
+                     core::Dtype::Float32, device);
+    core::Tensor dst = src.Unique();
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({4}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3}));
+
+    // A tensor without duplicates comes back sorted and unchanged in
+    // size.
+    src = core::Tensor(std::vector<int64_t>({5, 2, 7}), {3},
+                       core::Dtype::Int64, device);
+    dst = src.Unique();
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 5, 7}));
+
+    // Only 1-D tensors are supported.
+    EXPECT_THROW(
+            core::Tensor::Ones({2, 3}, core::Dtype::Float32, device).Unique(),
+            std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, TopK) {
+    core::Device device = GetParam();
+    core::Tensor src(std::vector<float>({3, 1, 4, 1, 5, 9, 2, 6}), {8},
+                     core::Dtype::Float32, device);
+    core::Tensor vals, idxs;
+    std::tie(vals, idxs) = src.TopK(3);
+    EXPECT_EQ(vals.GetShape(), core::SizeVector({3}));
+    EXPECT_EQ(idxs.GetDtype(), core::Dtype::Int64);
+    EXPECT_EQ(vals.ToFlatVector<float>(), std::vector<float>({9, 6, 5}));
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(), std::vector<int64_t>({5, 7, 4}));
+
+    std::tie(vals, idxs) = src.TopK(3, /*largest=*/false);
+    EXPECT_EQ(vals.ToFlatVector<float>(), std::vector<float>({1, 1, 2}));
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 3, 6}));
+
+    // Selection works per row along the last dimension.
+    src = core::Tensor(std::vector<float>({3, 1, 4, 1, 5, 9, 2, 6}), {2, 4},
+                       core::Dtype::Float32, device);
+    std::tie(vals, idxs) = src.TopK(2);
+    EXPECT_EQ(vals.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(vals.ToFlatVector<float>(), std::vector<float>({4, 3, 9, 6}));
+    EXPECT_EQ(idxs.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 1, 3}));
+
+    // k == 0 selects nothing; k out of range is an error.
+    std::tie(vals, idxs) = src.TopK(0);
+    EXPECT_EQ(vals.GetShape(), core::SizeVector({2, 0}));
+    EXPECT_THROW(src.TopK(5), std::runtime_error);
+    EXPECT_THROW(src.TopK(-1), std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
     core::Device device = GetParam();
     std::vector<float> vals{0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11,
@@ -55,7 +55,7 @@ TEST_P(TensorListPermuteDevices, ConstructFromIterators) {
     core::SizeVector shape({3, 2, 3});
     EXPECT_EQ(tensor_list.AsTensor().GetShape(), shape);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
 }
 
 TEST_P(TensorListPermuteDevices, ConstructFromVector) {
@@ -74,7 +74,7 @@ TEST_P(TensorListPermuteDevices, ConstructFromVector) {
     core::SizeVector shape({3, 2, 3});
     EXPECT_EQ(tensor_list.AsTensor().GetShape(), shape);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
 }
 
 TEST_P(TensorListPermuteDevices, ConstructFromInitList) {
@@ -92,7 +92,7 @@ TEST_P(TensorListPermuteDevices, ConstructFromInitList) {
     core::SizeVector shape({3, 2, 3});
     EXPECT_EQ(tensor_list.AsTensor().GetShape(), shape);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
 }
 
 TEST_P(TensorListPermuteDevices, TensorConstructFromTensor) {
@@ -105,7 +105,7 @@ TEST_P(TensorListPermuteDevices, TensorConstructFromTensor) {
     core::SizeVector shape({2, 3});
     EXPECT_EQ(tensor_list.GetShape(), shape);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>(3 * 2 * 3, 1));
 }
@@ -166,14 +166,14 @@ TEST_P(TensorListPermuteDevices, Resize) {
     std::vector<core::Tensor> tensors = {t0, t1, t2};
     core::TensorList tensor_list(tensors, device);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>(
                       {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2}));
 
     tensor_list.Resize(5);
     EXPECT_EQ(tensor_list.GetSize(), 5);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 16);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
     EXPECT_EQ(
             tensor_list.AsTensor().ToFlatVector<float>(),
             std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2,
@@ -181,7 +181,7 @@ TEST_P(TensorListPermuteDevices, Resize) {
 
     tensor_list.Resize(2);
     EXPECT_EQ(tensor_list.GetSize(), 2);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 16);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1}));
 }
@@ -202,19 +202,19 @@ TEST_P(TensorListPermuteDevices, PushBack) {
 
     tensor_list.PushBack(t0);
     EXPECT_EQ(tensor_list.GetSize(), 1);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 2);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 1);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>({0, 0, 0, 0, 0, 0}));
 
     tensor_list.PushBack(t1);
     EXPECT_EQ(tensor_list.GetSize(), 2);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 2);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1}));
 
     tensor_list.PushBack(t2);
     EXPECT_EQ(tensor_list.GetSize(), 3);
-    EXPECT_EQ(tensor_list.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
               std::vector<float>(
                       {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2}));
@@ -310,7 +310,7 @@ TEST_P(TensorListPermuteDevices, Concatenate) {
 
     core::TensorList tensor_list2 = tensor_list0 + tensor_list1;
     EXPECT_EQ(tensor_list2.GetSize(), 4);
-    EXPECT_EQ(tensor_list2.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list2.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list2.AsTensor().ToFlatVector<float>(),
               std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
                                   2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3}));
@@ -318,7 +318,7 @@ TEST_P(TensorListPermuteDevices, Concatenate) {
     core::TensorList tensor_list3 =
             core::TensorList::Concatenate(tensor_list1, tensor_list0);
     EXPECT_EQ(tensor_list3.GetSize(), 4);
-    EXPECT_EQ(tensor_list3.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list3.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list3.AsTensor().ToFlatVector<float>(),
               std::vector<float>({1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
                                   3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0}));
@@ -344,14 +344,14 @@ TEST_P(TensorListPermuteDevices, Extend) {
 
     tensor_list0.Extend(tensor_list1);
     EXPECT_EQ(tensor_list0.GetSize(), 4);
-    EXPECT_EQ(tensor_list0.GetReservedSize(), 8);
+    EXPECT_EQ(tensor_list0.GetReservedSize(), 4);
     EXPECT_EQ(tensor_list0.AsTensor().ToFlatVector<float>(),
               std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
                                   2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3}));
 
     tensor_list1 += tensor_list1;
     EXPECT_EQ(tensor_list1.GetSize(), 6);
-    EXPECT_EQ(tensor_list1.GetReservedSize(), 16);
+    EXPECT_EQ(tensor_list1.GetReservedSize(), 8);
     EXPECT_EQ(tensor_list1.AsTensor().ToFlatVector<float>(),
               std::vector<float>({1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
                                   3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1,
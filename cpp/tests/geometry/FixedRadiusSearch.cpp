@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/FixedRadiusSearch.h"
+
+#include <algorithm>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Brute-force reference: indices of all points within radius of query,
+// sorted ascending.
+static std::vector<int> BruteForceRadius(
+        const std::vector<Eigen::Vector3d> &points,
+        const Eigen::Vector3d &query,
+        double radius) {
+    std::vector<int> indices;
+    for (size_t i = 0; i < points.size(); i++) {
+        if ((points[i] - query).squaredNorm() <= radius * radius) {
+            indices.push_back(int(i));
+        }
+    }
+    return indices;
+}
+
+TEST(FixedRadiusSearch, SearchRadius) {
+    int size = 1000;
+    double radius = 1.5;
+
+    std::vector<Eigen::Vector3d> points(size);
+    Rand(points, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    geometry::FixedRadiusSearch grid(points, radius);
+    EXPECT_EQ(grid.GetRadius(), radius);
+
+    // Every point queried against the grid must return exactly the
+    // brute-force neighbor set; the grid does not order its results,
+    // so compare sorted.
+    for (int i = 0; i < size; i += 7) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int result = grid.SearchRadius(points[i], indices, distance2);
+
+        std::vector<int> ref_indices =
+                BruteForceRadius(points, points[i], radius);
+        EXPECT_EQ(result, int(ref_indices.size()));
+        EXPECT_EQ(result, int(indices.size()));
+        EXPECT_EQ(indices.size(), distance2.size());
+        for (size_t k = 0; k < indices.size(); k++) {
+            double d2 = (points[indices[k]] - points[i]).squaredNorm();
+            EXPECT_NEAR(distance2[k], d2, 1e-12);
+            EXPECT_LE(distance2[k], radius * radius);
+        }
+        std::sort(indices.begin(), indices.end());
+        ExpectEQ(ref_indices, indices);
+    }
+}
+
+TEST(FixedRadiusSearch, SearchRadiusFarQuery) {
+    std::vector<Eigen::Vector3d> points(100);
+    Rand(points, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    geometry::FixedRadiusSearch grid(points, 1.0);
+
+    // A query far outside the indexed volume hashes to empty cells.
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    int result = grid.SearchRadius(Eigen::Vector3d(100.0, 100.0, 100.0),
+                                   indices, distance2);
+    EXPECT_EQ(result, 0);
+    EXPECT_TRUE(indices.empty());
+    EXPECT_TRUE(distance2.empty());
+}
+
+TEST(FixedRadiusSearch, SetGeometry) {
+    std::vector<Eigen::Vector3d> points = {{0, 0, 0}, {1, 0, 0}, {5, 5, 5}};
+
+    geometry::FixedRadiusSearch grid;
+    EXPECT_TRUE(grid.SetGeometry(points, 1.5));
+
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    EXPECT_EQ(grid.SearchRadius({0, 0, 0}, indices, distance2), 2);
+    std::sort(indices.begin(), indices.end());
+    ExpectEQ(std::vector<int>({0, 1}), indices);
+
+    // Rebuilding with a smaller radius answers for the new radius.
+    EXPECT_TRUE(grid.SetGeometry(points, 0.5));
+    EXPECT_EQ(grid.SearchRadius({0, 0, 0}, indices, distance2), 1);
+    ExpectEQ(std::vector<int>({0}), indices);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -593,6 +593,24 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleParallel) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 1000; i++) {
+        pcd.points_.push_back(
+                Eigen::Vector3d(0.01 * (i % 100), 0.01 * (i / 100), 0.0));
+        pcd.colors_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5));
+    }
+
+    auto serial = pcd.VoxelDownSample(0.1);
+    auto parallel = pcd.VoxelDownSampleParallel(0.1);
+    EXPECT_EQ(serial->points_.size(), parallel->points_.size());
+
+    std::vector<size_t> sort_indices =
+            GetIndicesAToB(parallel->points_, serial->points_);
+    ExpectEQ(ApplyIndices(parallel->points_, sort_indices), serial->points_);
+    ExpectEQ(ApplyIndices(parallel->colors_, sort_indices), serial->colors_);
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloudSoA.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(PointCloudSoA, ConstructorDefault) {
+    geometry::PointCloudSoA pcd;
+
+    EXPECT_TRUE(pcd.IsEmpty());
+    EXPECT_EQ(0u, pcd.size());
+    EXPECT_FALSE(pcd.HasNormals());
+    EXPECT_FALSE(pcd.HasColors());
+}
+
+TEST(PointCloudSoA, FromLegacyToLegacy) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}, {-1.0, -2.0, -3.0}};
+    pcd.colors_ = {{0.0, 0.5, 1.0}, {1.0, 0.5, 0.0}, {0.5, 0.5, 0.5}};
+
+    auto soa = geometry::PointCloudSoA::FromLegacy(pcd);
+    EXPECT_EQ(pcd.points_.size(), soa->size());
+    EXPECT_FALSE(soa->HasNormals());
+    EXPECT_TRUE(soa->HasColors());
+
+    auto legacy = soa->ToLegacy();
+    EXPECT_EQ(pcd.points_.size(), legacy->points_.size());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        ExpectEQ(pcd.points_[i], legacy->points_[i], 1e-6);
+        ExpectEQ(pcd.colors_[i], legacy->colors_[i], 1e-6);
+    }
+}
+
+TEST(PointCloudSoA, Transform) {
+    geometry::PointCloudSoA pcd;
+    pcd.x_ = {1.0, 0.0};
+    pcd.y_ = {0.0, 1.0};
+    pcd.z_ = {0.0, 0.0};
+
+    Eigen::Matrix4d transformation;
+    transformation << 1.0, 0.0, 0.0, 2.0, 0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 1.0,
+            0.5, 0.0, 0.0, 0.0, 1.0;
+    pcd.Transform(transformation);
+
+    ExpectEQ(Eigen::Vector3d(3.0, -1.0, 0.5), pcd.GetPoint(0), 1e-6);
+    ExpectEQ(Eigen::Vector3d(2.0, 0.0, 0.5), pcd.GetPoint(1), 1e-6);
+}
+
+TEST(PointCloudSoA, VoxelDownSample) {
+    geometry::PointCloudSoA pcd;
+    pcd.x_ = {0.0, 0.01, 10.0};
+    pcd.y_ = {0.0, 0.01, 10.0};
+    pcd.z_ = {0.0, 0.01, 10.0};
+
+    auto output = pcd.VoxelDownSample(1.0);
+    EXPECT_EQ(2u, output->size());
+}
+
+TEST(PointCloudSoA, EstimateNormals) {
+    geometry::PointCloudSoA pcd;
+    // Points on the z = 0 plane.
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            pcd.x_.push_back(0.1 * i);
+            pcd.y_.push_back(0.1 * j);
+            pcd.z_.push_back(0.0);
+        }
+    }
+
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    EXPECT_TRUE(pcd.HasNormals());
+    for (size_t i = 0; i < pcd.size(); i++) {
+        EXPECT_NEAR(1.0, std::abs(pcd.nz_[i]), 1e-4);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
@@ -1080,6 +1081,161 @@ TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_EQ(mesh1.IsSelfIntersecting(), true);
 }
 
+TEST(TriangleMesh, GetNonManifoldEdges) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}, {1, 0.5, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 2, 3}, {1, 2, 4}};
+
+    // Edge (1, 2) is shared by three triangles; with boundary edges
+    // disallowed all the single-triangle edges are reported too, in
+    // a deterministic order sorted by the smaller vertex.
+    ExpectEQ(std::vector<Eigen::Vector2i>({{1, 2}}),
+             mesh.GetNonManifoldEdges(true));
+    ExpectEQ(std::vector<Eigen::Vector2i>({{0, 1},
+                                           {0, 2},
+                                           {1, 2},
+                                           {1, 3},
+                                           {1, 4},
+                                           {2, 3},
+                                           {2, 4}}),
+             mesh.GetNonManifoldEdges(false));
+
+    // A closed manifold mesh has no non-manifold edges.
+    EXPECT_TRUE(geometry::TriangleMesh::CreateSphere()
+                        ->GetNonManifoldEdges(false)
+                        .empty());
+}
+
+TEST(TriangleMesh, GetSelfIntersectingTriangles) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0},      {0, 1, 0}, {1, 0, 0}, {1, 1, 0},
+                      {0.5, 0.5, -1}, {0, 1, 1}, {1, 0, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 2, 3}, {4, 5, 6}};
+    // The pairs come back sorted regardless of the thread schedule.
+    ExpectEQ(std::vector<Eigen::Vector2i>({{0, 2}, {1, 2}}),
+             mesh.GetSelfIntersectingTriangles());
+
+    // The BVH broadphase must report the same pairs as the serial
+    // all-pairs scan. A sphere pushed through a plane of quads makes a
+    // mesh with many intersecting and many non-intersecting triangles.
+    auto sphere = geometry::TriangleMesh::CreateSphere(0.8, 10);
+    geometry::TriangleMesh plane;
+    int grid = 8;
+    for (int i = 0; i <= grid; i++) {
+        for (int j = 0; j <= grid; j++) {
+            plane.vertices_.push_back(
+                    {-2.0 + 4.0 * i / grid, -2.0 + 4.0 * j / grid, 0.0});
+        }
+    }
+    for (int i = 0; i < grid; i++) {
+        for (int j = 0; j < grid; j++) {
+            int v0 = i * (grid + 1) + j;
+            int v1 = v0 + grid + 1;
+            plane.triangles_.push_back({v0, v1, v0 + 1});
+            plane.triangles_.push_back({v0 + 1, v1, v1 + 1});
+        }
+    }
+    geometry::TriangleMesh combined = *sphere + plane;
+
+    std::vector<Eigen::Vector2i> pairs =
+            combined.GetSelfIntersectingTriangles();
+
+    std::vector<Eigen::Vector2i> ref_pairs;
+    for (size_t t0 = 0; t0 < combined.triangles_.size(); t0++) {
+        const Eigen::Vector3i &tria0 = combined.triangles_[t0];
+        for (size_t t1 = t0 + 1; t1 < combined.triangles_.size(); t1++) {
+            const Eigen::Vector3i &tria1 = combined.triangles_[t1];
+            // Skip triangle pairs that share a vertex, as the
+            // self-intersection test does.
+            if (tria0(0) == tria1(0) || tria0(0) == tria1(1) ||
+                tria0(0) == tria1(2) || tria0(1) == tria1(0) ||
+                tria0(1) == tria1(1) || tria0(1) == tria1(2) ||
+                tria0(2) == tria1(0) || tria0(2) == tria1(1) ||
+                tria0(2) == tria1(2)) {
+                continue;
+            }
+            if (geometry::IntersectionTest::TriangleTriangle3d(
+                        combined.vertices_[tria0(0)],
+                        combined.vertices_[tria0(1)],
+                        combined.vertices_[tria0(2)],
+                        combined.vertices_[tria1(0)],
+                        combined.vertices_[tria1(1)],
+                        combined.vertices_[tria1(2)])) {
+                ref_pairs.push_back({int(t0), int(t1)});
+            }
+        }
+    }
+    EXPECT_FALSE(ref_pairs.empty());
+    ExpectEQ(ref_pairs, pairs);
+}
+
+TEST(TriangleMesh, SubdivideMidpoint) {
+    // A single triangle splits into four; edge vertices are appended
+    // in sorted (vmin, vmax) edge order, so the output is exact.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}};
+    auto subdivided = mesh.SubdivideMidpoint(1);
+    ExpectEQ(std::vector<Eigen::Vector3d>({{0, 0, 0},
+                                           {1, 0, 0},
+                                           {0, 1, 0},
+                                           {0.5, 0, 0},
+                                           {0, 0.5, 0},
+                                           {0.5, 0.5, 0}}),
+             subdivided->vertices_);
+    ExpectEQ(std::vector<Eigen::Vector3i>(
+                     {{0, 3, 4}, {3, 1, 5}, {5, 2, 4}, {3, 5, 4}}),
+             subdivided->triangles_);
+
+    // A closed mesh gains one vertex per unique edge and 4x triangles
+    // per iteration and keeps its surface area and manifoldness.
+    auto box = geometry::TriangleMesh::CreateBox();
+    subdivided = box->SubdivideMidpoint(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 98u);
+    EXPECT_EQ(subdivided->triangles_.size(), 192u);
+    EXPECT_NEAR(box->GetSurfaceArea(), subdivided->GetSurfaceArea(), 1e-12);
+    EXPECT_TRUE(subdivided->IsEdgeManifold(false));
+    EXPECT_TRUE(subdivided->IsVertexManifold());
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    // A single triangle exercises the boundary rules: edge vertices at
+    // the midpoints, old vertices at 3/4 self + 1/8 each boundary
+    // neighbor.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}};
+    auto subdivided = mesh.SubdivideLoop(1);
+    ExpectEQ(std::vector<Eigen::Vector3d>({{0.125, 0.125, 0},
+                                           {0.75, 0.125, 0},
+                                           {0.125, 0.75, 0},
+                                           {0.5, 0, 0},
+                                           {0, 0.5, 0},
+                                           {0.5, 0.5, 0}}),
+             subdivided->vertices_);
+    ExpectEQ(std::vector<Eigen::Vector3i>(
+                     {{0, 3, 4}, {3, 1, 5}, {5, 2, 4}, {3, 5, 4}}),
+             subdivided->triangles_);
+
+    // On a closed mesh the counts follow the same V + E / 4F pattern
+    // and the smoothed mesh stays manifold with finite coordinates.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    subdivided = sphere->SubdivideLoop(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 2882u);
+    EXPECT_EQ(subdivided->triangles_.size(), 5760u);
+    EXPECT_TRUE(subdivided->IsEdgeManifold(false));
+    EXPECT_TRUE(subdivided->IsVertexManifold());
+    for (const Eigen::Vector3d &v : subdivided->vertices_) {
+        EXPECT_TRUE(v.allFinite());
+    }
+
+    // An isolated vertex is copied through unchanged instead of
+    // turning into NaN from a zero-valence division.
+    mesh.vertices_.push_back({5, 5, 5});
+    subdivided = mesh.SubdivideLoop(1);
+    ExpectEQ(Eigen::Vector3d(5, 5, 5), subdivided->vertices_[3]);
+}
+
 TEST(TriangleMesh, ClusterConnectedTriangles) {
     // Test 1
 
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshBVH, ConstructorDefault) {
+    geometry::TriangleMeshBVH bvh;
+    EXPECT_TRUE(bvh.IsEmpty());
+}
+
+TEST(TriangleMeshBVH, RayCast) {
+    auto mesh = geometry::TriangleMesh::CreateBox(1, 1, 1);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    EXPECT_FALSE(bvh.IsEmpty());
+
+    double t;
+    int triangle_index;
+    // Hits the box from outside.
+    EXPECT_TRUE(bvh.RayCast(Eigen::Vector3d(0.5, 0.5, 2),
+                            Eigen::Vector3d(0, 0, -1), t, triangle_index));
+    EXPECT_NEAR(1.0, t, 1e-12);
+    EXPECT_GE(triangle_index, 0);
+    EXPECT_LT(triangle_index, int(mesh->triangles_.size()));
+
+    // Points away from the box.
+    EXPECT_FALSE(bvh.RayCast(Eigen::Vector3d(0.5, 0.5, 2),
+                             Eigen::Vector3d(0, 0, 1), t, triangle_index));
+}
+
+TEST(TriangleMeshBVH, ClosestPoint) {
+    auto mesh = geometry::TriangleMesh::CreateBox(1, 1, 1);
+    geometry::TriangleMeshBVH bvh(*mesh);
+
+    Eigen::Vector3d closest_point;
+    int triangle_index;
+    double dist = bvh.ClosestPoint(Eigen::Vector3d(0.5, 0.5, 2),
+                                   closest_point, triangle_index);
+    EXPECT_NEAR(1.0, dist, 1e-12);
+    ExpectEQ(Eigen::Vector3d(0.5, 0.5, 1), closest_point);
+
+    // A point inside the box is closest to one of the faces.
+    dist = bvh.ClosestPoint(Eigen::Vector3d(0.5, 0.5, 0.9), closest_point,
+                            triangle_index);
+    EXPECT_NEAR(0.1, dist, 1e-12);
+}
+
+TEST(TriangleMeshBVH, IntersectsMesh) {
+    auto mesh0 = geometry::TriangleMesh::CreateBox(1, 1, 1);
+    auto mesh1 = geometry::TriangleMesh::CreateBox(1, 1, 1);
+
+    geometry::TriangleMeshBVH bvh0(*mesh0);
+
+    // Overlapping boxes intersect.
+    auto mesh_overlap = std::make_shared<geometry::TriangleMesh>(*mesh1);
+    mesh_overlap->Translate(Eigen::Vector3d(0.5, 0.5, 0.5));
+    geometry::TriangleMeshBVH bvh_overlap(*mesh_overlap);
+    EXPECT_TRUE(bvh0.IntersectsMesh(bvh_overlap));
+
+    // Disjoint boxes do not.
+    auto mesh_disjoint = std::make_shared<geometry::TriangleMesh>(*mesh1);
+    mesh_disjoint->Translate(Eigen::Vector3d(3, 0, 0));
+    geometry::TriangleMeshBVH bvh_disjoint(*mesh_disjoint);
+    EXPECT_FALSE(bvh0.IntersectsMesh(bvh_disjoint));
+}
+
+}  // namespace tests
+}  // namespace open3d
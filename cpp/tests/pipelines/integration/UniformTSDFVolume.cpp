@@ -28,11 +28,14 @@
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/ImageIO.h"
+#include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
 
 #include <sstream>
+#include <unordered_map>
 
 namespace open3d {
 namespace tests {
@@ -94,7 +97,9 @@ TEST(UniformTSDFVolume, Constructor) {
     EXPECT_EQ(tsdf_volume.length_, length);
     EXPECT_EQ(tsdf_volume.resolution_, resolution);
     EXPECT_EQ(tsdf_volume.voxel_num_, resolution * resolution * resolution);
-    EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.voxel_tsdf_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.voxel_weight_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.voxel_color_.size()), tsdf_volume.voxel_num_);
 }
 
 TEST(UniformTSDFVolume, RealData) {
@@ -195,6 +200,119 @@ TEST(UniformTSDFVolume, RealData) {
              /*threshold*/ 0.1);
 }
 
+// Golden comparison of the two-pass parallel marching cubes against a
+// serial reference with hash-map vertex dedup (the previous
+// implementation). Triangle order and winding must match exactly;
+// vertex indices differ (sorted-edge-key order vs. discovery order),
+// so the resolved corner positions are compared per triangle.
+TEST(UniformTSDFVolume, ExtractTriangleMeshMatchesSerial) {
+    const int resolution = 32;
+    const double length = 3.2;
+    const double voxel_length = length / resolution;
+    pipelines::integration::UniformTSDFVolume tsdf_volume(
+            length, resolution, /*sdf_trunc=*/0.2,
+            pipelines::integration::TSDFVolumeColorType::NoColor);
+
+    // Sphere SDF, with one side of the volume left unobserved so the
+    // weight == 0 cube skipping is exercised on the surface.
+    const Eigen::Vector3d center(1.6, 1.6, 1.6);
+    const double radius = 0.8;
+    for (int x = 0; x < resolution; x++) {
+        for (int y = 0; y < resolution; y++) {
+            for (int z = 0; z < resolution; z++) {
+                int ind = tsdf_volume.IndexOf(x, y, z);
+                Eigen::Vector3d pt(voxel_length * (x + 0.5),
+                                   voxel_length * (y + 0.5),
+                                   voxel_length * (z + 0.5));
+                double sdf = ((pt - center).norm() - radius) / 0.2;
+                tsdf_volume.voxel_tsdf_[ind] =
+                        float(std::max(-1.0, std::min(1.0, sdf)));
+                tsdf_volume.voxel_weight_[ind] = x >= 22 ? 0.0f : 1.0f;
+            }
+        }
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    EXPECT_FALSE(mesh->triangles_.empty());
+
+    // Serial reference cube walk.
+    std::unordered_map<Eigen::Vector4i, int,
+                       utility::hash_eigen<Eigen::Vector4i>>
+            edgeindex_to_vertexindex;
+    std::vector<Eigen::Vector3d> ref_vertices;
+    std::vector<Eigen::Vector3i> ref_triangles;
+    const double half_voxel_length = voxel_length * 0.5;
+    for (int x = 0; x < resolution - 1; x++) {
+        for (int y = 0; y < resolution - 1; y++) {
+            for (int z = 0; z < resolution - 1; z++) {
+                int cube_index = 0;
+                float f[8];
+                for (int i = 0; i < 8; i++) {
+                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
+                    int ind = tsdf_volume.IndexOf(idx);
+                    if (tsdf_volume.voxel_weight_[ind] == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    }
+                    f[i] = tsdf_volume.voxel_tsdf_[ind];
+                    if (f[i] < 0.0f) {
+                        cube_index |= (1 << i);
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                int edge_to_index[12];
+                for (int i = 0; i < 12; i++) {
+                    if (edge_table[cube_index] & (1 << i)) {
+                        Eigen::Vector4i edge_index =
+                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                        auto it = edgeindex_to_vertexindex.find(edge_index);
+                        if (it == edgeindex_to_vertexindex.end()) {
+                            edge_to_index[i] = int(ref_vertices.size());
+                            edgeindex_to_vertexindex[edge_index] =
+                                    edge_to_index[i];
+                            Eigen::Vector3d pt(
+                                    half_voxel_length +
+                                            voxel_length * edge_index(0),
+                                    half_voxel_length +
+                                            voxel_length * edge_index(1),
+                                    half_voxel_length +
+                                            voxel_length * edge_index(2));
+                            double f0 = std::abs(
+                                    double(f[edge_to_vert[i][0]]));
+                            double f1 = std::abs(
+                                    double(f[edge_to_vert[i][1]]));
+                            pt(edge_index(3)) +=
+                                    f0 * voxel_length / (f0 + f1);
+                            ref_vertices.push_back(pt + tsdf_volume.origin_);
+                        } else {
+                            edge_to_index[i] = it->second;
+                        }
+                    }
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    ref_triangles.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]));
+                }
+            }
+        }
+    }
+
+    // Both paths weld the same edges, so the vertex counts agree.
+    EXPECT_EQ(mesh->vertices_.size(), ref_vertices.size());
+    ASSERT_EQ(mesh->triangles_.size(), ref_triangles.size());
+    for (size_t t = 0; t < ref_triangles.size(); t++) {
+        for (int corner = 0; corner < 3; corner++) {
+            ExpectEQ(ref_vertices[ref_triangles[t](corner)],
+                     mesh->vertices_[mesh->triangles_[t](corner)], 1e-12);
+        }
+    }
+}
+
 TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}